@@ -0,0 +1,30 @@
+﻿#version 410
+		
+layout(location = 0) in vec2 VertexPosition;
+layout(location = 3) in vec4 InstanceRect;
+layout(location = 4) in vec4 InstanceUV;
+layout(location = 5) in vec4 InstanceColor;
+		
+layout(location = 0) out vec4 Color;
+layout(location = 1) out vec2 Tex;
+
+layout(std140) uniform SpriteCB
+{
+	vec4 g_transform[2];
+};
+		
+out gl_PerVertex
+{
+	vec4 gl_Position;
+};
+
+void main()
+{
+	// VertexPosition は共有メッシュの単位座標 (0, 0) - (1, 1)
+	vec2 position = mix(InstanceRect.xy, InstanceRect.zw, VertexPosition);
+
+	Color = InstanceColor;
+	gl_Position.xy	= g_transform[0].zw + position.x * g_transform[0].xy + position.y * g_transform[1].xy;
+	gl_Position.zw	= g_transform[1].zw;
+	Tex = mix(InstanceUV.xy, InstanceUV.zw, VertexPosition);
+}
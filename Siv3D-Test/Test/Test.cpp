@@ -5,12 +5,22 @@
 # if defined(SIV3D_DO_TEST)
 
 # include <Siv3D.hpp>
+# include "../../Siv3D/src/Siv3D/Renderer2D/Vertex2DBuilder.hpp"
+
+// 以前の JSONReader（UTF-32 の DOM）との比較用。SivJSONReader.cpp と同じ設定で読み込む
+# define RAPIDJSON_SSE2
+# include "../../Siv3D/src/ThirdParty/rapidjson/rapidjson.h"
+# include "../../Siv3D/src/ThirdParty/rapidjson/document.h"
 
 # if defined(SIV3D_TARGET_WINDOWS)
 
 	# include <conio.h>  
 	# include <Siv3D/Windows.hpp>
 
+# elif defined(SIV3D_TARGET_LINUX)
+
+	# include <fstream>
+
 # endif
 
 # define CATCH_CONFIG_RUNNER
@@ -401,4 +411,2262 @@ TEST_CASE("Format", "[normal]")
 
 }
 
+TEST_CASE("Parallel", "[normal]")
+{
+	const Array<int32> values = step(10000).asArray();
+
+	SECTION("Array::parallel_count_if()")
+	{
+		REQUIRE(values.parallel_count_if(IsEven) == values.count_if(IsEven));
+		REQUIRE(values.parallel_count_if(IsEven, 1) == values.count_if(IsEven));
+		REQUIRE(Array<int32>().parallel_count_if(IsEven) == 0);
+	}
+
+	SECTION("Array::parallel_each()")
+	{
+		Array<int32> a = values;
+		a.parallel_each([](int32& n) { n *= 2; });
+		REQUIRE(a == values.map([](int32 n) { return n * 2; }));
+	}
+
+	SECTION("Array::parallel_map()")
+	{
+		REQUIRE(values.parallel_map([](int32 n) { return n * 3; }) == values.map([](int32 n) { return n * 3; }));
+		REQUIRE(values.parallel_map([](int32 n) { return n % 3 == 0; }) == values.map([](int32 n) { return n % 3 == 0; }));
+	}
+
+	SECTION("step::parallel_count_if()")
+	{
+		REQUIRE(step(10000).parallel_count_if(IsEven) == 5000);
+		REQUIRE(step(9999, 10000, -1).parallel_count_if(IsEven) == 5000);
+	}
+
+	SECTION("SetParallelGrainSize()")
+	{
+		const size_t grainSize = Threading::GetParallelGrainSize();
+		Threading::SetParallelGrainSize(4096);
+		REQUIRE(values.parallel_count_if(IsOdd) == 5000);
+		Threading::SetParallelGrainSize(0);
+		REQUIRE(Threading::GetParallelGrainSize() == 1);
+		Threading::SetParallelGrainSize(grainSize);
+	}
+
+	SECTION("exception")
+	{
+		REQUIRE_THROWS_AS(values.parallel_each([](int32 n) { if (n == 9000) { throw std::runtime_error("parallel_each"); } }), std::runtime_error);
+	}
+}
+
+TEST_CASE("ConcurrentTask", "[normal]")
+{
+	SECTION("get()")
+	{
+		auto task = CreateConcurrentTask([](int32 a, int32 b) { return a + b; }, 2, 3);
+		REQUIRE(task.get() == 5);
+		REQUIRE_FALSE(task.valid());
+	}
+
+	SECTION("then()")
+	{
+		auto task = CreateConcurrentTask(TaskPriority::High, []() { return 10; })
+			.then([](int32 n) { return n * 2; })
+			.then([](int32 n) { return Format(n); });
+		REQUIRE(task.get() == U"20");
+	}
+
+	SECTION("then() propagates exceptions")
+	{
+		bool called = false;
+		auto task = CreateConcurrentTask([]() -> int32 { throw std::runtime_error("ConcurrentTask"); })
+			.then([&](int32 n) { called = true; return n; });
+		REQUIRE_THROWS_AS(task.get(), std::runtime_error);
+		REQUIRE_FALSE(called);
+	}
+
+	SECTION("WhenAll()")
+	{
+		Array<ConcurrentTask<int32>> tasks;
+		for (auto i : step(100))
+		{
+			tasks.push_back(CreateConcurrentTask([i]() { return i * i; }));
+		}
+		const Array<int32> results = WhenAll(std::move(tasks)).get();
+		REQUIRE(results == step(100).asArray().map([](int32 i) { return i * i; }));
+	}
+
+	SECTION("WhenAny()")
+	{
+		Array<ConcurrentTask<int32>> tasks;
+		for (auto i : step(4))
+		{
+			tasks.push_back(CreateConcurrentTask([i]() { return i; }));
+		}
+		const auto result = WhenAny(std::move(tasks)).get();
+		REQUIRE(static_cast<int32>(result.first) == result.second);
+	}
+
+	SECTION("cancel()")
+	{
+		std::atomic<bool> started = false;
+		auto task = CreateConcurrentTask([&]()
+		{
+			started = true;
+			while (!Threading::IsCancellationRequested())
+			{
+				std::this_thread::yield();
+			}
+			return true;
+		});
+		while (!started)
+		{
+			std::this_thread::yield();
+		}
+		task.cancel();
+		REQUIRE(task.isCancellationRequested());
+		REQUIRE(task.get());
+	}
+
+	SECTION("cancel() before start")
+	{
+		// 継続タスクは、先行タスクが完了するまで開始しない
+		std::atomic<bool> released = false;
+		std::atomic<bool> called = false;
+		auto task = CreateConcurrentTask([&]()
+		{
+			while (!released)
+			{
+				std::this_thread::yield();
+			}
+		}).then([&]() { called = true; return 1; });
+		task.cancel();
+		released = true;
+		REQUIRE_THROWS_AS(task.get(), ConcurrentTaskCanceled);
+		REQUIRE_FALSE(called);
+	}
+
+	SECTION("invalid tasks")
+	{
+		Array<ConcurrentTask<int32>> tasks;
+		tasks.push_back(CreateConcurrentTask([]() { return 1; }));
+		tasks.emplace_back();
+		REQUIRE_THROWS_AS(WhenAll(std::move(tasks)), std::invalid_argument);
+
+		tasks.clear();
+		tasks.emplace_back();
+		REQUIRE_THROWS_AS(WhenAny(std::move(tasks)), std::invalid_argument);
+	}
+
+	SECTION("nested get()")
+	{
+		Array<ConcurrentTask<int32>> tasks;
+		for (size_t i = 0; i < Threading::GetConcurrency() * 4; ++i)
+		{
+			tasks.push_back(CreateConcurrentTask([]() { return CreateConcurrentTask([]() { return 1; }).get(); }));
+		}
+		REQUIRE(WhenAll(std::move(tasks)).get().sum() == static_cast<int32>(Threading::GetConcurrency() * 4));
+	}
+
+	SECTION("destructor waits")
+	{
+		std::atomic<int32> finished = 0;
+		{
+			auto task = CreateConcurrentTask([&]()
+			{
+				System::Sleep(50);
+				++finished;
+			});
+			task = CreateConcurrentTask([&]() { ++finished; });
+		}
+		REQUIRE(finished == 2);
+	}
+}
+
+namespace
+{
+	// 参照実装、SSE2 のみ、AVX2 の順に、CPU が対応している実装ごとに f を適用した結果を返す
+	template <class Fty>
+	Array<Image> ApplyWithEachKernel(const Image& source, Fty f)
+	{
+		const CPUFeature feature = CPU::GetFeature();
+
+		const auto apply = [&](const bool sse2, const bool avx2)
+		{
+			CPUFeature selected = feature;
+			selected.SSE2 = sse2;
+			selected.AVX2 = avx2;
+			CPU::SetFeature(selected);
+
+			Image image(source);
+			f(image);
+
+			CPU::SetFeature(feature);
+			return image;
+		};
+
+		Array<Image> results = { apply(false, false) };
+
+		if (feature.SSE2)
+		{
+			results << apply(true, false);
+		}
+
+		if (feature.AVX2)
+		{
+			results << apply(true, true);
+		}
+
+		return results;
+	}
+
+	// すべての実装の結果が expected と一致するか
+	template <class Fty>
+	bool MatchesExpected(const Image& source, Fty f, const Image& expected)
+	{
+		return ApplyWithEachKernel(source, f).all([&](const Image& image)
+		{
+			return std::equal(image.begin(), image.end(), expected.begin());
+		});
+	}
+
+	// SSE2 版と AVX2 版の結果を、それぞれ参照実装の結果と比較する
+	template <class Fty>
+	bool MatchesReference(const Image& source, Fty f)
+	{
+		const Array<Image> results = ApplyWithEachKernel(source, f);
+
+		return results.all([&](const Image& image)
+		{
+			return std::equal(image.begin(), image.end(), results.front().begin());
+		});
+	}
+
+	// RGB の各チャンネルを table で変換した画像（アルファは変えない）
+	Image ApplyTableScalar(const Image& source, const std::array<uint8, 256>& table)
+	{
+		Image image(source);
+
+		for (auto& pixel : image)
+		{
+			pixel.r = table[pixel.r];
+			pixel.g = table[pixel.g];
+			pixel.b = table[pixel.b];
+		}
+
+		return image;
+	}
+}
+
+TEST_CASE("Image pixel operations", "[normal]")
+{
+	// SIMD 版の端数処理も通るよう、幅は 4 や 8 の倍数にしない
+	Image source(257, 131);
+
+	for (auto& pixel : source)
+	{
+		pixel = Color(Random(255), Random(255), Random(255), Random(255));
+	}
+
+	REQUIRE(MatchesReference(source, [](Image& image) { image.negate(); }));
+	REQUIRE(MatchesReference(source, [](Image& image) { image.grayscale(); }));
+	REQUIRE(MatchesReference(source, [](Image& image) { image.swapRB(); }));
+
+	for (const int32 level : { -1, 0, 1, 20, 255, 300 })
+	{
+		REQUIRE(MatchesReference(source, [=](Image& image) { image.sepia(level); }));
+	}
+
+	// postarize と gammaCorrect はテーブル変換なので、手計算したテーブルの結果と比較する
+	{
+		std::array<uint8, 256> binary, identity, square;
+
+		for (size_t i = 0; i < 256; ++i)
+		{
+			binary[i] = (i < 128) ? 0 : 255;
+			identity[i] = static_cast<uint8>(i);
+			square[i] = static_cast<uint8>(i * i / 255.0);
+		}
+
+		for (const int32 level : { -1, 0, 1, 2 })
+		{
+			REQUIRE(MatchesExpected(source, [=](Image& image) { image.postarize(level); }, ApplyTableScalar(source, binary)));
+		}
+
+		for (const int32 level : { 256, 300 })
+		{
+			REQUIRE(MatchesExpected(source, [=](Image& image) { image.postarize(level); }, source));
+		}
+
+		REQUIRE(MatchesExpected(source, [](Image& image) { image.gammaCorrect(1.0); }, source));
+		REQUIRE(MatchesExpected(source, [](Image& image) { image.gammaCorrect(0.5); }, ApplyTableScalar(source, square)));
+	}
+
+	for (const int32 level : { -300, -255, -20, 0, 20, 255, 300 })
+	{
+		REQUIRE(MatchesReference(source, [=](Image& image) { image.brighten(level); }));
+	}
+
+	for (const int32 threshold : { 0, 1, 85, 127, 128, 254, 255 })
+	{
+		REQUIRE(MatchesReference(source, [=](Image& image) { image.threshold(static_cast<uint8>(threshold), false); }));
+		REQUIRE(MatchesReference(source, [=](Image& image) { image.threshold(static_cast<uint8>(threshold), true); }));
+	}
+
+	// 境界値: 全画素が同じ色
+	for (const Color color : { Color(0, 0, 0, 0), Color(255, 255, 255, 255), Color(82, 69, 0, 128), Color(0, 82, 69, 255) })
+	{
+		const Image flat(33, 3, color);
+		REQUIRE(MatchesReference(flat, [](Image& image) { image.grayscale(); }));
+		REQUIRE(MatchesReference(flat, [](Image& image) { image.sepia(30); }));
+		REQUIRE(MatchesReference(flat, [](Image& image) { image.threshold(56, false); }));
+	}
+}
+
+TEST_CASE("Image parallel execution", "[normal]")
+{
+	Image source(517, 264);
+
+	for (auto& pixel : source)
+	{
+		pixel = Color(Random(255), Random(255), Random(255), Random(255));
+	}
+
+	const auto matches = [&](auto f)
+	{
+		const Image sequential = f(source, ImageExecution::Sequential);
+		const Image parallel = f(source, ImageExecution::Parallel);
+		return (sequential.size() == parallel.size())
+			&& std::equal(sequential.begin(), sequential.end(), parallel.begin());
+	};
+
+	REQUIRE(matches([](const Image& image, ImageExecution e) { return image.gaussianBlurred(3, 9, BorderType::Default, e); }));
+	REQUIRE(matches([](const Image& image, ImageExecution e) { return image.gaussianBlurred(3, 9, BorderType::Replicate, e); }));
+	REQUIRE(matches([](const Image& image, ImageExecution e) { return image.blurred(4, 7, e); }));
+	REQUIRE(matches([](const Image& image, ImageExecution e) { return image.medianBlurred(3, e); }));
+	REQUIRE(matches([](const Image& image, ImageExecution e) { return image.medianBlurred(9, e); }));
+	REQUIRE(matches([](const Image& image, ImageExecution e) { return image.dilated(3, e); }));
+	REQUIRE(matches([](const Image& image, ImageExecution e) { return image.eroded(2, e); }));
+	REQUIRE(matches([](const Image& image, ImageExecution e) { return image.mosaiced(7, 5, e); }));
+	REQUIRE(matches([](const Image& image, ImageExecution e) { return image.spreaded(3, 4, e); }));
+	REQUIRE(matches([](const Image& image, ImageExecution e) { return image.rotated90(e); }));
+	REQUIRE(matches([](const Image& image, ImageExecution e) { Image tmp(image); tmp.gaussianBlur(5, BorderType::Default, e); return tmp; }));
+	REQUIRE(matches([](const Image& image, ImageExecution e) { Image tmp(image); tmp.dilate(2, e); return tmp; }));
+
+	for (const auto interpolation : { Interpolation::Nearest, Interpolation::Linear, Interpolation::Cubic, Interpolation::Area, Interpolation::Lanczos })
+	{
+		// 整数分の 1 の縮小、2 の累乗倍の拡大、それ以外の比率
+		for (const Size size : { Size(301, 66), Size(211, 1056), Size(300, 200) })
+		{
+			REQUIRE(matches([=](const Image& image, ImageExecution e) { return image.scaled(size, interpolation, e); }));
+		}
+	}
+
+	Image::SetDefaultExecution(ImageExecution::Parallel);
+	REQUIRE(Image::GetDefaultExecution() == ImageExecution::Parallel);
+	REQUIRE(matches([](const Image& image, ImageExecution) { return image.gaussianBlurred(4); }));
+	Image::SetDefaultExecution(ImageExecution::Sequential);
+	REQUIRE(Image::GetDefaultExecution() == ImageExecution::Sequential);
+}
+
+TEST_CASE("ImageView", "[normal]")
+{
+	Image source(203, 157);
+
+	for (auto& pixel : source)
+	{
+		pixel = Color(Random(255), Random(255), Random(255), Random(255));
+	}
+
+	const Rect rect(17, 23, 101, 88);
+
+	const ImageConstView view(source, rect);
+	REQUIRE(view.size() == rect.size);
+	REQUIRE(view[0] == &source[23][17]);
+	REQUIRE(!view.isContinuous());
+	REQUIRE(ImageConstView(source(rect)).data() == view.data());
+	REQUIRE(ImageConstView(source, Rect(-10, -10, 20, 20)).size() == Size(10, 10));
+	REQUIRE(ImageConstView(source, Rect(300, 0, 10, 10)).isEmpty());
+
+	const Image clipped(view);
+	REQUIRE(clipped.size() == rect.size);
+	REQUIRE(std::equal(clipped.begin(), clipped.end(), source.clipped(rect).begin()));
+
+	// 切り出し → 処理 → 書き戻し と、領域をその場で処理した結果が一致するか
+	const auto matches = [&](auto imageFunction, auto viewFunction)
+	{
+		Image expected(source);
+		Image region = source.clipped(rect);
+		imageFunction(region);
+		region.overwrite(expected, rect.pos);
+
+		Image result(source);
+		const ImageView target(result, rect);
+		viewFunction(target, target);
+
+		return std::equal(result.begin(), result.end(), expected.begin());
+	};
+
+	REQUIRE(matches([](Image& image) { image.negate(); }, [](auto src, auto dst) { ImageProcessing::Negate(src, dst); }));
+	REQUIRE(matches([](Image& image) { image.sepia(30); }, [](auto src, auto dst) { ImageProcessing::Sepia(src, dst, 30); }));
+	REQUIRE(matches([](Image& image) { image.threshold(100, true); }, [](auto src, auto dst) { ImageProcessing::Threshold(src, dst, 100, true); }));
+	REQUIRE(matches([](Image& image) { image.mosaic(7, 5); }, [](auto src, auto dst) { ImageProcessing::Mosaic(src, dst, 7, 5); }));
+	REQUIRE(matches([](Image& image) { image.gaussianBlur(3, 5); }, [](auto src, auto dst) { ImageProcessing::GaussianBlur(src, dst, 3, 5); }));
+	REQUIRE(matches([](Image& image) { image.gaussianBlur(3, 5, BorderType::Default, ImageExecution::Parallel); }, [](auto src, auto dst) { ImageProcessing::GaussianBlur(src, dst, 3, 5, BorderType::Default, ImageExecution::Parallel); }));
+	REQUIRE(matches([](Image& image) { image.medianBlur(5); }, [](auto src, auto dst) { ImageProcessing::MedianBlur(src, dst, 5); }));
+	REQUIRE(matches([](Image& image) { image.dilate(2); }, [](auto src, auto dst) { ImageProcessing::Dilate(src, dst, 2); }));
+
+	// 重なっている別の領域への書き込み
+	{
+		Image expected(source);
+		source.clipped(rect).blurred(2).overwrite(expected, rect.pos.movedBy(9, 4));
+
+		Image result(source);
+		ImageProcessing::Blur(ImageConstView(result, rect), ImageView(result, rect.movedBy(9, 4)), 2);
+
+		REQUIRE(std::equal(result.begin(), result.end(), expected.begin()));
+	}
+
+	// 別の画像への拡大縮小
+	{
+		Image result(50, 40);
+		ImageProcessing::Resize(view, result, Interpolation::Linear);
+
+		const Image expected = source.clipped(rect).scaled(50, 40, Interpolation::Linear);
+		REQUIRE(std::equal(result.begin(), result.end(), expected.begin()));
+	}
+}
+
+namespace
+{
+	// テスト用のログを数える出力先。stall が true の間に "Logger stall" を受け取ると、書き込みスレッドを止める
+	class CountingLogSink : public ILogSink
+	{
+	public:
+
+		std::atomic<size_t> count = 0;
+
+		std::atomic<bool> stall = false;
+
+		std::atomic<bool> stalled = false;
+
+		String dropReport;
+
+		void write(const LogEntry& entry) override
+		{
+			if (entry.text.starts_with(U"Logger async test "))
+			{
+				++count;
+			}
+			else if (entry.text.starts_with(U"⚠️ Logger: "))
+			{
+				dropReport = entry.text;
+			}
+			else if (entry.text == U"Logger stall")
+			{
+				stalled = true;
+
+				while (stall)
+				{
+					std::this_thread::yield();
+				}
+			}
+		}
+	};
+}
+
+TEST_CASE("Logger async", "[normal]")
+{
+	const bool wasAsync = Logger.isAsync();
+
+	SECTION("Block")
+	{
+		const auto sink = std::make_shared<CountingLogSink>();
+		Logger.addSink(sink);
+		Logger.enableAsync(LogOverflowPolicy::Block);
+		REQUIRE(Logger.isAsync());
+
+		const size_t droppedBefore = Logger.droppedCount();
+
+		// バッファの容量 (8192) を超える数を書き込む
+		Array<int32>{ 0, 1, 2, 3 }.parallel_each([](int32 i)
+		{
+			for (int32 k = 0; k < 4000; ++k)
+			{
+				Logger << U"Logger async test " << i << U" " << k;
+			}
+		});
+
+		Logger.flush();
+		Logger.removeSink(sink);
+		REQUIRE(sink->count == 16000);
+		REQUIRE(Logger.droppedCount() == droppedBefore);
+	}
+
+	SECTION("DropAndCount")
+	{
+		const auto sink = std::make_shared<CountingLogSink>();
+		sink->stall = true;
+		Logger.addSink(sink);
+		Logger.enableAsync(LogOverflowPolicy::DropAndCount);
+		REQUIRE(Logger.isAsync());
+
+		// 書き込みスレッドが出力先で止まるのを待つ
+		Logger << U"Logger stall";
+		while (!sink->stalled)
+		{
+			std::this_thread::yield();
+		}
+
+		const size_t droppedBefore = Logger.droppedCount();
+		const size_t written = 10000;
+
+		for (size_t k = 0; k < written; ++k)
+		{
+			Logger << U"Logger async test " << k;
+		}
+
+		const size_t dropped = (Logger.droppedCount() - droppedBefore);
+		sink->stall = false;
+
+		Logger.flush();
+		Logger.removeSink(sink);
+		REQUIRE(dropped > 0);
+		REQUIRE(sink->count + dropped == written);
+		REQUIRE(sink->dropReport.includes(U" {} log messages"_fmt(dropped)));
+	}
+
+	Logger.disableAsync();
+	REQUIRE(!Logger.isAsync());
+
+	if (wasAsync)
+	{
+		Logger.enableAsync();
+	}
+}
+
+TEST_CASE("LogSink", "[normal]")
+{
+	const FilePath binaryPath = FileSystem::TempDirectoryPath() + U"Siv3DTest/log.bin";
+	const FilePath htmlPath = FileSystem::TempDirectoryPath() + U"Siv3DTest/log.html";
+
+	{
+		const auto sink = LogSink::Binary(binaryPath);
+		REQUIRE(sink);
+
+		Logger.addSink(sink);
+		LOG_WARNING(U"LogSink \"test\"");
+		Logger.flush();
+		Logger.removeSink(sink);
+	}
+
+	Array<LogEntry> entries;
+	Array<String> texts;
+	REQUIRE(LogSink::LoadBinary(binaryPath, entries, texts));
+	REQUIRE(entries.size() == 1);
+	REQUIRE(entries[0].level == LogDescription::Warning);
+	REQUIRE(entries[0].text == U"LogSink \"test\"");
+	REQUIRE(entries[0].timestamp <= Time::GetMicrosecSinceEpoch());
+
+	REQUIRE(LogSink::ConvertBinaryToHTML(binaryPath, htmlPath));
+	REQUIRE(TextReader(htmlPath).readAll().includes(U"LogSink &quot;test&quot;"));
+
+	FileSystem::Remove(FileSystem::TempDirectoryPath() + U"Siv3DTest/");
+}
+
+TEST_CASE("Profiler CPU scopes", "[normal]")
+{
+	const FilePath path = FileSystem::TempDirectoryPath() + U"Siv3DTest/trace.json";
+
+	Profiler::ClearTrace();
+	Profiler::EnableCPUProfiling();
+	REQUIRE(Profiler::IsCPUProfilingEnabled());
+
+	{
+		SIV3D_PROFILE_SCOPE("Test outer");
+
+		Array<int32>{ 0, 1, 2, 3 }.parallel_each([](int32)
+		{
+			SIV3D_PROFILE_SCOPE("Test worker");
+		});
+	}
+
+	Profiler::EnableCPUProfiling(false);
+
+	REQUIRE(Profiler::ExportChromeTrace(path));
+
+	const String trace = TextReader(path).readAll();
+	REQUIRE(trace.includes(U"\"traceEvents\""));
+	REQUIRE(trace.includes(U"\"Test outer\""));
+	REQUIRE(trace.includes(U"\"Test worker\""));
+
+	FileSystem::Remove(FileSystem::TempDirectoryPath() + U"Siv3DTest/");
+}
+
+TEST_CASE("Compressor", "[normal]")
+{
+	Array<ByteArray> samples;
+
+	for (int32 i = 0; i < 1000; ++i)
+	{
+		const std::string s = Format(U"{\"name\":\"player", i % 17, U"\",\"hp\":", i * 7 % 100, U",\"items\":[\"sword\",\"shield\"]}").narrow();
+		samples.emplace_back(s.data(), s.size());
+	}
+
+	const CompressionDictionary dictionary = CompressionDictionary::Train(samples, 4096);
+	REQUIRE(dictionary);
+
+	Compressor compressor(dictionary);
+	Decompressor decompressor(dictionary);
+	Array<Byte> compressed, decompressed;
+
+	for (const auto& sample : samples)
+	{
+		REQUIRE(compressor.compress(sample.view(), compressed));
+		REQUIRE(decompressor.decompress(ByteArrayView(compressed.data(), compressed.size()), decompressed));
+		REQUIRE(std::equal(decompressed.begin(), decompressed.end(), sample.view().begin(), sample.view().end()));
+	}
+
+	// 辞書なしでは展開できない
+	REQUIRE_FALSE(Decompressor().decompress(ByteArrayView(compressed.data(), compressed.size()), decompressed));
+
+	Array<Byte> data(4 << 20);
+
+	for (size_t i = 0; i < data.size(); ++i)
+	{
+		data[i] = static_cast<Byte>((i * 2654435761u) >> 28);
+	}
+
+	Compressor mtCompressor(3);
+	REQUIRE(mtCompressor.setNumWorkers(2));
+
+	ReaderView reader(data.data(), data.size());
+	MemoryWriter writer;
+	REQUIRE(mtCompressor.compress(reader, writer));
+
+	const ByteArray result = Decompressor().decompress(writer.view());
+	REQUIRE(std::equal(data.begin(), data.end(), result.view().begin(), result.view().end()));
+
+	// 上限を超えるサイズはストリームとして展開する
+	Decompressor limitedDecompressor;
+	limitedDecompressor.setMaxPreallocationSize(1 << 20);
+	REQUIRE(limitedDecompressor.getMaxPreallocationSize() == (1 << 20));
+	REQUIRE(limitedDecompressor.decompress(writer.view(), decompressed));
+	REQUIRE(std::equal(data.begin(), data.end(), decompressed.begin(), decompressed.end()));
+
+	// ヘッダの展開後のサイズ (1 TiB) を偽ったフレームで、巨大なバッファを確保しない
+	const uint8 forged[] = { 0x28, 0xB5, 0x2F, 0xFD, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00 };
+	REQUIRE_FALSE(Decompressor().decompress(ByteArrayView(forged, sizeof(forged)), decompressed));
+	REQUIRE(decompressed.isEmpty());
+}
+
+TEST_CASE("FileArchive", "[normal]")
+{
+	const FilePath directory = FileSystem::TempDirectoryPath() + U"Siv3DTest/archive/";
+	const FilePath archivePath = FileSystem::TempDirectoryPath() + U"Siv3DTest/test.s3da";
+
+	const std::string text(10000, 'a');
+	BinaryWriter(directory + U"text.txt").write(text.data(), text.size());
+
+	Image image(16, 16, Palette::Orange);
+	REQUIRE(image.savePNG(directory + U"sub/image.png"));
+
+	REQUIRE(FileArchive::Build(archivePath, directory));
+
+	FileArchive archive(archivePath);
+	REQUIRE(archive);
+	REQUIRE(archive.num_files() == 2);
+	REQUIRE(archive.contains(U"sub/image.png"));
+	REQUIRE(archive.contains(U"./sub\\image.png"));
+	REQUIRE(!archive.contains(U"image.png"));
+	REQUIRE(archive.fileSize(U"text.txt") == static_cast<int64>(text.size()));
+
+	REQUIRE(FileArchive::Mount(archive));
+
+	{
+		ArchivedFileReader reader(U"text.txt");
+		REQUIRE(reader);
+		REQUIRE(reader.size() == static_cast<int64>(text.size()));
+		REQUIRE(std::equal(text.begin(), text.end(), reader.view().begin(), reader.view().end(), [](char a, Byte b) { return static_cast<Byte>(a) == b; }));
+	}
+
+	FileSystem::Remove(directory);
+
+	// ディスク上のファイルを削除しても、マウントしたアーカイブから読み込める
+	const Image loaded(U"sub/image.png");
+	REQUIRE(loaded.size() == image.size());
+	REQUIRE(loaded[0][0] == image[0][0]);
+
+	{
+		// 開いている ArchivedFileReader は、アーカイブを閉じた後も使用できる
+		ArchivedFileReader reader(U"text.txt");
+		REQUIRE(reader);
+
+		// close() はマウントも解除する
+		archive.close();
+		REQUIRE(!ArchivedFileReader(U"text.txt"));
+		REQUIRE(reader.size() == static_cast<int64>(text.size()));
+		REQUIRE(std::equal(text.begin(), text.end(), reader.view().begin(), reader.view().end(), [](char a, Byte b) { return static_cast<Byte>(a) == b; }));
+	}
+
+	REQUIRE(archive.open(archivePath));
+	REQUIRE(FileArchive::Mount(archive));
+	FileArchive::UnmountAll();
+	REQUIRE(!ArchivedFileReader(U"text.txt"));
+
+	archive.close();
+	FileSystem::Remove(FileSystem::TempDirectoryPath() + U"Siv3DTest/");
+}
+
+TEST_CASE("AudioMixer", "[normal]")
+{
+	if (!AudioMixer::IsAvailable())
+	{
+		return;
+	}
+
+	AudioMixer::EnableOfflineRendering();
+
+	const Wave wave(SecondsF(0.5), Arg::generator = [](double t) { return std::sin(t * Math::TwoPi * 440.0); }, Arg::samplingRate = AudioMixer::SamplingRate());
+	const Audio audio(wave);
+
+	audio.setVolumeLR(0.5, 0.25);
+	audio.play();
+
+	const Wave rendered = AudioMixer::Render(1000);
+	REQUIRE(rendered.size() == 1000);
+	REQUIRE(audio.posSample() == 1000);
+
+	for (size_t i = 0; i < rendered.size(); ++i)
+	{
+		REQUIRE(rendered[i].left == Approx(wave[i].left * 0.5f));
+		REQUIRE(rendered[i].right == Approx(wave[i].right * 0.25f));
+	}
+
+	audio.stop();
+
+	// 左にパンしたワンショットは、右チャンネルに出力されない
+	audio.playOneShot(1.0, 2.0, -1.0);
+	REQUIRE(AudioMixer::NumActiveVoices() == 1);
+
+	const Wave shot = AudioMixer::Render(wave.size() / 2 + 1);
+	REQUIRE(std::all_of(shot.begin(), shot.end(), [](const WaveSample& s) { return s.right == 0.0f; }));
+	REQUIRE(AudioMixer::NumActiveVoices() == 0);
+
+	AudioMixer::EnableOfflineRendering(false);
+}
+
+TEST_CASE("Font glyph atlas", "[normal]")
+{
+	const size_t bytesBefore = Profiler::GetStatistics().fontAtlasBytes;
+	const size_t pagesBefore = Profiler::GetStatistics().fontAtlasPages;
+	const int32 frameCount = System::FrameCount();
+
+	{
+		const Font font(16);
+		const String ascii = U"Hello, Siv3D!";
+		const Array<int32> xAdvances = font.getGlyphs(ascii).map([](const Glyph& glyph) { return glyph.xAdvance; });
+		REQUIRE(Profiler::GetStatistics().fontAtlasPages == pagesBefore + 1);
+
+		// フレームごとに異なる 500 文字を使い、古いグリフを追い出させる
+		for (int32 i = 0; i < 16; ++i)
+		{
+			System::SetFrameCount(frameCount + 1 + i);
+
+			String text;
+
+			for (char32 ch = 0; ch < 500; ++ch)
+			{
+				text.push_back(static_cast<char32>(U'\u4E00' + i * 500 + ch));
+			}
+
+			const Array<Glyph> glyphs = font.getGlyphs(text);
+			REQUIRE(std::all_of(glyphs.begin(), glyphs.end(), [](const Glyph& glyph) { return glyph.texture.size.x > 0; }));
+		}
+
+		// 追い出しによってページ数は上限を超えない
+		REQUIRE(Profiler::GetStatistics().fontAtlasPages <= pagesBefore + 4);
+
+		System::SetFrameCount(frameCount + 17);
+		REQUIRE(font.getGlyphs(ascii).map([](const Glyph& glyph) { return glyph.xAdvance; }) == xAdvances);
+	}
+
+	System::SetFrameCount(frameCount);
+
+	REQUIRE(Profiler::GetStatistics().fontAtlasBytes == bytesBefore);
+}
+
+TEST_CASE("Font layout cache", "[normal]")
+{
+	const Font font(20);
+	const Font reference(20);
+	reference.setLayoutCacheBudget(0);
+
+	const Array<String> texts = { U"Score: 12345", U"HP\t100\nMP\t50", U"あいうえお Siv3D", U"\n", U"" };
+
+	for (int32 i = 0; i < 3; ++i)
+	{
+		for (const auto& text : texts)
+		{
+			REQUIRE(font(text).region() == reference(text).region());
+			REQUIRE(font(text).boundingRect() == reference(text).boundingRect());
+			REQUIRE(font(text).getXAdvances() == reference(text).getXAdvances());
+		}
+	}
+
+	REQUIRE(font.layoutCacheBytes() > 0);
+	REQUIRE(reference.layoutCacheBytes() == 0);
+
+	// 上限を超えると古いレイアウトから破棄される
+	font.setLayoutCacheBudget(1024);
+	REQUIRE(font.layoutCacheBytes() <= 1024);
+
+	for (int32 i = 0; i < 100; ++i)
+	{
+		const String text = U"Label {}"_fmt(i);
+		REQUIRE(font(text).region() == reference(text).region());
+		REQUIRE(font(text).region() == reference(text).region());
+		REQUIRE(font.layoutCacheBytes() <= 1024);
+	}
+
+	font.clearLayoutCache();
+	REQUIRE(font.layoutCacheBytes() == 0);
+}
+
+TEST_CASE("Font SDF", "[normal]")
+{
+	const Font font(FontMethod::SDF, 32);
+	REQUIRE(font.method() == FontMethod::SDF);
+	REQUIRE(Font(32).method() == FontMethod::Bitmap);
+
+	const String text = U"Siv3D あいう";
+
+	for (const auto& glyph : font.getGlyphs(text))
+	{
+		if (glyph.codePoint != U' ')
+		{
+			REQUIRE(glyph.texture.texture.isSDF());
+		}
+	}
+
+	// 1 つのアトラスを任意の大きさで描画できる
+	const RectF region = font(text).region();
+	REQUIRE(font(text).region(64, Vec2(0, 0)).size == region.size * 2.0);
+	REQUIRE(font(text).draw(16, Vec2(0, 0)).w == Approx(font(text).draw(Vec2(0, 0)).w * 0.5));
+
+	// 事前生成したアトラスを読み込むと、同じグリフが得られる
+	const FilePath path = FileSystem::TempDirectoryPath() + U"Siv3DTest/font.sdfa";
+	REQUIRE(font.saveSDFAtlas(path, text));
+
+	const Font loaded(FontMethod::SDF, 32);
+	REQUIRE(loaded.loadSDFAtlas(path));
+	REQUIRE(loaded(text).region() == region);
+	REQUIRE(loaded(text).boundingRect() == font(text).boundingRect());
+
+	REQUIRE_FALSE(Font(FontMethod::SDF, 24).loadSDFAtlas(path));
+	REQUIRE_FALSE(Font(32).saveSDFAtlas(path, text));
+
+	// グリフ数が壊れたファイルは、メモリを確保する前に失敗する
+	const FilePath corruptedPath = FileSystem::TempDirectoryPath() + U"Siv3DTest/corrupted.sdfa";
+	{
+		Array<Byte> bytes(static_cast<size_t>(FileSystem::FileSize(path)));
+		BinaryReader(path).read(bytes.data(), bytes.size_bytes());
+
+		const uint32 numGlyphs = 0xFFFFFFFF;
+		std::memcpy(bytes.data() + 24, &numGlyphs, sizeof(numGlyphs));
+		BinaryWriter(corruptedPath).write(bytes.data(), bytes.size_bytes());
+	}
+	REQUIRE_FALSE(Font(FontMethod::SDF, 32).loadSDFAtlas(corruptedPath));
+
+	FileSystem::Remove(FileSystem::TempDirectoryPath() + U"Siv3DTest/");
+}
+
+TEST_CASE("Vertex2DBuilder", "[normal]")
+{
+	const Float2 center(100.0f, 50.0f);
+	const Float4 color(0.1f, 0.2f, 0.3f, 0.4f);
+
+	for (uint32 quality = 3; quality <= Vertex2DBuilder::MaxCircleQuality; ++quality)
+	{
+		const Float2* unit = Vertex2DBuilder::GetUnitCircle(quality);
+		Array<Vertex2D> vertices(quality * 2);
+		Array<uint32> indices(quality * 6);
+
+		Vertex2DBuilder::BuildFan(vertices.data(), indices.data(), 10, center, Float2(8.0f, 4.0f), unit, quality, color, true);
+
+		for (uint32 i = 0; i < quality; ++i)
+		{
+			const double rad = Math::TwoPi * i / quality;
+			REQUIRE(vertices[i + 1].pos.x == Approx(100.0 + 8.0 * std::cos(rad)));
+			REQUIRE(vertices[i + 1].pos.y == Approx(50.0 - 4.0 * std::sin(rad)));
+			REQUIRE(vertices[i + 1].color.w == 0.4f);
+			REQUIRE(indices[i * 3 + 0] == 10 + i + 1);
+			REQUIRE(indices[i * 3 + 1] == 10);
+			REQUIRE(indices[i * 3 + 2] == 10 + (i + 1) % quality + 1);
+		}
+
+		Vertex2DBuilder::BuildRing(vertices.data(), indices.data(), 0, center, Float2(8.0f, 8.0f), Float2(6.0f, 6.0f), unit, quality, color, color, false);
+
+		REQUIRE(std::all_of(indices.begin(), indices.begin() + (quality - 1) * 6, [=](uint32 index) { return index < quality * 2; }));
+		REQUIRE(vertices[quality * 2 - 1].pos.x == Approx(100.0 + 6.0 * std::cos(Math::TwoPi * (quality - 1) / quality)));
+	}
+
+	// 円弧は開始角から等間隔に並ぶ
+	Float2 arc[16];
+	Vertex2DBuilder::GetUnitArc(arc, 1.0f, -0.25f, 16);
+
+	for (int32 i = 0; i < 16; ++i)
+	{
+		REQUIRE(arc[i].x == Approx(std::cos(1.0 - 0.25 * i)).margin(1e-5));
+		REQUIRE(arc[i].y == Approx(std::sin(1.0 - 0.25 * i)).margin(1e-5));
+	}
+}
+
+TEST_CASE("Renderer2D instancing", "[normal]")
+{
+	const bool enabled = Graphics2D::IsInstancingEnabled();
+	Graphics2D::EnableInstancing(true);
+
+	// インスタンス描画に対応していないバックエンド
+	if (!Graphics2D::IsInstancingEnabled())
+	{
+		return;
+	}
+
+	Statistics statistics[2];
+
+	for (const bool instancing : { true, false })
+	{
+		Graphics2D::EnableInstancing(instancing);
+
+		for (int32 i = 0; i < 1000; ++i)
+		{
+			Rect(i % 100 * 8, i / 100 * 8, 6).draw(ColorF(0.5));
+		}
+
+		for (int32 i = 0; i < 1000; ++i)
+		{
+			Circle(i % 100 * 8, i / 100 * 8 + 100, 3).draw(ColorF(0.5));
+		}
+
+		System::Update();
+
+		statistics[instancing] = Profiler::GetStatistics();
+	}
+
+	REQUIRE(statistics[true].triangles == statistics[false].triangles);
+	REQUIRE(statistics[true].drawcalls <= statistics[false].drawcalls + 1);
+	REQUIRE(statistics[true].vertexUploadBytes < statistics[false].vertexUploadBytes / 3);
+
+	Graphics2D::EnableInstancing(enabled);
+}
+
+TEST_CASE("Renderer2D screen capture", "[normal]")
+{
+	// --headless で実行した場合はオフスクリーンのフレームバッファから取得される
+	Graphics::SetBackground(ColorF(0.0, 0.0, 1.0));
+
+	Rect(0, 0, 100, 100).draw(Color(255, 0, 0));
+
+	ScreenCapture::RequestCurrentFrame();
+
+	System::Update();
+
+	REQUIRE(Profiler::GetStatistics().triangles == 2);
+	REQUIRE(ScreenCapture::HasNewFrame());
+
+	const Image& image = ScreenCapture::GetFrame();
+	REQUIRE(image.size() == Window::Size());
+	REQUIRE(image[50][50].r == 255);
+	REQUIRE(image[50][50].b == 0);
+	REQUIRE(image[200][200].r == 0);
+	REQUIRE(image[200][200].b == 255);
+
+	Graphics::SetBackground(Palette::DefaultBackground);
+}
+
+TEST_CASE("Renderer2D vertex buffers", "[normal]")
+{
+	const bool enabled = Graphics2D::IsInstancingEnabled();
+	Graphics2D::EnableInstancing(false);
+
+	// 1 フレームで頂点バッファのすべての領域を使い切る場合と、そうでない場合
+	for (const int32 count : { 100, 100'000, 100, 100'000, 100 })
+	{
+		for (int32 i = 0; i < count; ++i)
+		{
+			RectF(i % 400 * 2, i / 400 * 2, 1.5).draw(ColorF(0.5));
+		}
+
+		System::Update();
+
+		REQUIRE(Profiler::GetStatistics().triangles == static_cast<size_t>(count * 2));
+		REQUIRE(Profiler::GetStatistics().vertexUploadBytes == count * (sizeof(Vertex2D) * 4 + sizeof(uint32) * 6));
+	}
+
+	Graphics2D::EnableInstancing(enabled);
+}
+
+TEST_CASE("DrawList2D", "[normal]")
+{
+	DrawList2D list(2);
+	REQUIRE(list.isEmpty());
+	REQUIRE(list.layer() == 2);
+
+	list.addRect(RectF(0, 0, 10, 10), ColorF(1.0));
+	list.addTriangle(Triangle(0, 0, 10, 0, 0, 10), ColorF(1.0));
+	REQUIRE(list.num_vertices() == 7);
+	REQUIRE(list.num_triangles() == 3);
+
+	// コピーは変更するまで内容を共有する
+	DrawList2D copy = list;
+	copy.addCircle(Circle(50, 50, 20), ColorF(1.0));
+	REQUIRE(list.num_triangles() == 3);
+	REQUIRE(copy.num_triangles() > 3);
+
+	copy.clear();
+	REQUIRE(copy.isEmpty());
+	REQUIRE(!list.isEmpty());
+
+	// 複数のスレッドで記録
+	Array<DrawList2D> lists(4);
+
+	Threading::ParallelFor(lists.size(), [&](const size_t begin, const size_t end)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			lists[i].setLayer(static_cast<int32>(lists.size() - i));
+
+			for (int32 k = 0; k < 100; ++k)
+			{
+				lists[i].addRect(RectF(k * 4, i * 4, 3), ColorF(0.5));
+			}
+		}
+	});
+
+	size_t triangles = 0;
+
+	for (const auto& l : lists)
+	{
+		REQUIRE(l.num_triangles() == 200);
+		triangles += l.num_triangles();
+	}
+
+	Graphics2D::DrawLists(lists);
+
+	System::Update();
+
+	REQUIRE(Profiler::GetStatistics().triangles >= triangles);
+}
+
+TEST_CASE("Renderer2D draw call sorting", "[normal]")
+{
+	// 重ならない四角形（インスタンス描画）と三角形（頂点による描画）を交互に描く
+	const auto drawInterleaved = []()
+	{
+		for (int32 i = 0; i < 100; ++i)
+		{
+			RectF(i * 8, 0, 6).draw(ColorF(0.5));
+			Triangle(i * 8, 20, i * 8 + 6, 20, i * 8, 26).draw(ColorF(0.5));
+		}
+	};
+
+	drawInterleaved();
+	System::Update();
+
+	const Statistics unsorted = Profiler::GetStatistics();
+	REQUIRE(unsorted.savedDrawcalls == 0);
+
+	Graphics2D::EnableDrawCallSorting(true);
+	REQUIRE(Graphics2D::IsDrawCallSortingEnabled());
+
+	// 有効にしたフレームでも並べ替えられる
+	drawInterleaved();
+	System::Update();
+	REQUIRE(Profiler::GetStatistics().savedDrawcalls > 0);
+
+	drawInterleaved();
+	System::Update();
+
+	const Statistics sorted = Profiler::GetStatistics();
+	REQUIRE(sorted.triangles == unsorted.triangles);
+	REQUIRE(sorted.drawcalls < unsorted.drawcalls);
+	REQUIRE(sorted.savedDrawcalls > 0);
+
+	// 重なる描画の順序は変わらない
+	Rect(0, 0, 100, 100).draw(Color(255, 0, 0));
+	Triangle(0, 0, 200, 0, 0, 200).draw(Color(0, 255, 0));
+	Rect(20, 20, 10, 10).draw(Color(0, 0, 255));
+	Rect(300, 300, 10, 10).draw(Color(255, 0, 0));
+
+	ScreenCapture::RequestCurrentFrame();
+	System::Update();
+
+	REQUIRE(ScreenCapture::HasNewFrame());
+
+	const Image& image = ScreenCapture::GetFrame();
+	REQUIRE(image[25][25].b == 255);
+	REQUIRE(image[60][60].g == 255);
+	REQUIRE(image[60][60].r == 0);
+	REQUIRE(image[305][305].r == 255);
+
+	Graphics2D::EnableDrawCallSorting(false);
+}
+
+TEST_CASE("JSONReader", "[normal]")
+{
+	const FilePath path = FileSystem::TempDirectoryPath() + U"Siv3DTest/test.json";
+	const String text = U"{ // comment\n \"name\": \"あい\\n\", \"obj\": { \"x\": 1.5, \"arr\": [1, 2, 3,] },"
+		U" \"items\": [ { \"id\": 1 }, 5, \"s\", { \"id\": 2 } ], \"after\": true }";
+
+	for (const auto encoding : { TextEncoding::UTF8, TextEncoding::UTF8_NO_BOM, TextEncoding::UTF16LE })
+	{
+		{
+			TextWriter writer(path, encoding);
+			writer.write(text);
+		}
+
+		const JSONReader json(path);
+		REQUIRE(json);
+		REQUIRE(json[U"name"].getString() == U"あい\n");
+		REQUIRE(json[U"obj.x"].get<double>() == 1.5);
+		REQUIRE(json[U"obj.arr"].getArray<int32>() == Array<int32>{ 1, 2, 3 });
+		REQUIRE(json.hasMember(U"items"));
+		REQUIRE(!json.hasMember(U"missing"));
+		REQUIRE(json[U"name.x"].isEmpty());
+		REQUIRE(json.memberCount() == 4);
+	}
+
+	// UTF-8 のファイルは、ファイル全体を読み込まずに先頭から解析できる
+	{
+		TextWriter writer(path);
+		writer.write(text);
+	}
+
+	JSONStreamReader stream(path);
+	REQUIRE(stream);
+
+	Array<String> keys;
+	size_t maxDepth = 0;
+
+	REQUIRE(stream.read([&](const JSONStreamEvent& event)
+	{
+		if (event.type == JSONStreamEventType::Key)
+		{
+			keys << event.getString();
+		}
+
+		maxDepth = Max(maxDepth, event.depth);
+		return true;
+	}));
+
+	REQUIRE(keys == Array<String>{ U"name", U"obj", U"x", U"arr", U"items", U"id", U"id", U"after" });
+	REQUIRE(maxDepth == 3);
+
+	Array<int32> ids;
+
+	REQUIRE(stream.readArray(U"items", [&](const JSONValue& element)
+	{
+		ids << element[U"id"].getOr<int32>(-1);
+		return true;
+	}));
+
+	REQUIRE(ids == Array<int32>{ 1, -1, -1, 2 });
+
+	// handler が false を返すと中断する
+	size_t count = 0;
+	REQUIRE(!stream.readArray(U"obj.arr", [&](const JSONValue&) { return ++count < 2; }));
+	REQUIRE(count == 2);
+	REQUIRE(!stream.readArray(U"missing", [](const JSONValue&) { return true; }));
+
+	FileSystem::Remove(FileSystem::TempDirectoryPath() + U"Siv3DTest/");
+}
+
+namespace s3d
+{
+	namespace detail
+	{
+		// SivCSVReader.cpp
+		void SetCSVChunkSize(size_t size);
+	}
+}
+
+TEST_CASE("CSVReader", "[normal]")
+{
+	const FilePath path = FileSystem::TempDirectoryPath() + U"Siv3DTest/test.csv";
+
+	{
+		TextWriter writer(path);
+		writer.write(U"a,b,\"c,d\"\r\n1, 2 ,\"x\"\"y\"\n\"複数\n行\",e\\,f,+3\r4.5,,\n");
+	}
+
+	const CSVReader csv(path);
+	REQUIRE(csv);
+	REQUIRE(csv.rows() == 4);
+	REQUIRE(csv.getRow(0) == Array<String>{ U"a", U"b", U"c,d" });
+	REQUIRE(csv.getUTF8(1, 2) == "x\"y");
+	// TextWriter は環境によって改行を CRLF にする
+	REQUIRE(csv.get(2, 0).removed(U'\r') == U"複数\n行");
+	// 区切り文字はエスケープできない（以前の CSVData と同じ）
+	REQUIRE(csv.get(2, 1) == U"e\\");
+	REQUIRE(csv.get(2, 2) == U"f");
+	REQUIRE(csv.get(2, 3) == U"+3");
+	REQUIRE(csv.getRow(3) == Array<String>{ U"4.5", U"", U"" });
+	REQUIRE(csv.get<int32>(1, 1) == 2);
+	REQUIRE(csv.get<int32>(2, 3) == 3);
+	REQUIRE(!csv.getOpt<int32>(0, 0));
+	REQUIRE(csv.getOr<double>(9, 0, -1.0) == -1.0);
+	REQUIRE(csv.getColumn<double>(0, -1.0) == Array<double>{ -1.0, 1.0, -1.0, 4.5 });
+
+	// CSVData は CSVReader で読み込んだ結果を保持する
+	const CSVData data(path);
+	REQUIRE(data.rows() == csv.rows());
+
+	for (size_t row = 0; row < csv.rows(); ++row)
+	{
+		REQUIRE(data.getRow(row) == csv.getRow(row));
+	}
+
+	// クォートと区切り文字の変更
+	{
+		TextWriter writer(path, TextEncoding::UTF8_NO_BOM);
+		writer.write(U"a;'b;c';d");
+	}
+
+	const CSVReader semicolon(path, U';', U'\'');
+	REQUIRE(semicolon.getRow(0) == Array<String>{ U"a", U"b;c", U"d" });
+
+	// 複数のチャンクに分けて解析する。先頭の行の長さを変えて、チャンクの境界がクォート内の改行や "", \" の途中にかかるようにする
+	detail::SetCSVChunkSize(1);
+
+	for (size_t padding = 0; padding < 48; ++padding)
+	{
+		{
+			TextWriter writer(path, TextEncoding::UTF8_NO_BOM);
+			writer.write(String(padding, U'p') + U"\n");
+
+			for (int32 i = 0; i < 64; ++i)
+			{
+				writer.write(Format(i) + U",\"he said \"\"hi\"\"\nline two\",\"a\\\"b\"\n");
+			}
+		}
+
+		const CSVReader chunked(path);
+		REQUIRE(chunked.rows() == 65);
+
+		for (int32 i = 0; i < 64; ++i)
+		{
+			REQUIRE(chunked.columns(i + 1) == 3);
+			REQUIRE(chunked.get<int32>(i + 1, 0) == i);
+			REQUIRE(chunked.get(i + 1, 1).removed(U'\r') == U"he said \"hi\"\nline two");
+			REQUIRE(chunked.get(i + 1, 2) == U"a\"b");
+		}
+	}
+
+	detail::SetCSVChunkSize(0);
+
+	// 整数の範囲と書式
+	{
+		TextWriter writer(path, TextEncoding::UTF8_NO_BOM);
+		writer.write(U"-1,4294967296, 12 ,++3,1e3,\"\n5\"");
+	}
+
+	const CSVReader integers(path);
+	REQUIRE(integers.getOpt<int32>(0, 0) == -1);
+	REQUIRE(!integers.getOpt<uint32>(0, 0));
+	REQUIRE(!integers.getOpt<uint64>(0, 0));
+	REQUIRE(!integers.getOpt<uint32>(0, 1));
+	REQUIRE(integers.getOpt<int64>(0, 1) == int64(4294967296));
+	REQUIRE(integers.getOpt<uint64>(0, 2) == uint64(12));
+	REQUIRE(!integers.getOpt<int32>(0, 3));
+	REQUIRE(!integers.getOpt<int32>(0, 4));
+	REQUIRE(!integers.getOpt<int32>(0, 5));
+
+	// 空行はセルが 0 個の行になる（以前の boost::tokenizer による CSVData と同じ）
+	{
+		TextWriter writer(path, TextEncoding::UTF8_NO_BOM);
+		writer.write(U"a\n\nb\r\n\r\nc");
+	}
+
+	const CSVReader blank(path);
+	REQUIRE(blank.rows() == 5);
+	REQUIRE(blank.columns(1) == 0);
+	REQUIRE(blank.columns(3) == 0);
+	REQUIRE(blank.get(4, 0) == U"c");
+
+	for (const auto& data : { CSVData(path), CSVData(path, U",;") })
+	{
+		REQUIRE(data.rows() == 5);
+		REQUIRE(data.columns(0) == 1);
+		REQUIRE(data.columns(1) == 0);
+		REQUIRE(data.columns(3) == 0);
+		REQUIRE(data.get(4, 0) == U"c");
+	}
+
+	FileSystem::Remove(FileSystem::TempDirectoryPath() + U"Siv3DTest/");
+}
+
+TEST_CASE("TextReader", "[normal]")
+{
+	const FilePath path = FileSystem::TempDirectoryPath() + U"Siv3DTest/test.txt";
+
+	// 読み込みバッファ (64 KiB) をまたぐ行と、ASCII 以外の文字を含む行
+	Array<String> lines = { U"", U"abc", U"あいうえお", U"😀 emoji", U"Siv3D" };
+	lines << String(100'000, U'x') + U"終";
+
+	const String text = lines.join(U"\n", U"", U"");
+	REQUIRE(Unicode::FromUTF8(Unicode::ToUTF8(text)) == text);
+	REQUIRE(Unicode::FromUTF8("a\xFF\xE3\x81" "b") == U"a\xFFFD\xFFFD\xFFFD" U"b");
+
+	for (const auto encoding : { TextEncoding::UTF8, TextEncoding::UTF8_NO_BOM, TextEncoding::UTF16LE, TextEncoding::UTF16BE })
+	{
+		{
+			TextWriter writer(path, encoding);
+			writer.write(text);
+		}
+
+		TextReader reader(path);
+		REQUIRE(reader);
+
+		Array<String> result;
+		String line;
+
+		while (reader.readLine(line))
+		{
+			result << line;
+		}
+
+		REQUIRE(result == lines);
+		REQUIRE(TextReader(path).readAll() == text);
+
+		TextReader charReader(path);
+		String chars;
+		char32 ch;
+
+		while (charReader.readChar(ch))
+		{
+			chars.push_back(ch);
+		}
+
+		REQUIRE(chars == text);
+	}
+
+	FileSystem::Remove(FileSystem::TempDirectoryPath() + U"Siv3DTest/");
+}
+
+TEST_CASE("DirectoryWatcher", "[normal]")
+{
+	const FilePath directory = FileSystem::TempDirectoryPath() + U"Siv3DTest/watch/";
+	FileSystem::CreateDirectories(directory + U"sub/");
+
+	const DirectoryWatcher watcher(directory);
+	REQUIRE(watcher);
+
+	// 指定した変更が届くまで待つ
+	const auto waitFor = [&](const FilePath& path, const FileAction action)
+	{
+		const Stopwatch stopwatch(true);
+
+		while (stopwatch.ms() < 2000)
+		{
+			for (const auto& change : watcher.retrieveChanges())
+			{
+				if ((change.first == path) && (change.second == action))
+				{
+					return true;
+				}
+			}
+
+			System::Sleep(10);
+		}
+
+		return false;
+	};
+
+	const FilePath directoryFullPath = watcher.directory();
+
+	TextWriter(directory + U"sub/a.txt").write(U"a");
+	REQUIRE(waitFor(directoryFullPath + U"sub/a.txt", FileAction::Added));
+
+	TextWriter(directory + U"sub/a.txt", OpenMode::Append).write(U"b");
+	REQUIRE(waitFor(directoryFullPath + U"sub/a.txt", FileAction::Modified));
+
+	// 名前の変更は、古い名前の削除と新しい名前の作成として報告される
+	REQUIRE(std::rename(Unicode::Narrow(directory + U"sub").c_str(), Unicode::Narrow(directory + U"renamed").c_str()) == 0);
+	REQUIRE(waitFor(directoryFullPath + U"renamed", FileAction::Added));
+
+	// 名前を変えたディレクトリの中も引き続き監視される
+	TextWriter(directory + U"renamed/a.txt", OpenMode::Append).write(U"c");
+	REQUIRE(waitFor(directoryFullPath + U"renamed/a.txt", FileAction::Modified));
+
+	FileSystem::Remove(directory + U"renamed/a.txt");
+	REQUIRE(waitFor(directoryFullPath + U"renamed/a.txt", FileAction::Removed));
+
+	FileSystem::Remove(FileSystem::TempDirectoryPath() + U"Siv3DTest/");
+}
+
+TEST_CASE("Asset hot reload", "[normal]")
+{
+	const FilePath path = FileSystem::TempDirectoryPath() + U"Siv3DTest/hotreload/texture.png";
+	REQUIRE(Image(16, 16, Palette::White).save(path));
+
+	TextureAsset::Register(U"HotReload", path);
+	REQUIRE(TextureAsset(U"HotReload").size() == Size(16, 16));
+
+	Asset::EnableHotReload();
+	REQUIRE(Asset::IsHotReloadEnabled());
+
+	REQUIRE(Image(32, 8, Palette::White).save(path));
+
+	const Stopwatch stopwatch(true);
+
+	while ((TextureAsset(U"HotReload").size() != Size(32, 8)) && (stopwatch.ms() < 2000))
+	{
+		System::Update();
+	}
+
+	REQUIRE(TextureAsset(U"HotReload").size() == Size(32, 8));
+
+	Asset::EnableHotReload(false);
+	TextureAsset::Unregister(U"HotReload");
+	FileSystem::Remove(FileSystem::TempDirectoryPath() + U"Siv3DTest/");
+}
+
+TEST_CASE("BinaryReader", "[normal]")
+{
+	const FilePath path = FileSystem::TempDirectoryPath() + U"Siv3DTest/test.bin";
+
+	// 読み込みバッファ (64 KiB) より大きなファイル
+	const uint32 count = 100'000;
+
+	{
+		BinaryWriter writer(path);
+
+		for (uint32 i = 0; i < count; ++i)
+		{
+			writer.write(i);
+		}
+	}
+
+	{
+		BinaryReader reader(path, ReadAccessHint::Sequential);
+		REQUIRE(reader.size() == count * sizeof(uint32));
+
+		uint32 value;
+		bool ok = true;
+
+		for (uint32 i = 0; i < count; ++i)
+		{
+			ok &= (reader.read(value) && value == i);
+		}
+
+		REQUIRE(ok);
+		REQUIRE(!reader.read(value));
+
+		REQUIRE(reader.setPos(400));
+		REQUIRE((reader.lookahead(value) && value == 100));
+		REQUIRE(reader.getPos() == 400);
+
+		REQUIRE(reader.read(&value, 800, sizeof(value)) == sizeof(value));
+		REQUIRE(value == 200);
+		REQUIRE((reader.read(value) && value == 201));
+	}
+
+	{
+		BinaryReader reader(path, ReadAccessHint::Random);
+		Array<uint32> values(6);
+
+		// 順不同、隣接、隙間あり、ファイル終端をまたぐ要求
+		Array<BinaryReadRequest> requests =
+		{
+			{ &values[0], 4000, 4 },
+			{ &values[1], 0, 4 },
+			{ &values[2], 4, 4 },
+			{ &values[3], 40, 4 },
+			{ &values[4], (count - 1) * 4, 8 },
+			{ &values[5], count * 4, 4 },
+		};
+
+		REQUIRE(reader.readBatch(requests) == 20);
+		REQUIRE(requests.map([](const BinaryReadRequest& r) { return r.readSize; }) == Array<int64>{ 4, 4, 4, 4, 4, 0 });
+		REQUIRE(values.take(5) == Array<uint32>{ 1000, 0, 1, 10, count - 1 });
+
+		// 位置を指定した読み込みは複数のスレッドから同時に行える
+		Array<std::future<bool>> futures;
+
+		for (size_t t = 0; t < 4; ++t)
+		{
+			futures << std::async(std::launch::async, [&reader, t]()
+			{
+				bool ok = true;
+
+				for (uint32 i = static_cast<uint32>(t); i < count; i += 4)
+				{
+					uint32 value = 0;
+					ok &= (reader.lookahead(&value, i * 4, 4) == 4 && value == i);
+				}
+
+				return ok;
+			});
+		}
+
+		for (auto& future : futures)
+		{
+			REQUIRE(future.get());
+		}
+	}
+
+	FileSystem::Remove(FileSystem::TempDirectoryPath() + U"Siv3DTest/");
+}
+
+TEST_CASE("Parallel overhead", "[benchmark]")
+{
+	// スレッドプール導入前の実装（チャンクごとに std::async でスレッドを生成）
+	const auto parallelEachAsync = [](Array<float>& values, auto f)
+	{
+		const size_t n = std::max<size_t>(1, values.size() / Threading::GetConcurrency());
+		Array<std::future<void>> futures;
+		auto it = values.begin();
+		for (; it < values.end() - n; it += n)
+		{
+			futures.emplace_back(std::async(std::launch::async, [=]() { std::for_each(it, it + n, f); }));
+		}
+		std::for_each(it, values.end(), f);
+		for (auto& future : futures)
+		{
+			future.wait();
+		}
+	};
+
+	const auto update = [](float& x) { x = x * 0.5f + 1.0f; };
+
+	for (const size_t size : { 1'000, 1'000'000 })
+	{
+		Array<float> values(size, 1.0f);
+
+		BENCHMARK(U"std::async x{0}"_fmt(size).narrow())
+		{
+			parallelEachAsync(values, update);
+		}
+
+		BENCHMARK(U"parallel_each x{0}"_fmt(size).narrow())
+		{
+			values.parallel_each(update);
+		}
+	}
+}
+
+TEST_CASE("Image pixel operations throughput", "[benchmark]")
+{
+	const Size size(2048, 2048);
+	Image source(size);
+
+	for (auto& pixel : source)
+	{
+		pixel = Color(Random(255), Random(255), Random(255), Random(255));
+	}
+
+	const CPUFeature feature = CPU::GetFeature();
+
+	const auto measure = [&](const String& name, const std::function<void(Image&)>& f)
+	{
+		for (const bool simd : { false, true })
+		{
+			CPUFeature current = feature;
+
+			if (!simd)
+			{
+				current.SSE2 = current.AVX2 = false;
+			}
+
+			CPU::SetFeature(current);
+
+			Image image(source);
+			Stopwatch stopwatch(true);
+			f(image);
+			const double mpixPerSecond = (size.x * size.y) / stopwatch.usF();
+
+			Console << U"{0} ({1}): {2:.1f} MPix/s"_fmt(name, simd ? U"SIMD" : U"Reference", mpixPerSecond);
+		}
+
+		CPU::SetFeature(feature);
+	};
+
+	measure(U"negate", [](Image& image) { image.negate(); });
+	measure(U"grayscale", [](Image& image) { image.grayscale(); });
+	measure(U"sepia", [](Image& image) { image.sepia(); });
+	measure(U"postarize", [](Image& image) { image.postarize(4); });
+	measure(U"brighten", [](Image& image) { image.brighten(30); });
+	measure(U"gammaCorrect", [](Image& image) { image.gammaCorrect(2.2); });
+	measure(U"threshold", [](Image& image) { image.threshold(128); });
+	measure(U"swapRB", [](Image& image) { image.swapRB(); });
+}
+
+TEST_CASE("Image parallel execution throughput", "[benchmark]")
+{
+	Image source(4096, 4096);
+
+	for (auto& pixel : source)
+	{
+		pixel = Color(Random(255), Random(255), Random(255), Random(255));
+	}
+
+	for (const auto execution : { ImageExecution::Sequential, ImageExecution::Parallel })
+	{
+		const String name = (execution == ImageExecution::Sequential) ? U"Sequential" : U"Parallel";
+
+		BENCHMARK(U"gaussianBlurred(8) {0}"_fmt(name).narrow())
+		{
+			const Image result = source.gaussianBlurred(8, BorderType::Default, execution);
+		}
+
+		BENCHMARK(U"medianBlurred(5) {0}"_fmt(name).narrow())
+		{
+			const Image result = source.medianBlurred(5, execution);
+		}
+
+		BENCHMARK(U"scaled(0.5) {0}"_fmt(name).narrow())
+		{
+			const Image result = source.scaled(0.5, Interpolation::Area, execution);
+		}
+	}
+}
+
+// ファイルは直前に書き込んだばかりでページキャッシュに載っているため、
+// ディスクからの読み込みではなく、ファイルを開く処理と検索のコストを比較する
+TEST_CASE("FileArchive warm-cache loading", "[benchmark]")
+{
+	const FilePath directory = FileSystem::TempDirectoryPath() + U"Siv3DTest/archive/";
+	const FilePath archivePath = FileSystem::TempDirectoryPath() + U"Siv3DTest/test.s3da";
+	const int32 numFiles = 2000;
+
+	Array<FilePath> paths;
+	Array<Byte> data(4096);
+
+	for (int32 i = 0; i < numFiles; ++i)
+	{
+		for (auto& byte : data)
+		{
+			byte = static_cast<Byte>(Random(7));
+		}
+
+		paths << U"{0}/{1}.bin"_fmt(i % 16, i);
+		BinaryWriter(directory + paths.back()).write(data.data(), data.size());
+	}
+
+	REQUIRE(FileArchive::Build(archivePath, directory));
+
+	BENCHMARK("BinaryReader x2000 (warm cache)")
+	{
+		for (const auto& path : paths)
+		{
+			BinaryReader reader(directory + path);
+			reader.read(data.data(), reader.size());
+		}
+	}
+
+	REQUIRE(FileArchive::Mount(archivePath));
+
+	BENCHMARK("ArchivedFileReader x2000 (warm cache, mounted)")
+	{
+		for (const auto& path : paths)
+		{
+			ArchivedFileReader reader(path);
+			reader.read(data.data(), reader.size());
+		}
+	}
+
+	FileArchive::UnmountAll();
+
+	FileSystem::Remove(FileSystem::TempDirectoryPath() + U"Siv3DTest/");
+}
+
+TEST_CASE("AudioMixer throughput", "[benchmark]")
+{
+	if (!AudioMixer::IsAvailable())
+	{
+		return;
+	}
+
+	AudioMixer::EnableOfflineRendering();
+
+	const Wave wave(SecondsF(1.0), Arg::generator = [](double t) { return 0.01 * std::sin(t * Math::TwoPi * 440.0); });
+	Array<Audio> audios;
+
+	for (int32 i = 0; i < 128; ++i)
+	{
+		audios.emplace_back(wave, Arg::loop = true);
+		audios.back().setSpeed((i % 2) ? 1.0 : (0.75 + i * 0.002));
+		audios.back().play();
+	}
+
+	const CPUFeature feature = CPU::GetFeature();
+
+	for (const bool simd : { false, true })
+	{
+		CPUFeature current = feature;
+
+		if (!simd)
+		{
+			current.SSE2 = current.AVX2 = false;
+		}
+
+		CPU::SetFeature(current);
+
+		Stopwatch stopwatch(true);
+		const Wave rendered = AudioMixer::Render(AudioMixer::SamplingRate() * 10);
+
+		Console << U"128 voices x 10 s ({0}): {1:.1f}x realtime"_fmt(simd ? U"SIMD" : U"Reference", 10.0 / stopwatch.sF());
+	}
+
+	CPU::SetFeature(feature);
+
+	AudioMixer::EnableOfflineRendering(false);
+}
+
+TEST_CASE("Font layout cache throughput", "[benchmark]")
+{
+	// 毎フレーム同じ 200 個のラベルを中央揃えで配置する HUD
+	const Font font(16);
+	Array<String> labels;
+
+	for (int32 i = 0; i < 200; ++i)
+	{
+		labels.push_back(U"Unit #{0}  HP {1}/{2}  ATK {3}"_fmt(i, i * 37 % 1000, 1000, i * 13 % 200));
+	}
+
+	for (const bool cached : { false, true })
+	{
+		font.setLayoutCacheBudget(cached ? (4 * 1024 * 1024) : 0);
+
+		double sum = 0.0;
+		Stopwatch stopwatch(true);
+
+		for (int32 frame = 0; frame < 100; ++frame)
+		{
+			for (const auto& label : labels)
+			{
+				sum += font(label).regionAt(Vec2(400, 300)).w;
+				sum += font(label).getXAdvances().size();
+			}
+		}
+
+		Console << U"200 HUD labels x 100 frames ({0}): {1:.2f} ms/frame (checksum {2})"_fmt(cached ? U"cached" : U"uncached", stopwatch.msF() / 100, sum);
+	}
+
+	font.setLayoutCacheBudget(1024 * 1024);
+}
+
+TEST_CASE("Circle tessellation", "[benchmark]")
+{
+	// 毎フレーム 50,000 個のパーティクルを Circle として描く場合の CPU 側の頂点生成
+	constexpr uint32 quality = 24;
+	constexpr size_t numCircles = 50'000;
+	const Float4 color(1.0f, 1.0f, 1.0f, 0.5f);
+	Array<Vertex2D> vertices((quality + 1) * numCircles);
+	Array<uint32> indices(quality * 3 * numCircles);
+
+	for (const bool table : { false, true })
+	{
+		double sum = 0.0;
+		Stopwatch stopwatch(true);
+
+		for (int32 frame = 0; frame < 10; ++frame)
+		{
+			for (size_t n = 0; n < numCircles; ++n)
+			{
+				Vertex2D* pVertex = vertices.data() + (quality + 1) * n;
+				uint32* pIndex = indices.data() + quality * 3 * n;
+				const uint32 indexOffset = static_cast<uint32>((quality + 1) * n);
+				const Float2 center(n % 800, n % 600);
+				const float r = 4.0f + n % 5;
+
+				if (table)
+				{
+					Vertex2DBuilder::BuildFan(pVertex, pIndex, indexOffset, center, Float2(r, r),
+						Vertex2DBuilder::GetUnitCircle(quality), quality, color, true);
+				}
+				else
+				{
+					pVertex[0].pos = center;
+
+					const float radDelta = Math::TwoPiF / quality;
+
+					for (uint32 i = 1; i <= quality; ++i)
+					{
+						const float rad = radDelta * (i - 1.0f);
+						pVertex[i].pos.set(center.x + r * std::cos(rad), center.y - r * std::sin(rad));
+					}
+
+					for (uint32 i = 0; i <= quality; ++i)
+					{
+						pVertex[i].color = color;
+					}
+
+					for (uint32 i = 0; i < quality; ++i)
+					{
+						pIndex[i * 3 + 0] = indexOffset + i + 1;
+						pIndex[i * 3 + 1] = indexOffset;
+						pIndex[i * 3 + 2] = indexOffset + (i + 1) % quality + 1;
+					}
+				}
+
+				sum += pVertex[quality / 4 + 1].pos.y + pIndex[quality * 3 - 1];
+			}
+		}
+
+		Console << U"50000 circles x 10 frames ({0}): {1:.2f} ms/frame (checksum {2})"_fmt(table ? U"Vertex2DBuilder" : U"sin/cos", stopwatch.msF() / 10, sum);
+	}
+}
+
+TEST_CASE("Renderer2D instancing throughput", "[benchmark]")
+{
+	const bool enabled = Graphics2D::IsInstancingEnabled();
+
+	for (const bool instancing : { false, true })
+	{
+		Graphics2D::EnableInstancing(instancing);
+
+		if (Graphics2D::IsInstancingEnabled() != instancing)
+		{
+			continue;
+		}
+
+		double recordMs = 0.0, frameMs = 0.0;
+		size_t uploadBytes = 0, drawcalls = 0;
+
+		for (int32 frame = 0; frame < 10; ++frame)
+		{
+			Stopwatch stopwatch(true);
+
+			// 100,000 個の四角形
+			for (int32 i = 0; i < 100'000; ++i)
+			{
+				RectF(i % 400 * 2, i / 400 * 2, 1.5).draw(ColorF(i % 3 / 2.0, 0.5, 1.0));
+			}
+
+			recordMs += stopwatch.msF();
+
+			System::Update();
+
+			frameMs += stopwatch.msF();
+
+			uploadBytes += Profiler::GetStatistics().vertexUploadBytes;
+			drawcalls += Profiler::GetStatistics().drawcalls;
+		}
+
+		Console << U"100000 quads x 10 frames ({0}): record {1:.2f} ms/frame, total {2:.2f} ms/frame, {3:.2f} MB uploaded/frame, {4} drawcalls/frame"_fmt(
+			instancing ? U"instanced" : U"vertices", recordMs / 10, frameMs / 10, uploadBytes / 10 / (1024.0 * 1024.0), drawcalls / 10);
+	}
+
+	Graphics2D::EnableInstancing(enabled);
+}
+
+TEST_CASE("Renderer2D vertex upload frame time", "[benchmark]")
+{
+	const bool enabled = Graphics2D::IsInstancingEnabled();
+	Graphics2D::EnableInstancing(false);
+
+	for (const int32 count : { 10'000, 100'000, 300'000 })
+	{
+		// ウォームアップ
+		System::Update();
+
+		Stopwatch stopwatch(true);
+
+		for (int32 frame = 0; frame < 20; ++frame)
+		{
+			for (int32 i = 0; i < count; ++i)
+			{
+				RectF(i % 400 * 2, i / 400 % 300 * 2, 1.5).draw(ColorF(i % 3 / 2.0, 0.5, 1.0));
+			}
+
+			System::Update();
+		}
+
+		Console << U"{0} quads (vertex path): {1:.2f} ms/frame"_fmt(count, stopwatch.msF() / 20);
+	}
+
+	Graphics2D::EnableInstancing(enabled);
+}
+
+TEST_CASE("DrawList2D recording scaling", "[benchmark]")
+{
+	// 64 個の描画リストに、合計 128,000 個の四角形と 32,000 個の円を記録する
+	Array<DrawList2D> lists(64);
+
+	for (size_t numThreads = 1; numThreads <= Threading::GetConcurrency(); numThreads *= 2)
+	{
+		double recordMs = 0.0, frameMs = 0.0;
+
+		for (int32 frame = 0; frame < 10; ++frame)
+		{
+			Stopwatch stopwatch(true);
+
+			Threading::ParallelFor(lists.size(), [&](const size_t begin, const size_t end)
+			{
+				for (size_t i = begin; i < end; ++i)
+				{
+					DrawList2D& list = lists[i];
+					list.clear();
+
+					for (int32 k = 0; k < 2'000; ++k)
+					{
+						list.addRect(RectF(k % 200 * 4, (i * 10 + k / 200) * 4, 3), ColorF(k % 3 / 2.0, 0.5, 1.0));
+					}
+
+					for (int32 k = 0; k < 500; ++k)
+					{
+						list.addCircle(Circle(k % 100 * 8 + 4, (i * 5 + k / 100) * 8 + 4, 3.5), ColorF(1.0, 0.5, k % 3 / 2.0));
+					}
+				}
+			}, numThreads);
+
+			recordMs += stopwatch.msF();
+
+			Graphics2D::DrawLists(lists);
+
+			System::Update();
+
+			frameMs += stopwatch.msF();
+		}
+
+		Console << U"DrawList2D x 64 ({0} threads): record {1:.2f} ms/frame, total {2:.2f} ms/frame"_fmt(numThreads, recordMs / 10, frameMs / 10);
+	}
+}
+
+TEST_CASE("Renderer2D draw call sorting frame time", "[benchmark]")
+{
+	const Texture texture(Image(16, 16, Palette::White));
+
+	for (const bool sorting : { false, true })
+	{
+		Graphics2D::EnableDrawCallSorting(sorting);
+
+		// ウォームアップ
+		System::Update();
+
+		Stopwatch stopwatch(true);
+		size_t drawcalls = 0;
+
+		for (int32 frame = 0; frame < 20; ++frame)
+		{
+			// 図形、テクスチャ、線を交互に描く（UI のような描画）
+			for (int32 i = 0; i < 3'000; ++i)
+			{
+				const Vec2 pos(i % 60 * 13, i / 60 * 12);
+				RectF(pos, 10).draw(ColorF(0.2, 0.4, 0.6));
+				texture.resized(6).draw(pos.movedBy(2, 2));
+				Line(pos.movedBy(0, 11), pos.movedBy(10, 11)).draw(1.0, ColorF(1.0));
+			}
+
+			System::Update();
+
+			drawcalls += Profiler::GetStatistics().drawcalls;
+		}
+
+		Console << U"Interleaved draws (sorting: {0}): {1:.2f} ms/frame, {2} drawcalls/frame"_fmt(sorting, stopwatch.msF() / 20, drawcalls / 20);
+	}
+
+	Graphics2D::EnableDrawCallSorting(false);
+}
+
+# if defined(SIV3D_TARGET_LINUX)
+
+// f の実行中に増えた常駐メモリのピーク（バイト）を返す
+static int64 MeasurePeakMemoryIncrease(const std::function<void()>& f)
+{
+	const auto readStatus = [](const std::string& key)
+	{
+		std::ifstream ifs("/proc/self/status");
+
+		for (std::string line; std::getline(ifs, line);)
+		{
+			if (line.compare(0, key.size(), key) == 0)
+			{
+				return std::stoll(line.substr(key.size())) * 1024;
+			}
+		}
+
+		return 0LL;
+	};
+
+	// VmHWM（常駐メモリのピーク）を現在の値にリセットする
+	std::ofstream("/proc/self/clear_refs") << "5";
+
+	const int64 before = readStatus("VmRSS:");
+
+	f();
+
+	return readStatus("VmHWM:") - before;
+}
+
+# endif
+
+TEST_CASE("JSONReader large file", "[benchmark]")
+{
+	// 約 30 MB の JSON
+	const FilePath path = FileSystem::TempDirectoryPath() + U"Siv3DTest/large.json";
+	const int32 count = 300'000;
+
+	{
+		TextWriter writer(path, TextEncoding::UTF8_NO_BOM);
+		writer.write(U"{ \"records\": [");
+
+		for (int32 i = 0; i < count; ++i)
+		{
+			writer.write(U"{0}{{ \"id\": {1}, \"name\": \"レコード {1}\", \"pos\": [{2}, {3}], \"tags\": [\"a\", \"b\"] }}"_fmt((i ? U"," : U""), i, i * 0.5, i * 0.25));
+		}
+
+		writer.write(U"] }");
+	}
+
+	// 以前の JSONReader: ファイル全体を UTF-32 の String に変換してから、UTF-32 の DOM を構築していた
+	const auto parseUTF32 = [&]()
+	{
+		const String text = TextReader(path).readAll();
+		rapidjson::GenericStringStream<rapidjson::UTF32<char32>> stream(text.c_str());
+		rapidjson::GenericDocument<rapidjson::UTF32<char32>> document;
+		document.ParseStream<rapidjson::kParseCommentsFlag | rapidjson::kParseTrailingCommasFlag | rapidjson::kParseNanAndInfFlag>(stream);
+		REQUIRE(!document.HasParseError());
+		REQUIRE(document[U"records"].Size() == static_cast<rapidjson::SizeType>(count));
+	};
+
+	const auto parseUTF8 = [&]()
+	{
+		const JSONReader json(path);
+		REQUIRE(json[U"records"].arrayCount() == count);
+	};
+
+	BENCHMARK("readAll + UTF-32 DOM (previous JSONReader)")
+	{
+		parseUTF32();
+	}
+
+	BENCHMARK("JSONReader (UTF-8 in-situ DOM)")
+	{
+		parseUTF8();
+	}
+
+# if defined(SIV3D_TARGET_LINUX)
+
+	Console << U"Peak memory: readAll + UTF-32 DOM {0:.1f} MiB, JSONReader {1:.1f} MiB"_fmt(
+		MeasurePeakMemoryIncrease(parseUTF32) / (1024.0 * 1024.0),
+		MeasurePeakMemoryIncrease(parseUTF8) / (1024.0 * 1024.0));
+
+# endif
+
+	BENCHMARK("JSONStreamReader::read")
+	{
+		size_t events = 0;
+		REQUIRE(JSONStreamReader(path).read([&](const JSONStreamEvent&) { ++events; return true; }));
+		REQUIRE(events > 0);
+	}
+
+	BENCHMARK("JSONStreamReader::readArray")
+	{
+		int64 sum = 0;
+		REQUIRE(JSONStreamReader(path).readArray(U"records", [&](const JSONValue& record) { sum += record[U"id"].get<int64>(); return true; }));
+		REQUIRE(sum == int64(count) * (count - 1) / 2);
+	}
+
+	FileSystem::Remove(FileSystem::TempDirectoryPath() + U"Siv3DTest/");
+}
+
+TEST_CASE("CSVReader large file", "[benchmark]")
+{
+	// 約 20 MB の CSV
+	const FilePath path = FileSystem::TempDirectoryPath() + U"Siv3DTest/large.csv";
+	const int32 count = 500'000;
+
+	{
+		TextWriter writer(path, TextEncoding::UTF8_NO_BOM);
+
+		for (int32 i = 0; i < count; ++i)
+		{
+			writer.writeln(U"{0},\"レコード {0}\",{1},{2}"_fmt(i, i * 0.5, i * 0.25));
+		}
+	}
+
+	// 複数文字の区切り文字を指定すると、以前の String ベースのトークナイザが使われる
+	BENCHMARK("CSVData (tokenizer)")
+	{
+		REQUIRE(CSVData(path, U",;").rows() == count);
+	}
+
+	BENCHMARK("CSVData (CSVReader)")
+	{
+		REQUIRE(CSVData(path).rows() == count);
+	}
+
+	BENCHMARK("CSVReader")
+	{
+		REQUIRE(CSVReader(path).rows() == count);
+	}
+
+	BENCHMARK("CSVReader::getColumn")
+	{
+		const CSVReader csv(path);
+		const Array<int64> ids = csv.getColumn<int64>(0);
+		REQUIRE(ids.sum() == int64(count) * (count - 1) / 2);
+	}
+
+	FileSystem::Remove(FileSystem::TempDirectoryPath() + U"Siv3DTest/");
+}
+
+TEST_CASE("TextReader large file", "[benchmark]")
+{
+	// 約 40 MB のテキスト
+	const FilePath path = FileSystem::TempDirectoryPath() + U"Siv3DTest/large.txt";
+	const int32 count = 500'000;
+
+	{
+		TextWriter writer(path);
+
+		for (int32 i = 0; i < count; ++i)
+		{
+			writer.writeln(U"{0:0>8} [INFO] The quick brown fox jumps over the lazy dog / いろはにほへと"_fmt(i));
+		}
+	}
+
+	BENCHMARK("TextReader::readLine")
+	{
+		TextReader reader(path);
+		String line;
+		int32 lines = 0;
+
+		while (reader.readLine(line))
+		{
+			++lines;
+		}
+
+		REQUIRE(lines == count);
+	}
+
+	BENCHMARK("TextReader::readAll")
+	{
+		REQUIRE(TextReader(path).readAll().size() > 0);
+	}
+
+	const String text = TextReader(path).readAll();
+	const std::string utf8 = Unicode::ToUTF8(text);
+
+	BENCHMARK("Unicode::FromUTF8")
+	{
+		REQUIRE(Unicode::FromUTF8(utf8).size() == text.size());
+	}
+
+	BENCHMARK("Unicode::ToUTF8")
+	{
+		REQUIRE(Unicode::ToUTF8(text).size() == utf8.size());
+	}
+
+	BENCHMARK("TextWriter::write")
+	{
+		TextWriter writer(FileSystem::TempDirectoryPath() + U"Siv3DTest/write.txt");
+		writer.write(text);
+	}
+
+	FileSystem::Remove(FileSystem::TempDirectoryPath() + U"Siv3DTest/");
+}
+
+TEST_CASE("BinaryReader large file", "[benchmark]")
+{
+	// 64 バイトのレコード 1M 個を詰めた 64 MB のファイル
+	struct Record
+	{
+		uint64 id;
+
+		uint8 payload[56];
+	};
+
+	const FilePath path = FileSystem::TempDirectoryPath() + U"Siv3DTest/large.bin";
+	const size_t count = 1'000'000;
+
+	{
+		BinaryWriter writer(path);
+		Array<Record> records(count);
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			records[i].id = i;
+		}
+
+		writer.write(records.data(), records.size_bytes());
+	}
+
+	for (const auto hint : { ReadAccessHint::Normal, ReadAccessHint::Sequential })
+	{
+		BENCHMARK(U"BinaryReader::read sequential (hint: {0})"_fmt(static_cast<int32>(hint)).narrow())
+		{
+			BinaryReader reader(path, hint);
+			Record record;
+			size_t n = 0;
+
+			while (reader.read(record))
+			{
+				++n;
+			}
+
+			REQUIRE(n == count);
+		}
+	}
+
+	// 20,000 個のレコードをランダムに読み込む
+	Array<size_t> indices(20'000);
+
+	for (auto& index : indices)
+	{
+		index = Random(count - 1);
+	}
+
+	Array<Record> records(indices.size());
+
+	BENCHMARK("BinaryReader::read random x20000")
+	{
+		BinaryReader reader(path, ReadAccessHint::Random);
+
+		for (size_t i = 0; i < indices.size(); ++i)
+		{
+			reader.read(&records[i], indices[i] * sizeof(Record), sizeof(Record));
+		}
+	}
+
+	BENCHMARK("BinaryReader::readBatch random x20000")
+	{
+		BinaryReader reader(path, ReadAccessHint::Random);
+		Array<BinaryReadRequest> requests(indices.size());
+
+		for (size_t i = 0; i < indices.size(); ++i)
+		{
+			requests[i] = { &records[i], static_cast<int64>(indices[i] * sizeof(Record)), sizeof(Record) };
+		}
+
+		REQUIRE(reader.readBatch(requests) == static_cast<int64>(records.size_bytes()));
+	}
+
+	BENCHMARK("BinaryReader::lookahead random x20000 (parallel)")
+	{
+		BinaryReader reader(path, ReadAccessHint::Random);
+		const size_t numThreads = std::max<size_t>(1, Threading::GetConcurrency());
+		Array<std::future<void>> futures;
+
+		for (size_t t = 0; t < numThreads; ++t)
+		{
+			futures << std::async(std::launch::async, [&, t]()
+			{
+				for (size_t i = t; i < indices.size(); i += numThreads)
+				{
+					reader.lookahead(&records[i], indices[i] * sizeof(Record), sizeof(Record));
+				}
+			});
+		}
+
+		for (auto& future : futures)
+		{
+			future.wait();
+		}
+	}
+
+	FileSystem::Remove(FileSystem::TempDirectoryPath() + U"Siv3DTest/");
+}
+
 # endif
@@ -300,21 +300,30 @@
 	// Logger
 	# include "Siv3D/Logger.hpp"
 
+	// ログの出力先
+	# include "Siv3D/LogSink.hpp"
+
 	////// AES128 による暗号化
 	////# include "Siv3D/Crypto.hpp"
 
 	// Lossless compression with Zstandard algorithm
 	# include "Siv3D/Compression.hpp"
 
-	////// アーカイブファイルからの読み込み
-	////# include "Siv3D/ArchivedFileReader.hpp"
+	// 圧縮コンテキストを再利用する圧縮器 / 展開器と辞書
+	# include "Siv3D/Compressor.hpp"
+
+	// アーカイブファイルからの読み込み
+	# include "Siv3D/ArchivedFileReader.hpp"
 
-	////// アーカイブファイル
-	////# include "Siv3D/FileArchive.hpp"
+	// アーカイブファイル
+	# include "Siv3D/FileArchive.hpp"
 
 	// CSV ファイルデータの読み書き
 	# include "Siv3D/CSVData.hpp"
 
+	// CSV の読み込み
+	# include "Siv3D/CSVReader.hpp"
+
 	// INI ファイルデータの読み書き
 	# include "Siv3D/INIData.hpp"
 
@@ -531,6 +540,9 @@
 	// Region of Image
 	# include "Siv3D/ImageRegion.hpp"
 
+	// 画像の領域への参照
+	# include "Siv3D/ImageView.hpp"
+
 	// 画像デコーダ・エンコーダインタフェース
 	# include "Siv3D/ImageFormat.hpp"
 
@@ -740,6 +752,9 @@
 	// Audio
 	# include "Siv3D/Audio.hpp"
 
+	// オーディオミキサー
+	# include "Siv3D/AudioMixer.hpp"
+
 	//// サウンドの拍カウント
 	//# include "Siv3D/SoundBeat.hpp"
 
@@ -800,6 +815,9 @@
 	// 2D 座標変換
 	# include "Siv3D/Transformer2D.hpp"
 
+	// 任意のスレッドで記録できる 2D 描画リスト
+	# include "Siv3D/DrawList2D.hpp"
+
 //////////////////////////////////////////////////
 //
 //	Texture
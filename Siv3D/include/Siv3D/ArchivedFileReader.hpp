@@ -0,0 +1,275 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Fwd.hpp"
+# include "IReader.hpp"
+# include "ByteArrayView.hpp"
+
+namespace s3d
+{
+	/// <summary>
+	/// アーカイブ内のファイルの読み込み
+	/// </summary>
+	/// <remarks>
+	/// 圧縮されていないファイルはメモリマップトファイル上のデータを直接参照します。
+	/// 圧縮されているファイルはオープン時にメモリ上に展開されます。
+	/// </remarks>
+	class ArchivedFileReader : public IReader
+	{
+	private:
+
+		class CArchivedFileReader;
+
+		std::shared_ptr<CArchivedFileReader> pImpl;
+
+	public:
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		ArchivedFileReader();
+
+		/// <summary>
+		/// マウントされているアーカイブからファイルを開きます。
+		/// </summary>
+		/// <param name="path">
+		/// アーカイブ内のファイルのパス
+		/// </param>
+		explicit ArchivedFileReader(const FilePath& path)
+			: ArchivedFileReader()
+		{
+			open(path);
+		}
+
+		/// <summary>
+		/// アーカイブからファイルを開きます。
+		/// </summary>
+		/// <param name="archive">
+		/// アーカイブ
+		/// </param>
+		/// <param name="path">
+		/// アーカイブ内のファイルのパス
+		/// </param>
+		ArchivedFileReader(const FileArchive& archive, const FilePath& path)
+			: ArchivedFileReader()
+		{
+			open(archive, path);
+		}
+
+		/// <summary>
+		/// マウントされているアーカイブからファイルを開きます。
+		/// </summary>
+		/// <param name="path">
+		/// アーカイブ内のファイルのパス
+		/// </param>
+		/// <returns>
+		/// マウントされているアーカイブにファイルが含まれていて、オープンに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool open(const FilePath& path);
+
+		/// <summary>
+		/// アーカイブからファイルを開きます。
+		/// </summary>
+		/// <param name="archive">
+		/// アーカイブ
+		/// </param>
+		/// <param name="path">
+		/// アーカイブ内のファイルのパス
+		/// </param>
+		/// <returns>
+		/// ファイルのオープンに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool open(const FileArchive& archive, const FilePath& path);
+
+		/// <summary>
+		/// ファイルを閉じます。
+		/// </summary>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void close();
+
+		/// <summary>
+		/// ファイルが開いているかを返します。
+		/// </summary>
+		/// <returns>
+		/// ファイルが開いている場合 true, それ以外の場合は false
+		/// </returns>
+		[[nodiscard]] bool isOpened() const override;
+
+		/// <summary>
+		/// ファイルが開いているかを返します。
+		/// </summary>
+		/// <returns>
+		/// ファイルが開いている場合 true, それ以外の場合は false
+		/// </returns>
+		[[nodiscard]] explicit operator bool() const { return isOpened(); }
+
+		/// <summary>
+		/// ファイルのサイズを返します。
+		/// </summary>
+		/// <returns>
+		/// ファイルのサイズ（バイト）
+		/// </returns>
+		[[nodiscard]] int64 size() const override;
+
+		/// <summary>
+		/// 現在の読み込み位置を返します。
+		/// </summary>
+		/// <returns>
+		/// 現在の読み込み位置（バイト）
+		/// </returns>
+		[[nodiscard]] int64 getPos() const override;
+
+		/// <summary>
+		/// 読み込み位置を変更します。
+		/// </summary>
+		/// <param name="pos">
+		/// 新しい読み込み位置（バイト）
+		/// </param>
+		/// <returns>
+		/// 読み込み位置の変更に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool setPos(int64 pos) override;
+
+		/// <summary>
+		/// ファイルを読み飛ばし、読み込み位置を変更します。
+		/// </summary>
+		/// <param name="offset">
+		/// 読み飛ばすサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 新しい読み込み位置
+		/// </returns>
+		int64 skip(int64 offset) override;
+
+		/// <summary>
+		/// ファイルからデータを読み込みます。
+		/// </summary>
+		/// <param name="buffer">
+		/// 読み込み先
+		/// </param>
+		/// <param name="size">
+		/// 読み込むサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 実際に読み込んだサイズ（バイト）
+		/// </returns>
+		int64 read(void* buffer, int64 size) override;
+
+		/// <summary>
+		/// ファイルからデータを読み込みます。
+		/// </summary>
+		/// <param name="buffer">
+		/// 読み込み先
+		/// </param>
+		/// <param name="pos">
+		/// 先頭から数えた読み込み開始位置（バイト）
+		/// </param>
+		/// <param name="size">
+		/// 読み込むサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 実際に読み込んだサイズ（バイト）
+		/// </returns>
+		int64 read(void* buffer, int64 pos, int64 size) override;
+
+		/// <summary>
+		/// ファイルからデータを読み込みます。
+		/// </summary>
+		/// <param name="to">
+		/// 読み込み先
+		/// </param>
+		/// <returns>
+		/// 読み込みに成功したら true, それ以外の場合は false
+		/// </returns>
+		template <class Type, std::enable_if_t<std::is_trivially_copyable_v<Type>>* = nullptr>
+		bool read(Type& to)
+		{
+			return read(std::addressof(to), sizeof(Type)) == sizeof(Type);
+		}
+
+		/// <summary>
+		/// 読み込み位置を変更しないデータ読み込みをサポートしているかを返します。
+		/// </summary>
+		/// <returns>
+		/// つねに true
+		/// </returns>
+		[[nodiscard]] bool supportsLookahead() const override { return true; }
+
+		/// <summary>
+		/// 読み込み位置を変更しないでファイルからデータを読み込みます。
+		/// </summary>
+		/// <param name="buffer">
+		/// 読み込み先
+		/// </param>
+		/// <param name="size">
+		/// 読み込むサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 実際に読み込んだサイズ（バイト）
+		/// </returns>
+		int64 lookahead(void* buffer, int64 size) const override;
+
+		/// <summary>
+		/// 読み込み位置を変更しないでファイルからデータを読み込みます。
+		/// </summary>
+		/// <param name="buffer">
+		/// 読み込み先
+		/// </param>
+		/// <param name="pos">
+		/// 先頭から数えた読み込み開始位置（バイト）
+		/// </param>
+		/// <param name="size">
+		/// 読み込むサイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 実際に読み込んだサイズ（バイト）
+		/// </returns>
+		int64 lookahead(void* buffer, int64 pos, int64 size) const override;
+
+		/// <summary>
+		/// 読み込み位置を変更しないでファイルからデータを読み込みます。
+		/// </summary>
+		/// <param name="to">
+		/// 読み込み先
+		/// </param>
+		/// <returns>
+		/// 読み込みに成功したら true, それ以外の場合は false
+		/// </returns>
+		template <class Type, std::enable_if_t<std::is_trivially_copyable_v<Type>>* = nullptr>
+		bool lookahead(Type& to)
+		{
+			return lookahead(std::addressof(to), sizeof(Type)) == sizeof(Type);
+		}
+
+		/// <summary>
+		/// ファイルの内容全体を返します。
+		/// </summary>
+		/// <remarks>
+		/// 返されるデータは ArchivedFileReader が閉じられるまで有効です。
+		/// </remarks>
+		/// <returns>
+		/// ファイルの内容
+		/// </returns>
+		[[nodiscard]] ByteArrayView view() const;
+
+		/// <summary>
+		/// アーカイブ内のファイルのパスを返します。
+		/// </summary>
+		/// <returns>
+		/// アーカイブ内のファイルのパス
+		/// </returns>
+		[[nodiscard]] const FilePath& path() const;
+	};
+}
@@ -13,6 +13,7 @@
 # include "Fwd.hpp"
 # include "Array.hpp"
 # include "String.hpp"
+# include "ConcurrentTask.hpp"
 
 namespace s3d
 {
@@ -87,7 +88,7 @@ namespace s3d
 
 		AssetParameter parameter;
 
-		std::shared_ptr<std::future<bool>> m_loadingThread;
+		std::shared_ptr<ConcurrentTask<bool>> m_loadingThread;
 
 		enum class State
 		{
@@ -104,7 +105,7 @@ namespace s3d
 		template <class Fty>
 		void launchLoading(Fty&& fty)
 		{
-			m_loadingThread = std::make_unique<std::future<bool>>(std::async(std::launch::async, std::forward<Fty>(fty)));
+			m_loadingThread = std::make_shared<ConcurrentTask<bool>>(std::forward<Fty>(fty));
 		}
 
 	public:
@@ -144,15 +145,7 @@ namespace s3d
 				return true;
 			}
 
-		# if defined(SIV3D_TARGET_WINDOWS)
-
-			return m_loadingThread->_Is_ready();
-
-		# else
-
-			return m_loadingThread->wait_for(std::chrono::seconds(0)) == std::future_status::ready;
-
-		# endif	
+			return m_loadingThread->is_done();
 		}
 
 		void wait()
@@ -195,5 +188,63 @@ namespace s3d
 		{
 			return (m_state == State::LoadSucceeded);
 		}
+
+		/// <summary>
+		/// アセットの読み込み元のファイルを返します。
+		/// </summary>
+		/// <returns>
+		/// 読み込み元のファイルのパス。ファイルから読み込まないアセットの場合は空
+		/// </returns>
+		[[nodiscard]] virtual FilePath getSourcePath() const
+		{
+			return FilePath();
+		}
+
+		/// <summary>
+		/// 読み込み済みのアセットを、読み込み元から読み込み直します。
+		/// </summary>
+		/// <returns>
+		/// 読み込み直しに成功したか、まだ読み込まれていない場合 true, それ以外の場合は false
+		/// </returns>
+		virtual bool reload()
+		{
+			wait();
+
+			if (!isPreloaded())
+			{
+				return true;
+			}
+
+			release();
+
+			return preload();
+		}
 	};
+
+	namespace Asset
+	{
+		/// <summary>
+		/// アセットのホットリロードを有効または無効にします。
+		/// </summary>
+		/// <param name="enabled">
+		/// ホットリロードを有効にする場合 true, 無効にする場合は false
+		/// </param>
+		/// <remarks>
+		/// 有効な間は、ファイルから登録した TextureAsset, FontAsset, AudioAsset の読み込み元のディレクトリを監視し、
+		/// System::Update() のたびに、変更されたファイルから登録したアセットだけを読み込み直します。
+		/// 読み込み直したアセットは、TextureAsset(name) などで取得し直したときに反映されます。
+		/// </remarks>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void EnableHotReload(bool enabled = true);
+
+		/// <summary>
+		/// アセットのホットリロードが有効かを返します。
+		/// </summary>
+		/// <returns>
+		/// ホットリロードが有効な場合 true, それ以外の場合は false
+		/// </returns>
+		[[nodiscard]] bool IsHotReloadEnabled();
+	}
 }
@@ -150,7 +150,22 @@ namespace s3d
 
 		void stop(const Duration& fadeoutDuration = SecondsF(0.0)) const;
 
-		void playOneShot(double volume = 1.0, double pitch = 1.0) const;
+		/// <summary>
+		/// オーディオを再生位置や状態とは独立に、最初から 1 回再生します。
+		/// </summary>
+		/// <param name="volume">
+		/// 音量
+		/// </param>
+		/// <param name="pitch">
+		/// 再生速度
+		/// </param>
+		/// <param name="pan">
+		/// パン（-1.0 で左, 0.0 で中央, 1.0 で右）
+		/// </param>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void playOneShot(double volume = 1.0, double pitch = 1.0, double pan = 0.0) const;
 
 		void stopAllShots() const;
 
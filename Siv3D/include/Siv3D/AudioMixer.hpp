@@ -0,0 +1,89 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Fwd.hpp"
+# include "Wave.hpp"
+
+namespace s3d
+{
+	/// <summary>
+	/// すべての Audio を 1 つのストリームにミックスするエンジンのミキサー
+	/// </summary>
+	/// <remarks>
+	/// ミキサーは 1 つのオーディオスレッドで、すべてのボイスの音量・速度・パンを適用してミックスします。
+	/// Windows の XAudio2 バックエンドではミキサーは使われず、この名前空間の関数は何もしません。
+	/// </remarks>
+	namespace AudioMixer
+	{
+		/// <summary>
+		/// ミキサーが使われているかを返します。
+		/// </summary>
+		/// <returns>
+		/// ミキサーが使われている場合 true, それ以外の場合は false
+		/// </returns>
+		[[nodiscard]] bool IsAvailable();
+
+		/// <summary>
+		/// ミキサーの出力のサンプリングレートを返します。
+		/// </summary>
+		/// <returns>
+		/// サンプリングレート, ミキサーが使われていない場合は 0
+		/// </returns>
+		[[nodiscard]] uint32 SamplingRate();
+
+		/// <summary>
+		/// 再生中のボイスの数を返します。
+		/// </summary>
+		/// <returns>
+		/// 再生中のボイスの数
+		/// </returns>
+		[[nodiscard]] size_t NumActiveVoices();
+
+		/// <summary>
+		/// オフラインレンダリングを有効にします。
+		/// </summary>
+		/// <param name="enabled">
+		/// 有効にする場合 true, 無効にする場合は false
+		/// </param>
+		/// <remarks>
+		/// オフラインレンダリング中は、オーディオデバイスには無音が出力され、
+		/// ミキサーは AudioMixer::Render() を呼んだときだけ進みます。
+		/// </remarks>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void EnableOfflineRendering(bool enabled = true);
+
+		/// <summary>
+		/// オフラインレンダリングが有効であるかを返します。
+		/// </summary>
+		/// <returns>
+		/// オフラインレンダリングが有効な場合 true, それ以外の場合は false
+		/// </returns>
+		[[nodiscard]] bool IsOfflineRendering();
+
+		/// <summary>
+		/// ミキサーの出力を Wave にレンダリングします。
+		/// </summary>
+		/// <param name="samples">
+		/// レンダリングするサンプル数
+		/// </param>
+		/// <remarks>
+		/// オーディオデバイスが無い場合か、オフラインレンダリングが有効な場合のみ使えます。
+		/// 再生中のボイスはレンダリングしたサンプル数だけ進みます。
+		/// </remarks>
+		/// <returns>
+		/// レンダリングした Wave, 失敗した場合は空の Wave
+		/// </returns>
+		[[nodiscard]] Wave Render(size_t samples);
+	}
+}
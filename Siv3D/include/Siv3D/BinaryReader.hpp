@@ -14,9 +14,57 @@
 # include "Fwd.hpp"
 # include "IReader.hpp"
 # include "ByteArray.hpp"
+# include "Array.hpp"
 
 namespace s3d
 {
+	/// <summary>
+	/// ファイルへのアクセスパターンのヒント
+	/// </summary>
+	enum class ReadAccessHint
+	{
+		/// <summary>
+		/// 指定しない
+		/// </summary>
+		Normal,
+
+		/// <summary>
+		/// 先頭から順に読み込む
+		/// </summary>
+		Sequential,
+
+		/// <summary>
+		/// ランダムな位置を読み込む
+		/// </summary>
+		Random,
+	};
+
+	/// <summary>
+	/// BinaryReader::readBatch() の読み込み要求
+	/// </summary>
+	struct BinaryReadRequest
+	{
+		/// <summary>
+		/// 読み込み先
+		/// </summary>
+		void* buffer = nullptr;
+
+		/// <summary>
+		/// 先頭から数えた読み込み開始位置（バイト）
+		/// </summary>
+		int64 pos = 0;
+
+		/// <summary>
+		/// 読み込むサイズ（バイト）
+		/// </summary>
+		int64 size = 0;
+
+		/// <summary>
+		/// 実際に読み込んだサイズ（バイト）。readBatch() が設定します
+		/// </summary>
+		int64 readSize = 0;
+	};
+
 	/// <summary>
 	/// 読み込み用バイナリファイル
 	/// </summary>
@@ -41,10 +89,13 @@ namespace s3d
 		/// <param name="path">
 		/// ファイルパス
 		/// </param>
-		explicit BinaryReader(const FilePath& path)
+		/// <param name="hint">
+		/// ファイルへのアクセスパターンのヒント
+		/// </param>
+		explicit BinaryReader(const FilePath& path, ReadAccessHint hint = ReadAccessHint::Normal)
 			: BinaryReader()
 		{
-			open(path);
+			open(path, hint);
 		}
 
 		/// <summary>
@@ -53,10 +104,13 @@ namespace s3d
 		/// <param name="path">
 		/// ファイルパス
 		/// </param>
+		/// <param name="hint">
+		/// ファイルへのアクセスパターンのヒント
+		/// </param>
 		/// <returns>
 		/// ファイルのオープンに成功した場合 true, それ以外の場合は false
 		/// </returns>
-		bool open(const FilePath& path);
+		bool open(const FilePath& path, ReadAccessHint hint = ReadAccessHint::Normal);
 
 		/// <summary>
 		/// バイナリファイルをクローズします。
@@ -205,6 +259,53 @@ namespace s3d
 		/// </returns>
 		int64 lookahead(void* buffer, int64 pos, int64 size) const override;
 
+		/// <summary>
+		/// 複数の位置からまとめてデータを読み込みます。読み込み位置は変更しません。
+		/// </summary>
+		/// <param name="requests">
+		/// 読み込み要求の配列。各要求の readSize に実際に読み込んだサイズが書き込まれます
+		/// </param>
+		/// <param name="count">
+		/// 読み込み要求の個数
+		/// </param>
+		/// <remarks>
+		/// 隣接する要求は 1 回のシステムコールでまとめて読み込まれます。
+		/// Linux では、readBatch() と位置を指定した lookahead() に限り、複数のスレッドから同時に呼び出せます。
+		/// read() や位置を指定しない lookahead() など、読み込み位置を使う関数と同時に呼び出すことはできません。
+		/// </remarks>
+		/// <returns>
+		/// 実際に読み込んだサイズの合計（バイト）
+		/// </returns>
+		int64 readBatch(BinaryReadRequest* requests, size_t count) const;
+
+		/// <summary>
+		/// 複数の位置からまとめてデータを読み込みます。読み込み位置は変更しません。
+		/// </summary>
+		/// <param name="requests">
+		/// 読み込み要求の配列。各要求の readSize に実際に読み込んだサイズが書き込まれます
+		/// </param>
+		/// <returns>
+		/// 実際に読み込んだサイズの合計（バイト）
+		/// </returns>
+		int64 readBatch(Array<BinaryReadRequest>& requests) const
+		{
+			return readBatch(requests.data(), requests.size());
+		}
+
+		/// <summary>
+		/// 指定した範囲を近いうちに読み込むことを OS に通知し、先読みを促します。
+		/// </summary>
+		/// <param name="pos">
+		/// 先頭から数えた開始位置（バイト）
+		/// </param>
+		/// <param name="size">
+		/// サイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void prefetch(int64 pos, int64 size) const;
+
 		/// <summary>
 		/// 読み込み位置を変更しないでファイルからデータを読み込みます。
 		/// </summary>
@@ -1137,29 +1137,12 @@ namespace s3d
 				return 0;
 			}
 
-			const size_t n = std::max<size_t>(1, size() / std::max<size_t>(1, numThreads));
+			std::atomic<size_t> result = { 0 };
 
-			Array<std::future<std::ptrdiff_t>> futures;
-
-			auto it = begin();
-			const auto last = end();
-
-			for (; it < last - n; it += n)
+			Threading::ParallelFor(size(), [&](const size_t beginIndex, const size_t endIndex)
 			{
-				futures.emplace_back(std::async(std::launch::async, [=, &f]()
-				{
-					return std::count_if(it, it + n, f);
-				}));
-			}
-
-			std::for_each(it, last, f);
-
-			size_t result = 0;
-
-			for (auto& future : futures)
-			{
-				result += future.get();
-			}
+				result += std::count_if(begin() + beginIndex, begin() + endIndex, f);
+			}, numThreads);
 
 			return result;
 		}
@@ -1167,32 +1150,10 @@ namespace s3d
 		template <class Fty>
 		Array& parallel_each(Fty f, size_t numThreads = Threading::GetConcurrency())
 		{
-			if (isEmpty())
-			{
-				return *this;
-			}
-
-			const size_t n = std::max<size_t>(1, size() / std::max<size_t>(1, numThreads));
-
-			Array<std::future<void>> futures;
-
-			auto it = begin();
-			const auto last = end();
-
-			for (; it < last - n; it += n)
+			Threading::ParallelFor(size(), [&](const size_t beginIndex, const size_t endIndex)
 			{
-				futures.emplace_back(std::async(std::launch::async, [=, &f]()
-				{
-					std::for_each(it, it + n, f);
-				}));
-			}
-
-			std::for_each(it, last, f);
-
-			for (auto& future : futures)
-			{
-				future.wait();
-			}
+				std::for_each(begin() + beginIndex, begin() + endIndex, f);
+			}, numThreads);
 
 			return *this;
 		}
@@ -1200,32 +1161,10 @@ namespace s3d
 		template <class Fty>
 		const Array& parallel_each(Fty f, size_t numThreads = Threading::GetConcurrency()) const
 		{
-			if (isEmpty())
+			Threading::ParallelFor(size(), [&](const size_t beginIndex, const size_t endIndex)
 			{
-				return *this;
-			}
-
-			const size_t n = std::max<size_t>(1, size() / std::max<size_t>(1, numThreads));
-
-			Array<std::future<void>> futures;
-
-			auto it = begin();
-			const auto last = end();
-
-			for (; it < last - n; it += n)
-			{
-				futures.emplace_back(std::async(std::launch::async, [=, &f]()
-				{
-					std::for_each(it, it + n, f);
-				}));
-			}
-
-			std::for_each(it, last, f);
-
-			for (auto& future : futures)
-			{
-				future.wait();
-			}
+				std::for_each(begin() + beginIndex, begin() + endIndex, f);
+			}, numThreads);
 
 			return *this;
 		}
@@ -1242,36 +1181,17 @@ namespace s3d
 
 			new_array.resize(size());
 
-			const size_t n = std::max<size_t>(1, size() / std::max<size_t>(1, numThreads));
-
-			Array<std::future<void>> futures;
-
-			auto itSrc = begin();
-			const auto itSrcEnd = end();
-			auto itDst = new_array.begin();
-
-			for (; itSrc < itSrcEnd - n; itSrc += n, itDst += n)
+			Threading::ParallelFor(size(), [&](const size_t beginIndex, const size_t endIndex)
 			{
-				futures.emplace_back(std::async(std::launch::async, [=, &f]() mutable
-				{
-					const auto itSrcEnd = itSrc + n;
+				auto itSrc = begin() + beginIndex;
+				const auto itSrcEnd = begin() + endIndex;
+				auto itDst = new_array.begin() + beginIndex;
 
-					while (itSrc != itSrcEnd)
-					{
-						*itDst++ = f(*itSrc++);
-					}
-				}));
-			}
-
-			while (itSrc != itSrcEnd)
-			{
-				*itDst++ = f(*itSrc++);
-			}
-
-			for (auto& future : futures)
-			{
-				future.wait();
-			}
+				while (itSrc != itSrcEnd)
+				{
+					*itDst++ = f(*itSrc++);
+				}
+			}, numThreads);
 
 			return new_array;
 		}
@@ -18,6 +18,10 @@
 
 namespace s3d
 {
+	// 区切り文字が 1 文字で、区切り文字・クォート・エスケープ文字が ASCII の場合は CSVReader で解析する。
+	// 以前の行ごとの解析とは次の点が異なる:
+	// ・クォート内の改行はセルの一部になる（以前は行が分かれていた）
+	// ・無効なエスケープ（例: "e\,f" の "\,"）は、そのエスケープ文字だけがそのまま文字になる（以前は同じ行のすべてのエスケープ文字がそのまま文字になっていた）
 	class CSVData
 	{
 	private:
@@ -64,7 +68,7 @@ namespace s3d
 		template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader>>* = nullptr>
 		bool load(Reader&& reader, StringView separators = U",", StringView quotes = U"\"", StringView escapes = U"\\")
 		{
-			return load(std::make_shared<Reader>(std::move(reader), separators, quotes, escapes));
+			return load(std::make_shared<Reader>(std::move(reader)), separators, quotes, escapes);
 		}
 
 		bool load(const std::shared_ptr<IReader>& reader, StringView separators = U",", StringView quotes = U"\"", StringView escapes = U"\\");
@@ -0,0 +1,154 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <string_view>
+# include "Fwd.hpp"
+# include "String.hpp"
+# include "Array.hpp"
+# include "Optional.hpp"
+# include "Parse.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		struct CSVReaderDetail;
+	}
+
+	// UTF-8 のテキストをそのまま解析する、読み込み専用の CSV
+	// セルはファイルの内容を指すため、セルごとのメモリ確保が発生しない。大きなファイルは複数のスレッドで分割して解析する。
+	// クォート内の "" はクォート 1 文字、クォート内の改行はセルの一部として扱う。空行はセルが 0 個の行になる。
+	// エスケープ文字の後に置けるのはエスケープ文字、クォート、n のみで、それ以外（区切り文字を含む）の前のエスケープ文字はそのまま文字になる。
+	class CSVReader
+	{
+	private:
+
+		std::shared_ptr<detail::CSVReaderDetail> m_detail;
+
+		Optional<String> getItem(size_t row, size_t column) const;
+
+	public:
+
+		CSVReader();
+
+		explicit CSVReader(const FilePath& path, char32 separator = U',', char32 quote = U'\"', char32 escape = U'\\');
+
+		template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>* = nullptr>
+		explicit CSVReader(Reader&& reader, char32 separator = U',', char32 quote = U'\"', char32 escape = U'\\')
+			: CSVReader()
+		{
+			open(std::make_shared<Reader>(std::forward<Reader>(reader)), separator, quote, escape);
+		}
+
+		explicit CSVReader(const std::shared_ptr<IReader>& reader, char32 separator = U',', char32 quote = U'\"', char32 escape = U'\\');
+
+		// separator, quote, escape は ASCII 文字のみ。quote, escape に 0 を指定すると使用しない
+		bool open(const FilePath& path, char32 separator = U',', char32 quote = U'\"', char32 escape = U'\\');
+
+		template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>* = nullptr>
+		bool open(Reader&& reader, char32 separator = U',', char32 quote = U'\"', char32 escape = U'\\')
+		{
+			return open(std::make_shared<Reader>(std::forward<Reader>(reader)), separator, quote, escape);
+		}
+
+		bool open(const std::shared_ptr<IReader>& reader, char32 separator = U',', char32 quote = U'\"', char32 escape = U'\\');
+
+		void close();
+
+		[[nodiscard]] bool isOpened() const;
+
+		[[nodiscard]] explicit operator bool() const
+		{
+			return isOpened();
+		}
+
+		[[nodiscard]] size_t rows() const;
+
+		[[nodiscard]] size_t columns(size_t row) const;
+
+		// セルの UTF-8 の文字列（範囲外の場合は空）。CSVReader が閉じられるまで有効
+		[[nodiscard]] std::string_view getUTF8(size_t row, size_t column) const;
+
+		template <class Type = String>
+		[[nodiscard]] Type get(size_t row, size_t column) const
+		{
+			if (const auto opt = getOpt<Type>(row, column))
+			{
+				return opt.value();
+			}
+
+			return Type();
+		}
+
+		template <class Type, class U>
+		[[nodiscard]] Type getOr(size_t row, size_t column, U&& defaultValue) const
+		{
+			return getOpt<Type>(row, column).value_or(std::forward<U>(defaultValue));
+		}
+
+		template <class Type>
+		[[nodiscard]] Optional<Type> getOpt(size_t row, size_t column) const
+		{
+			if (const auto item = getItem(row, column))
+			{
+				return ParseOpt<Type>(item.value());
+			}
+
+			return none;
+		}
+
+		[[nodiscard]] Array<String> getRow(size_t row) const;
+
+		// 列 column のすべての値。値が無い、または変換できないセルは defaultValue になる
+		template <class Type>
+		[[nodiscard]] Array<Type> getColumn(size_t column, const Type& defaultValue = Type()) const
+		{
+			Array<Type> result(rows(), defaultValue);
+
+			for (size_t row = 0; row < result.size(); ++row)
+			{
+				if (const auto value = getOpt<Type>(row, column))
+				{
+					result[row] = value.value();
+				}
+			}
+
+			return result;
+		}
+
+		// すべてのセルを String に変換する
+		[[nodiscard]] Array<Array<String>> toArray() const;
+	};
+
+	// 以下の型は String を経由せずに UTF-8 から直接変換する
+
+	template <>
+	Optional<String> CSVReader::getOpt<String>(size_t row, size_t column) const;
+
+	template <>
+	Optional<int32> CSVReader::getOpt<int32>(size_t row, size_t column) const;
+
+	template <>
+	Optional<uint32> CSVReader::getOpt<uint32>(size_t row, size_t column) const;
+
+	template <>
+	Optional<int64> CSVReader::getOpt<int64>(size_t row, size_t column) const;
+
+	template <>
+	Optional<uint64> CSVReader::getOpt<uint64>(size_t row, size_t column) const;
+
+	template <>
+	Optional<float> CSVReader::getOpt<float>(size_t row, size_t column) const;
+
+	template <>
+	Optional<double> CSVReader::getOpt<double>(size_t row, size_t column) const;
+}
@@ -0,0 +1,409 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Fwd.hpp"
+# include "Array.hpp"
+# include "ByteArrayView.hpp"
+# include "ByteArray.hpp"
+# include "Compression.hpp"
+
+namespace s3d
+{
+	/// <summary>
+	/// Zstandard 圧縮用の辞書
+	/// </summary>
+	/// <remarks>
+	/// 似た内容の小さなデータを多数圧縮する場合、事前に学習した辞書を使うことで圧縮率が大きく向上します。
+	/// 圧縮に使った辞書と同じ辞書で展開する必要があります。
+	/// </remarks>
+	class CompressionDictionary
+	{
+	private:
+
+		class CCompressionDictionary;
+
+		std::shared_ptr<CCompressionDictionary> pImpl;
+
+		friend class Compressor;
+
+		friend class Decompressor;
+
+	public:
+
+		/// <summary>
+		/// 辞書の最大サイズのデフォルト値（バイト）
+		/// </summary>
+		static constexpr size_t DefaultDictionarySize = 112 * 1024;
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		CompressionDictionary();
+
+		/// <summary>
+		/// 辞書データから辞書を作成します。
+		/// </summary>
+		/// <param name="dictionary">
+		/// 辞書データ
+		/// </param>
+		explicit CompressionDictionary(ByteArrayView dictionary);
+
+		/// <summary>
+		/// 辞書ファイルから辞書を作成します。
+		/// </summary>
+		/// <param name="path">
+		/// 辞書ファイルのパス
+		/// </param>
+		explicit CompressionDictionary(const FilePath& path);
+
+		/// <summary>
+		/// 辞書が空であるかを返します。
+		/// </summary>
+		/// <returns>
+		/// 辞書が空である場合 true, それ以外の場合は false
+		/// </returns>
+		[[nodiscard]] bool isEmpty() const;
+
+		/// <summary>
+		/// 辞書が空でないかを返します。
+		/// </summary>
+		/// <returns>
+		/// 辞書が空でない場合 true, それ以外の場合は false
+		/// </returns>
+		[[nodiscard]] explicit operator bool() const
+		{
+			return !isEmpty();
+		}
+
+		/// <summary>
+		/// 辞書の ID を返します。
+		/// </summary>
+		/// <returns>
+		/// 辞書の ID, 辞書が空であるか ID を持たない場合は 0
+		/// </returns>
+		[[nodiscard]] uint32 id() const;
+
+		/// <summary>
+		/// 辞書データを返します。
+		/// </summary>
+		/// <returns>
+		/// 辞書データ
+		/// </returns>
+		[[nodiscard]] ByteArrayView view() const;
+
+		/// <summary>
+		/// 辞書データをファイルに保存します。
+		/// </summary>
+		/// <param name="path">
+		/// ファイルパス
+		/// </param>
+		/// <returns>
+		/// 保存に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool save(const FilePath& path) const;
+
+		/// <summary>
+		/// サンプルデータから辞書を学習します。
+		/// </summary>
+		/// <param name="samples">
+		/// サンプルデータ
+		/// </param>
+		/// <param name="maxDictionarySize">
+		/// 辞書の最大サイズ（バイト）
+		/// </param>
+		/// <remarks>
+		/// 数百個以上のサンプルを与えることが推奨されます。
+		/// サンプルが少なすぎる場合は学習に失敗します。
+		/// </remarks>
+		/// <returns>
+		/// 学習した辞書, 失敗した場合は空の辞書
+		/// </returns>
+		[[nodiscard]] static CompressionDictionary Train(const Array<ByteArrayView>& samples, size_t maxDictionarySize = DefaultDictionarySize);
+
+		/// <summary>
+		/// サンプルデータから辞書を学習します。
+		/// </summary>
+		/// <param name="samples">
+		/// サンプルデータ
+		/// </param>
+		/// <param name="maxDictionarySize">
+		/// 辞書の最大サイズ（バイト）
+		/// </param>
+		/// <returns>
+		/// 学習した辞書, 失敗した場合は空の辞書
+		/// </returns>
+		[[nodiscard]] static CompressionDictionary Train(const Array<ByteArray>& samples, size_t maxDictionarySize = DefaultDictionarySize);
+	};
+
+	/// <summary>
+	/// Zstandard 圧縮器
+	/// </summary>
+	/// <remarks>
+	/// 内部のコンテキストを呼び出し間で再利用するため、多数のデータを圧縮する場合は
+	/// Compression::Compress() よりも効率的です。
+	/// 1 つの Compressor を複数のスレッドから同時に使用することはできません。
+	/// </remarks>
+	class Compressor
+	{
+	private:
+
+		class CCompressor;
+
+		std::shared_ptr<CCompressor> pImpl;
+
+	public:
+
+		/// <summary>
+		/// 圧縮器を作成します。
+		/// </summary>
+		/// <param name="compressionLevel">
+		/// 圧縮レベル
+		/// </param>
+		/// <param name="numWorkers">
+		/// 圧縮に使うワーカースレッドの数。0 の場合は呼び出し元のスレッドで圧縮します
+		/// </param>
+		explicit Compressor(int32 compressionLevel = Compression::DefaultCompressionLevel, size_t numWorkers = 0);
+
+		/// <summary>
+		/// 辞書を使う圧縮器を作成します。
+		/// </summary>
+		/// <param name="dictionary">
+		/// 辞書
+		/// </param>
+		/// <param name="compressionLevel">
+		/// 圧縮レベル
+		/// </param>
+		/// <param name="numWorkers">
+		/// 圧縮に使うワーカースレッドの数。0 の場合は呼び出し元のスレッドで圧縮します
+		/// </param>
+		explicit Compressor(const CompressionDictionary& dictionary, int32 compressionLevel = Compression::DefaultCompressionLevel, size_t numWorkers = 0);
+
+		/// <summary>
+		/// 圧縮レベルを設定します。
+		/// </summary>
+		/// <param name="compressionLevel">
+		/// 圧縮レベル
+		/// </param>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void setCompressionLevel(int32 compressionLevel);
+
+		/// <summary>
+		/// 圧縮レベルを返します。
+		/// </summary>
+		/// <returns>
+		/// 圧縮レベル
+		/// </returns>
+		[[nodiscard]] int32 getCompressionLevel() const;
+
+		/// <summary>
+		/// 圧縮に使うワーカースレッドの数を設定します。
+		/// </summary>
+		/// <param name="numWorkers">
+		/// ワーカースレッドの数。0 の場合は呼び出し元のスレッドで圧縮します
+		/// </param>
+		/// <remarks>
+		/// ワーカースレッドを使う場合、入力はジョブ単位に分割されて並列に圧縮されます。
+		/// 数 MB 以上の大きなデータで効果があります。
+		/// </remarks>
+		/// <returns>
+		/// 設定に成功した場合 true, マルチスレッド圧縮がサポートされていない場合は false
+		/// </returns>
+		bool setNumWorkers(size_t numWorkers);
+
+		/// <summary>
+		/// 圧縮に使うワーカースレッドの数を返します。
+		/// </summary>
+		/// <returns>
+		/// ワーカースレッドの数
+		/// </returns>
+		[[nodiscard]] size_t getNumWorkers() const;
+
+		/// <summary>
+		/// 圧縮に使う辞書を設定します。
+		/// </summary>
+		/// <param name="dictionary">
+		/// 辞書。空の辞書の場合は辞書を使いません
+		/// </param>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void setDictionary(const CompressionDictionary& dictionary);
+
+		/// <summary>
+		/// 圧縮に使う辞書を返します。
+		/// </summary>
+		/// <returns>
+		/// 辞書
+		/// </returns>
+		[[nodiscard]] const CompressionDictionary& getDictionary() const;
+
+		/// <summary>
+		/// データを圧縮します。
+		/// </summary>
+		/// <param name="view">
+		/// 圧縮するデータ
+		/// </param>
+		/// <returns>
+		/// 圧縮したデータ, 失敗した場合は空のデータ
+		/// </returns>
+		[[nodiscard]] ByteArray compress(ByteArrayView view);
+
+		/// <summary>
+		/// データを圧縮します。
+		/// </summary>
+		/// <param name="view">
+		/// 圧縮するデータ
+		/// </param>
+		/// <param name="dst">
+		/// 圧縮したデータの格納先。既存の内容は上書きされ、確保済みの容量は再利用されます
+		/// </param>
+		/// <returns>
+		/// 圧縮に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool compress(ByteArrayView view, Array<Byte>& dst);
+
+		/// <summary>
+		/// reader の現在位置から終端までのデータを圧縮し、writer に書き込みます。
+		/// </summary>
+		/// <param name="reader">
+		/// 圧縮するデータの読み込み元
+		/// </param>
+		/// <param name="writer">
+		/// 圧縮したデータの書き込み先
+		/// </param>
+		/// <returns>
+		/// 圧縮に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool compress(IReader& reader, IWriter& writer);
+	};
+
+	/// <summary>
+	/// Zstandard 展開器
+	/// </summary>
+	/// <remarks>
+	/// 内部のコンテキストを呼び出し間で再利用するため、多数のデータを展開する場合は
+	/// Compression::Decompress() よりも効率的です。
+	/// 1 つの Decompressor を複数のスレッドから同時に使用することはできません。
+	/// </remarks>
+	class Decompressor
+	{
+	private:
+
+		class CDecompressor;
+
+		std::shared_ptr<CDecompressor> pImpl;
+
+	public:
+
+		/// <summary>
+		/// 展開後のサイズに合わせて一括で確保するバッファの最大サイズのデフォルト値（バイト）
+		/// </summary>
+		static constexpr size_t DefaultMaxPreallocationSize = 64 * 1024 * 1024;
+
+		/// <summary>
+		/// 展開器を作成します。
+		/// </summary>
+		Decompressor();
+
+		/// <summary>
+		/// 辞書を使う展開器を作成します。
+		/// </summary>
+		/// <param name="dictionary">
+		/// 辞書
+		/// </param>
+		explicit Decompressor(const CompressionDictionary& dictionary);
+
+		/// <summary>
+		/// 展開に使う辞書を設定します。
+		/// </summary>
+		/// <param name="dictionary">
+		/// 辞書。空の辞書の場合は辞書を使いません
+		/// </param>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void setDictionary(const CompressionDictionary& dictionary);
+
+		/// <summary>
+		/// 展開に使う辞書を返します。
+		/// </summary>
+		/// <returns>
+		/// 辞書
+		/// </returns>
+		[[nodiscard]] const CompressionDictionary& getDictionary() const;
+
+		/// <summary>
+		/// フレームヘッダに記録された展開後のサイズで、一括で確保するバッファの最大サイズを設定します。
+		/// </summary>
+		/// <param name="size">
+		/// 最大サイズ（バイト）
+		/// </param>
+		/// <remarks>
+		/// 展開後のサイズがこれを超える場合は、実際に展開したデータに合わせてバッファを拡張しながら展開します。
+		/// 壊れたデータや悪意のあるデータのヘッダによって、巨大なバッファが確保されることを防ぎます。
+		/// </remarks>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void setMaxPreallocationSize(size_t size);
+
+		/// <summary>
+		/// 一括で確保するバッファの最大サイズを返します。
+		/// </summary>
+		/// <returns>
+		/// 最大サイズ（バイト）
+		/// </returns>
+		[[nodiscard]] size_t getMaxPreallocationSize() const;
+
+		/// <summary>
+		/// データを展開します。
+		/// </summary>
+		/// <param name="view">
+		/// 圧縮されたデータ
+		/// </param>
+		/// <returns>
+		/// 展開したデータ, 失敗した場合は空のデータ
+		/// </returns>
+		[[nodiscard]] ByteArray decompress(ByteArrayView view);
+
+		/// <summary>
+		/// データを展開します。
+		/// </summary>
+		/// <param name="view">
+		/// 圧縮されたデータ
+		/// </param>
+		/// <param name="dst">
+		/// 展開したデータの格納先。既存の内容は上書きされ、確保済みの容量は再利用されます
+		/// </param>
+		/// <returns>
+		/// 展開に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool decompress(ByteArrayView view, Array<Byte>& dst);
+
+		/// <summary>
+		/// reader の現在位置から終端までの圧縮されたデータを展開し、writer に書き込みます。
+		/// </summary>
+		/// <param name="reader">
+		/// 圧縮されたデータの読み込み元
+		/// </param>
+		/// <param name="writer">
+		/// 展開したデータの書き込み先
+		/// </param>
+		/// <returns>
+		/// 展開に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool decompress(IReader& reader, IWriter& writer);
+	};
+}
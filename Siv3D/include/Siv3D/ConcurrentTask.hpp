@@ -11,50 +11,676 @@
 
 # pragma once
 # include <future>
+# include <functional>
+# include <memory>
+# include <mutex>
+# include <atomic>
+# include <tuple>
+# include <utility>
+# include <vector>
+# include <exception>
+# include <stdexcept>
 # include "Fwd.hpp"
+# include "Array.hpp"
 
 namespace s3d
 {
+	/// <summary>
+	/// ConcurrentTask の実行優先度
+	/// </summary>
+	enum class TaskPriority
+	{
+		/// <summary>
+		/// 他のタスクが無いときに実行されます。
+		/// </summary>
+		Low,
+
+		/// <summary>
+		/// 通常の優先度です。
+		/// </summary>
+		Normal,
+
+		/// <summary>
+		/// 他のタスクより優先して実行されます。
+		/// </summary>
+		High,
+	};
+
+	/// <summary>
+	/// 実行前にキャンセルされた ConcurrentTask の get() が送出する例外
+	/// </summary>
+	class ConcurrentTaskCanceled : public std::exception
+	{
+	public:
+
+		const char* what() const noexcept override
+		{
+			return "ConcurrentTask was canceled";
+		}
+	};
+
+	namespace detail
+	{
+		class ConcurrentTaskControl
+		{
+		private:
+
+			std::mutex m_mutex;
+
+			std::vector<std::function<void()>> m_continuations;
+
+			std::shared_ptr<std::atomic<bool>> m_cancellationRequested;
+
+			bool m_finished = false;
+
+		public:
+
+			explicit ConcurrentTaskControl(std::shared_ptr<std::atomic<bool>> cancellationRequested)
+				: m_cancellationRequested(std::move(cancellationRequested)) {}
+
+			[[nodiscard]] const std::shared_ptr<std::atomic<bool>>& getCancellationFlag() const noexcept
+			{
+				return m_cancellationRequested;
+			}
+
+			void requestCancellation() noexcept
+			{
+				*m_cancellationRequested = true;
+			}
+
+			[[nodiscard]] bool isCancellationRequested() const noexcept
+			{
+				return *m_cancellationRequested;
+			}
+
+			// タスクの完了時に f を呼びます。既に完了している場合はすぐに呼びます。
+			void onFinished(std::function<void()> f)
+			{
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+
+					if (!m_finished)
+					{
+						m_continuations.push_back(std::move(f));
+
+						return;
+					}
+				}
+
+				f();
+			}
+
+			void finish()
+			{
+				std::vector<std::function<void()>> continuations;
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+
+					m_finished = true;
+
+					continuations.swap(m_continuations);
+				}
+
+				for (auto& continuation : continuations)
+				{
+					continuation();
+				}
+			}
+		};
+
+		void ScheduleConcurrentTask(std::function<void()> job, TaskPriority priority);
+
+		[[nodiscard]] bool IsConcurrentTaskWorker();
+
+		bool RunPendingConcurrentTask();
+
+		ConcurrentTaskControl* ExchangeCurrentConcurrentTask(ConcurrentTaskControl* control) noexcept;
+
+		template <class Type, class Work>
+		class ConcurrentTaskJob
+		{
+		private:
+
+			std::shared_ptr<ConcurrentTaskControl> m_control;
+
+			std::promise<Type> m_promise;
+
+			Work m_work;
+
+			void invoke()
+			{
+				if constexpr (std::is_void_v<Type>)
+				{
+					m_work();
+
+					m_promise.set_value();
+				}
+				else
+				{
+					m_promise.set_value(m_work());
+				}
+			}
+
+		public:
+
+			ConcurrentTaskJob(std::shared_ptr<ConcurrentTaskControl> control, Work&& work)
+				: m_control(std::move(control))
+				, m_work(std::move(work)) {}
+
+			[[nodiscard]] std::future<Type> getFuture()
+			{
+				return m_promise.get_future();
+			}
+
+			void run()
+			{
+				if (m_control->isCancellationRequested())
+				{
+					m_promise.set_exception(std::make_exception_ptr(ConcurrentTaskCanceled()));
+				}
+				else
+				{
+					ConcurrentTaskControl* const previous = ExchangeCurrentConcurrentTask(m_control.get());
+
+					try
+					{
+						invoke();
+					}
+					catch (...)
+					{
+						m_promise.set_exception(std::current_exception());
+					}
+
+					ExchangeCurrentConcurrentTask(previous);
+				}
+
+				m_control->finish();
+			}
+		};
+
+		template <class Type, class Work>
+		[[nodiscard]] inline auto MakeConcurrentTaskJob(std::shared_ptr<ConcurrentTaskControl> control, Work&& work)
+		{
+			return std::make_shared<ConcurrentTaskJob<Type, std::decay_t<Work>>>(std::move(control), std::forward<Work>(work));
+		}
+
+		template <class Job>
+		inline void ScheduleConcurrentTaskJob(const std::shared_ptr<Job>& job, const TaskPriority priority)
+		{
+			ScheduleConcurrentTask([job]() { job->run(); }, priority);
+		}
+
+		struct ConcurrentTaskAccess;
+
+		template <class Type, class Fty>
+		using ContinuationResult_t = typename std::conditional_t<std::is_void_v<Type>, std::invoke_result<Fty>, std::invoke_result<Fty, Type>>::type;
+
+		template <class Type>
+		struct WhenAllResult
+		{
+			using type = Array<Type>;
+		};
+
+		template <>
+		struct WhenAllResult<void>
+		{
+			using type = void;
+		};
+
+		template <class Type>
+		struct WhenAnyResult
+		{
+			using type = std::pair<size_t, Type>;
+		};
+
+		template <>
+		struct WhenAnyResult<void>
+		{
+			using type = size_t;
+		};
+	}
+
+	/// <summary>
+	/// エンジンのスレッドプールで非同期に実行されるタスク
+	/// </summary>
+	/// <remarks>
+	/// then() による継続、WhenAll() / WhenAny() による待ち合わせ、
+	/// cancel() による協調的なキャンセル、TaskPriority による優先度の指定に対応します。
+	/// </remarks>
 	template <class Type>
 	class ConcurrentTask : protected std::future<Type>
 	{
 	private:
 
+		template <class> friend class ConcurrentTask;
+
+		friend struct detail::ConcurrentTaskAccess;
+
 		using base_type = std::future<Type>;
 
+		std::shared_ptr<detail::ConcurrentTaskControl> m_control;
+
+		ConcurrentTask(base_type&& future, std::shared_ptr<detail::ConcurrentTaskControl> control)
+			: base_type(std::move(future))
+			, m_control(std::move(control)) {}
+
+		[[nodiscard]] base_type& future() noexcept
+		{
+			return *this;
+		}
+
 	public:
 
-		using base_type::operator=;
-		using base_type::get;
 		using base_type::valid;
-		using base_type::wait;
 		using base_type::wait_for;
 		using base_type::wait_until;
 		using base_type::share;
 
 		ConcurrentTask() = default;
 
-		template <class Fty, class... Args>
+		ConcurrentTask(ConcurrentTask&&) = default;
+
+		/// <summary>
+		/// 実行中のタスクを上書きする場合は、その完了を待ってから置き換えます。
+		/// </summary>
+		ConcurrentTask& operator =(ConcurrentTask&& other)
+		{
+			if (this != &other)
+			{
+				if (valid())
+				{
+					wait();
+				}
+
+				future() = std::move(other.future());
+
+				m_control = std::move(other.m_control);
+			}
+
+			return *this;
+		}
+
+		/// <summary>
+		/// デストラクタ
+		/// </summary>
+		/// <remarks>
+		/// std::async と同様に、実行中のタスクの完了を待ちます。
+		/// </remarks>
+		~ConcurrentTask()
+		{
+			if (valid())
+			{
+				wait();
+			}
+		}
+
+		template <class Fty, class... Args, std::enable_if_t<!std::is_same_v<std::decay_t<Fty>, TaskPriority>>* = nullptr>
 		ConcurrentTask(Fty&& f, Args&&... args)
-			: std::future<Type>(std::async(std::launch::async, std::forward<Fty>(f), std::forward<Args>(args)...)) {}
+			: ConcurrentTask(TaskPriority::Normal, std::forward<Fty>(f), std::forward<Args>(args)...) {}
+
+		template <class Fty, class... Args>
+		ConcurrentTask(const TaskPriority priority, Fty&& f, Args&&... args)
+		{
+			m_control = std::make_shared<detail::ConcurrentTaskControl>(std::make_shared<std::atomic<bool>>(false));
+
+			auto job = detail::MakeConcurrentTaskJob<Type>(m_control,
+				[f = std::decay_t<Fty>(std::forward<Fty>(f)), args = std::make_tuple(std::forward<Args>(args)...)]() mutable
+			{
+				return std::apply(std::move(f), std::move(args));
+			});
+
+			future() = job->getFuture();
+
+			detail::ScheduleConcurrentTaskJob(job, priority);
+		}
+
+		/// <summary>
+		/// タスクの完了を待ちます。
+		/// </summary>
+		/// <remarks>
+		/// スレッドプールのワーカースレッドから呼ばれた場合は、待っている間に他のタスクを実行します。
+		/// </remarks>
+		void wait() const
+		{
+			if (!detail::IsConcurrentTaskWorker())
+			{
+				base_type::wait();
+
+				return;
+			}
+
+			while (!is_done())
+			{
+				if (!detail::RunPendingConcurrentTask())
+				{
+					base_type::wait_for(std::chrono::milliseconds(1));
+				}
+			}
+		}
+
+		/// <summary>
+		/// タスクの完了を待ち、結果を取得します。
+		/// </summary>
+		/// <returns>
+		/// タスクの結果
+		/// </returns>
+		Type get()
+		{
+			wait();
+
+			return base_type::get();
+		}
 
 		[[nodiscard]] bool is_done() const
 		{
 		# if defined(SIV3D_TARGET_WINDOWS)
 
-			return _Is_ready();
+			return base_type::_Is_ready();
 
 		# else
 
-			return wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+			return base_type::wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+
+		# endif
+		}
+
+		/// <summary>
+		/// タスクのキャンセルを要求します。
+		/// </summary>
+		/// <remarks>
+		/// まだ開始していないタスクは実行されず、get() は ConcurrentTaskCanceled を送出します。
+		/// 実行中のタスクは Threading::IsCancellationRequested() で要求を確認できます。
+		/// then() で作成した継続タスクともキャンセル要求を共有します。
+		/// </remarks>
+		void cancel() noexcept
+		{
+			if (m_control)
+			{
+				m_control->requestCancellation();
+			}
+		}
+
+		/// <summary>
+		/// タスクのキャンセルが要求されているかを返します。
+		/// </summary>
+		/// <returns>
+		/// キャンセルが要求されている場合 true, それ以外の場合は false
+		/// </returns>
+		[[nodiscard]] bool isCancellationRequested() const noexcept
+		{
+			return m_control && m_control->isCancellationRequested();
+		}
+
+		/// <summary>
+		/// タスクが完了したら、その結果を引数に f を実行するタスクを作成します。
+		/// </summary>
+		/// <param name="f">
+		/// 継続して実行する関数
+		/// </param>
+		/// <param name="priority">
+		/// 継続タスクの優先度
+		/// </param>
+		/// <remarks>
+		/// このタスクの結果は継続タスクに移るため、呼び出し後 valid() は false になります。
+		/// このタスクが例外で終了した場合、f は実行されずに例外が継続タスクに伝わります。
+		/// </remarks>
+		/// <returns>
+		/// 継続タスク
+		/// </returns>
+		template <class Fty>
+		[[nodiscard]] ConcurrentTask<detail::ContinuationResult_t<Type, Fty>> then(Fty&& f, const TaskPriority priority = TaskPriority::Normal)
+		{
+			using Result = detail::ContinuationResult_t<Type, Fty>;
+
+			if (!valid())
+			{
+				throw std::future_error(std::future_errc::no_state);
+			}
+
+			auto control = std::make_shared<detail::ConcurrentTaskControl>(m_control->getCancellationFlag());
 
-		# endif	
+			auto job = detail::MakeConcurrentTaskJob<Result>(control,
+				[f = std::decay_t<Fty>(std::forward<Fty>(f)), antecedent = std::move(future())]() mutable
+			{
+				if constexpr (std::is_void_v<Type>)
+				{
+					antecedent.get();
+
+					return f();
+				}
+				else
+				{
+					return f(antecedent.get());
+				}
+			});
+
+			ConcurrentTask<Result> continuation(job->getFuture(), std::move(control));
+
+			std::exchange(m_control, nullptr)->onFinished([job, priority]()
+			{
+				detail::ScheduleConcurrentTaskJob(job, priority);
+			});
+
+			return continuation;
 		}
 	};
 
-	template <class Fty, class... Args>
+	namespace detail
+	{
+		struct ConcurrentTaskAccess
+		{
+			template <class Type>
+			[[nodiscard]] static ConcurrentTask<Type> Make(std::future<Type>&& future, std::shared_ptr<ConcurrentTaskControl> control)
+			{
+				return ConcurrentTask<Type>(std::move(future), std::move(control));
+			}
+
+			template <class Type>
+			[[nodiscard]] static std::future<Type>& Future(ConcurrentTask<Type>& task) noexcept
+			{
+				return task.future();
+			}
+
+			template <class Type>
+			[[nodiscard]] static std::shared_ptr<ConcurrentTaskControl> ReleaseControl(ConcurrentTask<Type>& task) noexcept
+			{
+				return std::exchange(task.m_control, nullptr);
+			}
+		};
+	}
+
+	/// <summary>
+	/// ConcurrentTask を作成します。
+	/// </summary>
+	template <class Fty, class... Args, std::enable_if_t<!std::is_same_v<std::decay_t<Fty>, TaskPriority>>* = nullptr>
 	[[nodiscard]] inline auto CreateConcurrentTask(Fty&& f, Args&&... args)
 	{
 		return ConcurrentTask<std::result_of_t<std::decay_t<Fty>(std::decay_t<Args>...)>>(std::forward<Fty>(f), std::forward<Args>(args)...);
 	}
+
+	/// <summary>
+	/// 優先度を指定して ConcurrentTask を作成します。
+	/// </summary>
+	template <class Fty, class... Args>
+	[[nodiscard]] inline auto CreateConcurrentTask(const TaskPriority priority, Fty&& f, Args&&... args)
+	{
+		return ConcurrentTask<std::result_of_t<std::decay_t<Fty>(std::decay_t<Args>...)>>(priority, std::forward<Fty>(f), std::forward<Args>(args)...);
+	}
+
+	/// <summary>
+	/// すべてのタスクが完了したら完了するタスクを作成します。
+	/// </summary>
+	/// <param name="tasks">
+	/// 待ち合わせるタスク（すべて valid() であること）
+	/// </param>
+	/// <param name="priority">
+	/// 作成するタスクの優先度
+	/// </param>
+	/// <returns>
+	/// 各タスクの結果を順に格納した配列を返すタスク（Type が void の場合は ConcurrentTask&lt;void&gt;）
+	/// </returns>
+	template <class Type>
+	[[nodiscard]] auto WhenAll(Array<ConcurrentTask<Type>> tasks, const TaskPriority priority = TaskPriority::Normal)
+	{
+		using Result = typename detail::WhenAllResult<Type>::type;
+
+		if (!tasks.all([](const ConcurrentTask<Type>& task) { return task.valid(); }))
+		{
+			throw std::invalid_argument("WhenAll() requires valid tasks");
+		}
+
+		struct State
+		{
+			Array<std::future<Type>> futures;
+
+			std::atomic<size_t> remaining = { 0 };
+		};
+
+		auto state = std::make_shared<State>();
+
+		auto control = std::make_shared<detail::ConcurrentTaskControl>(std::make_shared<std::atomic<bool>>(false));
+
+		auto job = detail::MakeConcurrentTaskJob<Result>(control, [state]()
+		{
+			if constexpr (std::is_void_v<Type>)
+			{
+				for (auto& future : state->futures)
+				{
+					future.get();
+				}
+			}
+			else
+			{
+				Array<Type> results;
+
+				results.reserve(state->futures.size());
+
+				for (auto& future : state->futures)
+				{
+					results.push_back(future.get());
+				}
+
+				return results;
+			}
+		});
+
+		auto result = detail::ConcurrentTaskAccess::Make(job->getFuture(), control);
+
+		if (tasks.isEmpty())
+		{
+			detail::ScheduleConcurrentTaskJob(job, priority);
+
+			return result;
+		}
+
+		state->remaining = tasks.size();
+
+		for (auto& task : tasks)
+		{
+			state->futures.push_back(std::move(detail::ConcurrentTaskAccess::Future(task)));
+		}
+
+		for (auto& task : tasks)
+		{
+			detail::ConcurrentTaskAccess::ReleaseControl(task)->onFinished([state, job, priority]()
+			{
+				if (--state->remaining == 0)
+				{
+					detail::ScheduleConcurrentTaskJob(job, priority);
+				}
+			});
+		}
+
+		return result;
+	}
+
+	/// <summary>
+	/// いずれかのタスクが完了したら完了するタスクを作成します。
+	/// </summary>
+	/// <param name="tasks">
+	/// 待ち合わせるタスク（1 つ以上、すべて valid() であること）
+	/// </param>
+	/// <param name="priority">
+	/// 作成するタスクの優先度
+	/// </param>
+	/// <returns>
+	/// 最初に完了したタスクのインデックスと結果のペアを返すタスク（Type が void の場合はインデックスのみ）
+	/// </returns>
+	template <class Type>
+	[[nodiscard]] auto WhenAny(Array<ConcurrentTask<Type>> tasks, const TaskPriority priority = TaskPriority::Normal)
+	{
+		using Result = typename detail::WhenAnyResult<Type>::type;
+
+		if (tasks.isEmpty())
+		{
+			throw std::invalid_argument("WhenAny() requires at least one task");
+		}
+
+		if (!tasks.all([](const ConcurrentTask<Type>& task) { return task.valid(); }))
+		{
+			throw std::invalid_argument("WhenAny() requires valid tasks");
+		}
+
+		struct State
+		{
+			Array<std::future<Type>> futures;
+
+			std::atomic<bool> finished = { false };
+
+			size_t index = 0;
+		};
+
+		auto state = std::make_shared<State>();
+
+		auto control = std::make_shared<detail::ConcurrentTaskControl>(std::make_shared<std::atomic<bool>>(false));
+
+		auto job = detail::MakeConcurrentTaskJob<Result>(control, [state]()
+		{
+			const size_t index = state->index;
+
+			if constexpr (std::is_void_v<Type>)
+			{
+				state->futures[index].get();
+
+				return index;
+			}
+			else
+			{
+				return std::make_pair(index, state->futures[index].get());
+			}
+		});
+
+		auto result = detail::ConcurrentTaskAccess::Make(job->getFuture(), control);
+
+		for (auto& task : tasks)
+		{
+			state->futures.push_back(std::move(detail::ConcurrentTaskAccess::Future(task)));
+		}
+
+		for (size_t i = 0; i < tasks.size(); ++i)
+		{
+			detail::ConcurrentTaskAccess::ReleaseControl(tasks[i])->onFinished([state, job, priority, i]()
+			{
+				if (!state->finished.exchange(true))
+				{
+					state->index = i;
+
+					detail::ScheduleConcurrentTaskJob(job, priority);
+				}
+			});
+		}
+
+		return result;
+	}
+
+	namespace Threading
+	{
+		/// <summary>
+		/// 現在のスレッドで実行中の ConcurrentTask にキャンセルが要求されているかを返します。
+		/// </summary>
+		/// <returns>
+		/// キャンセルが要求されている場合 true, それ以外の場合は false
+		/// </returns>
+		[[nodiscard]] bool IsCancellationRequested() noexcept;
+	}
 }
@@ -0,0 +1,197 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Fwd.hpp"
+# include "Array.hpp"
+# include "Color.hpp"
+
+namespace s3d
+{
+	struct DrawList2DData;
+
+	/// <summary>
+	/// 任意のスレッドで記録できる 2D 描画のリスト
+	/// </summary>
+	/// <remarks>
+	/// 頂点の生成は記録したスレッドで行われ、draw() したときには記録済みの頂点がそのまま描画に使われます。
+	/// 異なる DrawList2D には、異なるスレッドから同時に記録できます。
+	/// 1 つの DrawList2D を複数のスレッドから同時に変更することはできません。
+	/// draw() と Graphics2D::DrawLists() はメインスレッドから呼ぶ必要があります。
+	/// DrawList2D のコピーは内容を共有し、どちらかを変更したときに初めて内容が複製されます。
+	/// </remarks>
+	class DrawList2D
+	{
+	private:
+
+		std::shared_ptr<DrawList2DData> pImpl;
+
+		// 変更の前に、内容を他と共有していれば複製する
+		DrawList2DData& mutableData();
+
+	public:
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		DrawList2D();
+
+		/// <summary>
+		/// 空の描画リストを作成します。
+		/// </summary>
+		/// <param name="layer">
+		/// Graphics2D::DrawLists() で描画リストを並べ替えるときのキー
+		/// </param>
+		explicit DrawList2D(int32 layer);
+
+		/// <summary>
+		/// 描画リストのレイヤーを返します。
+		/// </summary>
+		/// <returns>
+		/// 描画リストのレイヤー
+		/// </returns>
+		[[nodiscard]] int32 layer() const;
+
+		/// <summary>
+		/// 描画リストのレイヤーを設定します。
+		/// </summary>
+		/// <param name="layer">
+		/// Graphics2D::DrawLists() で描画リストを並べ替えるときのキー
+		/// </param>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void setLayer(int32 layer);
+
+		/// <summary>
+		/// 記録した内容を消去します。
+		/// </summary>
+		/// <remarks>
+		/// 確保したメモリは再利用されます。
+		/// </remarks>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void clear();
+
+		/// <summary>
+		/// 描画リストが空であるかを返します。
+		/// </summary>
+		/// <returns>
+		/// 描画リストが空の場合 true, それ以外の場合は false
+		/// </returns>
+		[[nodiscard]] bool isEmpty() const;
+
+		/// <summary>
+		/// 記録した頂点の数を返します。
+		/// </summary>
+		/// <returns>
+		/// 頂点の数
+		/// </returns>
+		[[nodiscard]] size_t num_vertices() const;
+
+		/// <summary>
+		/// 記録した三角形の数を返します。
+		/// </summary>
+		/// <returns>
+		/// 三角形の数
+		/// </returns>
+		[[nodiscard]] size_t num_triangles() const;
+
+		/// <summary>
+		/// 三角形を記録します。
+		/// </summary>
+		/// <param name="triangle">
+		/// 三角形
+		/// </param>
+		/// <param name="color">
+		/// 色
+		/// </param>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void addTriangle(const Triangle& triangle, const ColorF& color);
+
+		/// <summary>
+		/// 長方形を記録します。
+		/// </summary>
+		/// <param name="rect">
+		/// 長方形
+		/// </param>
+		/// <param name="color">
+		/// 色
+		/// </param>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void addRect(const RectF& rect, const ColorF& color);
+
+		/// <summary>
+		/// 円を記録します。
+		/// </summary>
+		/// <param name="circle">
+		/// 円
+		/// </param>
+		/// <param name="color">
+		/// 色
+		/// </param>
+		/// <remarks>
+		/// 円の分割数は、座標変換による拡大を考慮せずに半径から決まります。
+		/// </remarks>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void addCircle(const Circle& circle, const ColorF& color);
+
+		/// <summary>
+		/// テクスチャの領域を記録します。
+		/// </summary>
+		/// <param name="region">
+		/// テクスチャの領域
+		/// </param>
+		/// <param name="pos">
+		/// 描画を開始する座標
+		/// </param>
+		/// <param name="color">
+		/// 乗算する色
+		/// </param>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void addTextureRegion(const TextureRegion& region, const Vec2& pos, const ColorF& color = ColorF(1.0));
+
+		/// <summary>
+		/// 記録した内容を、現在の 2D 描画の設定で描画します。
+		/// </summary>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void draw() const;
+	};
+
+	namespace Graphics2D
+	{
+		/// <summary>
+		/// 複数の描画リストを、レイヤーの小さい順に描画します。
+		/// </summary>
+		/// <param name="lists">
+		/// 描画リストの配列
+		/// </param>
+		/// <remarks>
+		/// 同じレイヤーの描画リストは配列の順に描画されるため、記録したスレッドや完了した順序によらず結果は同じになります。
+		/// </remarks>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void DrawLists(const Array<DrawList2D>& lists);
+	}
+}
@@ -58,5 +58,22 @@ namespace s3d
 		bool fill(const Image& image);
 
 		bool tryFill(const Image& image);
+
+		/// <summary>
+		/// 動的テクスチャの中身のうち、指定した範囲だけを同じ大きさの画像で更新します。
+		/// </summary>
+		/// <param name="image">
+		/// 動的テクスチャと同じ大きさの画像
+		/// </param>
+		/// <param name="rect">
+		/// 更新する範囲
+		/// </param>
+		/// <remarks>
+		/// 画像の rect の範囲が、動的テクスチャの同じ位置に転送されます。
+		/// </remarks>
+		/// <returns>
+		/// 動的テクスチャの更新に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool fillRegion(const Image& image, const Rect& rect);
 	};
 }
@@ -0,0 +1,234 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Fwd.hpp"
+# include "Array.hpp"
+# include "String.hpp"
+# include "Compression.hpp"
+
+namespace s3d
+{
+	/// <summary>
+	/// 複数のファイルを 1 つにまとめたアーカイブファイル
+	/// </summary>
+	/// <remarks>
+	/// アーカイブはメモリマップトファイルとして開かれ、各ファイルへは XXHash による索引でアクセスします。
+	/// Mount() したアーカイブ内のファイルは、Image, Wave, Texture, Font などのコンストラクタに
+	/// アーカイブ内のパスを渡すだけで読み込めます。
+	/// </remarks>
+	class FileArchive
+	{
+	private:
+
+		class CFileArchive;
+
+		std::shared_ptr<CFileArchive> pImpl;
+
+		friend class ArchivedFileReader;
+
+	public:
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		FileArchive();
+
+		/// <summary>
+		/// アーカイブファイルを開きます。
+		/// </summary>
+		/// <param name="path">
+		/// アーカイブファイルのパス
+		/// </param>
+		explicit FileArchive(const FilePath& path)
+			: FileArchive()
+		{
+			open(path);
+		}
+
+		/// <summary>
+		/// アーカイブファイルを開きます。
+		/// </summary>
+		/// <param name="path">
+		/// アーカイブファイルのパス
+		/// </param>
+		/// <returns>
+		/// アーカイブファイルのオープンに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool open(const FilePath& path);
+
+		/// <summary>
+		/// アーカイブファイルを閉じます。
+		/// </summary>
+		/// <remarks>
+		/// アーカイブがマウントされている場合は、マウントも解除されます。
+		/// 開かれている ArchivedFileReader は、閉じられるまで引き続き使用できます。
+		/// </remarks>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void close();
+
+		/// <summary>
+		/// アーカイブファイルが開いているかを返します。
+		/// </summary>
+		/// <returns>
+		/// アーカイブファイルが開いている場合 true, それ以外の場合は false
+		/// </returns>
+		[[nodiscard]] bool isOpened() const;
+
+		/// <summary>
+		/// アーカイブファイルが開いているかを返します。
+		/// </summary>
+		/// <returns>
+		/// アーカイブファイルが開いている場合 true, それ以外の場合は false
+		/// </returns>
+		[[nodiscard]] explicit operator bool() const
+		{
+			return isOpened();
+		}
+
+		/// <summary>
+		/// アーカイブに含まれるファイルの数を返します。
+		/// </summary>
+		/// <returns>
+		/// ファイルの数
+		/// </returns>
+		[[nodiscard]] size_t num_files() const;
+
+		/// <summary>
+		/// アーカイブに含まれるファイルのパスの一覧を返します。
+		/// </summary>
+		/// <returns>
+		/// アーカイブ内のファイルのパスの一覧
+		/// </returns>
+		[[nodiscard]] Array<FilePath> files() const;
+
+		/// <summary>
+		/// アーカイブに指定したファイルが含まれているかを返します。
+		/// </summary>
+		/// <param name="path">
+		/// アーカイブ内のファイルのパス
+		/// </param>
+		/// <returns>
+		/// ファイルが含まれている場合 true, それ以外の場合は false
+		/// </returns>
+		[[nodiscard]] bool contains(const FilePath& path) const;
+
+		/// <summary>
+		/// アーカイブ内のファイルの展開後のサイズを返します。
+		/// </summary>
+		/// <param name="path">
+		/// アーカイブ内のファイルのパス
+		/// </param>
+		/// <returns>
+		/// ファイルのサイズ（バイト）, ファイルが含まれていない場合は 0
+		/// </returns>
+		[[nodiscard]] int64 fileSize(const FilePath& path) const;
+
+		/// <summary>
+		/// アーカイブファイルのフルパスを返します。
+		/// </summary>
+		/// <returns>
+		/// アーカイブファイルのフルパス
+		/// </returns>
+		[[nodiscard]] const FilePath& path() const;
+
+		/// <summary>
+		/// ディレクトリ内のすべてのファイルからアーカイブファイルを作成します。
+		/// </summary>
+		/// <param name="archivePath">
+		/// 作成するアーカイブファイルのパス
+		/// </param>
+		/// <param name="directory">
+		/// アーカイブにまとめるディレクトリ。アーカイブ内のパスはこのディレクトリからの相対パスになります
+		/// </param>
+		/// <param name="compressionLevel">
+		/// 各ファイルの圧縮レベル。0 の場合は圧縮しません
+		/// </param>
+		/// <remarks>
+		/// 圧縮してもサイズがほとんど小さくならないファイルや、PNG や MP3 などの圧縮済みの形式は圧縮せずに格納します。
+		/// </remarks>
+		/// <returns>
+		/// 作成に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		static bool Build(const FilePath& archivePath, const FilePath& directory, int32 compressionLevel = Compression::DefaultCompressionLevel);
+
+		/// <summary>
+		/// ファイルの一覧からアーカイブファイルを作成します。
+		/// </summary>
+		/// <param name="archivePath">
+		/// 作成するアーカイブファイルのパス
+		/// </param>
+		/// <param name="files">
+		/// アーカイブにまとめるファイルの一覧
+		/// </param>
+		/// <param name="baseDirectory">
+		/// アーカイブ内のパスの基準となるディレクトリ
+		/// </param>
+		/// <param name="compressionLevel">
+		/// 各ファイルの圧縮レベル。0 の場合は圧縮しません
+		/// </param>
+		/// <returns>
+		/// 作成に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		static bool Build(const FilePath& archivePath, const Array<FilePath>& files, const FilePath& baseDirectory, int32 compressionLevel = Compression::DefaultCompressionLevel);
+
+		/// <summary>
+		/// アーカイブをマウントします。
+		/// </summary>
+		/// <param name="archive">
+		/// アーカイブ
+		/// </param>
+		/// <remarks>
+		/// マウントしたアーカイブ内のファイルは、同じパスのディスク上のファイルよりも優先して読み込まれます。
+		/// 複数のアーカイブが同じパスを含む場合、後からマウントしたアーカイブが優先されます。
+		/// </remarks>
+		/// <returns>
+		/// マウントに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		static bool Mount(const FileArchive& archive);
+
+		/// <summary>
+		/// アーカイブファイルを開いてマウントします。
+		/// </summary>
+		/// <param name="archivePath">
+		/// アーカイブファイルのパス
+		/// </param>
+		/// <returns>
+		/// マウントに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		static bool Mount(const FilePath& archivePath)
+		{
+			return Mount(FileArchive(archivePath));
+		}
+
+		/// <summary>
+		/// アーカイブのマウントを解除します。
+		/// </summary>
+		/// <param name="archivePath">
+		/// アーカイブファイルのパス
+		/// </param>
+		/// <returns>
+		/// なし
+		/// </returns>
+		static void Unmount(const FilePath& archivePath);
+
+		/// <summary>
+		/// すべてのアーカイブのマウントを解除します。
+		/// </summary>
+		/// <returns>
+		/// なし
+		/// </returns>
+		static void UnmountAll();
+	};
+}
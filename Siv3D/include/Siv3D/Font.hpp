@@ -65,6 +65,22 @@ namespace s3d
 		BoldItalicBitmap = Bold | Italic | Bitmap,
 	};
 
+	/// <summary>
+	///	フォントのグリフの描画方式
+	/// </summary>
+	enum class FontMethod
+	{
+		/// <summary>
+		///	フォントサイズのビットマップ
+		/// </summary>
+		Bitmap,
+
+		/// <summary>
+		///	Signed Distance Field. 1 つのグリフアトラスを任意の大きさで描画できます
+		/// </summary>
+		SDF,
+	};
+
 	struct Glyph
 	{
 		TextureRegion texture;
@@ -111,6 +127,44 @@ namespace s3d
 
 		Font(int32 fontSize, const FilePath& path, FontStyle style = FontStyle::Default);
 
+		/// <summary>
+		/// 描画方式を指定してフォントを作成します。
+		/// </summary>
+		/// <param name="method">
+		/// グリフの描画方式
+		/// </param>
+		/// <param name="fontSize">
+		/// フォントサイズ。FontMethod::SDF の場合はグリフアトラスを作成する基準の大きさです
+		/// </param>
+		/// <param name="typeface">
+		/// タイプフェイス
+		/// </param>
+		/// <param name="style">
+		/// フォントスタイル
+		/// </param>
+		/// <remarks>
+		/// FontMethod::SDF のグリフはアウトラインからワーカースレッドで生成されます。
+		/// DrawableText::draw(double, const Vec2&, const ColorF&) で、任意の大きさで描画できます。
+		/// </remarks>
+		Font(FontMethod method, int32 fontSize, Typeface typeface = Typeface::Default, FontStyle style = FontStyle::Default);
+
+		/// <summary>
+		/// 描画方式を指定してフォントを作成します。
+		/// </summary>
+		/// <param name="method">
+		/// グリフの描画方式
+		/// </param>
+		/// <param name="fontSize">
+		/// フォントサイズ。FontMethod::SDF の場合はグリフアトラスを作成する基準の大きさです
+		/// </param>
+		/// <param name="path">
+		/// フォントファイルのパス
+		/// </param>
+		/// <param name="style">
+		/// フォントスタイル
+		/// </param>
+		Font(FontMethod method, int32 fontSize, const FilePath& path, FontStyle style = FontStyle::Default);
+
 		virtual ~Font();
 
 		void release();
@@ -134,6 +188,14 @@ namespace s3d
 
 		[[nodiscard]] int32 fontSize() const;
 
+		/// <summary>
+		/// グリフの描画方式を返します。
+		/// </summary>
+		/// <returns>
+		/// グリフの描画方式
+		/// </returns>
+		[[nodiscard]] FontMethod method() const;
+
 		[[nodiscard]] int32 ascent() const;
 
 		[[nodiscard]] int32 descent() const;
@@ -142,12 +204,90 @@ namespace s3d
 
 		[[nodiscard]] Glyph getGlyph(char32 codePoint) const;
 
+		/// <summary>
+		/// 文字列の各文字のグリフを返します。
+		/// </summary>
+		/// <param name="text">
+		/// 文字列
+		/// </param>
+		/// <remarks>
+		/// グリフのテクスチャはフォントのグリフアトラスの一部です。
+		/// しばらく使われていないグリフはアトラスから追い出されるため、テクスチャは取得したフレームの間だけ使用してください。
+		/// </remarks>
+		/// <returns>
+		/// 各文字のグリフ
+		/// </returns>
 		[[nodiscard]] Array<Glyph> getGlyphs(const String& text) const;
 
 		[[nodiscard]] Array<Glyph> getVerticalGlyphs(const String& text) const;
 
 		[[nodiscard]] OutlineGlyph getOutlineGlyph(char32 codePoint) const;
 
+		/// <summary>
+		/// 文字列のレイアウトのキャッシュが使うメモリの上限を設定します。
+		/// </summary>
+		/// <param name="bytes">
+		/// 上限（バイト）。0 の場合はキャッシュを無効にします
+		/// </param>
+		/// <remarks>
+		/// 2 回以上使われた文字列のグリフの配置と領域はフォントごとにキャッシュされ、
+		/// 以降の DrawableText::draw(), region(), boundingRect(), getXAdvances() で再利用されます。
+		/// 上限を超えると、長い間使われていないものから破棄されます。デフォルトの上限は 1 MiB です。
+		/// </remarks>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void setLayoutCacheBudget(size_t bytes) const;
+
+		/// <summary>
+		/// 文字列のレイアウトのキャッシュが使っているメモリを返します。
+		/// </summary>
+		/// <returns>
+		/// キャッシュが使っているメモリ（バイト）
+		/// </returns>
+		[[nodiscard]] size_t layoutCacheBytes() const;
+
+		/// <summary>
+		/// 文字列のレイアウトのキャッシュを消去します。
+		/// </summary>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void clearLayoutCache() const;
+
+		/// <summary>
+		/// 文字の SDF グリフを生成し、事前生成済みのグリフアトラスとしてファイルに保存します。
+		/// </summary>
+		/// <param name="path">
+		/// 保存するファイルのパス
+		/// </param>
+		/// <param name="text">
+		/// 保存する文字
+		/// </param>
+		/// <remarks>
+		/// FontMethod::SDF のフォントでのみ使用できます。
+		/// 保存したファイルを loadSDFAtlas() で読み込むと、起動時のグリフの生成を省略できます。
+		/// </remarks>
+		/// <returns>
+		/// 保存に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool saveSDFAtlas(const FilePath& path, const String& text) const;
+
+		/// <summary>
+		/// saveSDFAtlas() で保存したグリフアトラスを読み込みます。
+		/// </summary>
+		/// <param name="path">
+		/// ファイルのパス
+		/// </param>
+		/// <remarks>
+		/// 同じフォントファイル、フォントサイズ、スタイルの FontMethod::SDF のフォントでのみ読み込めます。
+		/// ファイルに含まれない文字のグリフは、これまでどおりアウトラインから生成されます。
+		/// </remarks>
+		/// <returns>
+		/// 読み込みに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool loadSDFAtlas(const FilePath& path) const;
+
 		/// <summary>
 		/// 描画するテキストを作成します。
 		/// </summary>
@@ -336,6 +476,20 @@ namespace s3d
 
 		[[nodiscard]] RectF region(const Vec2& pos) const;
 
+		/// <summary>
+		/// 指定した大きさで描画したときのテキストの領域を返します。
+		/// </summary>
+		/// <param name="fontSize">
+		/// 描画するフォントサイズ
+		/// </param>
+		/// <param name="pos">
+		/// 描画する左上の座標
+		/// </param>
+		/// <returns>
+		/// テキストの領域
+		/// </returns>
+		[[nodiscard]] RectF region(double fontSize, const Vec2& pos) const;
+
 		[[nodiscard]] RectF region(Arg::topLeft_<Vec2> topLeft) const
 		{
 			return region(*topLeft);
@@ -402,6 +556,47 @@ namespace s3d
 
 		RectF draw(const Vec2& pos = Vec2(0, 0), const ColorF& color = Palette::White) const;
 
+		/// <summary>
+		/// 大きさを指定してテキストを描画します。
+		/// </summary>
+		/// <param name="fontSize">
+		/// 描画するフォントサイズ
+		/// </param>
+		/// <param name="pos">
+		/// 描画する左上の座標
+		/// </param>
+		/// <param name="color">
+		/// 文字の色
+		/// </param>
+		/// <remarks>
+		/// FontMethod::SDF のフォントは、どの大きさでも輪郭が滑らかに描画されます。
+		/// FontMethod::Bitmap のフォントはビットマップを拡大縮小して描画します。
+		/// </remarks>
+		/// <returns>
+		/// テキストが描画された領域
+		/// </returns>
+		RectF draw(double fontSize, const Vec2& pos, const ColorF& color = Palette::White) const;
+
+		/// <summary>
+		/// 大きさを指定して、中心座標を基準にテキストを描画します。
+		/// </summary>
+		/// <param name="fontSize">
+		/// 描画するフォントサイズ
+		/// </param>
+		/// <param name="pos">
+		/// 描画する中心座標
+		/// </param>
+		/// <param name="color">
+		/// 文字の色
+		/// </param>
+		/// <returns>
+		/// テキストが描画された領域
+		/// </returns>
+		RectF drawAt(double fontSize, const Vec2& pos, const ColorF& color = Palette::White) const
+		{
+			return draw(fontSize, pos - region(fontSize, Vec2(0, 0)).center(), color);
+		}
+
 		RectF draw(Arg::topLeft_<Vec2> topLeft, const ColorF& color = Palette::White) const
 		{
 			return draw(*topLeft, color);
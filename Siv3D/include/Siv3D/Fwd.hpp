@@ -44,6 +44,7 @@ namespace s3d
 	//	ConcurrentTask.hpp
 	//
 	template <class Type> class ConcurrentTask;
+	enum class TaskPriority;
 
 	//////////////////////////////////////////////////////
 	//
@@ -254,6 +255,8 @@ namespace s3d
 	//
 	//	BinaryReader.hpp
 	//
+	enum class ReadAccessHint;
+	struct BinaryReadRequest;
 	class BinaryReader;
 
 	//////////////////////////////////////////////////////
@@ -298,6 +301,34 @@ namespace s3d
 	//
 	enum class OutputLevel;
 	enum class LogDescription;
+	enum class LogOverflowPolicy;
+
+	//////////////////////////////////////////////////////
+	//
+	//	LogSink.hpp
+	//
+	struct LogEntry;
+	class ILogSink;
+
+	//////////////////////////////////////////////////////
+	//
+	//	Compressor.hpp
+	//
+	class CompressionDictionary;
+	class Compressor;
+	class Decompressor;
+
+	//////////////////////////////////////////////////////
+	//
+	//	ArchivedFileReader.hpp
+	//
+	class ArchivedFileReader;
+
+	//////////////////////////////////////////////////////
+	//
+	//	FileArchive.hpp
+	//
+	class FileArchive;
 
 	//////////////////////////////////////////////////////
 	//
@@ -305,6 +336,12 @@ namespace s3d
 	//
 	class CSVData;
 
+	//////////////////////////////////////////////////////
+	//
+	//	CSVReader.hpp
+	//
+	class CSVReader;
+
 	//////////////////////////////////////////////////////
 	//
 	//	INIData.hpp
@@ -323,6 +360,9 @@ namespace s3d
 	class JSONValue;
 	struct JSONObjectMember;
 	class JSONReader;
+	enum class JSONStreamEventType;
+	struct JSONStreamEvent;
+	class JSONStreamReader;
 
 	//////////////////////////////////////////////////////
 	//
@@ -594,6 +634,7 @@ namespace s3d
 	enum class BorderType;
 	enum class FloodFillConnectivity;
 	enum class Interpolation;
+	enum class ImageExecution;
 	enum class HaarCascade;
 	class Image;
 
@@ -603,6 +644,13 @@ namespace s3d
 	//
 	class ImageRegion;
 
+	//////////////////////////////////////////////////////
+	//
+	//	ImageView.hpp
+	//
+	class ImageConstView;
+	class ImageView;
+
 	//////////////////////////////////////////////////////
 	//
 	//	ImageFormat.hpp
@@ -760,6 +808,8 @@ namespace s3d
 	//	Profiler.hpp
 	//
 	struct Statistics;
+	struct ProfileScopeStat;
+	class ProfileScope;
 
 	//////////////////////////////////////////////////////
 	//
@@ -885,6 +935,12 @@ namespace s3d
 	//
 	class Transformer2D;
 
+	//////////////////////////////////////////////////////
+	//
+	//	DrawList2D.hpp
+	//
+	class DrawList2D;
+
 	//////////////////////////////////////////////////////
 	//
 	//	Shader.hpp
@@ -128,5 +128,54 @@ namespace s3d
 		[[nodiscard]] const Mat3x2& GetTransformScreen();
 
 		[[nodiscard]] double GetMaxScaling();
+
+		/// <summary>
+		/// 単色の Rect, Circle と、テクスチャの描画をインスタンス描画で行うかを設定します。
+		/// </summary>
+		/// <param name="enabled">
+		/// インスタンス描画を行う場合 true, 頂点を毎回転送する場合は false
+		/// </param>
+		/// <remarks>
+		/// インスタンス描画では、1 つの図形あたり 48 バイトのデータだけを転送し、頂点は GPU 上で共有のメッシュから生成されます。
+		/// 同じ種類の図形が続く描画は、自動的に 1 回のドローコールにまとめられます。
+		/// 現在は OpenGL 版でのみ有効で、デフォルトで有効です。
+		/// </remarks>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void EnableInstancing(bool enabled = true);
+
+		/// <summary>
+		/// インスタンス描画が有効であるかを返します。
+		/// </summary>
+		/// <returns>
+		/// インスタンス描画が有効な場合 true, それ以外の場合は false
+		/// </returns>
+		[[nodiscard]] bool IsInstancingEnabled();
+
+		/// <summary>
+		/// フレームの描画コマンドを並べ替えて、ドローコールをまとめるかを設定します。
+		/// </summary>
+		/// <param name="enabled">
+		/// 並べ替えを行う場合 true, 描画した順にドローコールを発行する場合は false
+		/// </param>
+		/// <remarks>
+		/// 同じシェーダとテクスチャを使う描画を、重なり合う描画の順序を変えない範囲で 1 回のドローコールにまとめます。
+		/// ブレンドステートやシザー矩形、座標変換などの変更をまたいだ並べ替えは行いません。
+		/// 削減したドローコールの数は Profiler::GetStatistics() の savedDrawcalls で確認できます。
+		/// 現在は OpenGL 版でのみ有効で、デフォルトでは無効です。
+		/// </remarks>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void EnableDrawCallSorting(bool enabled = true);
+
+		/// <summary>
+		/// 描画コマンドの並べ替えが有効であるかを返します。
+		/// </summary>
+		/// <returns>
+		/// 描画コマンドの並べ替えが有効な場合 true, それ以外の場合は false
+		/// </returns>
+		[[nodiscard]] bool IsDrawCallSortingEnabled();
 	}
 }
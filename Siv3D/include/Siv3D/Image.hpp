@@ -99,6 +99,27 @@ namespace s3d
 		Unspecified,
 	};
 
+	/// <summary>
+	/// 重い画像処理（ぼかしや拡大縮小など）の実行方法
+	/// </summary>
+	enum class ImageExecution
+	{
+		/// <summary>
+		/// Image::SetDefaultExecution() で設定された方法
+		/// </summary>
+		Default,
+
+		/// <summary>
+		/// 呼び出し元のスレッドだけで処理する
+		/// </summary>
+		Sequential,
+
+		/// <summary>
+		/// 画像を行単位の帯に分割し、スレッドプールで並列に処理する（結果は Sequential と同じ）
+		/// </summary>
+		Parallel,
+	};
+
 	enum class HaarCascade
 	{
 		Face,
@@ -181,6 +202,25 @@ namespace s3d
 
 		static constexpr int32 MaxHeight = 8192;
 
+		/// <summary>
+		/// ImageExecution::Default を指定した処理の実行方法を設定します。
+		/// </summary>
+		/// <param name="execution">
+		/// ImageExecution::Sequential または ImageExecution::Parallel
+		/// </param>
+		/// <remarks>
+		/// デフォルトは ImageExecution::Sequential です。
+		/// </remarks>
+		static void SetDefaultExecution(ImageExecution execution) noexcept;
+
+		/// <summary>
+		/// ImageExecution::Default を指定した処理の実行方法を返します。
+		/// </summary>
+		/// <returns>
+		/// ImageExecution::Sequential または ImageExecution::Parallel
+		/// </returns>
+		[[nodiscard]] static ImageExecution GetDefaultExecution() noexcept;
+
 		using iterator					= Array<Color>::iterator;
 		using const_iterator			= Array<Color>::const_iterator;
 		using reverse_iterator			= Array<Color>::reverse_iterator;
@@ -349,6 +389,14 @@ namespace s3d
 
 		explicit Image(const Grid<Color>& grid);
 
+		/// <summary>
+		/// 画像の領域への参照からピクセルをコピーして画像を作成します。
+		/// </summary>
+		/// <param name="view">
+		/// コピーする領域
+		/// </param>
+		explicit Image(const ImageConstView& view);
+
 		explicit Image(const Grid<ColorF>& grid);
 
 		template <class Type, class Fty>
@@ -953,17 +1001,7 @@ namespace s3d
 			return *this;
 		}
 
-		Image& swapRB()
-		{
-			for (auto& pixel : m_data)
-			{
-				const uint32 t = pixel.r;
-				pixel.r = pixel.b;
-				pixel.b = t;
-			}
-
-			return *this;
-		}
+		Image& swapRB();
 
 		bool applyAlphaFromRChannel(const FilePath& alpha);
 
@@ -1086,9 +1124,9 @@ namespace s3d
 
 		[[nodiscard]] Image flipped() const;
 
-		Image& rotate90();
+		Image& rotate90(ImageExecution execution = ImageExecution::Default);
 
-		[[nodiscard]] Image rotated90() const;
+		[[nodiscard]] Image rotated90(ImageExecution execution = ImageExecution::Default) const;
 
 		Image& rotate180();
 
@@ -1152,65 +1190,65 @@ namespace s3d
 		/// </returns>
 		[[nodiscard]] Image adaptiveThresholded(AdaptiveMethod method, int32 blockSize, double c, bool inverse = false) const;
 
-		Image& mosaic(int32 size);
+		Image& mosaic(int32 size, ImageExecution execution = ImageExecution::Default);
 
-		Image& mosaic(int32 horizontal, int32 vertical);
+		Image& mosaic(int32 horizontal, int32 vertical, ImageExecution execution = ImageExecution::Default);
 
-		[[nodiscard]] Image mosaiced(int32 size) const;
+		[[nodiscard]] Image mosaiced(int32 size, ImageExecution execution = ImageExecution::Default) const;
 
-		[[nodiscard]] Image mosaiced(int32 horizontal, int32 vertical) const;
+		[[nodiscard]] Image mosaiced(int32 horizontal, int32 vertical, ImageExecution execution = ImageExecution::Default) const;
 
-		Image& spread(int32 size);
+		Image& spread(int32 size, ImageExecution execution = ImageExecution::Default);
 
-		Image& spread(int32 horizontal, int32 vertical);
+		Image& spread(int32 horizontal, int32 vertical, ImageExecution execution = ImageExecution::Default);
 
-		[[nodiscard]] Image spreaded(int32 size) const;
+		[[nodiscard]] Image spreaded(int32 size, ImageExecution execution = ImageExecution::Default) const;
 
-		[[nodiscard]] Image spreaded(int32 horizontal, int32 vertical) const;
+		[[nodiscard]] Image spreaded(int32 horizontal, int32 vertical, ImageExecution execution = ImageExecution::Default) const;
 
-		Image& blur(int32 size);
+		Image& blur(int32 size, ImageExecution execution = ImageExecution::Default);
 
-		Image& blur(int32 horizontal, int32 vertical);
+		Image& blur(int32 horizontal, int32 vertical, ImageExecution execution = ImageExecution::Default);
 
-		[[nodiscard]] Image blurred(int32 size) const;
+		[[nodiscard]] Image blurred(int32 size, ImageExecution execution = ImageExecution::Default) const;
 
-		[[nodiscard]] Image blurred(int32 horizontal, int32 vertical) const;
+		[[nodiscard]] Image blurred(int32 horizontal, int32 vertical, ImageExecution execution = ImageExecution::Default) const;
 
-		Image& medianBlur(int32 apertureSize);
+		Image& medianBlur(int32 apertureSize, ImageExecution execution = ImageExecution::Default);
 
-		[[nodiscard]] Image medianBlurred(int32 apertureSize) const;
+		[[nodiscard]] Image medianBlurred(int32 apertureSize, ImageExecution execution = ImageExecution::Default) const;
 
-		Image& gaussianBlur(int32 size, BorderType borderType = BorderType::Default);
+		Image& gaussianBlur(int32 size, BorderType borderType = BorderType::Default, ImageExecution execution = ImageExecution::Default);
 
-		Image& gaussianBlur(int32 horizontal, int32 vertical, BorderType borderType = BorderType::Default);
+		Image& gaussianBlur(int32 horizontal, int32 vertical, BorderType borderType = BorderType::Default, ImageExecution execution = ImageExecution::Default);
 
-		[[nodiscard]] Image gaussianBlurred(int32 size, BorderType borderType = BorderType::Default) const;
+		[[nodiscard]] Image gaussianBlurred(int32 size, BorderType borderType = BorderType::Default, ImageExecution execution = ImageExecution::Default) const;
 
-		[[nodiscard]] Image gaussianBlurred(int32 horizontal, int32 vertical, BorderType borderType = BorderType::Default) const;
+		[[nodiscard]] Image gaussianBlurred(int32 horizontal, int32 vertical, BorderType borderType = BorderType::Default, ImageExecution execution = ImageExecution::Default) const;
 
-		Image& dilate(int32 iterations = 1);
+		Image& dilate(int32 iterations = 1, ImageExecution execution = ImageExecution::Default);
 
-		[[nodiscard]] Image dilated(int32 iterations = 1) const;
+		[[nodiscard]] Image dilated(int32 iterations = 1, ImageExecution execution = ImageExecution::Default) const;
 
-		Image& erode(int32 iterations = 1);
+		Image& erode(int32 iterations = 1, ImageExecution execution = ImageExecution::Default);
 
-		[[nodiscard]] Image eroded(int32 iterations = 1) const;
+		[[nodiscard]] Image eroded(int32 iterations = 1, ImageExecution execution = ImageExecution::Default) const;
 
 		Image& floodFill(const Point& pos, const Color& color, FloodFillConnectivity connectivity = FloodFillConnectivity::Value4, int32 lowerDifference = 0, int32 upperDifference = 0);
 
 		[[nodiscard]] Image floodFilled(const Point& pos, const Color& color, FloodFillConnectivity connectivity = FloodFillConnectivity::Value4, int32 lowerDifference = 0, int32 upperDifference = 0) const;
 
-		Image& scale(int32 width, int32 height, Interpolation interpolation = Interpolation::Unspecified);
+		Image& scale(int32 width, int32 height, Interpolation interpolation = Interpolation::Unspecified, ImageExecution execution = ImageExecution::Default);
 
-		[[nodiscard]] Image scaled(int32 width, int32 height, Interpolation interpolation = Interpolation::Unspecified) const;
+		[[nodiscard]] Image scaled(int32 width, int32 height, Interpolation interpolation = Interpolation::Unspecified, ImageExecution execution = ImageExecution::Default) const;
 
-		Image& scale(const Size& size, Interpolation interpolation = Interpolation::Unspecified);
+		Image& scale(const Size& size, Interpolation interpolation = Interpolation::Unspecified, ImageExecution execution = ImageExecution::Default);
 
-		[[nodiscard]] Image scaled(const Size& size, Interpolation interpolation = Interpolation::Unspecified) const;
+		[[nodiscard]] Image scaled(const Size& size, Interpolation interpolation = Interpolation::Unspecified, ImageExecution execution = ImageExecution::Default) const;
 
-		Image& scale(double scaling, Interpolation interpolation = Interpolation::Unspecified);
+		Image& scale(double scaling, Interpolation interpolation = Interpolation::Unspecified, ImageExecution execution = ImageExecution::Default);
 
-		[[nodiscard]] Image scaled(double scaling, Interpolation interpolation = Interpolation::Unspecified) const;
+		[[nodiscard]] Image scaled(double scaling, Interpolation interpolation = Interpolation::Unspecified, ImageExecution execution = ImageExecution::Default) const;
 
 		Image& fit(int32 width, int32 height, bool scaleUp = true, Interpolation interpolation = Interpolation::Unspecified);
 
@@ -13,6 +13,7 @@
 # include "Fwd.hpp"
 # include "Array.hpp"
 # include "Image.hpp"
+# include "ImageView.hpp"
 # include "Polygon.hpp"
 # include "MultiPolygon.hpp"
 
@@ -96,7 +97,7 @@ namespace s3d
 		/// <returns>
 		/// 輪郭から構成された Polygon
 		/// </returns>
-		[[nodiscard]] Polygon FindContour(const Image& image, bool useAlpha = false, uint32 threshold = 127);
+		[[nodiscard]] Polygon FindContour(const ImageConstView& image, bool useAlpha = false, uint32 threshold = 127);
 
 		/// <summary>
 		/// 画像から穴を含む輪郭を抽出します。
@@ -113,27 +114,150 @@ namespace s3d
 		/// <returns>
 		/// 輪郭から構成された Polygon の Array
 		/// </returns>
-		[[nodiscard]] MultiPolygon FindContours(const Image& image, bool useAlpha = false, uint32 threshold = 127);
+		[[nodiscard]] MultiPolygon FindContours(const ImageConstView& image, bool useAlpha = false, uint32 threshold = 127);
 
 		void Sobel(const Image& src, Image& dst, int32 dx = 1, int32 dy = 1, int32 apertureSize = 3);
 
+		void Sobel(const ImageConstView& src, const ImageView& dst, int32 dx = 1, int32 dy = 1, int32 apertureSize = 3);
+
 		void Laplacian(const Image& src, Image& dst, int32 apertureSize = 3);
 
+		void Laplacian(const ImageConstView& src, const ImageView& dst, int32 apertureSize = 3);
+
 		void Canny(const Image& src, Image& dst, uint8 lowThreshold, uint8 highThreshold, int32 apertureSize = 3, bool useL2Gradient = false);
 
+		void Canny(const ImageConstView& src, const ImageView& dst, uint8 lowThreshold, uint8 highThreshold, int32 apertureSize = 3, bool useL2Gradient = false);
+
 		// _Field_range_(0.0, 200.0) sigma_s, _Field_range_(0.0, 1.0) double sigma_r
 		void EdgePreservingFilter(const Image& src, Image& dst, EdgePreservingFilterType filterType = EdgePreservingFilterType::Recursive, double sigma_s = 60, double sigma_r = 0.4);
 
+		void EdgePreservingFilter(const ImageConstView& src, const ImageView& dst, EdgePreservingFilterType filterType = EdgePreservingFilterType::Recursive, double sigma_s = 60, double sigma_r = 0.4);
+
 		// _Field_range_(0.0, 200.0) sigma_s, _Field_range_(0.0, 1.0) double sigma_r
 		void DetailEnhance(const Image& src, Image& dst, double sigma_s = 10, double sigma_r = 0.15);
 
+		void DetailEnhance(const ImageConstView& src, const ImageView& dst, double sigma_s = 10, double sigma_r = 0.15);
+
 		// _Field_range_(0.0, 200.0) sigma_s, _Field_range_(0.0, 1.0) double sigma_r
 		void Stylization(const Image& src, Image& dst, double sigma_s = 60, double sigma_r = 0.07);
 
-		[[nodiscard]] ColorF SSIM(const Image& image1, const Image& image2);
+		void Stylization(const ImageConstView& src, const ImageView& dst, double sigma_s = 60, double sigma_r = 0.07);
+
+		[[nodiscard]] ColorF SSIM(const ImageConstView& image1, const ImageConstView& image2);
 
 		void Inpaint(const Image& image, const Image& maskImage, Image& result, int32 radius = 2);
 
 		void Inpaint(const Image& image, const Grid<uint8>& maskImage, Image& result, int32 radius = 2);
+
+		//
+		//	ImageConstView / ImageView に対する画像処理
+		//
+		//	src の処理結果を、同じサイズの dst に書き込みます（Resize を除く）。
+		//	サイズが異なる場合は何もしません。
+		//	src と dst には同じ領域を渡すこともでき、画像の一部の領域をその場で処理できます。
+		//	ぼかしなどの周囲のピクセルを参照する処理では、src の範囲外のピクセルは参照しません。
+		//
+
+		/// <summary>
+		/// 赤と青の成分を入れ替えます。
+		/// </summary>
+		void SwapRB(const ImageConstView& src, const ImageView& dst);
+
+		/// <summary>
+		/// 色を反転します。
+		/// </summary>
+		void Negate(const ImageConstView& src, const ImageView& dst);
+
+		/// <summary>
+		/// グレースケールに変換します。
+		/// </summary>
+		void Grayscale(const ImageConstView& src, const ImageView& dst);
+
+		/// <summary>
+		/// セピア調に変換します。
+		/// </summary>
+		/// <param name="level">
+		/// セピアの強さ
+		/// </param>
+		void Sepia(const ImageConstView& src, const ImageView& dst, int32 level = 25);
+
+		/// <summary>
+		/// ポスタライズします。
+		/// </summary>
+		/// <param name="level">
+		/// 各成分の階調数
+		/// </param>
+		void Postarize(const ImageConstView& src, const ImageView& dst, int32 level);
+
+		/// <summary>
+		/// 明るさを変更します。
+		/// </summary>
+		/// <param name="level">
+		/// 各成分に加える値
+		/// </param>
+		void Brighten(const ImageConstView& src, const ImageView& dst, int32 level);
+
+		/// <summary>
+		/// ガンマ補正をします。
+		/// </summary>
+		/// <param name="gamma">
+		/// ガンマ値
+		/// </param>
+		void GammaCorrect(const ImageConstView& src, const ImageView& dst, double gamma);
+
+		/// <summary>
+		/// 2 値化します。
+		/// </summary>
+		/// <param name="threshold">
+		/// 閾値
+		/// </param>
+		/// <param name="inverse">
+		/// 結果を反転する場合は true
+		/// </param>
+		void Threshold(const ImageConstView& src, const ImageView& dst, uint8 threshold, bool inverse = false);
+
+		/// <summary>
+		/// モザイク処理をします。
+		/// </summary>
+		void Mosaic(const ImageConstView& src, const ImageView& dst, int32 size, ImageExecution execution = ImageExecution::Default);
+
+		void Mosaic(const ImageConstView& src, const ImageView& dst, int32 horizontal, int32 vertical, ImageExecution execution = ImageExecution::Default);
+
+		/// <summary>
+		/// ぼかし処理をします。
+		/// </summary>
+		void Blur(const ImageConstView& src, const ImageView& dst, int32 size, ImageExecution execution = ImageExecution::Default);
+
+		void Blur(const ImageConstView& src, const ImageView& dst, int32 horizontal, int32 vertical, ImageExecution execution = ImageExecution::Default);
+
+		/// <summary>
+		/// メディアンフィルタを適用します。
+		/// </summary>
+		void MedianBlur(const ImageConstView& src, const ImageView& dst, int32 apertureSize, ImageExecution execution = ImageExecution::Default);
+
+		/// <summary>
+		/// ガウスぼかしを適用します。
+		/// </summary>
+		void GaussianBlur(const ImageConstView& src, const ImageView& dst, int32 size, BorderType borderType = BorderType::Default, ImageExecution execution = ImageExecution::Default);
+
+		void GaussianBlur(const ImageConstView& src, const ImageView& dst, int32 horizontal, int32 vertical, BorderType borderType = BorderType::Default, ImageExecution execution = ImageExecution::Default);
+
+		/// <summary>
+		/// 膨張処理をします。
+		/// </summary>
+		void Dilate(const ImageConstView& src, const ImageView& dst, int32 iterations = 1, ImageExecution execution = ImageExecution::Default);
+
+		/// <summary>
+		/// 収縮処理をします。
+		/// </summary>
+		void Erode(const ImageConstView& src, const ImageView& dst, int32 iterations = 1, ImageExecution execution = ImageExecution::Default);
+
+		/// <summary>
+		/// src を dst のサイズに拡大縮小して書き込みます。
+		/// </summary>
+		/// <param name="interpolation">
+		/// 補間方法
+		/// </param>
+		void Resize(const ImageConstView& src, const ImageView& dst, Interpolation interpolation = Interpolation::Unspecified, ImageExecution execution = ImageExecution::Default);
 	}
 }
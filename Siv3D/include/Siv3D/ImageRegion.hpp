@@ -21,6 +21,8 @@ namespace s3d
 
 		friend class Image;
 
+		friend class ImageConstView;
+
 		const Image& m_imageRef;
 
 		const Rect m_rect;
@@ -0,0 +1,385 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Fwd.hpp"
+# include "Color.hpp"
+# include "PointVector.hpp"
+# include "Rectangle.hpp"
+
+namespace s3d
+{
+	/// <summary>
+	/// 画像の矩形領域への読み取り専用の参照
+	/// </summary>
+	/// <remarks>
+	/// ピクセルデータを所有しないため、参照先の画像が解放・リサイズされた後に使ってはいけません。
+	/// 各行の先頭は stride() バイトずつ離れているので、画像の一部の領域をコピーせずに表せます。
+	/// </remarks>
+	class ImageConstView
+	{
+	private:
+
+		const Color* m_data = nullptr;
+
+		int32 m_width = 0;
+
+		int32 m_height = 0;
+
+		uint32 m_stride = 0;
+
+	public:
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		ImageConstView() = default;
+
+		/// <summary>
+		/// ピクセルデータへのポインタから参照を作成します。
+		/// </summary>
+		/// <param name="data">
+		/// 左上のピクセルへのポインタ
+		/// </param>
+		/// <param name="width">
+		/// 幅（ピクセル）
+		/// </param>
+		/// <param name="height">
+		/// 高さ（ピクセル）
+		/// </param>
+		/// <param name="stride">
+		/// 各行の先頭の間隔（バイト）
+		/// </param>
+		constexpr ImageConstView(const Color* data, const int32 width, const int32 height, const uint32 stride) noexcept
+			: m_data(data)
+			, m_width(width)
+			, m_height(height)
+			, m_stride(stride) {}
+
+		/// <summary>
+		/// 画像全体への参照を作成します。
+		/// </summary>
+		/// <param name="image">
+		/// 画像
+		/// </param>
+		ImageConstView(const Image& image) noexcept;
+
+		/// <summary>
+		/// 画像の矩形領域への参照を作成します。
+		/// </summary>
+		/// <param name="image">
+		/// 画像
+		/// </param>
+		/// <param name="rect">
+		/// 領域。画像の範囲外の部分は除かれます。
+		/// </param>
+		ImageConstView(const Image& image, const Rect& rect) noexcept;
+
+		/// <summary>
+		/// 画像の矩形領域への参照を作成します。
+		/// </summary>
+		/// <param name="region">
+		/// 画像の領域。画像の範囲外の部分は除かれます。
+		/// </param>
+		ImageConstView(const ImageRegion& region) noexcept;
+
+		/// <summary>
+		/// 左上のピクセルへのポインタ
+		/// </summary>
+		[[nodiscard]] constexpr const Color* data() const noexcept
+		{
+			return m_data;
+		}
+
+		/// <summary>
+		/// 幅（ピクセル）
+		/// </summary>
+		[[nodiscard]] constexpr int32 width() const noexcept
+		{
+			return m_width;
+		}
+
+		/// <summary>
+		/// 高さ（ピクセル）
+		/// </summary>
+		[[nodiscard]] constexpr int32 height() const noexcept
+		{
+			return m_height;
+		}
+
+		/// <summary>
+		/// 幅と高さ（ピクセル）
+		/// </summary>
+		[[nodiscard]] constexpr Size size() const noexcept
+		{
+			return{ m_width, m_height };
+		}
+
+		/// <summary>
+		/// 各行の先頭の間隔（バイト）
+		/// </summary>
+		[[nodiscard]] constexpr uint32 stride() const noexcept
+		{
+			return m_stride;
+		}
+
+		/// <summary>
+		/// ピクセル数
+		/// </summary>
+		[[nodiscard]] constexpr uint32 num_pixels() const noexcept
+		{
+			return m_width * m_height;
+		}
+
+		/// <summary>
+		/// 参照している領域が空かどうかを示します。
+		/// </summary>
+		[[nodiscard]] constexpr bool isEmpty() const noexcept
+		{
+			return (m_width == 0) || (m_height == 0);
+		}
+
+		/// <summary>
+		/// 参照している領域が空でないかを示します。
+		/// </summary>
+		[[nodiscard]] constexpr explicit operator bool() const noexcept
+		{
+			return !isEmpty();
+		}
+
+		/// <summary>
+		/// 各行の間に隙間がないかを示します。
+		/// </summary>
+		[[nodiscard]] constexpr bool isContinuous() const noexcept
+		{
+			return (m_stride == m_width * sizeof(Color)) || (m_height <= 1);
+		}
+
+		/// <summary>
+		/// 指定した行の先頭のピクセルへのポインタを返します。
+		/// </summary>
+		/// <param name="y">
+		/// 行
+		/// </param>
+		[[nodiscard]] const Color* operator [](const size_t y) const noexcept
+		{
+			return static_cast<const Color*>(static_cast<const void*>(static_cast<const uint8*>(static_cast<const void*>(m_data)) + m_stride * y));
+		}
+
+		/// <summary>
+		/// 参照している領域の一部への参照を返します。
+		/// </summary>
+		/// <param name="rect">
+		/// 領域。範囲外の部分は除かれます。
+		/// </param>
+		[[nodiscard]] ImageConstView operator ()(const Rect& rect) const noexcept;
+
+		[[nodiscard]] ImageConstView operator ()(int32 x, int32 y, int32 w, int32 h) const noexcept
+		{
+			return operator()(Rect(x, y, w, h));
+		}
+
+		/// <summary>
+		/// 参照している領域が other の領域とメモリ上で重なっているかを返します。
+		/// </summary>
+		[[nodiscard]] bool overlaps(const ImageConstView& other) const noexcept;
+	};
+
+	/// <summary>
+	/// 画像の矩形領域への書き込み可能な参照
+	/// </summary>
+	/// <remarks>
+	/// ピクセルデータを所有しないため、参照先の画像が解放・リサイズされた後に使ってはいけません。
+	/// ImageProcessing の関数の出力先に渡すと、画像の一部の領域を直接書き換えられます。
+	/// </remarks>
+	class ImageView
+	{
+	private:
+
+		Color* m_data = nullptr;
+
+		int32 m_width = 0;
+
+		int32 m_height = 0;
+
+		uint32 m_stride = 0;
+
+	public:
+
+		/// <summary>
+		/// デフォルトコンストラクタ
+		/// </summary>
+		ImageView() = default;
+
+		/// <summary>
+		/// ピクセルデータへのポインタから参照を作成します。
+		/// </summary>
+		/// <param name="data">
+		/// 左上のピクセルへのポインタ
+		/// </param>
+		/// <param name="width">
+		/// 幅（ピクセル）
+		/// </param>
+		/// <param name="height">
+		/// 高さ（ピクセル）
+		/// </param>
+		/// <param name="stride">
+		/// 各行の先頭の間隔（バイト）
+		/// </param>
+		constexpr ImageView(Color* data, const int32 width, const int32 height, const uint32 stride) noexcept
+			: m_data(data)
+			, m_width(width)
+			, m_height(height)
+			, m_stride(stride) {}
+
+		/// <summary>
+		/// 画像全体への参照を作成します。
+		/// </summary>
+		/// <param name="image">
+		/// 画像
+		/// </param>
+		ImageView(Image& image) noexcept;
+
+		/// <summary>
+		/// 画像の矩形領域への参照を作成します。
+		/// </summary>
+		/// <param name="image">
+		/// 画像
+		/// </param>
+		/// <param name="rect">
+		/// 領域。画像の範囲外の部分は除かれます。
+		/// </param>
+		ImageView(Image& image, const Rect& rect) noexcept;
+
+		/// <summary>
+		/// 読み取り専用の参照に変換します。
+		/// </summary>
+		constexpr operator ImageConstView() const noexcept
+		{
+			return ImageConstView(m_data, m_width, m_height, m_stride);
+		}
+
+		/// <summary>
+		/// 左上のピクセルへのポインタ
+		/// </summary>
+		[[nodiscard]] constexpr Color* data() const noexcept
+		{
+			return m_data;
+		}
+
+		/// <summary>
+		/// 幅（ピクセル）
+		/// </summary>
+		[[nodiscard]] constexpr int32 width() const noexcept
+		{
+			return m_width;
+		}
+
+		/// <summary>
+		/// 高さ（ピクセル）
+		/// </summary>
+		[[nodiscard]] constexpr int32 height() const noexcept
+		{
+			return m_height;
+		}
+
+		/// <summary>
+		/// 幅と高さ（ピクセル）
+		/// </summary>
+		[[nodiscard]] constexpr Size size() const noexcept
+		{
+			return{ m_width, m_height };
+		}
+
+		/// <summary>
+		/// 各行の先頭の間隔（バイト）
+		/// </summary>
+		[[nodiscard]] constexpr uint32 stride() const noexcept
+		{
+			return m_stride;
+		}
+
+		/// <summary>
+		/// ピクセル数
+		/// </summary>
+		[[nodiscard]] constexpr uint32 num_pixels() const noexcept
+		{
+			return m_width * m_height;
+		}
+
+		/// <summary>
+		/// 参照している領域が空かどうかを示します。
+		/// </summary>
+		[[nodiscard]] constexpr bool isEmpty() const noexcept
+		{
+			return (m_width == 0) || (m_height == 0);
+		}
+
+		/// <summary>
+		/// 参照している領域が空でないかを示します。
+		/// </summary>
+		[[nodiscard]] constexpr explicit operator bool() const noexcept
+		{
+			return !isEmpty();
+		}
+
+		/// <summary>
+		/// 各行の間に隙間がないかを示します。
+		/// </summary>
+		[[nodiscard]] constexpr bool isContinuous() const noexcept
+		{
+			return (m_stride == m_width * sizeof(Color)) || (m_height <= 1);
+		}
+
+		/// <summary>
+		/// 指定した行の先頭のピクセルへのポインタを返します。
+		/// </summary>
+		/// <param name="y">
+		/// 行
+		/// </param>
+		[[nodiscard]] Color* operator [](const size_t y) const noexcept
+		{
+			return static_cast<Color*>(static_cast<void*>(static_cast<uint8*>(static_cast<void*>(m_data)) + m_stride * y));
+		}
+
+		/// <summary>
+		/// 参照している領域の一部への参照を返します。
+		/// </summary>
+		/// <param name="rect">
+		/// 領域。範囲外の部分は除かれます。
+		/// </param>
+		[[nodiscard]] ImageView operator ()(const Rect& rect) const noexcept;
+
+		[[nodiscard]] ImageView operator ()(int32 x, int32 y, int32 w, int32 h) const noexcept
+		{
+			return operator()(Rect(x, y, w, h));
+		}
+
+		/// <summary>
+		/// 参照している領域を指定した色で塗りつぶします。
+		/// </summary>
+		/// <param name="color">
+		/// 塗りつぶしの色
+		/// </param>
+		void fill(const Color& color) const noexcept;
+
+		/// <summary>
+		/// 同じサイズの領域からピクセルをコピーします。
+		/// </summary>
+		/// <param name="src">
+		/// コピー元の領域
+		/// </param>
+		/// <remarks>
+		/// サイズが異なる場合は何もしません。
+		/// </remarks>
+		void copyFrom(const ImageConstView& src) const noexcept;
+	};
+}
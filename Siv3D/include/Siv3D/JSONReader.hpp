@@ -10,6 +10,8 @@
 //-----------------------------------------------
 
 # pragma once
+# include <functional>
+# include <string_view>
 # include "Fwd.hpp"
 # include "Optional.hpp"
 # include "Array.hpp"
@@ -27,6 +29,8 @@ namespace s3d
 		struct JSONValueDetail;
 
 		struct JSONDocumentDetail;
+
+		struct JSONStreamReaderDetail;
 	}
 
 	enum class JSONValueType
@@ -347,4 +351,96 @@ namespace s3d
 			return isOpened();
 		}
 	};
+
+	enum class JSONStreamEventType
+	{
+		Null,
+
+		Bool,
+
+		Number,
+
+		String,
+
+		Key,
+
+		StartObject,
+
+		EndObject,
+
+		StartArray,
+
+		EndArray,
+	};
+
+	struct JSONStreamEvent
+	{
+		JSONStreamEventType type = JSONStreamEventType::Null;
+
+		// ネストの深さ（ルートの値は 0）
+		size_t depth = 0;
+
+		bool boolValue = false;
+
+		double number = 0.0;
+
+		// Number が int64 で表せる整数の場合はその値
+		Optional<int64> integer;
+
+		// String, Key の UTF-8 文字列（イベントの通知中のみ有効）
+		std::string_view utf8;
+
+		[[nodiscard]] String getString() const;
+	};
+
+	// ファイル全体を読み込まずに、先頭から順に JSON を解析する
+	// 使用するメモリはネストの深さと最も長い文字列の長さだけに比例する。UTF-8 のファイルのみに対応する。
+	class JSONStreamReader
+	{
+	private:
+
+		std::shared_ptr<detail::JSONStreamReaderDetail> m_detail;
+
+	public:
+
+		JSONStreamReader();
+
+		explicit JSONStreamReader(const FilePath& path);
+
+		template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>* = nullptr>
+		explicit JSONStreamReader(Reader&& reader)
+			: JSONStreamReader()
+		{
+			open(std::make_shared<Reader>(std::forward<Reader>(reader)));
+		}
+
+		explicit JSONStreamReader(const std::shared_ptr<IReader>& reader);
+
+		bool open(const FilePath& path);
+
+		template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>* = nullptr>
+		bool open(Reader&& reader)
+		{
+			return open(std::make_shared<Reader>(std::forward<Reader>(reader)));
+		}
+
+		bool open(const std::shared_ptr<IReader>& reader);
+
+		void close();
+
+		[[nodiscard]] bool isOpened() const;
+
+		[[nodiscard]] explicit operator bool() const
+		{
+			return isOpened();
+		}
+
+		// 先頭から順にイベントを handler に渡す。handler が false を返すと中断する
+		// 最後まで解析できた場合 true
+		bool read(const std::function<bool(const JSONStreamEvent&)>& handler);
+
+		// path（. 区切りのメンバ名。空の場合はルート）にある配列の要素を、1 つずつ JSONValue として handler に渡す
+		// 要素の JSONValue は handler の中でのみ有効。配列を最後まで読み込めた場合 true
+		bool readArray(const String& path, const std::function<bool(const JSONValue&)>& handler);
+	};
 }
@@ -0,0 +1,145 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Fwd.hpp"
+# include "Logger.hpp"
+# include "String.hpp"
+# include "Array.hpp"
+
+namespace s3d
+{
+	/// <summary>
+	/// ログ 1 件の情報
+	/// </summary>
+	struct LogEntry
+	{
+		/// <summary>
+		/// ログが出力された時刻（UNIX 時間, マイクロ秒）
+		/// </summary>
+		uint64 timestamp = 0;
+
+		/// <summary>
+		/// ログを出力したスレッドの ID
+		/// </summary>
+		uint64 threadID = 0;
+
+		/// <summary>
+		/// ログが出力されたときのフレーム数
+		/// </summary>
+		uint64 frameCount = 0;
+
+		/// <summary>
+		/// ログの種類
+		/// </summary>
+		LogDescription level = LogDescription::App;
+
+		/// <summary>
+		/// ログのテキスト
+		/// </summary>
+		/// <remarks>
+		/// ILogSink::write() の呼び出し中のみ有効です。
+		/// </remarks>
+		StringView text;
+	};
+
+	/// <summary>
+	/// ログの出力先のインタフェース
+	/// </summary>
+	/// <remarks>
+	/// write() と flush() は Logger の内部でロックされた状態で呼ばれるため、スレッドセーフである必要はありません。
+	/// 非同期モードでは、ログの書き込みスレッドから呼ばれます。
+	/// </remarks>
+	class ILogSink
+	{
+	public:
+
+		virtual ~ILogSink() = default;
+
+		/// <summary>
+		/// ログを 1 件書き込みます。
+		/// </summary>
+		/// <param name="entry">
+		/// ログの情報
+		/// </param>
+		virtual void write(const LogEntry& entry) = 0;
+
+		/// <summary>
+		/// 書き込みバッファをフラッシュします。
+		/// </summary>
+		virtual void flush() {}
+	};
+
+	namespace LogSink
+	{
+		/// <summary>
+		/// ログをバイナリ形式で書き込む出力先を作成します。
+		/// </summary>
+		/// <param name="path">
+		/// ファイルパス
+		/// </param>
+		/// <remarks>
+		/// ファイルの先頭には 8 バイトのヘッダ ("S3DLOG" と 2 バイトのバージョン番号) が書き込まれます。
+		/// 各レコードは timestamp, threadID, frameCount (各 uint64), level (uint8), テキストのバイト数 (uint32),
+		/// UTF-8 のテキストの順で、リトルエンディアンで格納されます。
+		/// </remarks>
+		/// <returns>
+		/// ログの出力先。ファイルのオープンに失敗した場合は nullptr
+		/// </returns>
+		[[nodiscard]] std::shared_ptr<ILogSink> Binary(const FilePath& path);
+
+		/// <summary>
+		/// ログを JSON Lines 形式で書き込む出力先を作成します。
+		/// </summary>
+		/// <param name="path">
+		/// ファイルパス
+		/// </param>
+		/// <remarks>
+		/// 1 行に 1 件ずつ {"timestamp":..., "thread":..., "frame":..., "level":"...", "text":"..."} の形式で書き込まれます。
+		/// </remarks>
+		/// <returns>
+		/// ログの出力先。ファイルのオープンに失敗した場合は nullptr
+		/// </returns>
+		[[nodiscard]] std::shared_ptr<ILogSink> JSONLines(const FilePath& path);
+
+		/// <summary>
+		/// LogSink::Binary() で書き込んだログファイルを読み込みます。
+		/// </summary>
+		/// <param name="path">
+		/// ファイルパス
+		/// </param>
+		/// <param name="entries">
+		/// 読み込んだログの格納先
+		/// </param>
+		/// <param name="texts">
+		/// 読み込んだログのテキストの格納先。entries[i].text は texts[i] を指します。
+		/// </param>
+		/// <returns>
+		/// ファイルの読み込みに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool LoadBinary(const FilePath& path, Array<LogEntry>& entries, Array<String>& texts);
+
+		/// <summary>
+		/// LogSink::Binary() で書き込んだログファイルを、Logger と同じ形式の HTML に変換します。
+		/// </summary>
+		/// <param name="binaryLogPath">
+		/// バイナリ形式のログファイルのパス
+		/// </param>
+		/// <param name="htmlPath">
+		/// 出力する HTML ファイルのパス
+		/// </param>
+		/// <returns>
+		/// 変換に成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool ConvertBinaryToHTML(const FilePath& binaryLogPath, const FilePath& htmlPath);
+	}
+}
@@ -49,6 +49,27 @@ namespace s3d
 		Debug,		// More
 	};
 
+	/// <summary>
+	/// 非同期ログのバッファが一杯のときの動作
+	/// </summary>
+	enum class LogOverflowPolicy
+	{
+		/// <summary>
+		/// バッファに空きができるまで待つ
+		/// </summary>
+		Block,
+
+		/// <summary>
+		/// ログを破棄する
+		/// </summary>
+		Drop,
+
+		/// <summary>
+		/// ログを破棄し、破棄した件数をログファイルに出力する
+		/// </summary>
+		DropAndCount,
+	};
+
 	namespace detail
 	{
 		struct LoggerBuffer
@@ -99,6 +120,54 @@ namespace s3d
 
 			void setOutputLevel(OutputLevel level) const;
 
+			/// <summary>
+			/// ログを非同期で出力するようにします。
+			/// </summary>
+			/// <param name="policy">
+			/// バッファが一杯のときの動作
+			/// </param>
+			/// <remarks>
+			/// ログはバッファに追加されるだけで、整形とファイルへの書き込みはバックグラウンドのスレッドがまとめて行います。
+			/// 終了時や異常終了時には、バッファに残っているログが書き込まれます。
+			/// </remarks>
+			void enableAsync(LogOverflowPolicy policy = LogOverflowPolicy::Block) const;
+
+			/// <summary>
+			/// バッファに残っているログを書き込み、ログを同期的に出力するようにします。
+			/// </summary>
+			void disableAsync() const;
+
+			/// <summary>
+			/// ログを非同期で出力しているかを返します。
+			/// </summary>
+			[[nodiscard]] bool isAsync() const;
+
+			/// <summary>
+			/// バッファに残っているログをすべてファイルに書き込みます。
+			/// </summary>
+			void flush() const;
+
+			/// <summary>
+			/// バッファが一杯で破棄されたログの件数を返します。
+			/// </summary>
+			[[nodiscard]] size_t droppedCount() const;
+
+			/// <summary>
+			/// HTML のログファイルに加えて、ログを書き込む出力先を追加します。
+			/// </summary>
+			/// <param name="sink">
+			/// ログの出力先
+			/// </param>
+			void addSink(const std::shared_ptr<ILogSink>& sink) const;
+
+			/// <summary>
+			/// 追加したログの出力先を削除します。
+			/// </summary>
+			/// <param name="sink">
+			/// ログの出力先
+			/// </param>
+			void removeSink(const std::shared_ptr<ILogSink>& sink) const;
+
 			void _outputLog(LogDescription desc, const String& text) const;
 
 			void _outputLogOnce(LogDescription desc, uint32 id, const String& text) const;
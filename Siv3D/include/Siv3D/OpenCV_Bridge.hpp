@@ -13,25 +13,30 @@
 # if __has_include(<opencv2/core.hpp>)
 # include <opencv2/core.hpp>
 # include "Image.hpp"
+# include "ImageView.hpp"
 
 namespace s3d
 {
 	namespace OpenCV_Bridge
 	{
-		void RedToBinary(const Image& from, cv::Mat_<uint8>& to, uint32 threshold);
+		void RedToBinary(const ImageConstView& from, cv::Mat_<uint8>& to, uint32 threshold);
 
-		void AlphaToBinary(const Image& from, cv::Mat_<uint8>& to, uint32 threshold);
+		void AlphaToBinary(const ImageConstView& from, cv::Mat_<uint8>& to, uint32 threshold);
 
-		void ToGrayScale(const Image& from, cv::Mat_<uint8>& to);
+		void ToGrayScale(const ImageConstView& from, cv::Mat_<uint8>& to);
 
-		void ToMatVec3b(const Image& from, cv::Mat_<cv::Vec3b>& to);
+		void ToMatVec3b(const ImageConstView& from, cv::Mat_<cv::Vec3b>& to);
 
-		void ToMatVec3f255(const Image& from, cv::Mat_<cv::Vec3f>& to);
+		void ToMatVec3f255(const ImageConstView& from, cv::Mat_<cv::Vec3f>& to);
 
 		void FromMat(const cv::Mat_<cv::Vec3b>& from, Image& to, bool preserveAlpha = false);
 
+		void FromMat(const cv::Mat_<cv::Vec3b>& from, const ImageView& to, bool preserveAlpha = false);
+
 		void FromGrayScale(const cv::Mat_<uint8>& from, Image& to, bool preserveAlpha = false);
 
+		void FromGrayScale(const cv::Mat_<uint8>& from, const ImageView& to, bool preserveAlpha = false);
+
 		cv::Mat_<uint8> ImRead_GrayScale(const FilePath& path);
 
 		cv::Mat_<uint8> ImRead_GrayScale(const Image& image);
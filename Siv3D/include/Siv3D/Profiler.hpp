@@ -11,6 +11,8 @@
 
 # pragma once
 # include "Fwd.hpp"
+# include "Array.hpp"
+# include "String.hpp"
 
 namespace s3d
 {
@@ -19,6 +21,77 @@ namespace s3d
 		size_t drawcalls = 0;
 
 		size_t triangles = 0;
+
+		/// <summary>
+		/// フォントのグリフアトラスのページ数
+		/// </summary>
+		size_t fontAtlasPages = 0;
+
+		/// <summary>
+		/// フォントのグリフアトラスが使用しているメモリ（バイト）。テクスチャと CPU 側の画像のそれぞれで、この大きさを使用します。
+		/// </summary>
+		size_t fontAtlasBytes = 0;
+
+		/// <summary>
+		/// 1 フレームでフォントのグリフアトラスのテクスチャに転送したデータ（バイト）
+		/// </summary>
+		size_t fontUploadBytes = 0;
+
+		/// <summary>
+		/// 1 フレームで 2D 描画の頂点・インデックス・インスタンスのバッファに転送したデータ（バイト）
+		/// </summary>
+		size_t vertexUploadBytes = 0;
+
+		/// <summary>
+		/// 1 フレームで描画コマンドの並べ替えによって削減したドローコールの数
+		/// </summary>
+		size_t savedDrawcalls = 0;
+	};
+
+	/// <summary>
+	/// 1 フレームで集計した、CPU プロファイリングのスコープの情報
+	/// </summary>
+	struct ProfileScopeStat
+	{
+		/// <summary>
+		/// スコープの名前
+		/// </summary>
+		String name;
+
+		/// <summary>
+		/// スコープを実行したスレッドの名前
+		/// </summary>
+		String threadName;
+
+		/// <summary>
+		/// スコープを実行したスレッドの番号（Chrome トレースの tid と同じ値）
+		/// </summary>
+		uint32 threadIndex = 0;
+
+		/// <summary>
+		/// スコープの深さ（最も外側のスコープが 0）
+		/// </summary>
+		int32 depth = 0;
+
+		/// <summary>
+		/// 親のスコープのインデックス。親がない場合は -1
+		/// </summary>
+		int32 parentIndex = -1;
+
+		/// <summary>
+		/// 呼び出し回数
+		/// </summary>
+		uint32 count = 0;
+
+		/// <summary>
+		/// 子のスコープを含む合計時間（ミリ秒）
+		/// </summary>
+		double totalMillisec = 0.0;
+
+		/// <summary>
+		/// 子のスコープを除いた合計時間（ミリ秒）
+		/// </summary>
+		double selfMillisec = 0.0;
 	};
 
 	/// <summary>
@@ -40,5 +113,100 @@ namespace s3d
 		void EnableAssetCreationWarning(bool enabled);
 
 		[[nodiscard]] Statistics GetStatistics();
+
+		/// <summary>
+		/// CPU プロファイリングを有効にします。
+		/// </summary>
+		/// <param name="enabled">
+		/// 有効にする場合 true, 無効にする場合は false
+		/// </param>
+		/// <remarks>
+		/// 無効の間、SIV3D_PROFILE_SCOPE() のコストはほぼなくなります。デフォルトでは無効です。
+		/// </remarks>
+		void EnableCPUProfiling(bool enabled = true);
+
+		/// <summary>
+		/// CPU プロファイリングが有効であるかを返します。
+		/// </summary>
+		/// <returns>
+		/// CPU プロファイリングが有効である場合 true, それ以外の場合は false
+		/// </returns>
+		[[nodiscard]] bool IsCPUProfilingEnabled();
+
+		/// <summary>
+		/// 現在のスレッドに、トレースで表示する名前を付けます。
+		/// </summary>
+		/// <param name="name">
+		/// スレッドの名前
+		/// </param>
+		void SetThreadName(const String& name);
+
+		/// <summary>
+		/// 現在のスレッドでスコープを開始します。
+		/// </summary>
+		/// <param name="name">
+		/// スコープの名前。文字列リテラルなど、プログラムの終了まで有効な文字列である必要があります。
+		/// </param>
+		/// <remarks>
+		/// 通常は SIV3D_PROFILE_SCOPE() を使います。
+		/// </remarks>
+		void BeginScope(const char* name) noexcept;
+
+		/// <summary>
+		/// 現在のスレッドで最後に開始したスコープを終了します。
+		/// </summary>
+		void EndScope() noexcept;
+
+		/// <summary>
+		/// 直前のフレームで記録されたスコープを、スレッドと呼び出し階層ごとに集計した結果を返します。
+		/// </summary>
+		/// <returns>
+		/// スコープの集計結果。親のスコープは子のスコープより前に並びます。
+		/// </returns>
+		[[nodiscard]] Array<ProfileScopeStat> GetFrameScopes();
+
+		/// <summary>
+		/// CPU プロファイリングを有効にしてから記録したスコープを、
+		/// Chrome の about:tracing や Perfetto で読み込める JSON 形式で書き出します。
+		/// </summary>
+		/// <param name="path">
+		/// ファイルパス
+		/// </param>
+		/// <returns>
+		/// 書き出しに成功した場合 true, それ以外の場合は false
+		/// </returns>
+		bool ExportChromeTrace(const FilePath& path);
+
+		/// <summary>
+		/// 記録したトレースを消去します。
+		/// </summary>
+		void ClearTrace();
 	}
+
+	/// <summary>
+	/// スコープの開始から終了までを CPU プロファイリングで記録します。
+	/// </summary>
+	class ProfileScope
+	{
+	public:
+
+		explicit ProfileScope(const char* name) noexcept
+		{
+			Profiler::BeginScope(name);
+		}
+
+		~ProfileScope()
+		{
+			Profiler::EndScope();
+		}
+
+		ProfileScope(const ProfileScope&) = delete;
+
+		ProfileScope& operator =(const ProfileScope&) = delete;
+	};
 }
+
+# define SIV3D_PROFILE_CONCAT_IMPL(a, b)	a##b
+# define SIV3D_PROFILE_CONCAT(a, b)		SIV3D_PROFILE_CONCAT_IMPL(a, b)
+# define SIV3D_PROFILE_SCOPE(NAME)		const s3d::ProfileScope SIV3D_PROFILE_CONCAT(siv3dProfileScope, __LINE__)(NAME)
+# define SIV3D_PROFILE_FUNCTION()		SIV3D_PROFILE_SCOPE(__func__)
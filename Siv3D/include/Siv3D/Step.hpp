@@ -30,7 +30,9 @@
 
 # include <iterator>
 # include <type_traits>
+# include <atomic>
 # include "Types.hpp"
+# include "Threading.hpp"
 # include "BigNumber.hpp"
 # include "Format.hpp"
 # include "Functor.hpp"
@@ -501,52 +503,29 @@ namespace s3d
 				return 0;
 			}
 
-			N result = 0;
-			auto count_ = count();
-			auto value = startValue();
+			const auto startValue_ = startValue();
 			const auto step_ = step();
 
-			numThreads = std::max<size_t>(1, numThreads);
-
-			const auto n = std::max<N>(1, count_ / numThreads);
-
-			N num_processed = 0;
-			const N num_all = count_;
-
-			Array<std::future<std::size_t>> futures;
+			std::atomic<size_t> result = { 0 };
 
-			for (; num_processed < num_all - n; num_processed += n)
+			Threading::ParallelFor(static_cast<size_t>(count()), [&](const size_t beginIndex, const size_t endIndex)
 			{
-				futures.emplace_back(std::async(std::launch::async, [=, &f]() mutable
-				{
-					size_t t_result = 0;
-
-					for (N i = 0; i < n; ++i)
-					{
-						t_result += f(value);
-
-						value += step_;
-					}
+				auto value = startValue_;
+				value += static_cast<T>(static_cast<N>(beginIndex) * step_);
 
-					return t_result;
-				}));
+				size_t t_result = 0;
 
-				value += static_cast<T>(n * step_);
-			}
-
-			for (; num_processed < num_all; ++num_processed)
-			{
-				result += f(value);
+				for (size_t i = beginIndex; i < endIndex; ++i)
+				{
+					t_result += f(value);
 
-				value += step_;
-			}
+					value += step_;
+				}
 
-			for (auto& future : futures)
-			{
-				result += future.get();
-			}
+				result += t_result;
+			}, numThreads);
 
-			return result;
+			return static_cast<N>(result.load());
 		}
 
 		template <class Fty>
@@ -557,45 +536,21 @@ namespace s3d
 				return;
 			}
 
-			auto count_ = count();
-			auto value = startValue();
+			const auto startValue_ = startValue();
 			const auto step_ = step();
 
-			numThreads = std::max<size_t>(1, numThreads);
-
-			const auto n = std::max<N>(1, count_ / numThreads);
-
-			N num_processed = 0;
-			const N num_all = count_;
-
-			Array<std::future<void>> futures;
-
-			for (; num_processed < num_all - n; num_processed += n)
+			Threading::ParallelFor(static_cast<size_t>(count()), [&](const size_t beginIndex, const size_t endIndex)
 			{
-				futures.emplace_back(std::async(std::launch::async, [=, &f]() mutable
-				{
-					for (N i = 0; i < n; ++i)
-					{
-						f(value);
-
-						value += step_;
-					}
-				}));
+				auto value = startValue_;
+				value += static_cast<T>(static_cast<N>(beginIndex) * step_);
 
-				value += static_cast<T>(n * step_);
-			}
-
-			for (; num_processed < num_all; ++num_processed)
-			{
-				f(value);
-
-				value += step_;
-			}
+				for (size_t i = beginIndex; i < endIndex; ++i)
+				{
+					f(value);
 
-			for (auto& future : futures)
-			{
-				future.wait();
-			}
+					value += step_;
+				}
+			}, numThreads);
 		}
 
 		// parallel_map
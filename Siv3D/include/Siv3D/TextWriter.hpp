@@ -178,6 +178,14 @@ namespace s3d
 		/// </returns>
 		void clear();
 
+		/// <summary>
+		/// バッファに残っているデータをファイルに書き込みます。
+		/// </summary>
+		/// <returns>
+		/// なし
+		/// </returns>
+		void flush();
+
 		/// <summary>
 		/// ファイルに文字を書き込みます。
 		/// </summary>
@@ -117,6 +117,11 @@ namespace s3d
 
 			return result;
 		}
+
+		[[nodiscard]] FilePath getSourcePath() const override
+		{
+			return path;
+		}
 	};
 
 	/// <summary>
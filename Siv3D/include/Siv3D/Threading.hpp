@@ -17,5 +17,57 @@ namespace s3d
 	namespace Threading
 	{
 		[[nodiscard]] size_t GetConcurrency() noexcept;
+
+		/// <summary>
+		/// 並列処理で 1 つのタスクが担当する要素数の最小値を設定します。
+		/// </summary>
+		/// <param name="grainSize">
+		/// 1 つのタスクが担当する要素数の最小値（0 の場合は 1）
+		/// </param>
+		/// <remarks>
+		/// 要素あたりの処理が軽い場合は大きな値を設定すると、タスクの分配コストを抑えられます。
+		/// デフォルトは 1 です。
+		/// </remarks>
+		void SetParallelGrainSize(size_t grainSize) noexcept;
+
+		/// <summary>
+		/// 並列処理で 1 つのタスクが担当する要素数の最小値を返します。
+		/// </summary>
+		/// <returns>
+		/// 1 つのタスクが担当する要素数の最小値
+		/// </returns>
+		[[nodiscard]] size_t GetParallelGrainSize() noexcept;
+
+		namespace detail
+		{
+			using ParallelForFunction = void(*)(void* data, size_t beginIndex, size_t endIndex);
+
+			void ParallelFor(size_t count, size_t numThreads, ParallelForFunction f, void* data);
+		}
+
+		/// <summary>
+		/// [0, count) の範囲を分割し、エンジンのスレッドプールで並列に処理します。
+		/// </summary>
+		/// <param name="count">
+		/// 要素数
+		/// </param>
+		/// <param name="f">
+		/// 範囲 [beginIndex, endIndex) を処理する関数
+		/// </param>
+		/// <param name="numThreads">
+		/// 使用するスレッド数の最大数（呼び出し元のスレッドを含む）
+		/// </param>
+		/// <remarks>
+		/// 呼び出し元のスレッドも処理に参加し、すべての範囲の処理が終わるまで戻りません。
+		/// f が例外を送出した場合、最初の例外が呼び出し元で再送出されます。
+		/// </remarks>
+		template <class Fty>
+		void ParallelFor(const size_t count, Fty f, const size_t numThreads = GetConcurrency())
+		{
+			detail::ParallelFor(count, numThreads, [](void* data, const size_t beginIndex, const size_t endIndex)
+			{
+				(*static_cast<Fty*>(data))(beginIndex, endIndex);
+			}, &f);
+		}
 	}
 }
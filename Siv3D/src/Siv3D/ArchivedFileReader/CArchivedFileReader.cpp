@@ -0,0 +1,172 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Compressor.hpp>
+# include <Siv3D/Logger.hpp>
+# include "CArchivedFileReader.hpp"
+
+namespace s3d
+{
+	ArchivedFileReader::CArchivedFileReader::CArchivedFileReader()
+	{
+
+	}
+
+	ArchivedFileReader::CArchivedFileReader::~CArchivedFileReader()
+	{
+		close();
+	}
+
+	bool ArchivedFileReader::CArchivedFileReader::open(const FileArchive& archive, const FilePath& path)
+	{
+		close();
+
+		if (!archive)
+		{
+			return false;
+		}
+
+		const std::string normalizedPath = detail::NormalizeArchivePath(path);
+
+		const detail::FileArchiveEntry* entry = archive.pImpl->find(normalizedPath, detail::HashArchivePath(normalizedPath));
+
+		if (!entry)
+		{
+			LOG_FAIL(U"❌ ArchivedFileReader: \"{0}\" is not found in \"{1}\""_fmt(path, archive.path()));
+
+			return false;
+		}
+
+		return openEntry(*entry, archive.pImpl->getMapping(), path, archive.path());
+	}
+
+	bool ArchivedFileReader::CArchivedFileReader::openMounted(const FilePath& path)
+	{
+		close();
+
+		const std::string normalizedPath = detail::NormalizeArchivePath(path);
+
+		detail::FileArchiveEntry entry;
+
+		MemoryMapping mapping;
+
+		FilePath archivePath;
+
+		if (!FileArchive::CFileArchive::FindMounted(normalizedPath, detail::HashArchivePath(normalizedPath), entry, mapping, archivePath))
+		{
+			return false;
+		}
+
+		return openEntry(entry, mapping, path, archivePath);
+	}
+
+	bool ArchivedFileReader::CArchivedFileReader::openEntry(const detail::FileArchiveEntry& entry, const MemoryMapping& mapping, const FilePath& path, const FilePath& archivePath)
+	{
+		const Byte* const storedData = mapping.data() + entry.offset;
+
+		if (entry.flags & detail::FileArchiveEntryFlag_Compressed)
+		{
+			// 展開器のコンテキストはスレッドごとに再利用する
+			thread_local Decompressor decompressor;
+
+			if (!decompressor.decompress(ByteArrayView(storedData, static_cast<size_t>(entry.storedSize)), m_decompressed)
+				|| (m_decompressed.size() != entry.originalSize))
+			{
+				LOG_FAIL(U"❌ ArchivedFileReader: Failed to decompress \"{0}\" in \"{1}\""_fmt(path, archivePath));
+
+				m_decompressed.clear();
+
+				return false;
+			}
+
+			m_data = m_decompressed.data();
+		}
+		else
+		{
+			m_mapping = mapping;
+
+			m_data = storedData;
+		}
+
+		m_size = static_cast<int64>(entry.originalSize);
+
+		m_pos = 0;
+
+		m_path = path;
+
+		m_opened = true;
+
+		return true;
+	}
+
+	void ArchivedFileReader::CArchivedFileReader::close()
+	{
+		if (!m_opened)
+		{
+			return;
+		}
+
+		m_mapping = MemoryMapping();
+
+		m_decompressed.release();
+
+		m_data = nullptr;
+
+		m_size = 0;
+
+		m_pos = 0;
+
+		m_path.clear();
+
+		m_opened = false;
+	}
+
+	int64 ArchivedFileReader::CArchivedFileReader::setPos(const int64 pos)
+	{
+		m_pos = Clamp<int64>(pos, 0, m_size);
+
+		return m_pos;
+	}
+
+	int64 ArchivedFileReader::CArchivedFileReader::read(void* const buffer, const int64 size)
+	{
+		const int64 readSize = lookahead(buffer, m_pos, size);
+
+		m_pos += readSize;
+
+		return readSize;
+	}
+
+	int64 ArchivedFileReader::CArchivedFileReader::read(void* const buffer, const int64 pos, const int64 size)
+	{
+		const int64 readSize = lookahead(buffer, pos, size);
+
+		m_pos = Clamp<int64>(pos, 0, m_size) + readSize;
+
+		return readSize;
+	}
+
+	int64 ArchivedFileReader::CArchivedFileReader::lookahead(void* const buffer, const int64 pos, const int64 size) const
+	{
+		assert(buffer != nullptr || size == 0);
+
+		if (pos < 0 || pos >= m_size)
+		{
+			return 0;
+		}
+
+		const int64 readSize = Clamp<int64>(size, 0, m_size - pos);
+
+		std::memcpy(buffer, m_data + pos, static_cast<size_t>(readSize));
+
+		return readSize;
+	}
+}
@@ -0,0 +1,89 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/ArchivedFileReader.hpp>
+# include <Siv3D/FileArchive.hpp>
+# include <Siv3D/MemoryMapping.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/String.hpp>
+# include "../FileArchive/CFileArchive.hpp"
+
+namespace s3d
+{
+	class ArchivedFileReader::CArchivedFileReader
+	{
+	private:
+
+		// 圧縮されていないファイルのデータを指している間、マッピングを保持する
+		MemoryMapping m_mapping;
+
+		// 圧縮されているファイルの展開先
+		Array<Byte> m_decompressed;
+
+		const Byte* m_data = nullptr;
+
+		int64 m_size = 0;
+
+		int64 m_pos = 0;
+
+		FilePath m_path;
+
+		bool m_opened = false;
+
+		bool openEntry(const detail::FileArchiveEntry& entry, const MemoryMapping& mapping, const FilePath& path, const FilePath& archivePath);
+
+	public:
+
+		CArchivedFileReader();
+
+		~CArchivedFileReader();
+
+		bool open(const FileArchive& archive, const FilePath& path);
+
+		bool openMounted(const FilePath& path);
+
+		void close();
+
+		bool isOpened() const noexcept
+		{
+			return m_opened;
+		}
+
+		int64 size() const noexcept
+		{
+			return m_size;
+		}
+
+		int64 setPos(int64 pos);
+
+		int64 getPos() const noexcept
+		{
+			return m_pos;
+		}
+
+		int64 read(void* buffer, int64 size);
+
+		int64 read(void* buffer, int64 pos, int64 size);
+
+		int64 lookahead(void* buffer, int64 pos, int64 size) const;
+
+		ByteArrayView view() const noexcept
+		{
+			return ByteArrayView(m_data, static_cast<size_t>(m_size));
+		}
+
+		const FilePath& path() const noexcept
+		{
+			return m_path;
+		}
+	};
+}
@@ -0,0 +1,97 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/ArchivedFileReader.hpp>
+# include "CArchivedFileReader.hpp"
+
+namespace s3d
+{
+	ArchivedFileReader::ArchivedFileReader()
+		: pImpl(std::make_shared<CArchivedFileReader>())
+	{
+
+	}
+
+	bool ArchivedFileReader::open(const FilePath& path)
+	{
+		return pImpl->openMounted(path);
+	}
+
+	bool ArchivedFileReader::open(const FileArchive& archive, const FilePath& path)
+	{
+		return pImpl->open(archive, path);
+	}
+
+	void ArchivedFileReader::close()
+	{
+		pImpl->close();
+	}
+
+	bool ArchivedFileReader::isOpened() const
+	{
+		return pImpl->isOpened();
+	}
+
+	int64 ArchivedFileReader::size() const
+	{
+		return pImpl->size();
+	}
+
+	int64 ArchivedFileReader::getPos() const
+	{
+		return pImpl->getPos();
+	}
+
+	bool ArchivedFileReader::setPos(const int64 pos)
+	{
+		if (pos < 0 || pImpl->size() < pos)
+		{
+			return false;
+		}
+
+		return pImpl->setPos(pos) == pos;
+	}
+
+	int64 ArchivedFileReader::skip(const int64 offset)
+	{
+		return pImpl->setPos(pImpl->getPos() + offset);
+	}
+
+	int64 ArchivedFileReader::read(void* const buffer, const int64 size)
+	{
+		return pImpl->read(buffer, size);
+	}
+
+	int64 ArchivedFileReader::read(void* const buffer, const int64 pos, const int64 size)
+	{
+		return pImpl->read(buffer, pos, size);
+	}
+
+	int64 ArchivedFileReader::lookahead(void* const buffer, const int64 size) const
+	{
+		return pImpl->lookahead(buffer, pImpl->getPos(), size);
+	}
+
+	int64 ArchivedFileReader::lookahead(void* const buffer, const int64 pos, const int64 size) const
+	{
+		return pImpl->lookahead(buffer, pos, size);
+	}
+
+	ByteArrayView ArchivedFileReader::view() const
+	{
+		return pImpl->view();
+	}
+
+	const FilePath& ArchivedFileReader::path() const
+	{
+		return pImpl->path();
+	}
+}
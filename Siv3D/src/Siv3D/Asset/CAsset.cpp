@@ -12,6 +12,7 @@
 # include "CAsset.hpp"
 # include "../Siv3DEngine.hpp"
 # include "../Texture/ITexture.hpp"
+# include <Siv3D/FileSystem.hpp>
 # include <Siv3D/Logger.hpp>
 
 namespace s3d
@@ -62,7 +63,10 @@ namespace s3d
 
 	void CAsset::update()
 	{
-
+		if (m_hotReloadEnabled)
+		{
+			reloadChangedAssets();
+		}
 	}
 
 	bool CAsset::registerAsset(const AssetType assetType, const String& name, std::unique_ptr<IAsset>&& asset)
@@ -80,6 +84,11 @@ namespace s3d
 
 		LOG_DEBUG(U"ℹ️ {}Asset: Asset \"{}\" registered"_fmt(detail::GetAssetTypeName(assetType), name));
 
+		if (m_hotReloadEnabled)
+		{
+			watchSource(assetType, name, *result.first.value());
+		}
+
 		if (result.first.value()->getParameter().loadAsync)
 		{
 			result.first.value()->preloadAsync();
@@ -214,6 +223,11 @@ namespace s3d
 
 		assetList.erase(it);
 
+		if (m_hotReloadEnabled)
+		{
+			unwatchSource(assetType, name);
+		}
+
 		LOG_DEBUG(U"ℹ️ {}Asset: \"{}\" unregistered"_fmt(detail::GetAssetTypeName(assetType), name));
 	}
 
@@ -226,6 +240,11 @@ namespace s3d
 			asset.second->wait();
 
 			asset.second->release();
+
+			if (m_hotReloadEnabled)
+			{
+				unwatchSource(assetType, asset.first);
+			}
 		}
 
 		assetList.clear();
@@ -246,4 +265,128 @@ namespace s3d
 
 		return it->second->isReady();
 	}
+
+	void CAsset::setHotReloadEnabled(const bool enabled)
+	{
+		if (enabled == m_hotReloadEnabled)
+		{
+			return;
+		}
+
+		m_hotReloadEnabled = enabled;
+
+		if (enabled)
+		{
+			for (size_t i = 0; i < m_assetLists.size(); ++i)
+			{
+				for (const auto& asset : m_assetLists[i])
+				{
+					watchSource(static_cast<AssetType>(i), asset.first, *asset.second);
+				}
+			}
+
+			LOG_INFO(U"ℹ️ Asset hot reload enabled ({} files in {} directories)"_fmt(m_sourceFiles.size(), m_watchers.size()));
+		}
+		else
+		{
+			m_watchers.clear();
+
+			m_sourceFiles.clear();
+
+			LOG_INFO(U"ℹ️ Asset hot reload disabled");
+		}
+	}
+
+	bool CAsset::isHotReloadEnabled() const
+	{
+		return m_hotReloadEnabled;
+	}
+
+	void CAsset::watchSource(const AssetType assetType, const String& name, const IAsset& asset)
+	{
+		const FilePath sourcePath = asset.getSourcePath();
+
+		// アーカイブ内のファイルや、ファイルから読み込まないアセットは監視しない
+		if (sourcePath.isEmpty() || !FileSystem::IsFile(sourcePath))
+		{
+			return;
+		}
+
+		const FilePath fullPath = FileSystem::FullPath(sourcePath);
+
+		m_sourceFiles[fullPath].emplace_back(assetType, name);
+
+		const FilePath directory = FileSystem::ParentPath(fullPath);
+
+		const bool watched = m_watchers.any([&](const DirectoryWatcher& watcher)
+		{
+			return directory.starts_with(watcher.directory());
+		});
+
+		if (!watched)
+		{
+			m_watchers.emplace_back(directory);
+		}
+	}
+
+	void CAsset::unwatchSource(const AssetType assetType, const String& name)
+	{
+		for (auto it = m_sourceFiles.begin(); it != m_sourceFiles.end(); ++it)
+		{
+			it.value().remove_if([&](const std::pair<AssetType, String>& asset)
+			{
+				return (asset.first == assetType) && (asset.second == name);
+			});
+		}
+	}
+
+	void CAsset::reloadChangedAssets()
+	{
+		Array<std::pair<AssetType, String>> changedAssets;
+
+		for (const auto& watcher : m_watchers)
+		{
+			for (const auto& change : watcher.retrieveChanges())
+			{
+				if ((change.second != FileAction::Added) && (change.second != FileAction::Modified))
+				{
+					continue;
+				}
+
+				if (const auto it = m_sourceFiles.find(change.first); it != m_sourceFiles.end())
+				{
+					changedAssets.append(it->second);
+				}
+			}
+		}
+
+		if (!changedAssets)
+		{
+			return;
+		}
+
+		// 同じファイルへの複数の変更や、重複して監視しているディレクトリからの通知は 1 回の読み込み直しにまとめる
+		changedAssets.sort().unique();
+
+		for (const auto& [assetType, name] : changedAssets)
+		{
+			auto& assetList = m_assetLists[static_cast<size_t>(assetType)];
+
+			const auto it = assetList.find(name);
+
+			if (it == assetList.end())
+			{
+				continue;
+			}
+
+			if (it->second->reload())
+			{
+				LOG_INFO(U"ℹ️ {}Asset: \"{}\" reloaded"_fmt(detail::GetAssetTypeName(assetType), name));
+			}
+			else
+			{
+				LOG_FAIL(U"❌ {}Asset: Failed to reload \"{}\""_fmt(detail::GetAssetTypeName(assetType), name));
+			}
+		}
+	}
 }
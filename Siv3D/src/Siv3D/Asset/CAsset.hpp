@@ -14,6 +14,7 @@
 # include <Siv3D/HashTable.hpp>
 # include <Siv3D/String.hpp>
 # include <Siv3D/Asset.hpp>
+# include <Siv3D/DirectoryWatcher.hpp>
 # include "IAsset.hpp"
 
 namespace s3d
@@ -23,6 +24,20 @@ namespace s3d
 	private:
 
 		std::array<HashTable<String, std::unique_ptr<IAsset>>, 3> m_assetLists;
+
+		bool m_hotReloadEnabled = false;
+
+		// アセットの読み込み元のディレクトリを監視する（サブディレクトリも監視されるため、重複しないよう登録する）
+		Array<DirectoryWatcher> m_watchers;
+
+		// 読み込み元のファイルのフルパスと、そのファイルから読み込むアセット
+		HashTable<FilePath, Array<std::pair<AssetType, String>>> m_sourceFiles;
+
+		void watchSource(AssetType assetType, const String& name, const IAsset& asset);
+
+		void unwatchSource(AssetType assetType, const String& name);
+
+		void reloadChangedAssets();
 	
 	public:
 
@@ -51,5 +66,9 @@ namespace s3d
 		void unregisterAll(AssetType assetType) override;
 
 		bool isReady(AssetType assetType, const String& name) const override;
+
+		void setHotReloadEnabled(bool enabled) override;
+
+		bool isHotReloadEnabled() const override;
 	};
 }
@@ -53,5 +53,9 @@ namespace s3d
 		virtual void unregisterAll(AssetType assetType) = 0;
 
 		virtual bool isReady(AssetType assetType, const String& name) const = 0;
+
+		virtual void setHotReloadEnabled(bool enabled) = 0;
+
+		virtual bool isHotReloadEnabled() const = 0;
 	};
 }
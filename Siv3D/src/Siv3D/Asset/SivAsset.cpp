@@ -16,7 +16,16 @@
 
 namespace s3d
 {
+	namespace Asset
+	{
+		void EnableHotReload(const bool enabled)
+		{
+			Siv3DEngine::GetAsset()->setHotReloadEnabled(enabled);
+		}
 
-
-
+		bool IsHotReloadEnabled()
+		{
+			return Siv3DEngine::GetAsset()->isHotReloadEnabled();
+		}
+	}
 }
@@ -15,6 +15,9 @@
 # if defined(SIV3D_TARGET_MACOS) || defined(SIV3D_TARGET_LINUX)
 
 # include <unistd.h>
+# include <array>
+# include <atomic>
+# include <thread>
 
 # if defined(SIV3D_TARGET_MACOS)
 
@@ -28,711 +31,154 @@
 
 # endif
 
-# include "../AudioControlManager.hpp"
-# include <Siv3D/Optional.hpp>
-# include <Siv3D/Audio.hpp>
 # include <Siv3D/Wave.hpp>
 # include <Siv3D/Logger.hpp>
+# include <Siv3D/Profiler.hpp>
+# include "../Mixer/SoftwareMixer.hpp"
 
 namespace s3d
 {
-	class SimpleVoice_AL
+	// SoftwareMixer の出力を 1 つの OpenAL ソースにストリーミングする
+	class MixerOutput_AL
 	{
 	private:
-		
-		const Wave* m_pWave = nullptr;
-		
+
+		static constexpr size_t NumBuffers = 3;
+
+		static constexpr size_t BufferSamples = 1024;
+
+		SoftwareMixer* m_mixer = nullptr;
+
 		ALuint m_source = 0;
-		
-		
-		bool m_isActive = false;
-		
-		bool m_isPaused = false;
-		
-		bool m_isEnd = false;
-		
+
+		std::array<ALuint, NumBuffers> m_buffers = {};
+
+		Array<WaveSample> m_mixBuffer;
+
+		Array<WaveSampleS16> m_outputBuffer;
 
 		std::thread m_thread;
-		
-		std::atomic<bool> m_abort = false;
-		
-		
-		static constexpr size_t BufferSamples = 2048;
-		
-		Array<WaveSampleS16> m_tmpBuffer;
-		
-		size_t m_freeBuffer = 2;
-		
-		std::atomic<size_t> m_readPos = 0;
-		
-		std::array<ALuint, 2> m_buffers = {{ 0, 0 }};
-		
-		size_t m_currentBufferID = 0;
-		
-		
-		void feedDetailNonLoop()
-		{
-			const size_t samplesLeft = m_pWave->size() - m_readPos;
-			
-			if (samplesLeft == 0)
-			{
-				return;
-			}
-			
-			const size_t samplesToFeed = std::min(samplesLeft, m_tmpBuffer.size());
-			
-			for (size_t i = 0; i < samplesToFeed; ++i)
-			{
-				const WaveSample& src = (*m_pWave)[m_readPos + i];
-				
-				m_tmpBuffer[i] = src.asWaveSampleS16();
-			}
-			
-			m_readPos += samplesToFeed;
-			
-			const size_t samplesWritten = samplesToFeed;
-			
-			::alBufferData(m_buffers[m_currentBufferID], AL_FORMAT_STEREO16, m_tmpBuffer.data(),
-						   static_cast<ALsizei>(samplesWritten * sizeof(WaveSampleS16)), m_pWave->samplingRate());
-			
-			::alSourceQueueBuffers(m_source, 1, &m_buffers[m_currentBufferID]);
-			
-			++m_currentBufferID %= 2;
-			
-			--m_freeBuffer;
-			
-			//LOG_DEBUG(U"feed {} samples, pos: {}"_fmt(samplesToFeed, m_readPos));
-		}
-		
-		void feed()
+
+		std::atomic<bool> m_abort = { false };
+
+		void feed(const ALuint buffer)
 		{
-			if (m_freeBuffer > 0)
+			if (m_mixer->isOfflineRendering())
 			{
-				feedDetailNonLoop();
+				std::fill(m_outputBuffer.begin(), m_outputBuffer.end(), WaveSampleS16::Zero());
 			}
-			
-			ALint processed = 0;
-			::alGetSourcei(m_source, AL_BUFFERS_PROCESSED, &processed);
-			
-			while (processed--)
+			else
 			{
-				ALuint buffer = 0;
-				
-				::alSourceUnqueueBuffers(m_source, 1, &buffer);
-				
-				++m_freeBuffer;
-				
-				feedDetailNonLoop();
+				m_mixer->mix(m_mixBuffer.data(), BufferSamples);
+
+				MixerKernel::ConvertToS16(m_outputBuffer.data(), m_mixBuffer.data(), BufferSamples);
 			}
+
+			::alBufferData(buffer, AL_FORMAT_STEREO16, m_outputBuffer.data(),
+						   static_cast<ALsizei>(m_outputBuffer.size() * sizeof(WaveSampleS16)), m_mixer->samplingRate());
+
+			::alSourceQueueBuffers(m_source, 1, &buffer);
 		}
-		
-		void onStreamEnd()
-		{
-			m_isActive = false;
-			m_isPaused = false;
-			m_isEnd = true;
-			
-			m_readPos  = 0;
-			
-			//LOG_TEST(U"End of Stream");
-		}
-		
+
 		void onUpdate()
 		{
-			for (;;)
+			Profiler::SetThreadName(U"Siv3D Audio");
+
+			while (!m_abort)
 			{
-				if (!m_source)
-				{
-					continue;
-				}
-				
-				if (m_isActive)
+				ALint processed = 0;
+				::alGetSourcei(m_source, AL_BUFFERS_PROCESSED, &processed);
+
+				while (processed-- > 0)
 				{
-					feed();
-					
-					ALint sampleOffset = 0;
-					::alGetSourcei(m_source, AL_SAMPLE_OFFSET, &sampleOffset);
+					SIV3D_PROFILE_SCOPE("Audio::mix");
+
+					ALuint buffer = 0;
+					::alSourceUnqueueBuffers(m_source, 1, &buffer);
+
+					feed(buffer);
 				}
-				
+
 				ALint currentState = 0;
 				::alGetSourcei(m_source, AL_SOURCE_STATE, &currentState);
-				
-				if (!m_isEnd && m_isActive && currentState == AL_STOPPED)
-				{
-					onStreamEnd();
-				}
-				
-				if (m_abort)
+
+				// バッファが枯渇してソースが停止した場合は再開する
+				if (currentState != AL_PLAYING)
 				{
-					break;
+					::alSourcePlay(m_source);
 				}
-				
+
 				::usleep(5 * 1000);
 			}
 		}
-		
+
 	public:
-		
-		SimpleVoice_AL() = default;
-		
-		SimpleVoice_AL(const Wave& wave, const double volume, const double pitch)
-			: m_pWave(&wave)
-			, m_tmpBuffer(BufferSamples)
-		{
-			::alGenBuffers(2, m_buffers.data());
-			::alGenSources(1, &m_source);
-			
-			::alSourcef(m_source, AL_GAIN, static_cast<float>(volume));
-			::alSourcef(m_source, AL_PITCH, static_cast<float>(pitch));
-			
-			::alSource3f(m_source, AL_POSITION, 0, 0, 0);
-			::alSource3f(m_source, AL_VELOCITY, 0, 0, 0);
-			::alSourcei(m_source, AL_LOOPING, AL_FALSE);
-			
-			feed();
 
-			m_thread = std::thread(&SimpleVoice_AL::onUpdate, this);
+		MixerOutput_AL() = default;
 
-			::alSourcePlay(m_source);
-			
-			m_isActive = true;
-			m_isPaused = false;
-		}
-		
-		~SimpleVoice_AL()
-		{
-			if (!m_abort)
-			{
-				m_abort = true;
-			}
-			
-			if (m_thread.joinable())
-			{
-				m_thread.join();
-			}
-			
-			if (m_source)
-			{
-				::alSourceStop(m_source);
-				
-				::alDeleteSources(1, &m_source);
-			}
-			
-			if (m_buffers[0])
-			{
-				::alDeleteBuffers(2, &m_buffers[0]);
-			}
-		}
-	};
-	
-	class VoiceStream_AL
-	{
-	private:
-		
-		const Wave* m_pWave = nullptr;
-		
-		ALuint m_source = 0;
-		
-		
-		Optional<AudioLoopTiming> m_loop;
-		
-		std::pair<double, double> m_volume = { 1.0, 1.0 };
-		
-		double m_speed = 1.0;
-		
-
-		bool m_isActive = false;
-		
-		bool m_isPaused = false;
-		
-		bool m_isEnd = false;
-		
-		
-		std::thread m_thread;
-		
-		bool m_hasThread = false;
-		
-		std::atomic<bool> m_abort = false;
-		
-		
-		std::atomic<int64> m_posSampleCurrentStream = 0;
-		
-		std::atomic<int64> m_samplesPlayedAccumulated = 0;
-		
-		std::atomic<size_t> m_posSmaplesAccumulated = 0;
-		
-		Array<size_t> m_samplesQueued;
-		
-		
-		static constexpr size_t BufferSamples = 2048;
-		
-		Array<WaveSampleS16> m_tmpBuffer;
-		
-		size_t m_freeBuffer = 2;
-		
-		std::atomic<size_t> m_readPos = 0;
-		
-		std::array<ALuint, 2> m_buffers = {{ 0, 0 }};
-		
-		size_t m_currentBufferID = 0;
-		
-		
-		void feedDetailNonLoop()
-		{
-			const size_t samplesLeft = m_pWave->size() - m_readPos;
-			
-			if (samplesLeft == 0)
-			{
-				return;
-			}
-			
-			const size_t samplesToFeed = std::min(samplesLeft, m_tmpBuffer.size());
-			
-			for (size_t i = 0; i < samplesToFeed; ++i)
-			{
-				const WaveSample& src = (*m_pWave)[m_readPos + i];
-				
-				m_tmpBuffer[i] = src.asWaveSampleS16();
-			}
-			
-			m_readPos += samplesToFeed;
-			
-			const size_t samplesWritten = samplesToFeed;
-			
-			::alBufferData(m_buffers[m_currentBufferID], AL_FORMAT_STEREO16, m_tmpBuffer.data(),
-						   static_cast<ALsizei>(samplesWritten * sizeof(WaveSampleS16)), m_pWave->samplingRate());
-			
-			::alSourceQueueBuffers(m_source, 1, &m_buffers[m_currentBufferID]);
-			
-			m_samplesQueued << samplesWritten;
-			
-			++m_currentBufferID %= 2;
-			
-			--m_freeBuffer;
-			
-			//LOG_DEBUG(U"feed {} samples, pos: {}"_fmt(samplesToFeed, m_readPos));
-		}
-		
-		void feedDetailLoop()
-		{
-			const size_t bufferSize = m_tmpBuffer.size();
-			size_t samplesFed = 0;
-			size_t tmpBufferPos = 0;
-			
-			while (samplesFed < bufferSize)
-			{
-				size_t samplesAvailable = m_loop->endPos - m_readPos;
-				
-				if (samplesAvailable == 0)
-				{
-					m_readPos = m_loop->beginPos;
-					
-					// [Siv3D ToDo] ループすると Audio::posSample() が Audio::streamPosSample() より大きくなる
-					m_posSmaplesAccumulated = m_loop->beginPos;
-					m_posSampleCurrentStream = 0;
-					
-					samplesAvailable = m_loop->endPos - m_loop->beginPos;
-				}
-				
-				const size_t samplesToFeed = std::min(samplesAvailable, bufferSize - samplesFed);
-				
-				for (size_t i = 0; i < samplesToFeed; ++i)
-				{
-					const WaveSample& src = (*m_pWave)[m_readPos + i];
-					
-					m_tmpBuffer[tmpBufferPos++] = src.asWaveSampleS16();
-				}
-				
-				samplesFed += samplesToFeed;
-				m_readPos += samplesToFeed;
-			}
-			
-			const size_t samplesWritten = samplesFed;
-			
-			::alBufferData(m_buffers[m_currentBufferID], AL_FORMAT_STEREO16, m_tmpBuffer.data(),
-						   static_cast<ALsizei>(samplesWritten * sizeof(WaveSampleS16)), m_pWave->samplingRate());
-			
-			::alSourceQueueBuffers(m_source, 1, &m_buffers[m_currentBufferID]);
-			
-			m_samplesQueued << samplesWritten;
-			
-			++m_currentBufferID %= 2;
-			
-			--m_freeBuffer;
-			
-			//LOG_DEBUG(U"feed {} samples, pos: {}"_fmt(samplesFed, m_readPos));
-		}
-		
-		void feed()
-		{
-			if (m_freeBuffer > 0)
-			{
-				if (m_loop)
-				{
-					feedDetailLoop();
-				}
-				else
-				{
-					feedDetailNonLoop();
-				}
-			}
-			
-			ALint processed = 0;
-			::alGetSourcei(m_source, AL_BUFFERS_PROCESSED, &processed);
-			
-			while (processed--)
-			{
-				ALuint buffer = 0;
-				
-				::alSourceUnqueueBuffers(m_source, 1, &buffer);
-				
-				m_posSmaplesAccumulated += m_samplesQueued.front();
-				
-				m_samplesPlayedAccumulated += m_samplesQueued.front();
-				
-				m_samplesQueued.pop_front();
-				
-				++m_freeBuffer;
-				
-				if (m_loop)
-				{
-					feedDetailLoop();
-				}
-				else
-				{
-					feedDetailNonLoop();
-				}
-			}
-			
-			//LOG_TEST(U"#{}+{}"_fmt(m_posSmaplesAccumulated, m_posSampleCurrentStream));
-		}
-		
-		void onStreamEnd()
+		~MixerOutput_AL()
 		{
-			m_isActive = false;
-			m_isPaused = false;
-			m_isEnd = true;
-			
-			m_readPos  = 0;
-			m_posSmaplesAccumulated = 0;
-			m_samplesPlayedAccumulated = 0;
-			m_posSampleCurrentStream = 0;
-
-			m_volume = { 1.0, 1.0 };
-			m_speed = 1.0;
-			
-			//LOG_TEST(U"End of Stream");
+			release();
 		}
-		
-		void onUpdate()
+
+		bool init(SoftwareMixer& mixer)
 		{
-			for (;;)
+			m_mixer = &mixer;
+			m_mixBuffer.resize(BufferSamples);
+			m_outputBuffer.resize(BufferSamples);
+
+			::alGenSources(1, &m_source);
+			::alGenBuffers(static_cast<ALsizei>(NumBuffers), m_buffers.data());
+
+			if (::alGetError() != AL_NO_ERROR)
 			{
-				if (!m_source)
-				{
-					continue;
-				}
-				
-				if (m_isActive)
-				{
-					feed();
-					
-					ALint sampleOffset = 0;
-					::alGetSourcei(m_source, AL_SAMPLE_OFFSET, &sampleOffset);
-					m_posSampleCurrentStream = sampleOffset;
-				}
-	
-				ALint currentState = 0;
-				::alGetSourcei(m_source, AL_SOURCE_STATE, &currentState);
-				
-				if (!m_isEnd && m_isActive && currentState == AL_STOPPED)
-				{
-					onStreamEnd();
-				}
-				
-				if (m_abort)
-				{
-					break;
-				}
+				LOG_FAIL(U"❌ MixerOutput_AL: Failed to create an OpenAL source");
 
-				::usleep(5 * 1000);
+				return false;
 			}
-		}
-		
-		void updateVolume()
-		{
-			// [Siv3D ToDo]
-			const float volume = static_cast<float>((m_volume.first + m_volume.second) * 0.5);
-			
-			::alSourcef(m_source, AL_GAIN, volume);
-		}
-		
-		void updateSpeed()
-		{
-			::alSourcef(m_source, AL_PITCH, static_cast<float>(m_speed));
-		}
-		
-	public:
-		
-		VoiceStream_AL() = default;
-		
-		VoiceStream_AL(const Wave& wave)
-			: m_pWave(&wave)
-			, m_tmpBuffer(BufferSamples)
-		{
-			::alGenBuffers(2, m_buffers.data());
-			::alGenSources(1, &m_source);
-			
-			::alSourcef(m_source, AL_GAIN, 1.0);
-			::alSourcef(m_source, AL_PITCH, 1.0);
-			
+
+			::alSourcef(m_source, AL_GAIN, 1.0f);
+			::alSourcef(m_source, AL_PITCH, 1.0f);
 			::alSource3f(m_source, AL_POSITION, 0, 0, 0);
 			::alSource3f(m_source, AL_VELOCITY, 0, 0, 0);
 			::alSourcei(m_source, AL_LOOPING, AL_FALSE);
-		}
-		
-		~VoiceStream_AL()
-		{
-			if (!m_abort)
+
+			for (const auto buffer : m_buffers)
 			{
-				m_abort = true;
+				feed(buffer);
 			}
-			
+
+			::alSourcePlay(m_source);
+
+			m_thread = std::thread(&MixerOutput_AL::onUpdate, this);
+
+			return true;
+		}
+
+		void release()
+		{
+			m_abort = true;
+
 			if (m_thread.joinable())
 			{
 				m_thread.join();
 			}
-			
+
 			if (m_source)
 			{
 				::alSourceStop(m_source);
-				
+
 				::alDeleteSources(1, &m_source);
-			}
-			
-			if (m_buffers[0])
-			{
-				::alDeleteBuffers(2, &m_buffers[0]);
-			}
-		}
-		
-		bool isPlaying() const
-		{
-			return m_isActive && !m_isPaused;
-		}
-		
-		bool isPaused() const
-		{
-			return m_isPaused;
-		}
-		
-		int64 streamPosSample() const
-		{
-			return m_readPos;
-		}
-		
-		int64 getPosSample() const
-		{
-			//LOG_TEST(U"{}+{}"_fmt(m_posSmaplesAccumulated, m_posSampleCurrentStream));
-			
-			return std::min<int64>(m_posSmaplesAccumulated + m_posSampleCurrentStream, m_pWave->size());
-		}
-		
-		int64 samplesPlayed() const
-		{
-			return m_samplesPlayedAccumulated + m_posSampleCurrentStream;
-		}
-		
-		void setVolume(const std::pair<double, double>& volume)
-		{
-			if (volume == m_volume)
-			{
-				return;
-			}
-			
-			m_volume = volume;
-			
-			updateVolume();
-		}
-		
-		const std::pair<double, double> getVolume() const
-		{
-			return m_volume;
-		}
-		
-		void setSpeed(const double speed)
-		{
-			const double newSpeed = Clamp<double>(speed, 1.0 / 1024.0, 2.0);
-			
-			if (newSpeed == m_speed)
-			{
-				return;
-			}
-			
-			m_speed = newSpeed;
-			
-			updateSpeed();
-		}
-		
-		double getSpeed() const
-		{
-			return m_speed;
-		}
-		
-		void setLoop(const bool loop, const int64 loopBeginSample, const int64 loopEndSample)
-		{
-			if (!loop)
-			{
-				m_loop.reset();
-			}
-			else
-			{
-				m_loop.emplace(loopBeginSample, loopEndSample);
-			}
-			
-			stop();
-		}
-		
-		const Optional<AudioLoopTiming>& getLoop() const
-		{
-			return m_loop;
-		}
-		
-		bool play()
-		{
-			if (m_isActive && !m_isPaused)
-			{
-				return true;
-			}
-			
-			feed();
-			
-			if (!m_hasThread)
-			{
-				m_thread = std::thread(&VoiceStream_AL::onUpdate, this);
-				
-				m_hasThread = true;
-			}
 
-			::alSourcePlay(m_source);
-			
-			m_isActive = true;
-			m_isPaused = false;
-			m_isEnd = false;
-			
-			return true;
-		}
-		
-		void pause()
-		{
-			if (!m_isActive)
-			{
-				return;
+				m_source = 0;
 			}
-			
-			::alSourcePause(m_source);
-			
-			m_isPaused = true;
-		}
-		
-		void stop()
-		{
-			if (!m_isActive)
-			{
-				return;
-			}
-			
-			::alSourceStop(m_source);
-			
-			//m_isActive = false;
-			//m_isPaused = false;
-		}
-		
-		bool reachedEnd() const
-		{
-			return m_isEnd;
-		}
-		
-		void setPosSmaple(int64 posSample)
-		{
-			if (m_loop && posSample >= m_loop->endPos)
-			{
-				posSample = m_loop->endPos - 1;
-			}
-			
-			posSample = std::min<int64>(posSample, m_pWave->size() - 1);
-			
-			m_readPos = posSample;
-			
-			m_posSmaplesAccumulated = posSample;
-		}
-	};
-	
-	class Audio_AL
-	{
-	private:
-	
-		Wave m_wave;
-		
-		bool m_initialized = false;
-		
-		VoiceStream_AL m_stream;
-		
-		static constexpr size_t MaxVoiceShots = 32;
-		
-		Array<std::shared_ptr<SimpleVoice_AL>> m_voiceShots;
-		
-	public:
-		
-		Audio_AL() = default;
-		
-		Audio_AL(Wave&& wave)
-			: m_wave(std::move(wave))
-			, m_stream(m_wave)
-		{
-			m_initialized = true;
-			
-			m_voiceShots.reserve(MaxVoiceShots);
-		}
-		
-		~Audio_AL()
-		{
-			m_voiceShots.clear();
-		}
-		
-		bool isInitialized() const noexcept
-		{
-			return m_initialized;
-		}
 
-		const Wave& getWave() const
-		{
-			return m_wave;
-		}
-		
-		VoiceStream_AL& getStream()
-		{
-			return m_stream;
-		}
-		
-		const VoiceStream_AL& getStream() const
-		{
-			return m_stream;
-		}
-		
-		void playOneShot(const double volume, const double pitch)
-		{
-			if (m_voiceShots.size() + 1 >= MaxVoiceShots)
+			if (m_buffers[0])
 			{
-				m_voiceShots.pop_front();
+				::alDeleteBuffers(static_cast<ALsizei>(NumBuffers), m_buffers.data());
+
+				m_buffers = {};
 			}
-			
-			m_voiceShots.push_back(std::make_shared<SimpleVoice_AL>(m_wave, volume, pitch));
-		}
-		
-		void stopAllShots()
-		{
-			m_voiceShots.clear();
 		}
 	};
 }
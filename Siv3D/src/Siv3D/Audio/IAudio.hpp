@@ -15,6 +15,8 @@
 
 namespace s3d
 {
+	class SoftwareMixer;
+
 	class ISiv3DAudio
 	{
 	public:
@@ -43,7 +45,7 @@ namespace s3d
 
 		virtual void stop(AudioID handleID, const SecondsF& fadeoutDuration) = 0;
 
-		virtual void playOneShot(AudioID handleID, double volume, double pitch) = 0;
+		virtual void playOneShot(AudioID handleID, double volume, double pitch, double pan) = 0;
 
 		virtual void stopAllShots(AudioID handleID) = 0;
 
@@ -74,5 +76,8 @@ namespace s3d
 		virtual bool updateFade() = 0;
 
 		virtual void fadeMasterVolume() = 0;
+
+		// SoftwareMixer を使わないバックエンドでは nullptr
+		virtual SoftwareMixer* getMixer() = 0;
 	};
 }
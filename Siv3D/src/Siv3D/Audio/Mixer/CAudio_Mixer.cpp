@@ -0,0 +1,178 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/MathConstants.hpp>
+# include "CAudio_Mixer.hpp"
+
+namespace s3d
+{
+	CAudio_Mixer::CAudio_Mixer()
+	{
+
+	}
+
+	CAudio_Mixer::~CAudio_Mixer()
+	{
+		m_audios.destroy();
+	}
+
+	bool CAudio_Mixer::initMixer()
+	{
+		const auto nullAudio = std::make_shared<MixerAudio>(m_mixer,
+			Wave(SecondsF(0.5), Arg::generator = [](double t) {
+				return 0.5 * std::sin(t * Math::TwoPi) * std::sin(t * Math::TwoPi * 220.0 * (t * 4.0 + 1.0)); }));
+
+		m_audios.setNullData(nullAudio);
+
+		return true;
+	}
+
+	AudioID CAudio_Mixer::create(Wave&& wave)
+	{
+		if (!wave)
+		{
+			return AudioID::NullAsset();
+		}
+
+		return m_audios.add(std::make_shared<MixerAudio>(m_mixer, std::move(wave)));
+	}
+
+	void CAudio_Mixer::release(const AudioID handleID)
+	{
+		m_audios.erase(handleID);
+	}
+
+	uint32 CAudio_Mixer::samplingRate(const AudioID handleID)
+	{
+		return m_audios[handleID]->getWave().samplingRate();
+	}
+
+	size_t CAudio_Mixer::samples(const AudioID handleID)
+	{
+		return m_audios[handleID]->getWave().size();
+	}
+
+	void CAudio_Mixer::setLoop(const AudioID handleID, const bool loop, const int64 loopBeginSample, const int64 loopEndSample)
+	{
+		const MixerVoiceID stream = m_audios[handleID]->getStream();
+
+		if (loop)
+		{
+			m_mixer.setLoop(stream, AudioLoopTiming(loopBeginSample, loopEndSample));
+		}
+		else
+		{
+			m_mixer.setLoop(stream, none);
+		}
+	}
+
+	bool CAudio_Mixer::play(const AudioID handleID, const SecondsF& fadeinDuration)
+	{
+		return m_mixer.play(m_audios[handleID]->getStream(), fadeinDuration.count());
+	}
+
+	void CAudio_Mixer::pause(const AudioID handleID, const SecondsF& fadeoutDuration)
+	{
+		m_mixer.pause(m_audios[handleID]->getStream(), fadeoutDuration.count());
+	}
+
+	void CAudio_Mixer::stop(const AudioID handleID, const SecondsF& fadeoutDuration)
+	{
+		m_mixer.stop(m_audios[handleID]->getStream(), fadeoutDuration.count());
+	}
+
+	void CAudio_Mixer::playOneShot(const AudioID handleID, const double volume, const double pitch, const double pan)
+	{
+		m_mixer.playOneShot(m_audios[handleID]->getWave(), volume, pitch, pan);
+	}
+
+	void CAudio_Mixer::stopAllShots(const AudioID handleID)
+	{
+		m_mixer.stopAllShots(m_audios[handleID]->getWave());
+	}
+
+	bool CAudio_Mixer::isPlaying(const AudioID handleID)
+	{
+		return m_mixer.isPlaying(m_audios[handleID]->getStream());
+	}
+
+	bool CAudio_Mixer::isPaused(const AudioID handleID)
+	{
+		return m_mixer.isPaused(m_audios[handleID]->getStream());
+	}
+
+	uint64 CAudio_Mixer::posSample(const AudioID handleID)
+	{
+		return m_mixer.posSample(m_audios[handleID]->getStream());
+	}
+
+	uint64 CAudio_Mixer::streamPosSample(const AudioID handleID)
+	{
+		// ミキサーは先読みしないため、再生位置とストリームの位置は一致する
+		return m_mixer.posSample(m_audios[handleID]->getStream());
+	}
+
+	uint64 CAudio_Mixer::samplesPlayed(const AudioID handleID)
+	{
+		return m_mixer.samplesPlayed(m_audios[handleID]->getStream());
+	}
+
+	const Wave& CAudio_Mixer::getWave(const AudioID handleID)
+	{
+		return m_audios[handleID]->getWave();
+	}
+
+	void CAudio_Mixer::setPosSample(const AudioID handleID, const int64 sample)
+	{
+		m_mixer.setPosSample(m_audios[handleID]->getStream(), sample);
+	}
+
+	void CAudio_Mixer::setVolume(const AudioID handleID, const std::pair<double, double>& volume)
+	{
+		m_mixer.setVolume(m_audios[handleID]->getStream(), volume);
+	}
+
+	std::pair<double, double> CAudio_Mixer::getVolume(const AudioID handleID)
+	{
+		return m_mixer.getVolume(m_audios[handleID]->getStream());
+	}
+
+	void CAudio_Mixer::setSpeed(const AudioID handleID, const double speed)
+	{
+		m_mixer.setSpeed(m_audios[handleID]->getStream(), speed);
+	}
+
+	double CAudio_Mixer::getSpeed(const AudioID handleID)
+	{
+		return m_mixer.getSpeed(m_audios[handleID]->getStream());
+	}
+
+	std::pair<double, double> CAudio_Mixer::getMinMaxSpeed(const AudioID)
+	{
+		return{ SoftwareMixer::MinSpeed, SoftwareMixer::MaxSpeed };
+	}
+
+	bool CAudio_Mixer::updateFade()
+	{
+		// フェードはミキサーがサンプル単位で処理する
+		return true;
+	}
+
+	void CAudio_Mixer::fadeMasterVolume()
+	{
+		// [Siv3D ToDo]
+	}
+
+	SoftwareMixer* CAudio_Mixer::getMixer()
+	{
+		return &m_mixer;
+	}
+}
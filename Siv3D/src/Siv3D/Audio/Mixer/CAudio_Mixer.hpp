@@ -0,0 +1,120 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "../IAudio.hpp"
+# include "../../AssetHandleManager/AssetHandleManager.hpp"
+# include "SoftwareMixer.hpp"
+
+namespace s3d
+{
+	class MixerAudio
+	{
+	private:
+
+		SoftwareMixer* m_mixer = nullptr;
+
+		Wave m_wave;
+
+		MixerVoiceID m_stream = 0;
+
+	public:
+
+		MixerAudio(SoftwareMixer& mixer, Wave&& wave)
+			: m_mixer(&mixer)
+			, m_wave(std::move(wave))
+			, m_stream(mixer.addStream(m_wave)) {}
+
+		~MixerAudio()
+		{
+			m_mixer->removeVoices(m_wave);
+		}
+
+		const Wave& getWave() const noexcept
+		{
+			return m_wave;
+		}
+
+		MixerVoiceID getStream() const noexcept
+		{
+			return m_stream;
+		}
+	};
+
+	// SoftwareMixer で全ボイスをミックスするオーディオバックエンドの基底クラス
+	// 派生クラスはミキサーの出力をデバイスに送る処理だけを実装する。
+	class CAudio_Mixer : public ISiv3DAudio
+	{
+	protected:
+
+		SoftwareMixer m_mixer;
+
+		AssetHandleManager<AudioID, MixerAudio> m_audios{ U"Audio" };
+
+		bool initMixer();
+
+	public:
+
+		CAudio_Mixer();
+
+		~CAudio_Mixer() override;
+
+		AudioID create(Wave&& wave) override;
+
+		void release(AudioID handleID) override;
+
+		uint32 samplingRate(AudioID handleID) override;
+
+		size_t samples(AudioID handleID) override;
+
+		void setLoop(AudioID handleID, bool loop, int64 loopBeginSample, int64 loopEndSample) override;
+
+		bool play(AudioID handleID, const SecondsF& fadeinDuration) override;
+
+		void pause(AudioID handleID, const SecondsF& fadeoutDuration) override;
+
+		void stop(AudioID handleID, const SecondsF& fadeoutDuration) override;
+
+		void playOneShot(AudioID handleID, double volume, double pitch, double pan) override;
+
+		void stopAllShots(AudioID handleID) override;
+
+		bool isPlaying(AudioID handleID) override;
+
+		bool isPaused(AudioID handleID) override;
+
+		uint64 posSample(AudioID handleID) override;
+
+		uint64 streamPosSample(AudioID handleID) override;
+
+		uint64 samplesPlayed(AudioID handleID) override;
+
+		const Wave& getWave(AudioID handleID) override;
+
+		void setPosSample(AudioID handleID, int64 sample) override;
+
+		void setVolume(AudioID handleID, const std::pair<double, double>& volume) override;
+
+		std::pair<double, double> getVolume(AudioID handleID) override;
+
+		void setSpeed(AudioID handleID, double speed) override;
+
+		double getSpeed(AudioID handleID) override;
+
+		std::pair<double, double> getMinMaxSpeed(AudioID handleID) override;
+
+		bool updateFade() override;
+
+		void fadeMasterVolume() override;
+
+		SoftwareMixer* getMixer() override;
+	};
+}
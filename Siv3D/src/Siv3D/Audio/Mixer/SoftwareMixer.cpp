@@ -0,0 +1,750 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <cmath>
+# include <Siv3D/CPU.hpp>
+# include "SoftwareMixer.hpp"
+
+# if defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+	# define SIV3D_MIXERKERNEL_REFERENCE
+
+# else
+
+	# include <immintrin.h>
+
+	# if defined(__GNUC__) || defined(__clang__)
+
+		# define SIV3D_TARGET_AVX2 __attribute__((target("avx2")))
+
+	# else
+
+		# define SIV3D_TARGET_AVX2
+
+	# endif
+
+# endif
+
+namespace s3d
+{
+	namespace detail
+	{
+		constexpr uint64 FixedOne = uint64(1) << 32;
+
+		constexpr uint64 FixedFractionMask = FixedOne - 1;
+
+		constexpr float FixedToFloat = 1.0f / 4294967296.0f;
+
+		//////////////////////////////////////////////////
+		//
+		//	Reference
+		//
+		//////////////////////////////////////////////////
+
+		static void MixAddReference(WaveSample* dst, const WaveSample* src, const size_t samples, const float gainL, const float gainR)
+		{
+			for (size_t i = 0; i < samples; ++i)
+			{
+				dst[i].left += src[i].left * gainL;
+				dst[i].right += src[i].right * gainR;
+			}
+		}
+
+		static void MixAddResampledReference(WaveSample* dst, const WaveSample* src, const size_t samples, uint64 position, const uint64 step, const float gainL, const float gainR)
+		{
+			for (size_t i = 0; i < samples; ++i, position += step)
+			{
+				const WaveSample& a = src[position >> 32];
+				const WaveSample& b = src[(position >> 32) + 1];
+				const float t = (position & FixedFractionMask) * FixedToFloat;
+
+				dst[i].left += (a.left + (b.left - a.left) * t) * gainL;
+				dst[i].right += (a.right + (b.right - a.right) * t) * gainR;
+			}
+		}
+
+		static void ConvertToS16Reference(WaveSampleS16* dst, const WaveSample* src, const size_t samples)
+		{
+			for (size_t i = 0; i < samples; ++i)
+			{
+				dst[i].left = static_cast<int16>(Clamp(src[i].left, -1.0f, 1.0f) * 32767.0f);
+				dst[i].right = static_cast<int16>(Clamp(src[i].right, -1.0f, 1.0f) * 32767.0f);
+			}
+		}
+
+	# if !defined(SIV3D_MIXERKERNEL_REFERENCE)
+
+		//////////////////////////////////////////////////
+		//
+		//	SSE2
+		//
+		//////////////////////////////////////////////////
+
+		inline __m128 LoadSamples2(const WaveSample* p)
+		{
+			return ::_mm_loadu_ps(&p->left);
+		}
+
+		inline void StoreSamples2(WaveSample* p, const __m128 v)
+		{
+			::_mm_storeu_ps(&p->left, v);
+		}
+
+		static void MixAddSSE2(WaveSample* dst, const WaveSample* src, const size_t samples, const float gainL, const float gainR)
+		{
+			const __m128 gain = ::_mm_setr_ps(gainL, gainR, gainL, gainR);
+			const size_t samples2 = samples & ~size_t(1);
+
+			for (size_t i = 0; i < samples2; i += 2)
+			{
+				const __m128 s = ::_mm_mul_ps(LoadSamples2(src + i), gain);
+				StoreSamples2(dst + i, ::_mm_add_ps(LoadSamples2(dst + i), s));
+			}
+
+			MixAddReference(dst + samples2, src + samples2, samples - samples2, gainL, gainR);
+		}
+
+		static void MixAddResampledSSE2(WaveSample* dst, const WaveSample* src, const size_t samples, uint64 position, const uint64 step, const float gainL, const float gainR)
+		{
+			const __m128 gain = ::_mm_setr_ps(gainL, gainR, gainL, gainR);
+			const size_t samples2 = samples & ~size_t(1);
+
+			for (size_t i = 0; i < samples2; i += 2)
+			{
+				const uint64 position1 = position + step;
+				const WaveSample* p0 = src + (position >> 32);
+				const WaveSample* p1 = src + (position1 >> 32);
+
+				// a = (p0[0], p1[0]), b = (p0[1], p1[1])
+				const __m128 a = ::_mm_loadh_pi(::_mm_loadl_pi(::_mm_setzero_ps(), reinterpret_cast<const __m64*>(p0)), reinterpret_cast<const __m64*>(p1));
+				const __m128 b = ::_mm_loadh_pi(::_mm_loadl_pi(::_mm_setzero_ps(), reinterpret_cast<const __m64*>(p0 + 1)), reinterpret_cast<const __m64*>(p1 + 1));
+
+				const float t0 = (position & FixedFractionMask) * FixedToFloat;
+				const float t1 = (position1 & FixedFractionMask) * FixedToFloat;
+				const __m128 t = ::_mm_setr_ps(t0, t0, t1, t1);
+
+				const __m128 s = ::_mm_add_ps(a, ::_mm_mul_ps(::_mm_sub_ps(b, a), t));
+				StoreSamples2(dst + i, ::_mm_add_ps(LoadSamples2(dst + i), ::_mm_mul_ps(s, gain)));
+
+				position = position1 + step;
+			}
+
+			MixAddResampledReference(dst + samples2, src, samples - samples2, position, step, gainL, gainR);
+		}
+
+		static void ConvertToS16SSE2(WaveSampleS16* dst, const WaveSample* src, const size_t samples)
+		{
+			const __m128 minValue = ::_mm_set1_ps(-1.0f);
+			const __m128 maxValue = ::_mm_set1_ps(1.0f);
+			const __m128 scale = ::_mm_set1_ps(32767.0f);
+			const size_t samples4 = samples & ~size_t(3);
+
+			for (size_t i = 0; i < samples4; i += 4)
+			{
+				const __m128 v0 = ::_mm_mul_ps(::_mm_min_ps(::_mm_max_ps(LoadSamples2(src + i), minValue), maxValue), scale);
+				const __m128 v1 = ::_mm_mul_ps(::_mm_min_ps(::_mm_max_ps(LoadSamples2(src + i + 2), minValue), maxValue), scale);
+				const __m128i packed = ::_mm_packs_epi32(::_mm_cvttps_epi32(v0), ::_mm_cvttps_epi32(v1));
+				::_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), packed);
+			}
+
+			ConvertToS16Reference(dst + samples4, src + samples4, samples - samples4);
+		}
+
+		//////////////////////////////////////////////////
+		//
+		//	AVX2
+		//
+		//////////////////////////////////////////////////
+
+		SIV3D_TARGET_AVX2
+		static void MixAddAVX2(WaveSample* dst, const WaveSample* src, const size_t samples, const float gainL, const float gainR)
+		{
+			const __m256 gain = ::_mm256_setr_ps(gainL, gainR, gainL, gainR, gainL, gainR, gainL, gainR);
+			const size_t samples4 = samples & ~size_t(3);
+
+			for (size_t i = 0; i < samples4; i += 4)
+			{
+				const __m256 s = ::_mm256_mul_ps(::_mm256_loadu_ps(&src[i].left), gain);
+				::_mm256_storeu_ps(&dst[i].left, ::_mm256_add_ps(::_mm256_loadu_ps(&dst[i].left), s));
+			}
+
+			MixAddReference(dst + samples4, src + samples4, samples - samples4, gainL, gainR);
+		}
+
+	# endif
+	}
+
+	namespace MixerKernel
+	{
+	# if defined(SIV3D_MIXERKERNEL_REFERENCE)
+
+		void MixAdd(WaveSample* dst, const WaveSample* src, const size_t samples, const float gainL, const float gainR)
+		{
+			detail::MixAddReference(dst, src, samples, gainL, gainR);
+		}
+
+		void MixAddResampled(WaveSample* dst, const WaveSample* src, const size_t samples, const uint64 position, const uint64 step, const float gainL, const float gainR)
+		{
+			detail::MixAddResampledReference(dst, src, samples, position, step, gainL, gainR);
+		}
+
+		void ConvertToS16(WaveSampleS16* dst, const WaveSample* src, const size_t samples)
+		{
+			detail::ConvertToS16Reference(dst, src, samples);
+		}
+
+	# else
+
+		void MixAdd(WaveSample* dst, const WaveSample* src, const size_t samples, const float gainL, const float gainR)
+		{
+			const CPUFeature& cpu = CPU::GetFeature();
+
+			if (cpu.AVX2)
+			{
+				detail::MixAddAVX2(dst, src, samples, gainL, gainR);
+			}
+			else if (cpu.SSE2)
+			{
+				detail::MixAddSSE2(dst, src, samples, gainL, gainR);
+			}
+			else
+			{
+				detail::MixAddReference(dst, src, samples, gainL, gainR);
+			}
+		}
+
+		void MixAddResampled(WaveSample* dst, const WaveSample* src, const size_t samples, const uint64 position, const uint64 step, const float gainL, const float gainR)
+		{
+			if (CPU::GetFeature().SSE2)
+			{
+				detail::MixAddResampledSSE2(dst, src, samples, position, step, gainL, gainR);
+			}
+			else
+			{
+				detail::MixAddResampledReference(dst, src, samples, position, step, gainL, gainR);
+			}
+		}
+
+		void ConvertToS16(WaveSampleS16* dst, const WaveSample* src, const size_t samples)
+		{
+			if (CPU::GetFeature().SSE2)
+			{
+				detail::ConvertToS16SSE2(dst, src, samples);
+			}
+			else
+			{
+				detail::ConvertToS16Reference(dst, src, samples);
+			}
+		}
+
+	# endif
+	}
+
+	SoftwareMixer::SoftwareMixer(const uint32 samplingRate)
+		: m_samplingRate(samplingRate)
+	{
+
+	}
+
+	uint32 SoftwareMixer::samplingRate() const noexcept
+	{
+		return m_samplingRate;
+	}
+
+	MixerVoiceID SoftwareMixer::addStream(const Wave& wave)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		Voice voice;
+		voice.wave = &wave;
+		voice.id = ++m_idCount;
+		updateStep(voice);
+
+		m_voices.push_back(voice);
+
+		return voice.id;
+	}
+
+	void SoftwareMixer::removeVoices(const Wave& wave)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		m_voices.remove_if([&wave](const Voice& voice) { return voice.wave == &wave; });
+	}
+
+	void SoftwareMixer::playOneShot(const Wave& wave, const double volume, const double pitch, const double pan)
+	{
+		if (!wave)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		size_t numShots = 0, numShotsOfWave = 0;
+		Voice* oldestShot = nullptr;
+		Voice* oldestShotOfWave = nullptr;
+
+		for (auto& voice : m_voices)
+		{
+			if (!voice.oneShot)
+			{
+				continue;
+			}
+
+			++numShots;
+
+			if (!oldestShot || voice.id < oldestShot->id)
+			{
+				oldestShot = &voice;
+			}
+
+			if (voice.wave == &wave)
+			{
+				++numShotsOfWave;
+
+				if (!oldestShotOfWave || voice.id < oldestShotOfWave->id)
+				{
+					oldestShotOfWave = &voice;
+				}
+			}
+		}
+
+		// 上限に達している場合は最も古いワンショットを置き換える
+		Voice* target = nullptr;
+
+		if (numShotsOfWave >= MaxShotsPerWave)
+		{
+			target = oldestShotOfWave;
+		}
+		else if (numShots >= MaxShots)
+		{
+			target = oldestShot;
+		}
+		else
+		{
+			target = &m_voices.emplace_back();
+		}
+
+		const double clampedPan = Clamp(pan, -1.0, 1.0);
+
+		*target = Voice();
+		target->wave = &wave;
+		target->id = ++m_idCount;
+		target->volume = { volume * std::min(1.0, 1.0 - clampedPan), volume * std::min(1.0, 1.0 + clampedPan) };
+		target->gainL = static_cast<float>(target->volume.first);
+		target->gainR = static_cast<float>(target->volume.second);
+		target->speed = Clamp(pitch, MinSpeed, MaxSpeed);
+		target->state = VoiceState::Playing;
+		target->oneShot = true;
+		updateStep(*target);
+	}
+
+	void SoftwareMixer::stopAllShots(const Wave& wave)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		m_voices.remove_if([&wave](const Voice& voice) { return voice.oneShot && (voice.wave == &wave); });
+	}
+
+	void SoftwareMixer::setLoop(const MixerVoiceID id, const Optional<AudioLoopTiming>& loop)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (Voice* voice = findVoice(id))
+		{
+			voice->loop.reset();
+
+			if (loop)
+			{
+				const int64 endPos = std::min<int64>(loop->endPos, voice->wave->size());
+
+				if (0 <= loop->beginPos && loop->beginPos < endPos)
+				{
+					voice->loop.emplace(loop->beginPos, endPos);
+				}
+			}
+
+			ApplyState(*voice, VoiceState::Stopped);
+		}
+	}
+
+	bool SoftwareMixer::play(const MixerVoiceID id, const double fadeinSec)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		Voice* voice = findVoice(id);
+
+		if (!voice)
+		{
+			return false;
+		}
+
+		if ((voice->state == VoiceState::Playing) && (voice->fadeDelta >= 0.0f))
+		{
+			return true;
+		}
+
+		if (fadeinSec > 0.0)
+		{
+			if (voice->state != VoiceState::Playing)
+			{
+				voice->fade = 0.0f;
+			}
+
+			startFade(*voice, 1.0f, fadeinSec);
+		}
+		else
+		{
+			voice->fade = 1.0f;
+			voice->fadeDelta = 0.0f;
+			voice->fadeSamplesLeft = 0;
+		}
+
+		voice->state = VoiceState::Playing;
+
+		return true;
+	}
+
+	void SoftwareMixer::pause(const MixerVoiceID id, const double fadeoutSec)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		Voice* voice = findVoice(id);
+
+		if (!voice || (voice->state != VoiceState::Playing))
+		{
+			return;
+		}
+
+		if (fadeoutSec > 0.0)
+		{
+			voice->stateAfterFade = VoiceState::Paused;
+			startFade(*voice, 0.0f, fadeoutSec);
+		}
+		else
+		{
+			ApplyState(*voice, VoiceState::Paused);
+		}
+	}
+
+	void SoftwareMixer::stop(const MixerVoiceID id, const double fadeoutSec)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		Voice* voice = findVoice(id);
+
+		if (!voice || (voice->state == VoiceState::Stopped))
+		{
+			return;
+		}
+
+		if ((fadeoutSec > 0.0) && (voice->state == VoiceState::Playing))
+		{
+			voice->stateAfterFade = VoiceState::Stopped;
+			startFade(*voice, 0.0f, fadeoutSec);
+		}
+		else
+		{
+			ApplyState(*voice, VoiceState::Stopped);
+		}
+	}
+
+	bool SoftwareMixer::isPlaying(const MixerVoiceID id) const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		const Voice* voice = findVoice(id);
+
+		return voice && (voice->state == VoiceState::Playing);
+	}
+
+	bool SoftwareMixer::isPaused(const MixerVoiceID id) const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		const Voice* voice = findVoice(id);
+
+		return voice && (voice->state == VoiceState::Paused);
+	}
+
+	int64 SoftwareMixer::posSample(const MixerVoiceID id) const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		const Voice* voice = findVoice(id);
+
+		return voice ? static_cast<int64>(voice->position >> 32) : 0;
+	}
+
+	int64 SoftwareMixer::samplesPlayed(const MixerVoiceID id) const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		const Voice* voice = findVoice(id);
+
+		return voice ? voice->samplesPlayed : 0;
+	}
+
+	void SoftwareMixer::setPosSample(const MixerVoiceID id, int64 sample)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (Voice* voice = findVoice(id))
+		{
+			if (voice->loop && (sample >= voice->loop->endPos))
+			{
+				sample = voice->loop->endPos - 1;
+			}
+
+			sample = Clamp<int64>(sample, 0, voice->wave->size() - 1);
+
+			voice->position = static_cast<uint64>(sample) << 32;
+		}
+	}
+
+	void SoftwareMixer::setVolume(const MixerVoiceID id, const std::pair<double, double>& volume)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (Voice* voice = findVoice(id))
+		{
+			voice->volume = volume;
+			voice->gainL = static_cast<float>(volume.first);
+			voice->gainR = static_cast<float>(volume.second);
+		}
+	}
+
+	std::pair<double, double> SoftwareMixer::getVolume(const MixerVoiceID id) const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		const Voice* voice = findVoice(id);
+
+		return voice ? voice->volume : std::pair<double, double>(1.0, 1.0);
+	}
+
+	void SoftwareMixer::setSpeed(const MixerVoiceID id, const double speed)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (Voice* voice = findVoice(id))
+		{
+			voice->speed = Clamp(speed, MinSpeed, MaxSpeed);
+
+			updateStep(*voice);
+		}
+	}
+
+	double SoftwareMixer::getSpeed(const MixerVoiceID id) const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		const Voice* voice = findVoice(id);
+
+		return voice ? voice->speed : 1.0;
+	}
+
+	size_t SoftwareMixer::num_activeVoices() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		return m_voices.count_if([](const Voice& voice) { return voice.state == VoiceState::Playing; });
+	}
+
+	void SoftwareMixer::setOfflineRendering(const bool enabled) noexcept
+	{
+		m_offlineRendering = enabled;
+	}
+
+	bool SoftwareMixer::isOfflineRendering() const noexcept
+	{
+		return m_offlineRendering;
+	}
+
+	void SoftwareMixer::mix(WaveSample* dst, const size_t samples)
+	{
+		std::fill(dst, dst + samples, WaveSample::Zero());
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		bool hasFinishedShots = false;
+
+		for (auto& voice : m_voices)
+		{
+			if (voice.state != VoiceState::Playing)
+			{
+				continue;
+			}
+
+			mixVoice(voice, dst, samples);
+
+			hasFinishedShots |= (voice.oneShot && (voice.state == VoiceState::Stopped));
+		}
+
+		if (hasFinishedShots)
+		{
+			m_voices.remove_if([](const Voice& voice) { return voice.oneShot && (voice.state == VoiceState::Stopped); });
+		}
+	}
+
+	SoftwareMixer::Voice* SoftwareMixer::findVoice(const MixerVoiceID id)
+	{
+		for (auto& voice : m_voices)
+		{
+			if (voice.id == id)
+			{
+				return &voice;
+			}
+		}
+
+		return nullptr;
+	}
+
+	const SoftwareMixer::Voice* SoftwareMixer::findVoice(const MixerVoiceID id) const
+	{
+		for (const auto& voice : m_voices)
+		{
+			if (voice.id == id)
+			{
+				return &voice;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void SoftwareMixer::updateStep(Voice& voice) const
+	{
+		const double ratio = voice.speed * voice.wave->samplingRate() / m_samplingRate;
+
+		voice.step = std::max<uint64>(1, static_cast<uint64>(std::llround(ratio * detail::FixedOne)));
+	}
+
+	void SoftwareMixer::startFade(Voice& voice, const float target, const double durationSec) const
+	{
+		voice.fadeSamplesLeft = static_cast<uint32>(std::clamp(durationSec * m_samplingRate, 1.0, 4294967295.0));
+		voice.fadeDelta = (target - voice.fade) / voice.fadeSamplesLeft;
+	}
+
+	void SoftwareMixer::ApplyState(Voice& voice, const VoiceState state)
+	{
+		voice.state = state;
+		voice.fade = 1.0f;
+		voice.fadeDelta = 0.0f;
+		voice.fadeSamplesLeft = 0;
+
+		if (state == VoiceState::Stopped)
+		{
+			voice.position = 0;
+			voice.samplesPlayed = 0;
+		}
+	}
+
+	void SoftwareMixer::mixVoice(Voice& voice, WaveSample* dst, const size_t samples)
+	{
+		const WaveSample* src = voice.wave->data();
+		const int64 waveSize = voice.wave->size();
+		size_t i = 0;
+
+		while ((i < samples) && (voice.state == VoiceState::Playing))
+		{
+			const uint64 endPos = voice.loop ? voice.loop->endPos : waveSize;
+			const uint64 index = voice.position >> 32;
+
+			if (index >= endPos)
+			{
+				if (voice.loop)
+				{
+					voice.position -= static_cast<uint64>(voice.loop->endPos - voice.loop->beginPos) << 32;
+					continue;
+				}
+
+				ApplyState(voice, VoiceState::Stopped);
+				break;
+			}
+
+			// endPos に到達するまでに出力できるサンプル数
+			const uint64 samplesToEnd = ((endPos << 32) - voice.position + voice.step - 1) / voice.step;
+			size_t count = static_cast<size_t>(std::min<uint64>(samples - i, samplesToEnd));
+
+			if (voice.fadeSamplesLeft == 0)
+			{
+				const float gainL = voice.gainL * voice.fade;
+				const float gainR = voice.gainR * voice.fade;
+
+				if ((voice.step == detail::FixedOne) && ((voice.position & detail::FixedFractionMask) == 0))
+				{
+					MixerKernel::MixAdd(dst + i, src + index, count, gainL, gainR);
+				}
+				else
+				{
+					// 次のサンプルが endPos 未満に収まる範囲は SIMD で補間する
+					const uint64 safeEnd = (endPos - 1) << 32;
+					const size_t safeCount = (voice.position < safeEnd)
+						? static_cast<size_t>(std::min<uint64>(count, (safeEnd - voice.position + voice.step - 1) / voice.step)) : 0;
+
+					MixerKernel::MixAddResampled(dst + i, src, safeCount, voice.position, voice.step, gainL, gainR);
+
+					const WaveSample& next = voice.loop ? src[voice.loop->beginPos] : src[endPos - 1];
+					uint64 position = voice.position + voice.step * safeCount;
+
+					for (size_t k = safeCount; k < count; ++k, position += voice.step)
+					{
+						const WaveSample& a = src[position >> 32];
+						const WaveSample& b = (((position >> 32) + 1) < endPos) ? src[(position >> 32) + 1] : next;
+						const float t = (position & detail::FixedFractionMask) * detail::FixedToFloat;
+
+						dst[i + k].left += (a.left + (b.left - a.left) * t) * gainL;
+						dst[i + k].right += (a.right + (b.right - a.right) * t) * gainR;
+					}
+				}
+			}
+			else
+			{
+				// フェード中は 1 サンプルずつ音量を変化させる
+				const WaveSample& next = voice.loop ? src[voice.loop->beginPos] : src[endPos - 1];
+				uint64 position = voice.position;
+
+				for (size_t k = 0; k < count; ++k, position += voice.step)
+				{
+					const WaveSample& a = src[position >> 32];
+					const WaveSample& b = (((position >> 32) + 1) < endPos) ? src[(position >> 32) + 1] : next;
+					const float t = (position & detail::FixedFractionMask) * detail::FixedToFloat;
+
+					dst[i + k].left += (a.left + (b.left - a.left) * t) * voice.gainL * voice.fade;
+					dst[i + k].right += (a.right + (b.right - a.right) * t) * voice.gainR * voice.fade;
+
+					voice.fade += voice.fadeDelta;
+
+					if (--voice.fadeSamplesLeft == 0)
+					{
+						voice.fade = std::round(voice.fade);
+						voice.fadeDelta = 0.0f;
+						count = k + 1;
+					}
+				}
+
+				if (voice.fade == 0.0f)
+				{
+					voice.position += voice.step * count;
+					voice.samplesPlayed += ((voice.position >> 32) - index);
+					ApplyState(voice, voice.stateAfterFade);
+					break;
+				}
+			}
+
+			voice.position += voice.step * count;
+			voice.samplesPlayed += ((voice.position >> 32) - index);
+			i += count;
+		}
+	}
+}
@@ -0,0 +1,183 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <atomic>
+# include <mutex>
+# include <Siv3D/Fwd.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/Optional.hpp>
+# include <Siv3D/Audio.hpp>
+# include <Siv3D/Wave.hpp>
+
+namespace s3d
+{
+	using MixerVoiceID = uint64;
+
+	// 全ボイスを 1 本のステレオ float ストリームにミックスするソフトウェアミキサー
+	// バックエンドは mix() で得たストリームを 1 つの出力に送るだけでよい。
+	// すべての操作はスレッドセーフ（内部でロックする）。
+	class SoftwareMixer
+	{
+	public:
+
+		static constexpr uint32 DefaultSamplingRate = 44100;
+
+		// 1 つの Wave から同時に再生できるワンショットの最大数
+		static constexpr size_t MaxShotsPerWave = 32;
+
+		// 同時に再生できるワンショットの最大数
+		static constexpr size_t MaxShots = 256;
+
+		static constexpr double MinSpeed = 1.0 / 1024.0;
+
+		static constexpr double MaxSpeed = 2.0;
+
+	private:
+
+		enum class VoiceState
+		{
+			Stopped,
+
+			Playing,
+
+			Paused,
+		};
+
+		struct Voice
+		{
+			const Wave* wave = nullptr;
+
+			MixerVoiceID id = 0;
+
+			// 読み込み位置（32.32 固定小数点）
+			uint64 position = 0;
+
+			// 1 出力サンプルあたりの読み込み位置の増分（32.32 固定小数点）
+			uint64 step = 0;
+
+			int64 samplesPlayed = 0;
+
+			Optional<AudioLoopTiming> loop;
+
+			std::pair<double, double> volume = { 1.0, 1.0 };
+
+			double speed = 1.0;
+
+			float gainL = 1.0f;
+
+			float gainR = 1.0f;
+
+			float fade = 1.0f;
+
+			// 1 出力サンプルあたりのフェード量の変化
+			float fadeDelta = 0.0f;
+
+			// フェードが完了するまでの出力サンプル数（0 の場合はフェードなし）
+			uint32 fadeSamplesLeft = 0;
+
+			VoiceState state = VoiceState::Stopped;
+
+			// フェードアウト完了後に遷移する状態
+			VoiceState stateAfterFade = VoiceState::Paused;
+
+			bool oneShot = false;
+		};
+
+		Array<Voice> m_voices;
+
+		mutable std::mutex m_mutex;
+
+		uint32 m_samplingRate = DefaultSamplingRate;
+
+		MixerVoiceID m_idCount = 0;
+
+		std::atomic<bool> m_offlineRendering = { false };
+
+		Voice* findVoice(MixerVoiceID id);
+
+		const Voice* findVoice(MixerVoiceID id) const;
+
+		void updateStep(Voice& voice) const;
+
+		void startFade(Voice& voice, float target, double durationSec) const;
+
+		static void ApplyState(Voice& voice, VoiceState state);
+
+		void mixVoice(Voice& voice, WaveSample* dst, size_t samples);
+
+	public:
+
+		explicit SoftwareMixer(uint32 samplingRate = DefaultSamplingRate);
+
+		[[nodiscard]] uint32 samplingRate() const noexcept;
+
+		MixerVoiceID addStream(const Wave& wave);
+
+		// wave を参照するすべてのボイス（ストリームとワンショット）を削除する
+		void removeVoices(const Wave& wave);
+
+		void playOneShot(const Wave& wave, double volume, double pitch, double pan);
+
+		void stopAllShots(const Wave& wave);
+
+		void setLoop(MixerVoiceID id, const Optional<AudioLoopTiming>& loop);
+
+		bool play(MixerVoiceID id, double fadeinSec);
+
+		void pause(MixerVoiceID id, double fadeoutSec);
+
+		void stop(MixerVoiceID id, double fadeoutSec);
+
+		[[nodiscard]] bool isPlaying(MixerVoiceID id) const;
+
+		[[nodiscard]] bool isPaused(MixerVoiceID id) const;
+
+		[[nodiscard]] int64 posSample(MixerVoiceID id) const;
+
+		[[nodiscard]] int64 samplesPlayed(MixerVoiceID id) const;
+
+		void setPosSample(MixerVoiceID id, int64 sample);
+
+		void setVolume(MixerVoiceID id, const std::pair<double, double>& volume);
+
+		[[nodiscard]] std::pair<double, double> getVolume(MixerVoiceID id) const;
+
+		void setSpeed(MixerVoiceID id, double speed);
+
+		[[nodiscard]] double getSpeed(MixerVoiceID id) const;
+
+		[[nodiscard]] size_t num_activeVoices() const;
+
+		// オフラインレンダリング中は、バックエンドはミキサーの出力を取得せず無音を出力する
+		void setOfflineRendering(bool enabled) noexcept;
+
+		[[nodiscard]] bool isOfflineRendering() const noexcept;
+
+		// samples 個のステレオサンプルをミックスして dst に書き込む（dst の内容は上書きされる）
+		void mix(WaveSample* dst, size_t samples);
+	};
+
+	// ミキサーの SIMD カーネル
+	// CPU::GetFeature() に応じて AVX2 / SSE2 / 参照実装 を選択する。
+	namespace MixerKernel
+	{
+		// dst[i] += src[i] * (gainL, gainR)
+		void MixAdd(WaveSample* dst, const WaveSample* src, size_t samples, float gainL, float gainR);
+
+		// dst[i] += lerp(src[p], src[p + 1], t) * (gainL, gainR)  (p, t は position + step * i の整数部と小数部)
+		// src[(position + step * (samples - 1)) >> 32 + 1] までが読み込み可能である必要がある。
+		void MixAddResampled(WaveSample* dst, const WaveSample* src, size_t samples, uint64 position, uint64 step, float gainL, float gainR);
+
+		// [-1.0, 1.0] にクランプして 16-bit に変換する
+		void ConvertToS16(WaveSampleS16* dst, const WaveSample* src, size_t samples);
+	}
+}
@@ -11,11 +11,13 @@
 
 # pragma once
 
-# include "../IAudio.hpp"
+# include "../Mixer/CAudio_Mixer.hpp"
 
 namespace s3d
 {
-	class CAudio_Null : public ISiv3DAudio
+	// オーディオデバイスを使わないバックエンド
+	// ミキサーの出力は AudioMixer::Render() でのみ取得でき、それまで再生位置は進まない。
+	class CAudio_Null : public CAudio_Mixer
 	{
 	private:
 
@@ -28,54 +30,6 @@ namespace s3d
 		bool hasAudioDevice() const override;
 
 		bool init() override;
-
-		AudioID create(Wave&& wave) override;
-
-		void release(AudioID handleID) override;
-
-		uint32 samplingRate(AudioID handleID) override;
-
-		size_t samples(AudioID handleID) override;
-
-		void setLoop(AudioID handleID, bool loop, int64 loopBeginSample, int64 loopEndSample) override;
-
-		bool play(AudioID handleID, const SecondsF& fadeinDuration) override;
-
-		void pause(AudioID handleID, const SecondsF& fadeoutDuration) override;
-
-		void stop(AudioID handleID, const SecondsF& fadeoutDuration) override;
-
-		void playOneShot(AudioID handleID, double volume, double pitch) override;
-
-		void stopAllShots(AudioID handleID) override;
-
-		bool isPlaying(AudioID handleID) override;
-
-		bool isPaused(AudioID handleID) override;
-
-		uint64 posSample(AudioID handleID) override;
-
-		uint64 streamPosSample(AudioID handleID) override;
-
-		uint64 samplesPlayed(AudioID handleID) override;
-
-		const Wave& getWave(AudioID handleID) override;
-
-		void setPosSample(AudioID handleID, int64 sample) override;
-
-		void setVolume(AudioID handleID, const std::pair<double, double>& volume) override;
-
-		std::pair<double, double> getVolume(AudioID handleID) override;
-
-		void setSpeed(AudioID handleID, double speed) override;
-
-		double getSpeed(AudioID handleID) override;
-
-		std::pair<double, double> getMinMaxSpeed(AudioID handleID) override;
-
-		bool updateFade() override;
-
-		void fadeMasterVolume() override;
 	};
 }
 
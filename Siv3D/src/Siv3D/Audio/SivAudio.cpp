@@ -314,9 +314,9 @@ namespace s3d
 		Siv3DEngine::GetAudio()->stop(m_handle->id(), fadeoutDuration);
 	}
 
-	void Audio::playOneShot(const double volume, const double pitch) const
+	void Audio::playOneShot(const double volume, const double pitch, const double pan) const
 	{
-		Siv3DEngine::GetAudio()->playOneShot(m_handle->id(), volume, pitch);
+		Siv3DEngine::GetAudio()->playOneShot(m_handle->id(), volume, pitch, pan);
 	}
 
 	void Audio::stopAllShots() const
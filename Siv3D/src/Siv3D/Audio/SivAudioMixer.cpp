@@ -0,0 +1,81 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/AudioMixer.hpp>
+# include "../Siv3DEngine.hpp"
+# include "IAudio.hpp"
+# include "Mixer/SoftwareMixer.hpp"
+
+namespace s3d
+{
+	namespace AudioMixer
+	{
+		bool IsAvailable()
+		{
+			return (Siv3DEngine::GetAudio()->getMixer() != nullptr);
+		}
+
+		uint32 SamplingRate()
+		{
+			if (const SoftwareMixer* mixer = Siv3DEngine::GetAudio()->getMixer())
+			{
+				return mixer->samplingRate();
+			}
+
+			return 0;
+		}
+
+		size_t NumActiveVoices()
+		{
+			if (const SoftwareMixer* mixer = Siv3DEngine::GetAudio()->getMixer())
+			{
+				return mixer->num_activeVoices();
+			}
+
+			return 0;
+		}
+
+		void EnableOfflineRendering(const bool enabled)
+		{
+			if (SoftwareMixer* mixer = Siv3DEngine::GetAudio()->getMixer())
+			{
+				mixer->setOfflineRendering(enabled);
+			}
+		}
+
+		bool IsOfflineRendering()
+		{
+			if (const SoftwareMixer* mixer = Siv3DEngine::GetAudio()->getMixer())
+			{
+				return mixer->isOfflineRendering();
+			}
+
+			return false;
+		}
+
+		Wave Render(const size_t samples)
+		{
+			ISiv3DAudio* const pAudio = Siv3DEngine::GetAudio();
+			SoftwareMixer* const mixer = pAudio->getMixer();
+
+			if (!mixer || (pAudio->hasAudioDevice() && !mixer->isOfflineRendering()))
+			{
+				return{};
+			}
+
+			Wave wave(samples, Arg::samplingRate = mixer->samplingRate());
+
+			mixer->mix(wave.data(), wave.size());
+
+			return wave;
+		}
+	}
+}
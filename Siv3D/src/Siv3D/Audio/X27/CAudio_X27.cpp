@@ -189,10 +189,11 @@ namespace s3d
 			fadeSec);
 	}
 
-	void CAudio_X27::playOneShot(const AudioID handleID, const double volume, const double pitch)
+	void CAudio_X27::playOneShot(const AudioID handleID, const double volume, const double pitch, double)
 	{
 		std::lock_guard<std::mutex> lock(m_mutex);
 
+		// [Siv3D ToDo] pan
 		m_audios[handleID]->playOneShot(volume, pitch);
 	}
 
@@ -322,6 +323,11 @@ namespace s3d
 			::Sleep(10);
 		}
 	}
+
+	SoftwareMixer* CAudio_X27::getMixer()
+	{
+		return nullptr;
+	}
 }
 
 # endif
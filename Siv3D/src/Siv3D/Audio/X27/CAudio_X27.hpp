@@ -70,7 +70,7 @@ namespace s3d
 
 		void stop(AudioID handleID, const SecondsF& fadeoutDuration) override;
 
-		void playOneShot(AudioID handleID, double volume, double pitch) override;
+		void playOneShot(AudioID handleID, double volume, double pitch, double pan) override;
 
 		void stopAllShots(AudioID handleID) override;
 
@@ -101,6 +101,8 @@ namespace s3d
 		bool updateFade() override;
 		
 		void fadeMasterVolume() override;
+
+		SoftwareMixer* getMixer() override;
 	};
 }
 
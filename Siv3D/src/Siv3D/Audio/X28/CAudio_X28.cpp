@@ -192,10 +192,11 @@ namespace s3d
 			fadeSec);
 	}
 
-	void CAudio_X28::playOneShot(const AudioID handleID, const double volume, const double pitch)
+	void CAudio_X28::playOneShot(const AudioID handleID, const double volume, const double pitch, double)
 	{
 		std::lock_guard<std::mutex> lock(m_mutex);
 
+		// [Siv3D ToDo] pan
 		m_audios[handleID]->playOneShot(volume, pitch);
 	}
 
@@ -325,6 +326,11 @@ namespace s3d
 			::Sleep(10);
 		}
 	}
+
+	SoftwareMixer* CAudio_X28::getMixer()
+	{
+		return nullptr;
+	}
 }
 
 # endif
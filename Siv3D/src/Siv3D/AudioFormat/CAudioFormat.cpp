@@ -17,6 +17,7 @@
 # include "AAC/AudioFormat_AAC_macOS.hpp"
 # include <Siv3D/IReader.hpp>
 # include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/ArchivedFileReader.hpp>
 # include <Siv3D/FileSystem.hpp>
 # include <Siv3D/WritableMemoryMapping.hpp>
 # include <Siv3D/Logger.hpp>
@@ -117,6 +118,14 @@ namespace s3d
 
 	Wave CAudioFormat::load(const FilePath& path) const
 	{
+		// マウントされているアーカイブ内のファイルを優先する
+		if (ArchivedFileReader archived{ path })
+		{
+			const AudioFormat format = getFormatFromReader(archived, path);
+
+			return decode(std::move(archived), format);
+		}
+
 		BinaryReader reader(path);
 
 		const auto it = findFormat(reader, path);
@@ -12,7 +12,16 @@
 # include <Siv3D/Platform.hpp>
 # if defined(SIV3D_TARGET_LINUX)
 
+# include <fcntl.h>
+# include <unistd.h>
+# include <limits.h>
+# include <sys/stat.h>
+# include <sys/uio.h>
+# include <cerrno>
+# include <cstring>
+# include <algorithm>
 # include <Siv3D/FileSystem.hpp>
+# include <Siv3D/Utility.hpp>
 # include <Siv3D/Logger.hpp>
 # include "CBinaryReader_Linux.hpp"
 
@@ -28,26 +37,40 @@ namespace s3d
 		close();
 	}
 
-	bool BinaryReader::CBinaryReader::open(const FilePath& path)
+	bool BinaryReader::CBinaryReader::open(const FilePath& path, const ReadAccessHint hint)
 	{
 		if (isOpened())
 		{
 			close();
 		}
 
-		m_pFile = std::fopen(path.narrow().c_str(), "r");
+		m_fd = ::open(path.narrow().c_str(), O_RDONLY | O_CLOEXEC);
 
-		if (!m_pFile)
+		if (m_fd == -1)
 		{
 			LOG_FAIL(U"❌ BinaryReader: Failed to open file \"{0}\""_fmt(path));
 
 			return false;
 		}
 
-		m_size = FileSystem::FileSize(path);
+		struct stat st;
+
+		if (::fstat(m_fd, &st) == 0)
+		{
+			m_size = st.st_size;
+		}
 
 		m_fullPath = FileSystem::FullPath(path);
 
+		if (hint == ReadAccessHint::Sequential)
+		{
+			::posix_fadvise(m_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+		}
+		else if (hint == ReadAccessHint::Random)
+		{
+			::posix_fadvise(m_fd, 0, 0, POSIX_FADV_RANDOM);
+		}
+
 		LOG_DEBUG(U"📤 BinaryReader: Opened file \"{0}\" size: {1}"_fmt(m_fullPath, FMTBYTES(m_size)));
 
 		return true;
@@ -60,20 +83,28 @@ namespace s3d
 			return;
 		}
 
-		std::fclose(m_pFile);
+		::close(m_fd);
 
 		LOG_DEBUG(U"📥 BinaryReader: Closed file \"{0}\""_fmt(m_fullPath));
 
-		m_pFile = nullptr;
+		m_fd = -1;
 
 		m_size = 0;
 
+		m_pos = 0;
+
+		m_buffer.reset();
+
+		m_bufferPos = 0;
+
+		m_bufferSize = 0;
+
 		m_fullPath.clear();
 	}
 
 	bool BinaryReader::CBinaryReader::isOpened() const noexcept
 	{
-		return m_pFile != nullptr;
+		return m_fd != -1;
 	}
 
 	int64 BinaryReader::CBinaryReader::size() const noexcept
@@ -88,9 +119,12 @@ namespace s3d
 			return 0;
 		}
 
-		std::fseek(m_pFile, pos, SEEK_SET);
+		if (pos >= 0)
+		{
+			m_pos = pos;
+		}
 
-		return std::ftell(m_pFile);
+		return m_pos;
 	}
 
 	int64 BinaryReader::CBinaryReader::getPos()
@@ -100,57 +134,274 @@ namespace s3d
 			return 0;
 		}
 
-		return std::ftell(m_pFile);
+		return m_pos;
 	}
 
 	int64 BinaryReader::CBinaryReader::read(void* const buffer, const int64 size)
 	{
 		assert(buffer != nullptr || size == 0);
 
-		return std::fread(buffer, 1, size, m_pFile);
+		const int64 pos = m_pos;
+
+		const int64 readSize = readBuffered(buffer, pos, size);
+
+		m_pos = pos + readSize;
+
+		return readSize;
 	}
 
 	int64 BinaryReader::CBinaryReader::read(void* const buffer, const int64 pos, const int64 size)
 	{
 		assert(buffer != nullptr || size == 0);
 
-		setPos(pos);
+		const int64 readSize = readAt(buffer, pos, size);
+
+		if (pos >= 0)
+		{
+			m_pos = pos + readSize;
+		}
 
-		return std::fread(buffer, 1, size, m_pFile);
+		return readSize;
 	}
 
 	int64 BinaryReader::CBinaryReader::lookahead(void* const buffer, const int64 size)
 	{
 		assert(buffer != nullptr || size == 0);
 
-		const auto previousPos = getPos();
-
-		const auto readSize = std::fread(buffer, 1, size, m_pFile);
-
-		setPos(previousPos);
-
-		return readSize;
+		return readBuffered(buffer, m_pos, size);
 	}
 
 	int64 BinaryReader::CBinaryReader::lookahead(void* const buffer, const int64 pos, const int64 size)
 	{
 		assert(buffer != nullptr || size == 0);
 
-		const auto previousPos = getPos();
+		return readAt(buffer, pos, size);
+	}
 
-		setPos(pos);
+	int64 BinaryReader::CBinaryReader::readBatch(BinaryReadRequest* const requests, const size_t count)
+	{
+		if (count == 0)
+		{
+			return 0;
+		}
 
-		const auto readSize = std::fread(buffer, 1, size, m_pFile);
+		Array<BinaryReadRequest*> sorted(count);
 
-		setPos(previousPos);
+		for (size_t i = 0; i < count; ++i)
+		{
+			requests[i].readSize = 0;
 
-		return readSize;
+			sorted[i] = (requests + i);
+		}
+
+		const auto byPos = [](const BinaryReadRequest* a, const BinaryReadRequest* b)
+		{
+			return a->pos < b->pos;
+		};
+
+		if (!std::is_sorted(sorted.begin(), sorted.end(), byPos))
+		{
+			std::stable_sort(sorted.begin(), sorted.end(), byPos);
+		}
+
+		// 要求間の隙間の読み捨て先
+		std::unique_ptr<Byte[]> gapBuffer;
+
+		Array<iovec> iov;
+
+		int64 total = 0;
+
+		for (size_t first = 0; first < count;)
+		{
+			const BinaryReadRequest& head = *sorted[first];
+
+			if (!isOpened() || head.pos < 0 || head.size <= 0 || m_size <= head.pos)
+			{
+				++first;
+
+				continue;
+			}
+
+			// 重ならず、隙間が小さい要求を 1 回の preadv にまとめる
+			iov.clear();
+
+			iov.push_back({ head.buffer, static_cast<size_t>(head.size) });
+
+			int64 end = head.pos + head.size;
+
+			size_t last = first + 1;
+
+			for (; last < count; ++last)
+			{
+				const BinaryReadRequest& next = *sorted[last];
+
+				if (next.size <= 0)
+				{
+					continue;
+				}
+
+				const int64 gap = next.pos - end;
+
+				if (gap < 0 || MaxBatchGap < gap || m_size <= end || IOV_MAX < static_cast<int64>(iov.size() + 2))
+				{
+					break;
+				}
+
+				if (gap > 0)
+				{
+					if (!gapBuffer)
+					{
+						gapBuffer.reset(new Byte[MaxBatchGap]);
+					}
+
+					iov.push_back({ gapBuffer.get(), static_cast<size_t>(gap) });
+				}
+
+				iov.push_back({ next.buffer, static_cast<size_t>(next.size) });
+
+				end = next.pos + next.size;
+			}
+
+			ssize_t result;
+
+			do
+			{
+				result = ::preadv(m_fd, iov.data(), static_cast<int>(iov.size()), head.pos);
+			}
+			while (result < 0 && errno == EINTR);
+
+			if (result < 0)
+			{
+				LOG_FAIL(U"❌ BinaryReader: Failed ::preadv() \"{0}\""_fmt(m_fullPath));
+			}
+
+			const int64 readEnd = head.pos + std::max<int64>(result, 0);
+
+			// ファイルの終端に達した場合以外の不足分は個別に読み直す
+			const bool reachedEnd = (m_size <= readEnd);
+
+			for (size_t i = first; i < last; ++i)
+			{
+				BinaryReadRequest& request = *sorted[i];
+
+				if (request.size <= 0)
+				{
+					continue;
+				}
+
+				request.readSize = Clamp<int64>(readEnd - request.pos, 0, request.size);
+
+				if (request.readSize < request.size && !reachedEnd)
+				{
+					request.readSize = readAt(request.buffer, request.pos, request.size);
+				}
+
+				total += request.readSize;
+			}
+
+			first = last;
+		}
+
+		return total;
+	}
+
+	void BinaryReader::CBinaryReader::prefetch(const int64 pos, const int64 size)
+	{
+		if (!isOpened())
+		{
+			return;
+		}
+
+		::posix_fadvise(m_fd, pos, size, POSIX_FADV_WILLNEED);
 	}
 
 	const FilePath& BinaryReader::CBinaryReader::path() const
 	{
 		return m_fullPath;
 	}
+
+	int64 BinaryReader::CBinaryReader::readAt(void* const buffer, const int64 pos, const int64 size) const
+	{
+		if (!isOpened() || pos < 0 || size <= 0)
+		{
+			return 0;
+		}
+
+		Byte* const dst = static_cast<Byte*>(buffer);
+
+		int64 total = 0;
+
+		while (total < size)
+		{
+			const ssize_t result = ::pread(m_fd, dst + total, static_cast<size_t>(size - total), pos + total);
+
+			if (result > 0)
+			{
+				total += result;
+			}
+			else if (result == 0)
+			{
+				break;
+			}
+			else if (errno != EINTR)
+			{
+				LOG_FAIL(U"❌ BinaryReader: Failed ::pread() \"{0}\""_fmt(m_fullPath));
+
+				break;
+			}
+		}
+
+		return total;
+	}
+
+	int64 BinaryReader::CBinaryReader::readBuffered(void* const buffer, int64 pos, int64 size)
+	{
+		Byte* dst = static_cast<Byte*>(buffer);
+
+		int64 total = 0;
+
+		while (size > 0)
+		{
+			if (m_bufferPos <= pos && pos < (m_bufferPos + m_bufferSize))
+			{
+				const int64 copySize = std::min(size, m_bufferPos + m_bufferSize - pos);
+
+				std::memcpy(dst, m_buffer.get() + (pos - m_bufferPos), static_cast<size_t>(copySize));
+
+				dst += copySize;
+
+				pos += copySize;
+
+				size -= copySize;
+
+				total += copySize;
+
+				continue;
+			}
+
+			// バッファより大きな読み込みはバッファを経由しない
+			if (BufferSize <= size)
+			{
+				return total + readAt(dst, pos, size);
+			}
+
+			if (!m_buffer)
+			{
+				m_buffer.reset(new Byte[BufferSize]);
+			}
+
+			m_bufferPos = pos;
+
+			m_bufferSize = readAt(m_buffer.get(), pos, BufferSize);
+
+			if (m_bufferSize == 0)
+			{
+				break;
+			}
+		}
+
+		return total;
+	}
 }
 
 # endif
@@ -13,28 +13,51 @@
 # include <Siv3D/Platform.hpp>
 # if defined(SIV3D_TARGET_LINUX)
 
+# include <memory>
 # include <Siv3D/BinaryReader.hpp>
 # include <Siv3D/String.hpp>
 
 namespace s3d
 {
+	// 読み込みはすべて pread / preadv で行い、ファイルオフセットを共有しない。
+	// 複数のスレッドから同時に呼び出せるのは、位置を指定した lookahead() と readBatch() のみ。
+	// read(), 位置を指定しない lookahead(), setPos() は m_pos と逐次読み込み用バッファを更新するため、同時に呼び出せない。
 	class BinaryReader::CBinaryReader
 	{
 	private:
 
-		FILE* m_pFile = nullptr;
+		// 逐次読み込み用バッファのサイズ
+		static constexpr int64 BufferSize = 64 * 1024;
+
+		// readBatch() で 1 回の preadv にまとめる要求間の隙間の最大サイズ
+		static constexpr int64 MaxBatchGap = 4 * 1024;
+
+		int m_fd = -1;
 
 		int64 m_size = 0;
 
+		int64 m_pos = 0;
+
+		// 逐次読み込み用バッファ（ファイル上の [m_bufferPos, m_bufferPos + m_bufferSize) を保持する）
+		std::unique_ptr<Byte[]> m_buffer;
+
+		int64 m_bufferPos = 0;
+
+		int64 m_bufferSize = 0;
+
 		FilePath m_fullPath;
 
+		int64 readAt(void* buffer, int64 pos, int64 size) const;
+
+		int64 readBuffered(void* buffer, int64 pos, int64 size);
+
 	public:
 
 		CBinaryReader();
 
 		~CBinaryReader();
 
-		bool open(const FilePath& path);
+		bool open(const FilePath& path, ReadAccessHint hint);
 
 		void close();
 
@@ -54,6 +77,10 @@ namespace s3d
 
 		int64 lookahead(void* buffer, int64 pos, int64 size);
 
+		int64 readBatch(BinaryReadRequest* requests, size_t count);
+
+		void prefetch(int64 pos, int64 size);
+
 		const FilePath& path() const;
 	};
 }
@@ -29,7 +29,7 @@ namespace s3d
 		close();
 	}
 
-	bool BinaryReader::CBinaryReader::open(const FilePath& path)
+	bool BinaryReader::CBinaryReader::open(const FilePath& path, const ReadAccessHint hint)
 	{
 		if (m_opened)
 		{
@@ -65,7 +65,18 @@ namespace s3d
 		}
 		else
 		{
-			m_handle = ::CreateFileW(path.toWstr().c_str(), GENERIC_READ, (FILE_SHARE_READ | FILE_SHARE_WRITE), nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			DWORD flags = FILE_ATTRIBUTE_NORMAL;
+
+			if (hint == ReadAccessHint::Sequential)
+			{
+				flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+			}
+			else if (hint == ReadAccessHint::Random)
+			{
+				flags |= FILE_FLAG_RANDOM_ACCESS;
+			}
+
+			m_handle = ::CreateFileW(path.toWstr().c_str(), GENERIC_READ, (FILE_SHARE_READ | FILE_SHARE_WRITE), nullptr, OPEN_EXISTING, flags, nullptr);
 
 			m_opened = (m_handle != INVALID_HANDLE_VALUE);
 
@@ -287,6 +298,28 @@ namespace s3d
 		}
 	}
 
+	int64 BinaryReader::CBinaryReader::readBatch(BinaryReadRequest* const requests, const size_t count)
+	{
+		int64 total = 0;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			BinaryReadRequest& request = requests[i];
+
+			request.readSize = (m_opened && request.pos >= 0 && request.size > 0)
+				? lookahead(request.buffer, request.pos, request.size) : 0;
+
+			total += request.readSize;
+		}
+
+		return total;
+	}
+
+	void BinaryReader::CBinaryReader::prefetch(const int64, const int64)
+	{
+		// Windows ではファイルの先読みの指示はオープン時のフラグのみで行う
+	}
+
 	const FilePath& BinaryReader::CBinaryReader::path() const
 	{
 		return m_fullPath;
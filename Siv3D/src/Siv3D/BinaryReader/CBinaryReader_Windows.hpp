@@ -41,7 +41,7 @@ namespace s3d
 
 		~CBinaryReader();
 
-		bool open(const FilePath& path);
+		bool open(const FilePath& path, ReadAccessHint hint);
 
 		void close();
 
@@ -61,6 +61,10 @@ namespace s3d
 
 		int64 lookahead(void* buffer, int64 pos, int64 size);
 
+		int64 readBatch(BinaryReadRequest* requests, size_t count);
+
+		void prefetch(int64 pos, int64 size);
+
 		const FilePath& path() const;
 	};
 }
@@ -12,6 +12,8 @@
 # include <Siv3D/Platform.hpp>
 # if defined(SIV3D_TARGET_MACOS)
 
+# include <fcntl.h>
+# include <climits>
 # include <Siv3D/FileSystem.hpp>
 # include <Siv3D/Logger.hpp>
 # include "CBinaryReader_macOS.hpp"
@@ -28,7 +30,7 @@ namespace s3d
         close();
     }
     
-    bool BinaryReader::CBinaryReader::open(const FilePath& path)
+    bool BinaryReader::CBinaryReader::open(const FilePath& path, const ReadAccessHint hint)
     {
         if (isOpened())
         {
@@ -48,6 +50,11 @@ namespace s3d
         
         m_fullPath = FileSystem::FullPath(path);
 
+        if (hint != ReadAccessHint::Normal)
+        {
+            ::fcntl(::fileno(m_pFile), F_RDAHEAD, (hint == ReadAccessHint::Sequential) ? 1 : 0);
+        }
+
 		LOG_DEBUG(U"📤 BinaryReader: Opened file \"{0}\" size: {1}"_fmt(m_fullPath, FMTBYTES(m_size)));
         
         return true;
@@ -147,6 +154,37 @@ namespace s3d
         return readSize;
     }
     
+    int64 BinaryReader::CBinaryReader::readBatch(BinaryReadRequest* const requests, const size_t count)
+    {
+        int64 total = 0;
+        
+        for (size_t i = 0; i < count; ++i)
+        {
+            BinaryReadRequest& request = requests[i];
+            
+            request.readSize = (isOpened() && request.pos >= 0 && request.size > 0)
+                ? lookahead(request.buffer, request.pos, request.size) : 0;
+            
+            total += request.readSize;
+        }
+        
+        return total;
+    }
+    
+    void BinaryReader::CBinaryReader::prefetch(const int64 pos, const int64 size)
+    {
+        if (!isOpened())
+        {
+            return;
+        }
+        
+        radvisory advisory;
+        advisory.ra_offset = pos;
+        advisory.ra_count = static_cast<int>(std::min<int64>(size, INT_MAX));
+        
+        ::fcntl(::fileno(m_pFile), F_RDADVISE, &advisory);
+    }
+    
     const FilePath& BinaryReader::CBinaryReader::path() const
     {
         return m_fullPath;
@@ -22,9 +22,9 @@ namespace s3d
 
 	}
 
-	bool BinaryReader::open(const FilePath& path)
+	bool BinaryReader::open(const FilePath& path, const ReadAccessHint hint)
 	{
-		return pImpl->open(path);
+		return pImpl->open(path, hint);
 	}
 
 	void BinaryReader::close()
@@ -82,6 +82,23 @@ namespace s3d
 		return pImpl->lookahead(buffer, pos, size);
 	}
 
+	int64 BinaryReader::readBatch(BinaryReadRequest* const requests, const size_t count) const
+	{
+		assert(requests != nullptr || count == 0);
+
+		return pImpl->readBatch(requests, count);
+	}
+
+	void BinaryReader::prefetch(const int64 pos, const int64 size) const
+	{
+		if (pos < 0 || size <= 0)
+		{
+			return;
+		}
+
+		pImpl->prefetch(pos, size);
+	}
+
 	//ByteArray BinaryReader::readWhole()
 	//{
 	//	return readSubset(0, size());
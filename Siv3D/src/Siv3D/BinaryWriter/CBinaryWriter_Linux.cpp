@@ -98,6 +98,8 @@ namespace s3d
 
 		std::fwrite(m_pBuffer, 1, m_currentBufferPos, m_pFile);
 
+		std::fflush(m_pFile);
+
 		m_currentBufferPos = 0;
 	}
 
@@ -11,11 +11,42 @@
 
 # include <boost/tokenizer.hpp>
 # include <Siv3D/CSVData.hpp>
+# include <Siv3D/CSVReader.hpp>
 # include <Siv3D/TextReader.hpp>
 # include <Siv3D/TextWriter.hpp>
 
 namespace s3d
 {
+	namespace detail
+	{
+		struct CSVSingleCharSyntax
+		{
+			char32 separator;
+
+			char32 quote;
+
+			char32 escape;
+		};
+
+		// 区切り文字が 1 文字、クォートとエスケープが 1 文字以下の ASCII であれば CSVReader で解析できる
+		static Optional<CSVSingleCharSyntax> GetSingleCharSyntax(const StringView separators, const StringView quotes, const StringView escapes)
+		{
+			if ((separators.size() != 1) || (quotes.size() > 1) || (escapes.size() > 1))
+			{
+				return none;
+			}
+
+			const CSVSingleCharSyntax syntax{ separators[0], (quotes ? quotes[0] : U'\0'), (escapes ? escapes[0] : U'\0') };
+
+			if ((syntax.separator >= 0x80) || (syntax.quote >= 0x80) || (syntax.escape >= 0x80))
+			{
+				return none;
+			}
+
+			return syntax;
+		}
+	}
+
 	Optional<String> CSVData::getItem(const size_t row, const size_t column) const
 	{
 		if (!inBounds(row, column))
@@ -82,6 +113,22 @@ namespace s3d
 
 	bool CSVData::load(const FilePath& path, const StringView separators, const StringView quotes, const StringView escapes)
 	{
+		if (const auto syntax = detail::GetSingleCharSyntax(separators, quotes, escapes))
+		{
+			const CSVReader csv(path, syntax->separator, syntax->quote, syntax->escape);
+
+			if (!csv)
+			{
+				clear();
+
+				return false;
+			}
+
+			m_data = csv.toArray();
+
+			return true;
+		}
+
 		TextReader textReader(path);
 
 		if (!loadFromTextReader(textReader, separators, quotes, escapes))
@@ -96,6 +143,22 @@ namespace s3d
 
 	bool CSVData::load(const std::shared_ptr<IReader>& reader, const StringView separators, const StringView quotes, const StringView escapes)
 	{
+		if (const auto syntax = detail::GetSingleCharSyntax(separators, quotes, escapes))
+		{
+			const CSVReader csv(reader, syntax->separator, syntax->quote, syntax->escape);
+
+			if (!csv)
+			{
+				clear();
+
+				return false;
+			}
+
+			m_data = csv.toArray();
+
+			return true;
+		}
+
 		TextReader textReader(reader);
 
 		if (!loadFromTextReader(textReader, separators, quotes, escapes))
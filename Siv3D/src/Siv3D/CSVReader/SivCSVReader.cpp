@@ -0,0 +1,791 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <cstring>
+# include <cerrno>
+# include <limits>
+# include <cstdlib>
+# include <Siv3D/Platform.hpp>
+# include <Siv3D/CSVReader.hpp>
+# include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/TextReader.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/Threading.hpp>
+# include "../../ThirdParty/double-conversion/double-conversion.h"
+
+# if defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+	# define SIV3D_CSVREADER_REFERENCE
+
+# else
+
+	# include <emmintrin.h>
+
+	# if defined(SIV3D_TARGET_WINDOWS)
+
+		# include <intrin.h>
+
+	# endif
+
+# endif
+
+namespace s3d
+{
+	namespace detail
+	{
+		struct CSVRow
+		{
+			// 行の先頭のバッファ内の位置
+			size_t offset;
+
+			// 行の最初のセルの番号
+			size_t firstCell;
+		};
+
+		struct CSVCell
+		{
+			// 行の先頭からの位置
+			uint32 begin;
+
+			uint32 length;
+		};
+
+		struct CSVSyntax
+		{
+			char separator;
+
+			char quote;
+
+			char escape;
+
+			bool hasQuote;
+
+			bool hasEscape;
+		};
+
+		struct CSVReaderDetail
+		{
+			// 解析後のテキスト。各セルはその場でエスケープを解除し、'\0' で終端する
+			Array<char> buffer;
+
+			Array<CSVRow> rows;
+
+			Array<CSVCell> cells;
+
+			[[nodiscard]] size_t columns(const size_t row) const
+			{
+				const size_t lastCell = ((row + 1) < rows.size()) ? rows[row + 1].firstCell : cells.size();
+
+				return (lastCell - rows[row].firstCell);
+			}
+		};
+
+		// 1 つのチャンクの大きさの目安
+		constexpr size_t DefaultCSVChunkSize = (1 << 20);
+
+		static size_t g_csvChunkSize = DefaultCSVChunkSize;
+
+		// テストで複数のチャンクに分けて解析させるために使う。0 を指定すると既定値に戻す
+		void SetCSVChunkSize(const size_t size)
+		{
+			g_csvChunkSize = (size ? size : DefaultCSVChunkSize);
+		}
+
+	# if !defined(SIV3D_CSVREADER_REFERENCE)
+
+		[[nodiscard]] inline uint32 CountTrailingZeros(const uint32 x)
+		{
+		# if defined(SIV3D_TARGET_WINDOWS)
+
+			unsigned long index;
+			::_BitScanForward(&index, x);
+			return static_cast<uint32>(index);
+
+		# else
+
+			return static_cast<uint32>(__builtin_ctz(x));
+
+		# endif
+		}
+
+	# endif
+
+		// [p, last) で最初のクォートかエスケープ（Delimiters が true の場合は区切り文字と改行も）の位置を返す
+		template <bool Delimiters>
+		[[nodiscard]] static const char* FindSpecial(const char* p, const char* const last, const CSVSyntax& syntax)
+		{
+			const auto isSpecial = [&syntax](const char c)
+			{
+				return (syntax.hasQuote && (c == syntax.quote))
+					|| (syntax.hasEscape && (c == syntax.escape))
+					|| (Delimiters && ((c == syntax.separator) || (c == '\n') || (c == '\r')));
+			};
+
+		# if !defined(SIV3D_CSVREADER_REFERENCE)
+
+			// 使用しないクォートとエスケープは区切り文字と比較する（候補は isSpecial で確かめる）
+			const __m128i quote = ::_mm_set1_epi8(syntax.hasQuote ? syntax.quote : syntax.separator);
+			const __m128i escape = ::_mm_set1_epi8(syntax.hasEscape ? syntax.escape : syntax.separator);
+			const __m128i separator = ::_mm_set1_epi8(syntax.separator);
+			const __m128i lf = ::_mm_set1_epi8('\n');
+			const __m128i cr = ::_mm_set1_epi8('\r');
+
+			for (; (p + 16) <= last; p += 16)
+			{
+				const __m128i v = ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+
+				__m128i match = ::_mm_or_si128(::_mm_cmpeq_epi8(v, quote), ::_mm_cmpeq_epi8(v, escape));
+
+				if (Delimiters)
+				{
+					match = ::_mm_or_si128(match, ::_mm_or_si128(::_mm_cmpeq_epi8(v, separator),
+						::_mm_or_si128(::_mm_cmpeq_epi8(v, lf), ::_mm_cmpeq_epi8(v, cr))));
+				}
+
+				for (uint32 mask = static_cast<uint32>(::_mm_movemask_epi8(match)); mask; mask &= (mask - 1))
+				{
+					const char* const candidate = p + CountTrailingZeros(mask);
+
+					if (isSpecial(*candidate))
+					{
+						return candidate;
+					}
+				}
+			}
+
+		# endif
+
+			for (; p < last; ++p)
+			{
+				if (isSpecial(*p))
+				{
+					return p;
+				}
+			}
+
+			return last;
+		}
+
+		// エスケープの次の文字。エスケープできない文字の場合、エスケープ自身を文字として扱う
+		// （以前の CSVData が使っていた boost::escaped_list_separator と同じく、区切り文字はエスケープできない）
+		[[nodiscard]] static size_t EscapedChar(const char* p, const char* const last, const CSVSyntax& syntax, char& result)
+		{
+			if ((p + 1) < last)
+			{
+				const char next = p[1];
+
+				if ((syntax.hasQuote && (next == syntax.quote)) || (next == syntax.escape))
+				{
+					result = next;
+
+					return 2;
+				}
+				else if (next == 'n')
+				{
+					result = '\n';
+
+					return 2;
+				}
+			}
+
+			result = *p;
+
+			return 1;
+		}
+
+		// [begin, end) の各チャンクの先頭（行の先頭）を返す
+		// 区切りを決めるためにクォートの状態だけを先頭から追い、その他の解析は各チャンクで並列に行う
+		[[nodiscard]] static Array<size_t> SplitIntoChunks(const char* const base, const size_t begin, const size_t end, const size_t numChunks, const CSVSyntax& syntax)
+		{
+			Array<size_t> starts = { begin };
+
+			const char* p = base + begin;
+			const char* const last = base + end;
+			bool inQuotes = false;
+
+			const auto advance = [&]()
+			{
+				const char c = *p;
+
+				if (syntax.hasQuote && (c == syntax.quote))
+				{
+					if (inQuotes && ((p + 1) < last) && (p[1] == syntax.quote))
+					{
+						p += 2;
+					}
+					else
+					{
+						inQuotes = !inQuotes;
+						++p;
+					}
+				}
+				else if (syntax.hasEscape && (c == syntax.escape))
+				{
+					char unused;
+					p += EscapedChar(p, last, syntax, unused);
+				}
+				else
+				{
+					++p;
+				}
+			};
+
+			for (size_t i = 1; i < numChunks; ++i)
+			{
+				const char* const target = base + begin + (end - begin) * i / numChunks;
+
+				// advance() が 2 文字の並びを読んで target を越えた場合に、p を戻さない
+				while ((p < target) && ((p = FindSpecial<false>(p, target, syntax)) < target))
+				{
+					advance();
+				}
+
+				// target の後の、クォートの外にある最初の改行の次の行から始める
+				while ((p = FindSpecial<true>(p, last, syntax)) < last)
+				{
+					const char c = *p;
+
+					if (!inQuotes && ((c == '\n') || (c == '\r')))
+					{
+						p += ((c == '\r') && ((p + 1) < last) && (p[1] == '\n')) ? 2 : 1;
+
+						break;
+					}
+
+					advance();
+				}
+
+				if (last <= p)
+				{
+					break;
+				}
+
+				starts.push_back(static_cast<size_t>(p - base));
+			}
+
+			starts.push_back(end);
+
+			return starts;
+		}
+
+		// [begin, end) の行を解析する。セルのエスケープはその場で解除する
+		static void ParseRows(char* const base, const size_t begin, const size_t end, const CSVSyntax& syntax, Array<CSVRow>& rows, Array<CSVCell>& cells)
+		{
+			char* p = base + begin;
+			char* const last = base + end;
+
+			while (p < last)
+			{
+				char* const rowBegin = p;
+
+				rows.push_back({ static_cast<size_t>(rowBegin - base), cells.size() });
+
+				// 空行はセルを持たない行にする（boost::tokenizer を使っていた以前の CSVData と同じ）
+				if ((*p == '\n') || (*p == '\r'))
+				{
+					p += ((*p == '\r') && ((p + 1) < last) && (p[1] == '\n')) ? 2 : 1;
+
+					continue;
+				}
+
+				bool endOfRow = false;
+
+				while (!endOfRow)
+				{
+					char* const cellBegin = p;
+					char* out = p;
+					bool inQuotes = false;
+
+					for (;;)
+					{
+						// 特殊な文字の手前までをまとめて進める
+						char* const special = const_cast<char*>(FindSpecial<true>(p, last, syntax));
+						const size_t length = (special - p);
+
+						if (out != p)
+						{
+							std::memmove(out, p, length);
+						}
+
+						out += length;
+						p = special;
+
+						if (p == last)
+						{
+							endOfRow = true;
+
+							break;
+						}
+
+						const char c = *p;
+
+						if (inQuotes)
+						{
+							if (syntax.hasQuote && (c == syntax.quote))
+							{
+								// クォート内の "" はクォート 1 文字
+								if (((p + 1) < last) && (p[1] == syntax.quote))
+								{
+									*out++ = c;
+									p += 2;
+								}
+								else
+								{
+									inQuotes = false;
+									++p;
+								}
+							}
+							else if (syntax.hasEscape && (c == syntax.escape))
+							{
+								char result;
+								p += EscapedChar(p, last, syntax, result);
+								*out++ = result;
+							}
+							else
+							{
+								// クォート内の区切り文字と改行
+								*out++ = c;
+								++p;
+							}
+						}
+						else if (c == syntax.separator)
+						{
+							++p;
+
+							break;
+						}
+						else if ((c == '\n') || (c == '\r'))
+						{
+							p += ((c == '\r') && ((p + 1) < last) && (p[1] == '\n')) ? 2 : 1;
+
+							endOfRow = true;
+
+							break;
+						}
+						else if (syntax.hasQuote && (c == syntax.quote))
+						{
+							inQuotes = true;
+							++p;
+						}
+						else
+						{
+							char result;
+							p += EscapedChar(p, last, syntax, result);
+							*out++ = result;
+						}
+					}
+
+					// チャンクの終端の位置は次のチャンクの先頭なので書き込まない（最後のチャンクの終端には '\0' がある）
+					if (out < last)
+					{
+						*out = '\0';
+					}
+
+					cells.push_back({ static_cast<uint32>(cellBegin - rowBegin), static_cast<uint32>(out - cellBegin) });
+				}
+			}
+		}
+
+		[[nodiscard]] static bool HasUTF8BOM(const Array<char>& buffer)
+		{
+			return (buffer.size() >= 3) && (static_cast<uint8>(buffer[0]) == 0xEF) && (static_cast<uint8>(buffer[1]) == 0xBB) && (static_cast<uint8>(buffer[2]) == 0xBF);
+		}
+
+		[[nodiscard]] static bool HasUTF16BOM(const Array<char>& buffer)
+		{
+			return (buffer.size() >= 2) && (((static_cast<uint8>(buffer[0]) == 0xFF) && (static_cast<uint8>(buffer[1]) == 0xFE))
+				|| ((static_cast<uint8>(buffer[0]) == 0xFE) && (static_cast<uint8>(buffer[1]) == 0xFF)));
+		}
+
+		[[nodiscard]] static bool IsValidSyntaxChar(const char32 ch)
+		{
+			return (ch < 0x80) && (ch != U'\n') && (ch != U'\r');
+		}
+
+		// buffer の UTF-8 のテキストを解析する
+		static bool Parse(CSVReaderDetail& detail, const char32 separator, const char32 quote, const char32 escape)
+		{
+			if (!separator || !IsValidSyntaxChar(separator) || !IsValidSyntaxChar(quote) || !IsValidSyntaxChar(escape))
+			{
+				return false;
+			}
+
+			const CSVSyntax syntax{ static_cast<char>(separator), static_cast<char>(quote), static_cast<char>(escape), (quote != 0), (escape != 0) };
+
+			const size_t begin = HasUTF8BOM(detail.buffer) ? 3 : 0;
+			const size_t end = detail.buffer.size();
+
+			// 終端の '\0'
+			detail.buffer.push_back('\0');
+
+			const size_t numChunks = Clamp<size_t>((end - begin) / g_csvChunkSize, 1, Threading::GetConcurrency() * 4);
+			const Array<size_t> starts = SplitIntoChunks(detail.buffer.data(), begin, end, numChunks, syntax);
+
+			Array<Array<CSVRow>> chunkRows(starts.size() - 1);
+			Array<Array<CSVCell>> chunkCells(starts.size() - 1);
+
+			Threading::ParallelFor(chunkRows.size(), [&](const size_t beginIndex, const size_t endIndex)
+			{
+				for (size_t i = beginIndex; i < endIndex; ++i)
+				{
+					ParseRows(detail.buffer.data(), starts[i], starts[i + 1], syntax, chunkRows[i], chunkCells[i]);
+				}
+			});
+
+			size_t numRows = 0, numCells = 0;
+
+			for (size_t i = 0; i < chunkRows.size(); ++i)
+			{
+				numRows += chunkRows[i].size();
+				numCells += chunkCells[i].size();
+			}
+
+			detail.rows.reserve(numRows);
+			detail.cells.reserve(numCells);
+
+			for (size_t i = 0; i < chunkRows.size(); ++i)
+			{
+				const size_t cellOffset = detail.cells.size();
+
+				for (const auto& row : chunkRows[i])
+				{
+					detail.rows.push_back({ row.offset, row.firstCell + cellOffset });
+				}
+
+				detail.cells.append(chunkCells[i]);
+
+				chunkRows[i].release();
+				chunkCells[i].release();
+			}
+
+			return true;
+		}
+
+		[[nodiscard]] static std::string_view TrimSpaces(std::string_view s)
+		{
+			while (!s.empty() && ((s.front() == ' ') || (s.front() == '\t')))
+			{
+				s.remove_prefix(1);
+			}
+
+			while (!s.empty() && ((s.back() == ' ') || (s.back() == '\t')))
+			{
+				s.remove_suffix(1);
+			}
+
+			return s;
+		}
+
+		// s はセルの一部で、セルは '\0' で終端されている（s の後ろには空白しか無い）
+		template <class IntType>
+		[[nodiscard]] static Optional<IntType> ParseInteger(std::string_view s)
+		{
+			s = TrimSpaces(s);
+
+			if ((s.size() >= 2) && (s.front() == '+'))
+			{
+				s.remove_prefix(1);
+			}
+
+			// strtoll / strtoull は先頭の空白や符号も受け付けるため、数字（符号付きの場合は '-' も）で始まることを確かめる
+			if (s.empty() || !(IsDigit(s.front()) || (std::is_signed_v<IntType> && (s.front() == '-'))))
+			{
+				return none;
+			}
+
+			char* end = nullptr;
+
+			errno = 0;
+
+			if constexpr (std::is_signed_v<IntType>)
+			{
+				const long long value = std::strtoll(s.data(), &end, 10);
+
+				if ((errno == ERANGE) || (end != (s.data() + s.size()))
+					|| (value < std::numeric_limits<IntType>::min()) || (std::numeric_limits<IntType>::max() < value))
+				{
+					return none;
+				}
+
+				return static_cast<IntType>(value);
+			}
+			else
+			{
+				const unsigned long long value = std::strtoull(s.data(), &end, 10);
+
+				if ((errno == ERANGE) || (end != (s.data() + s.size()))
+					|| (std::numeric_limits<IntType>::max() < value))
+				{
+					return none;
+				}
+
+				return static_cast<IntType>(value);
+			}
+		}
+
+		[[nodiscard]] static Optional<double> ParseDouble(std::string_view s)
+		{
+			using namespace double_conversion;
+
+			s = TrimSpaces(s);
+
+			if (s.empty())
+			{
+				return none;
+			}
+
+			const StringToDoubleConverter conv(StringToDoubleConverter::ALLOW_SPACES_AFTER_SIGN, 0.0, 0.0, "inf", "nan");
+
+			int processed = 0;
+
+			const double value = conv.StringToDouble(s.data(), static_cast<int>(s.size()), &processed);
+
+			if (processed != static_cast<int>(s.size()))
+			{
+				return none;
+			}
+
+			return value;
+		}
+	}
+
+	CSVReader::CSVReader()
+		: m_detail(std::make_shared<detail::CSVReaderDetail>())
+	{
+
+	}
+
+	CSVReader::CSVReader(const FilePath& path, const char32 separator, const char32 quote, const char32 escape)
+		: CSVReader()
+	{
+		open(path, separator, quote, escape);
+	}
+
+	CSVReader::CSVReader(const std::shared_ptr<IReader>& reader, const char32 separator, const char32 quote, const char32 escape)
+		: CSVReader()
+	{
+		open(reader, separator, quote, escape);
+	}
+
+	bool CSVReader::open(const FilePath& path, const char32 separator, const char32 quote, const char32 escape)
+	{
+		if (isOpened())
+		{
+			close();
+		}
+
+		{
+			BinaryReader reader(path, ReadAccessHint::Sequential);
+
+			if (!reader)
+			{
+				return false;
+			}
+
+			// 解析するバッファへ直接読み込む（終端の '\0' の分も確保しておく）
+			const size_t size = static_cast<size_t>(reader.size());
+
+			m_detail->buffer.reserve(size + 1);
+
+			m_detail->buffer.resize(size);
+
+			if (reader.read(m_detail->buffer.data(), size) != static_cast<int64>(size))
+			{
+				close();
+
+				return false;
+			}
+		}
+
+		// UTF-16 のファイルは UTF-8 に変換してから解析する
+		if (detail::HasUTF16BOM(m_detail->buffer))
+		{
+			const std::string text = Unicode::ToUTF8(TextReader(path).readAll());
+
+			m_detail->buffer.assign(text.begin(), text.end());
+		}
+
+		if (!detail::Parse(*m_detail, separator, quote, escape))
+		{
+			close();
+
+			return false;
+		}
+
+		return true;
+	}
+
+	bool CSVReader::open(const std::shared_ptr<IReader>& reader, const char32 separator, const char32 quote, const char32 escape)
+	{
+		if (isOpened())
+		{
+			close();
+		}
+
+		if (!reader || !reader->isOpened())
+		{
+			return false;
+		}
+
+		m_detail->buffer.resize(static_cast<size_t>(reader->size()));
+
+		if (reader->read(m_detail->buffer.data(), 0, reader->size()) != reader->size())
+		{
+			close();
+
+			return false;
+		}
+
+		if (detail::HasUTF16BOM(m_detail->buffer))
+		{
+			reader->setPos(0);
+
+			const std::string text = Unicode::ToUTF8(TextReader(reader).readAll());
+
+			m_detail->buffer.assign(text.begin(), text.end());
+		}
+
+		if (!detail::Parse(*m_detail, separator, quote, escape))
+		{
+			close();
+
+			return false;
+		}
+
+		return true;
+	}
+
+	void CSVReader::close()
+	{
+		m_detail->buffer.release();
+
+		m_detail->rows.release();
+
+		m_detail->cells.release();
+	}
+
+	bool CSVReader::isOpened() const
+	{
+		return !m_detail->buffer.isEmpty();
+	}
+
+	size_t CSVReader::rows() const
+	{
+		return m_detail->rows.size();
+	}
+
+	size_t CSVReader::columns(const size_t row) const
+	{
+		if (row >= m_detail->rows.size())
+		{
+			return 0;
+		}
+
+		return m_detail->columns(row);
+	}
+
+	std::string_view CSVReader::getUTF8(const size_t row, const size_t column) const
+	{
+		if ((row >= m_detail->rows.size()) || (column >= m_detail->columns(row)))
+		{
+			return std::string_view();
+		}
+
+		const detail::CSVRow& r = m_detail->rows[row];
+		const detail::CSVCell& cell = m_detail->cells[r.firstCell + column];
+
+		return std::string_view(m_detail->buffer.data() + r.offset + cell.begin, cell.length);
+	}
+
+	Optional<String> CSVReader::getItem(const size_t row, const size_t column) const
+	{
+		if ((row >= m_detail->rows.size()) || (column >= m_detail->columns(row)))
+		{
+			return none;
+		}
+
+		return Unicode::FromUTF8(getUTF8(row, column));
+	}
+
+	Array<String> CSVReader::getRow(const size_t row) const
+	{
+		Array<String> result(columns(row));
+
+		for (size_t column = 0; column < result.size(); ++column)
+		{
+			result[column] = Unicode::FromUTF8(getUTF8(row, column));
+		}
+
+		return result;
+	}
+
+	Array<Array<String>> CSVReader::toArray() const
+	{
+		Array<Array<String>> result(rows());
+
+		Threading::ParallelFor(result.size(), [&](const size_t beginIndex, const size_t endIndex)
+		{
+			for (size_t row = beginIndex; row < endIndex; ++row)
+			{
+				result[row] = getRow(row);
+			}
+		});
+
+		return result;
+	}
+
+	template <>
+	Optional<String> CSVReader::getOpt<String>(const size_t row, const size_t column) const
+	{
+		return getItem(row, column);
+	}
+
+	template <>
+	Optional<int32> CSVReader::getOpt<int32>(const size_t row, const size_t column) const
+	{
+		return detail::ParseInteger<int32>(getUTF8(row, column));
+	}
+
+	template <>
+	Optional<uint32> CSVReader::getOpt<uint32>(const size_t row, const size_t column) const
+	{
+		return detail::ParseInteger<uint32>(getUTF8(row, column));
+	}
+
+	template <>
+	Optional<int64> CSVReader::getOpt<int64>(const size_t row, const size_t column) const
+	{
+		return detail::ParseInteger<int64>(getUTF8(row, column));
+	}
+
+	template <>
+	Optional<uint64> CSVReader::getOpt<uint64>(const size_t row, const size_t column) const
+	{
+		return detail::ParseInteger<uint64>(getUTF8(row, column));
+	}
+
+	template <>
+	Optional<float> CSVReader::getOpt<float>(const size_t row, const size_t column) const
+	{
+		if (const auto value = detail::ParseDouble(getUTF8(row, column)))
+		{
+			return static_cast<float>(value.value());
+		}
+
+		return none;
+	}
+
+	template <>
+	Optional<double> CSVReader::getOpt<double>(const size_t row, const size_t column) const
+	{
+		return detail::ParseDouble(getUTF8(row, column));
+	}
+}
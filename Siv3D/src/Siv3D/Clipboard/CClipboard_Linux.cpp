@@ -47,6 +47,11 @@ namespace s3d
 
 	bool CClipboard_Linux::getText(String& text)
 	{
+		if (!m_glfwWindow)
+		{
+			return false;
+		}
+
 		const char* glfwText = glfwGetClipboardString(m_glfwWindow);
 		if (glfwText == nullptr)
 			return false;
@@ -71,6 +76,11 @@ namespace s3d
 
 	void CClipboard_Linux::setText(const String& text)
 	{
+		if (!m_glfwWindow)
+		{
+			return;
+		}
+
 		glfwSetClipboardString(m_glfwWindow, text.narrow().c_str());
 	}
 
@@ -81,6 +91,11 @@ namespace s3d
 
 	void CClipboard_Linux::clear()
 	{
+		if (!m_glfwWindow)
+		{
+			return;
+		}
+
 		glfwSetClipboardString(m_glfwWindow, "");
 	}
 }
@@ -0,0 +1,495 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/IReader.hpp>
+# include <Siv3D/IWriter.hpp>
+# include "CCompressor.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	CompressionDictionary
+	//
+
+	CompressionDictionary::CCompressionDictionary::CCompressionDictionary(Array<Byte>&& data)
+		: m_data(std::move(data))
+	{
+		m_id = ZSTD_getDictID_fromDict(m_data.data(), m_data.size());
+	}
+
+	CompressionDictionary::CCompressionDictionary::~CCompressionDictionary()
+	{
+		for (auto& cDict : m_cDicts)
+		{
+			ZSTD_freeCDict(cDict.second);
+		}
+
+		ZSTD_freeDDict(m_dDict);
+	}
+
+	const ZSTD_CDict* CompressionDictionary::CCompressionDictionary::getCDict(const int32 compressionLevel)
+	{
+		if (m_data.isEmpty())
+		{
+			return nullptr;
+		}
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (auto it = m_cDicts.find(compressionLevel); it != m_cDicts.end())
+		{
+			return it->second;
+		}
+
+		// m_data は辞書の寿命の間変更されないため、コピーせずに参照する
+		ZSTD_CDict* const cDict = ZSTD_createCDict_byReference(m_data.data(), m_data.size(), compressionLevel);
+
+		if (cDict)
+		{
+			m_cDicts.emplace(compressionLevel, cDict);
+		}
+
+		return cDict;
+	}
+
+	const ZSTD_DDict* CompressionDictionary::CCompressionDictionary::getDDict()
+	{
+		if (m_data.isEmpty())
+		{
+			return nullptr;
+		}
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (!m_dDict)
+		{
+			m_dDict = ZSTD_createDDict_byReference(m_data.data(), m_data.size());
+		}
+
+		return m_dDict;
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Compressor
+	//
+
+	Compressor::CCompressor::CCompressor(const CompressionDictionary& dictionary, const int32 compressionLevel, const size_t numWorkers)
+		: m_cctx(ZSTD_createCCtx())
+		, m_compressionLevel(compressionLevel)
+		, m_dictionary(dictionary)
+	{
+		setNumWorkers(numWorkers);
+	}
+
+	Compressor::CCompressor::~CCompressor()
+	{
+		ZSTD_freeCCtx(m_cctx);
+	}
+
+	void Compressor::CCompressor::setCompressionLevel(const int32 compressionLevel)
+	{
+		if (compressionLevel == m_compressionLevel)
+		{
+			return;
+		}
+
+		m_compressionLevel = compressionLevel;
+
+		m_dirty = true;
+	}
+
+	bool Compressor::CCompressor::setNumWorkers(const size_t numWorkers)
+	{
+		if (!m_cctx)
+		{
+			return false;
+		}
+
+		// ZSTD_MULTITHREAD が無効なビルドでは numWorkers > 0 がエラーになる
+		if (ZSTD_isError(ZSTD_CCtx_setParameter(m_cctx, ZSTD_p_nbWorkers, static_cast<unsigned>(numWorkers))))
+		{
+			ZSTD_CCtx_setParameter(m_cctx, ZSTD_p_nbWorkers, static_cast<unsigned>(m_numWorkers));
+
+			return false;
+		}
+
+		m_numWorkers = numWorkers;
+
+		return true;
+	}
+
+	void Compressor::CCompressor::setDictionary(const CompressionDictionary& dictionary)
+	{
+		// 古い ZSTD_CDict への参照を先に外す
+		abortFrame();
+
+		m_dictionary = dictionary;
+	}
+
+	bool Compressor::CCompressor::beginFrame(const uint64 pledgedSrcSize)
+	{
+		if (!m_cctx)
+		{
+			return false;
+		}
+
+		if (m_dirty)
+		{
+			ZSTD_CCtx_reset(m_cctx);
+
+			if (ZSTD_isError(ZSTD_CCtx_setParameter(m_cctx, ZSTD_p_compressionLevel, static_cast<unsigned>(m_compressionLevel)))
+				|| ZSTD_isError(ZSTD_CCtx_setParameter(m_cctx, ZSTD_p_nbWorkers, static_cast<unsigned>(m_numWorkers))))
+			{
+				return false;
+			}
+
+			if (m_dictionary)
+			{
+				const ZSTD_CDict* cDict = m_dictionary.pImpl->getCDict(m_compressionLevel);
+
+				if (!cDict || ZSTD_isError(ZSTD_CCtx_refCDict(m_cctx, cDict)))
+				{
+					return false;
+				}
+			}
+
+			m_dirty = false;
+		}
+
+		// 入力サイズが分かっている場合はフレームヘッダに記録し、展開時に一括で確保できるようにする
+		if (ZSTD_isError(ZSTD_CCtx_setPledgedSrcSize(m_cctx, pledgedSrcSize)))
+		{
+			abortFrame();
+
+			return false;
+		}
+
+		return true;
+	}
+
+	void Compressor::CCompressor::abortFrame()
+	{
+		if (m_cctx)
+		{
+			ZSTD_CCtx_reset(m_cctx);
+		}
+
+		m_dirty = true;
+	}
+
+	bool Compressor::CCompressor::compress(const ByteArrayView view, Array<Byte>& dst)
+	{
+		dst.clear();
+
+		if (!beginFrame(view.size()))
+		{
+			return false;
+		}
+
+		dst.resize(ZSTD_compressBound(view.size()));
+
+		ZSTD_inBuffer input = { view.data(), view.size(), 0 };
+		ZSTD_outBuffer output = { dst.data(), dst.size(), 0 };
+
+		for (;;)
+		{
+			const size_t remaining = ZSTD_compress_generic(m_cctx, &output, &input, ZSTD_e_end);
+
+			if (ZSTD_isError(remaining))
+			{
+				abortFrame();
+
+				dst.clear();
+
+				return false;
+			}
+
+			if (remaining == 0)
+			{
+				break;
+			}
+
+			if (output.pos == output.size)
+			{
+				dst.resize(dst.size() + remaining);
+				output.dst = dst.data();
+				output.size = dst.size();
+			}
+		}
+
+		dst.resize(output.pos);
+
+		return true;
+	}
+
+	bool Compressor::CCompressor::compress(IReader& reader, IWriter& writer)
+	{
+		if (!reader.isOpened() || !writer.isOpened())
+		{
+			return false;
+		}
+
+		const int64 srcSize = reader.size() - reader.getPos();
+
+		if (!beginFrame(srcSize >= 0 ? static_cast<uint64>(srcSize) : ZSTD_CONTENTSIZE_UNKNOWN))
+		{
+			return false;
+		}
+
+		m_inputBuffer.resize(ZSTD_CStreamInSize());
+		m_outputBuffer.resize(ZSTD_CStreamOutSize());
+
+		for (;;)
+		{
+			const int64 read = reader.read(m_inputBuffer.data(), m_inputBuffer.size());
+
+			if (read < 0)
+			{
+				abortFrame();
+
+				return false;
+			}
+
+			const ZSTD_EndDirective mode = (read == 0) ? ZSTD_e_end : ZSTD_e_continue;
+
+			ZSTD_inBuffer input = { m_inputBuffer.data(), static_cast<size_t>(read), 0 };
+
+			for (;;)
+			{
+				ZSTD_outBuffer output = { m_outputBuffer.data(), m_outputBuffer.size(), 0 };
+
+				const size_t remaining = ZSTD_compress_generic(m_cctx, &output, &input, mode);
+
+				if (ZSTD_isError(remaining)
+					|| (output.pos && (writer.write(output.dst, output.pos) != static_cast<int64>(output.pos))))
+				{
+					abortFrame();
+
+					return false;
+				}
+
+				if ((mode == ZSTD_e_end) ? (remaining == 0) : (input.pos == input.size))
+				{
+					break;
+				}
+			}
+
+			if (mode == ZSTD_e_end)
+			{
+				return true;
+			}
+		}
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Decompressor
+	//
+
+	Decompressor::CDecompressor::CDecompressor(const CompressionDictionary& dictionary)
+		: m_dctx(ZSTD_createDCtx())
+		, m_dictionary(dictionary)
+	{
+
+	}
+
+	Decompressor::CDecompressor::~CDecompressor()
+	{
+		ZSTD_freeDCtx(m_dctx);
+	}
+
+	void Decompressor::CDecompressor::setDictionary(const CompressionDictionary& dictionary)
+	{
+		if (m_dctx)
+		{
+			// 古い ZSTD_DDict への参照を先に外す
+			ZSTD_DCtx_reset(m_dctx);
+		}
+
+		m_dictionary = dictionary;
+	}
+
+	bool Decompressor::CDecompressor::beginStream()
+	{
+		if (!m_dctx)
+		{
+			return false;
+		}
+
+		if (m_dictionary)
+		{
+			const ZSTD_DDict* dDict = m_dictionary.pImpl->getDDict();
+
+			return dDict && !ZSTD_isError(ZSTD_initDStream_usingDDict(m_dctx, dDict));
+		}
+		else
+		{
+			return !ZSTD_isError(ZSTD_initDStream(m_dctx));
+		}
+	}
+
+	bool Decompressor::CDecompressor::decompress(const ByteArrayView view, Array<Byte>& dst)
+	{
+		dst.clear();
+
+		if (!m_dctx || view.empty())
+		{
+			return false;
+		}
+
+		const unsigned long long originalSize = ZSTD_findDecompressedSize(view.data(), view.size());
+
+		if (originalSize == ZSTD_CONTENTSIZE_ERROR)
+		{
+			return false;
+		}
+
+		// ヘッダのサイズは信頼できないため、上限を超える場合は一括で確保せずにストリームとして展開する
+		if ((originalSize != ZSTD_CONTENTSIZE_UNKNOWN) && (originalSize <= m_maxPreallocationSize))
+		{
+			dst.resize(static_cast<size_t>(originalSize));
+
+			size_t result;
+
+			if (m_dictionary)
+			{
+				const ZSTD_DDict* dDict = m_dictionary.pImpl->getDDict();
+
+				if (!dDict)
+				{
+					dst.clear();
+
+					return false;
+				}
+
+				result = ZSTD_decompress_usingDDict(m_dctx, dst.data(), dst.size(), view.data(), view.size(), dDict);
+			}
+			else
+			{
+				result = ZSTD_decompressDCtx(m_dctx, dst.data(), dst.size(), view.data(), view.size());
+			}
+
+			if (ZSTD_isError(result) || (result != originalSize))
+			{
+				dst.clear();
+
+				return false;
+			}
+
+			return true;
+		}
+
+		// 展開後のサイズがフレームヘッダに無いか上限を超える場合は、ストリームとして展開する
+		if (!beginStream())
+		{
+			return false;
+		}
+
+		const size_t outputChunkSize = ZSTD_DStreamOutSize();
+
+		ZSTD_inBuffer input = { view.data(), view.size(), 0 };
+
+		for (;;)
+		{
+			const size_t pos = dst.size();
+
+			dst.resize(pos + outputChunkSize);
+
+			ZSTD_outBuffer output = { dst.data() + pos, outputChunkSize, 0 };
+
+			const size_t result = ZSTD_decompressStream(m_dctx, &output, &input);
+
+			if (ZSTD_isError(result))
+			{
+				dst.clear();
+
+				return false;
+			}
+
+			dst.resize(pos + output.pos);
+
+			if ((input.pos == input.size) && ((output.pos < output.size) || (result == 0)))
+			{
+				if (result != 0)
+				{
+					// フレームが途中で終わっている
+					dst.clear();
+
+					return false;
+				}
+
+				return true;
+			}
+		}
+	}
+
+	bool Decompressor::CDecompressor::decompress(IReader& reader, IWriter& writer)
+	{
+		if (!reader.isOpened() || !writer.isOpened())
+		{
+			return false;
+		}
+
+		if (!beginStream())
+		{
+			return false;
+		}
+
+		m_inputBuffer.resize(ZSTD_DStreamInSize());
+		m_outputBuffer.resize(ZSTD_DStreamOutSize());
+
+		bool hasInput = false;
+
+		size_t result = 0;
+
+		for (;;)
+		{
+			const int64 read = reader.read(m_inputBuffer.data(), m_inputBuffer.size());
+
+			if (read < 0)
+			{
+				return false;
+			}
+			else if (read == 0)
+			{
+				break;
+			}
+
+			hasInput = true;
+
+			ZSTD_inBuffer input = { m_inputBuffer.data(), static_cast<size_t>(read), 0 };
+
+			for (;;)
+			{
+				ZSTD_outBuffer output = { m_outputBuffer.data(), m_outputBuffer.size(), 0 };
+
+				result = ZSTD_decompressStream(m_dctx, &output, &input);
+
+				if (ZSTD_isError(result)
+					|| (output.pos && (writer.write(output.dst, output.pos) != static_cast<int64>(output.pos))))
+				{
+					return false;
+				}
+
+				// フレームの終端 (result == 0) の後に空の入力で呼ぶと、次のフレームの開始とみなされる
+				if ((input.pos == input.size) && ((output.pos < output.size) || (result == 0)))
+				{
+					break;
+				}
+			}
+		}
+
+		// result が 0 でない場合、最後のフレームが途中で終わっている
+		return hasInput && (result == 0);
+	}
+}
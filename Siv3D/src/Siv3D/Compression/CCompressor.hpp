@@ -0,0 +1,165 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# define ZSTD_STATIC_LINKING_ONLY
+# include <mutex>
+# include <unordered_map>
+# include "../../ThirdParty/zstd/zstd.h"
+# include <Siv3D/Compressor.hpp>
+# include <Siv3D/Array.hpp>
+
+namespace s3d
+{
+	class CompressionDictionary::CCompressionDictionary
+	{
+	private:
+
+		Array<Byte> m_data;
+
+		uint32 m_id = 0;
+
+		std::mutex m_mutex;
+
+		// 圧縮レベルごとに作成した ZSTD_CDict
+		std::unordered_map<int32, ZSTD_CDict*> m_cDicts;
+
+		ZSTD_DDict* m_dDict = nullptr;
+
+	public:
+
+		CCompressionDictionary() = default;
+
+		explicit CCompressionDictionary(Array<Byte>&& data);
+
+		~CCompressionDictionary();
+
+		bool isEmpty() const noexcept
+		{
+			return m_data.isEmpty();
+		}
+
+		uint32 id() const noexcept
+		{
+			return m_id;
+		}
+
+		ByteArrayView view() const noexcept
+		{
+			return ByteArrayView(m_data.data(), m_data.size());
+		}
+
+		// 辞書が空の場合は nullptr
+		const ZSTD_CDict* getCDict(int32 compressionLevel);
+
+		// 辞書が空の場合は nullptr
+		const ZSTD_DDict* getDDict();
+	};
+
+	class Compressor::CCompressor
+	{
+	private:
+
+		ZSTD_CCtx* m_cctx = nullptr;
+
+		int32 m_compressionLevel = Compression::DefaultCompressionLevel;
+
+		size_t m_numWorkers = 0;
+
+		CompressionDictionary m_dictionary;
+
+		// パラメータをコンテキストに再設定する必要があるか
+		bool m_dirty = true;
+
+		Array<Byte> m_inputBuffer;
+
+		Array<Byte> m_outputBuffer;
+
+		bool beginFrame(uint64 pledgedSrcSize);
+
+		void abortFrame();
+
+	public:
+
+		CCompressor(const CompressionDictionary& dictionary, int32 compressionLevel, size_t numWorkers);
+
+		~CCompressor();
+
+		void setCompressionLevel(int32 compressionLevel);
+
+		int32 getCompressionLevel() const noexcept
+		{
+			return m_compressionLevel;
+		}
+
+		bool setNumWorkers(size_t numWorkers);
+
+		size_t getNumWorkers() const noexcept
+		{
+			return m_numWorkers;
+		}
+
+		void setDictionary(const CompressionDictionary& dictionary);
+
+		const CompressionDictionary& getDictionary() const noexcept
+		{
+			return m_dictionary;
+		}
+
+		bool compress(ByteArrayView view, Array<Byte>& dst);
+
+		bool compress(IReader& reader, IWriter& writer);
+	};
+
+	class Decompressor::CDecompressor
+	{
+	private:
+
+		ZSTD_DCtx* m_dctx = nullptr;
+
+		CompressionDictionary m_dictionary;
+
+		size_t m_maxPreallocationSize = Decompressor::DefaultMaxPreallocationSize;
+
+		Array<Byte> m_inputBuffer;
+
+		Array<Byte> m_outputBuffer;
+
+		bool beginStream();
+
+	public:
+
+		explicit CDecompressor(const CompressionDictionary& dictionary);
+
+		~CDecompressor();
+
+		void setDictionary(const CompressionDictionary& dictionary);
+
+		const CompressionDictionary& getDictionary() const noexcept
+		{
+			return m_dictionary;
+		}
+
+		void setMaxPreallocationSize(size_t size) noexcept
+		{
+			m_maxPreallocationSize = size;
+		}
+
+		size_t getMaxPreallocationSize() const noexcept
+		{
+			return m_maxPreallocationSize;
+		}
+
+		bool decompress(ByteArrayView view, Array<Byte>& dst);
+
+		bool decompress(IReader& reader, IWriter& writer);
+	};
+}
@@ -0,0 +1,268 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "../../ThirdParty/zstd/dictBuilder/zdict.h"
+# include <Siv3D/Compressor.hpp>
+# include <Siv3D/ByteArray.hpp>
+# include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/BinaryWriter.hpp>
+# include "CCompressor.hpp"
+
+namespace s3d
+{
+	////////////////////////////////////////////////////////////////
+	//
+	//	CompressionDictionary
+	//
+
+	CompressionDictionary::CompressionDictionary()
+		: pImpl(std::make_shared<CCompressionDictionary>())
+	{
+
+	}
+
+	CompressionDictionary::CompressionDictionary(const ByteArrayView dictionary)
+		: pImpl(std::make_shared<CCompressionDictionary>(Array<Byte>(dictionary.begin(), dictionary.end())))
+	{
+
+	}
+
+	CompressionDictionary::CompressionDictionary(const FilePath& path)
+		: CompressionDictionary()
+	{
+		BinaryReader reader(path);
+
+		if (!reader)
+		{
+			return;
+		}
+
+		Array<Byte> data(static_cast<size_t>(reader.size()));
+
+		if (reader.read(data.data(), data.size()) != static_cast<int64>(data.size()))
+		{
+			return;
+		}
+
+		pImpl = std::make_shared<CCompressionDictionary>(std::move(data));
+	}
+
+	bool CompressionDictionary::isEmpty() const
+	{
+		return pImpl->isEmpty();
+	}
+
+	uint32 CompressionDictionary::id() const
+	{
+		return pImpl->id();
+	}
+
+	ByteArrayView CompressionDictionary::view() const
+	{
+		return pImpl->view();
+	}
+
+	bool CompressionDictionary::save(const FilePath& path) const
+	{
+		BinaryWriter writer(path);
+
+		if (!writer)
+		{
+			return false;
+		}
+
+		const ByteArrayView data = pImpl->view();
+
+		return writer.write(data.data(), data.size()) == static_cast<int64>(data.size());
+	}
+
+	CompressionDictionary CompressionDictionary::Train(const Array<ByteArrayView>& samples, const size_t maxDictionarySize)
+	{
+		if (samples.isEmpty() || (maxDictionarySize == 0))
+		{
+			return CompressionDictionary();
+		}
+
+		// ZDICT はサンプルを連結したバッファとサイズの配列を受け取る
+		size_t totalSize = 0;
+
+		for (const auto& sample : samples)
+		{
+			totalSize += sample.size();
+		}
+
+		Array<Byte> buffer;
+		buffer.reserve(totalSize);
+
+		Array<size_t> sampleSizes;
+		sampleSizes.reserve(samples.size());
+
+		for (const auto& sample : samples)
+		{
+			buffer.insert(buffer.end(), sample.begin(), sample.end());
+
+			sampleSizes.push_back(sample.size());
+		}
+
+		Array<Byte> dictionary(maxDictionarySize);
+
+		const size_t result = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(),
+			buffer.data(), sampleSizes.data(), static_cast<unsigned>(sampleSizes.size()));
+
+		if (ZDICT_isError(result))
+		{
+			return CompressionDictionary();
+		}
+
+		dictionary.resize(result);
+
+		CompressionDictionary trained;
+
+		trained.pImpl = std::make_shared<CCompressionDictionary>(std::move(dictionary));
+
+		return trained;
+	}
+
+	CompressionDictionary CompressionDictionary::Train(const Array<ByteArray>& samples, const size_t maxDictionarySize)
+	{
+		return Train(samples.map([](const ByteArray& sample) { return sample.view(); }), maxDictionarySize);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Compressor
+	//
+
+	Compressor::Compressor(const int32 compressionLevel, const size_t numWorkers)
+		: pImpl(std::make_shared<CCompressor>(CompressionDictionary(), compressionLevel, numWorkers))
+	{
+
+	}
+
+	Compressor::Compressor(const CompressionDictionary& dictionary, const int32 compressionLevel, const size_t numWorkers)
+		: pImpl(std::make_shared<CCompressor>(dictionary, compressionLevel, numWorkers))
+	{
+
+	}
+
+	void Compressor::setCompressionLevel(const int32 compressionLevel)
+	{
+		pImpl->setCompressionLevel(compressionLevel);
+	}
+
+	int32 Compressor::getCompressionLevel() const
+	{
+		return pImpl->getCompressionLevel();
+	}
+
+	bool Compressor::setNumWorkers(const size_t numWorkers)
+	{
+		return pImpl->setNumWorkers(numWorkers);
+	}
+
+	size_t Compressor::getNumWorkers() const
+	{
+		return pImpl->getNumWorkers();
+	}
+
+	void Compressor::setDictionary(const CompressionDictionary& dictionary)
+	{
+		pImpl->setDictionary(dictionary);
+	}
+
+	const CompressionDictionary& Compressor::getDictionary() const
+	{
+		return pImpl->getDictionary();
+	}
+
+	ByteArray Compressor::compress(const ByteArrayView view)
+	{
+		Array<Byte> buffer;
+
+		if (!pImpl->compress(view, buffer))
+		{
+			return ByteArray();
+		}
+
+		buffer.shrink_to_fit();
+
+		return ByteArray(std::move(buffer));
+	}
+
+	bool Compressor::compress(const ByteArrayView view, Array<Byte>& dst)
+	{
+		return pImpl->compress(view, dst);
+	}
+
+	bool Compressor::compress(IReader& reader, IWriter& writer)
+	{
+		return pImpl->compress(reader, writer);
+	}
+
+	////////////////////////////////////////////////////////////////
+	//
+	//	Decompressor
+	//
+
+	Decompressor::Decompressor()
+		: pImpl(std::make_shared<CDecompressor>(CompressionDictionary()))
+	{
+
+	}
+
+	Decompressor::Decompressor(const CompressionDictionary& dictionary)
+		: pImpl(std::make_shared<CDecompressor>(dictionary))
+	{
+
+	}
+
+	void Decompressor::setDictionary(const CompressionDictionary& dictionary)
+	{
+		pImpl->setDictionary(dictionary);
+	}
+
+	const CompressionDictionary& Decompressor::getDictionary() const
+	{
+		return pImpl->getDictionary();
+	}
+
+	void Decompressor::setMaxPreallocationSize(const size_t size)
+	{
+		pImpl->setMaxPreallocationSize(size);
+	}
+
+	size_t Decompressor::getMaxPreallocationSize() const
+	{
+		return pImpl->getMaxPreallocationSize();
+	}
+
+	ByteArray Decompressor::decompress(const ByteArrayView view)
+	{
+		Array<Byte> buffer;
+
+		if (!pImpl->decompress(view, buffer))
+		{
+			return ByteArray();
+		}
+
+		return ByteArray(std::move(buffer));
+	}
+
+	bool Decompressor::decompress(const ByteArrayView view, Array<Byte>& dst)
+	{
+		return pImpl->decompress(view, dst);
+	}
+
+	bool Decompressor::decompress(IReader& reader, IWriter& writer)
+	{
+		return pImpl->decompress(reader, writer);
+	}
+}
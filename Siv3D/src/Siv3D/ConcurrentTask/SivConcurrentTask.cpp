@@ -0,0 +1,69 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <thread>
+# include <Siv3D/ConcurrentTask.hpp>
+# include "../Siv3DEngine.hpp"
+# include "../ThreadPool/IThreadPool.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// 現在のスレッドで実行中のタスク
+		static thread_local ConcurrentTaskControl* t_currentTask = nullptr;
+
+		static ISiv3DThreadPool* GetThreadPool()
+		{
+			return Siv3DEngine::isActive() ? Siv3DEngine::GetThreadPool() : nullptr;
+		}
+
+		void ScheduleConcurrentTask(std::function<void()> job, const TaskPriority priority)
+		{
+			if (ISiv3DThreadPool* const pool = GetThreadPool())
+			{
+				pool->submit(std::move(job), priority);
+			}
+			else
+			{
+				// エンジンの外（起動前・終了後）では専用のスレッドで実行する
+				std::thread(std::move(job)).detach();
+			}
+		}
+
+		bool IsConcurrentTaskWorker()
+		{
+			const ISiv3DThreadPool* const pool = GetThreadPool();
+
+			return pool && pool->isWorkerThread();
+		}
+
+		bool RunPendingConcurrentTask()
+		{
+			ISiv3DThreadPool* const pool = GetThreadPool();
+
+			return pool && pool->runPendingJob();
+		}
+
+		ConcurrentTaskControl* ExchangeCurrentConcurrentTask(ConcurrentTaskControl* const control) noexcept
+		{
+			return std::exchange(t_currentTask, control);
+		}
+	}
+
+	namespace Threading
+	{
+		bool IsCancellationRequested() noexcept
+		{
+			return s3d::detail::t_currentTask && s3d::detail::t_currentTask->isCancellationRequested();
+		}
+	}
+}
@@ -52,6 +52,12 @@ namespace s3d
 
 	void CCursor_Linux::update()
 	{
+		// ヘッドレスモード
+		if (!m_glfwWindow)
+		{
+			return;
+		}
+
 		// グラブ処理
 		if (!m_grabbing_old && m_grabbing)
 		{
@@ -12,31 +12,472 @@
 # include <Siv3D/Platform.hpp>
 # if defined(SIV3D_TARGET_LINUX)
 
+# include <cerrno>
+# include <dirent.h>
+# include <unistd.h>
+# include <sys/epoll.h>
+# include <sys/eventfd.h>
+# include <sys/inotify.h>
+# include <sys/stat.h>
 # include <Siv3D/FileSystem.hpp>
+# include <Siv3D/Optional.hpp>
 # include <Siv3D/Logger.hpp>
 # include "DirectoryWatcherDetail_Linux.hpp"
 
 namespace s3d
 {
+	namespace detail
+	{
+		constexpr uint32 WatchMask = IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE
+			| IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR | IN_EXCL_UNLINK;
+
+		// 2 つの変更をまとめる。none の場合は何もなかったことにする
+		[[nodiscard]] static Optional<FileAction> CoalesceActions(const FileAction previous, const FileAction action)
+		{
+			if ((previous == FileAction::Unknown) || (action == FileAction::Unknown))
+			{
+				return FileAction::Unknown;
+			}
+			else if (previous == FileAction::Added)
+			{
+				// 作成後の変更は作成、作成後の削除は何もなかったことにする
+				if (action == FileAction::Removed)
+				{
+					return none;
+				}
+
+				return FileAction::Added;
+			}
+			else if (previous == FileAction::Removed)
+			{
+				// 削除後の作成（エディタによる保存など）は変更とする
+				return (action == FileAction::Removed) ? FileAction::Removed : FileAction::Modified;
+			}
+			else
+			{
+				return (action == FileAction::Removed) ? FileAction::Removed : previous;
+			}
+		}
+	}
+
 	DirectoryWatcher::DirectoryWatcherDetail::DirectoryWatcherDetail(const FilePath& directory)
 	{
+		if (directory.isEmpty() || !FileSystem::IsDirectory(directory))
+		{
+			LOG_FAIL(U"❌ DirectoryWatcher: `{}` is not a directory"_fmt(directory));
+
+			return;
+		}
+
+		m_directory = FileSystem::FullPath(directory);
+
+		// 監視を始めてからコンストラクタを抜けるよう、inotify の登録はこのスレッドで行う
+		if (!init())
+		{
+			return;
+		}
 
+		m_thread = std::thread(&DirectoryWatcherDetail::run, this);
+
+		LOG_DEBUG(U"ℹ️ DirectoryWatcher: Started monitoring `{}` ({} directories)"_fmt(m_directory, m_watches.size()));
 	}
 
 	DirectoryWatcher::DirectoryWatcherDetail::~DirectoryWatcherDetail()
 	{
+		if (m_thread.joinable())
+		{
+			const uint64 value = 1;
+
+			[[maybe_unused]] const ssize_t result = ::write(m_wakeup, &value, sizeof(value));
+
+			m_thread.join();
+
+			LOG_DEBUG(U"ℹ️ DirectoryWatcher: End monitoring `{}`"_fmt(m_directory));
+		}
 
+		for (const int32 fd : { m_inotify, m_epoll, m_wakeup })
+		{
+			if (fd != -1)
+			{
+				::close(fd);
+			}
+		}
 	}
 
 	Array<std::pair<FilePath, FileAction>> DirectoryWatcher::DirectoryWatcherDetail::retrieveChanges()
 	{
-		return{};
+		std::lock_guard lock(m_changesMutex);
+
+		Array<std::pair<FilePath, FileAction>> results;
+
+		results.swap(m_changes);
+
+		return results;
 	}
 
 	const FilePath& DirectoryWatcher::DirectoryWatcherDetail::directory() const
 	{
 		return m_directory;
 	}
+
+	bool DirectoryWatcher::DirectoryWatcherDetail::init()
+	{
+		m_inotify = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+		m_epoll = ::epoll_create1(EPOLL_CLOEXEC);
+
+		m_wakeup = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+		if ((m_inotify == -1) || (m_epoll == -1) || (m_wakeup == -1))
+		{
+			LOG_FAIL(U"❌ DirectoryWatcher: Failed to create inotify / epoll instances (errno: {})"_fmt(errno));
+
+			return false;
+		}
+
+		for (const int32 fd : { m_inotify, m_wakeup })
+		{
+			::epoll_event event = {};
+			event.events = EPOLLIN;
+			event.data.fd = fd;
+
+			if (::epoll_ctl(m_epoll, EPOLL_CTL_ADD, fd, &event) == -1)
+			{
+				LOG_FAIL(U"❌ DirectoryWatcher: epoll_ctl() failed (errno: {})"_fmt(errno));
+
+				return false;
+			}
+		}
+
+		addWatches(m_directory, false);
+
+		return !m_watches.empty();
+	}
+
+	void DirectoryWatcher::DirectoryWatcherDetail::run()
+	{
+		Array<uint8> buffer(BufferSize);
+
+		int32 timeout = -1;
+
+		for (;;)
+		{
+			::epoll_event events[2];
+
+			const int32 count = ::epoll_wait(m_epoll, events, 2, timeout);
+
+			if ((count == -1) && (errno != EINTR))
+			{
+				LOG_FAIL(U"❌ DirectoryWatcher: epoll_wait() failed (errno: {})"_fmt(errno));
+
+				return;
+			}
+
+			for (int32 i = 0; i < count; ++i)
+			{
+				if (events[i].data.fd == m_wakeup)
+				{
+					return;
+				}
+
+				for (;;)
+				{
+					const ssize_t readSize = ::read(m_inotify, buffer.data(), buffer.size());
+
+					if (readSize <= 0)
+					{
+						break;
+					}
+
+					processEvents(buffer.data(), static_cast<size_t>(readSize));
+				}
+			}
+
+			timeout = flushChanges();
+		}
+	}
+
+	void DirectoryWatcher::DirectoryWatcherDetail::addWatches(const FilePath& directory, const bool reportContents)
+	{
+		Array<FilePath> directories = { directory };
+
+		while (directories)
+		{
+			const FilePath current = directories.back();
+
+			directories.pop_back();
+
+			const std::string currentUTF8 = current.toUTF8();
+
+			const int32 wd = ::inotify_add_watch(m_inotify, currentUTF8.c_str(), detail::WatchMask);
+
+			if (wd == -1)
+			{
+				// ENOSPC の場合は fs.inotify.max_user_watches が不足している
+				LOG_FAIL(U"❌ DirectoryWatcher: inotify_add_watch() failed `{}` (errno: {})"_fmt(current, errno));
+
+				continue;
+			}
+
+			m_watches[wd] = current;
+
+			DIR* const dir = ::opendir(currentUTF8.c_str());
+
+			if (!dir)
+			{
+				continue;
+			}
+
+			while (const ::dirent* entry = ::readdir(dir))
+			{
+				const std::string_view name(entry->d_name);
+
+				if ((name == ".") || (name == ".."))
+				{
+					continue;
+				}
+
+				const FilePath path = current + Unicode::FromUTF8(name);
+
+				bool isDirectory = (entry->d_type == DT_DIR);
+
+				if (entry->d_type == DT_UNKNOWN)
+				{
+					struct stat s;
+
+					isDirectory = (::stat((currentUTF8 + entry->d_name).c_str(), &s) == 0) && S_ISDIR(s.st_mode);
+				}
+
+				// 監視を始める前に作られたファイルを取りこぼさないよう、新しいディレクトリの中身は作成として報告する
+				if (reportContents)
+				{
+					addChange(path, FileAction::Added);
+				}
+
+				if (isDirectory)
+				{
+					directories.push_back(path + U'/');
+				}
+			}
+
+			::closedir(dir);
+		}
+	}
+
+	void DirectoryWatcher::DirectoryWatcherDetail::removeWatches(const FilePath& directory)
+	{
+		Array<int32> removed;
+
+		for (const auto& watch : m_watches)
+		{
+			if (watch.second.starts_with(directory))
+			{
+				removed.push_back(watch.first);
+			}
+		}
+
+		for (const int32 wd : removed)
+		{
+			::inotify_rm_watch(m_inotify, wd);
+
+			m_watches.erase(wd);
+		}
+	}
+
+	void DirectoryWatcher::DirectoryWatcherDetail::renameWatches(const FilePath& from, const FilePath& to)
+	{
+		// ディレクトリの名前が変わっても watch descriptor はそのまま使えるので、パスだけを置き換える
+		for (auto it = m_watches.begin(); it != m_watches.end(); ++it)
+		{
+			if (it->second.starts_with(from))
+			{
+				it.value() = to + it->second.substr(from.size());
+			}
+		}
+	}
+
+	void DirectoryWatcher::DirectoryWatcherDetail::processEvents(const uint8* buffer, const size_t size)
+	{
+		// IN_MOVED_FROM と IN_MOVED_TO は同じ cookie で続けて届く
+		Array<MovedFrom> movedFrom;
+
+		for (const uint8* p = buffer; p < (buffer + size);)
+		{
+			const ::inotify_event* event = reinterpret_cast<const ::inotify_event*>(p);
+
+			p += (sizeof(::inotify_event) + event->len);
+
+			if (event->mask & IN_Q_OVERFLOW)
+			{
+				LOG_FAIL(U"❌ DirectoryWatcher: inotify event queue overflowed `{}`"_fmt(m_directory));
+
+				addChange(m_directory, FileAction::Unknown);
+
+				continue;
+			}
+
+			const auto it = m_watches.find(event->wd);
+
+			if (it == m_watches.end())
+			{
+				continue;
+			}
+
+			if (event->mask & IN_IGNORED)
+			{
+				m_watches.erase(it);
+
+				continue;
+			}
+
+			if (event->len == 0)
+			{
+				continue;
+			}
+
+			const FilePath path = it->second + Unicode::FromUTF8(event->name);
+
+			const bool isDirectory = (event->mask & IN_ISDIR);
+
+			if (event->mask & IN_CREATE)
+			{
+				addChange(path, FileAction::Added);
+
+				if (isDirectory)
+				{
+					addWatches(path + U'/', true);
+				}
+			}
+			else if (event->mask & IN_DELETE)
+			{
+				addChange(path, FileAction::Removed);
+			}
+			else if (event->mask & (IN_MODIFY | IN_CLOSE_WRITE))
+			{
+				addChange(path, FileAction::Modified);
+			}
+			else if (event->mask & IN_MOVED_FROM)
+			{
+				movedFrom.push_back({ event->cookie, path, isDirectory });
+			}
+			else if (event->mask & IN_MOVED_TO)
+			{
+				const auto from = std::find_if(movedFrom.begin(), movedFrom.end(),
+					[cookie = event->cookie](const MovedFrom& m) { return m.cookie == cookie; });
+
+				if (from != movedFrom.end())
+				{
+					addChange(from->path, FileAction::Removed);
+
+					addChange(path, FileAction::Added);
+
+					if (isDirectory)
+					{
+						renameWatches(from->path + U'/', path + U'/');
+					}
+
+					movedFrom.erase(from);
+				}
+				else
+				{
+					// 監視していないディレクトリからの移動
+					addChange(path, FileAction::Added);
+
+					if (isDirectory)
+					{
+						addWatches(path + U'/', true);
+					}
+				}
+			}
+		}
+
+		// 監視していないディレクトリへの移動
+		for (const auto& from : movedFrom)
+		{
+			addChange(from.path, FileAction::Removed);
+
+			if (from.isDirectory)
+			{
+				removeWatches(from.path + U'/');
+			}
+		}
+	}
+
+	void DirectoryWatcher::DirectoryWatcherDetail::addChange(const FilePath& path, const FileAction action)
+	{
+		const Clock::time_point now = Clock::now();
+
+		const auto it = m_pendingChanges.find(path);
+
+		if (it == m_pendingChanges.end())
+		{
+			m_pendingChanges.emplace(path, PendingChange{ action, m_orderCount++, now });
+
+			return;
+		}
+
+		const Optional<FileAction> coalesced = detail::CoalesceActions(it->second.action, action);
+
+		if (!coalesced)
+		{
+			m_pendingChanges.erase(it);
+
+			return;
+		}
+
+		it.value().action = coalesced.value();
+
+		it.value().lastTime = now;
+	}
+
+	int32 DirectoryWatcher::DirectoryWatcherDetail::flushChanges()
+	{
+		if (m_pendingChanges.empty())
+		{
+			return -1;
+		}
+
+		const Clock::time_point now = Clock::now();
+
+		Clock::duration nextCheck = DebounceTime;
+
+		Array<std::pair<uint64, std::pair<FilePath, FileAction>>> ready;
+
+		for (const auto& change : m_pendingChanges)
+		{
+			const Clock::duration elapsed = (now - change.second.lastTime);
+
+			if (elapsed >= DebounceTime)
+			{
+				ready.emplace_back(change.second.order, std::make_pair(change.first, change.second.action));
+			}
+			else
+			{
+				nextCheck = std::min<Clock::duration>(nextCheck, DebounceTime - elapsed);
+			}
+		}
+
+		if (ready)
+		{
+			std::sort(ready.begin(), ready.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+			std::lock_guard lock(m_changesMutex);
+
+			for (auto& change : ready)
+			{
+				m_pendingChanges.erase(change.second.first);
+
+				m_changes.push_back(std::move(change.second));
+			}
+		}
+
+		if (m_pendingChanges.empty())
+		{
+			return -1;
+		}
+
+		return static_cast<int32>(std::chrono::duration_cast<std::chrono::milliseconds>(nextCheck).count()) + 1;
+	}
 }
 
 # endif
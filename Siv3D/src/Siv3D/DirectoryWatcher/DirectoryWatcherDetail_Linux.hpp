@@ -9,19 +9,89 @@
 //
 //-----------------------------------------------
 
+# pragma once
 # include <Siv3D/Platform.hpp>
 # if defined(SIV3D_TARGET_LINUX)
 
+# include <chrono>
+# include <mutex>
+# include <thread>
 # include <Siv3D/DirectoryWatcher.hpp>
+# include <Siv3D/HashTable.hpp>
+# include <Siv3D/String.hpp>
 
 namespace s3d
 {
+	// inotify と epoll でディレクトリ以下のすべてのディレクトリを監視する
+	// 同じファイルへの連続した変更は、最後の変更から DebounceTime が経過した時点で 1 つにまとめて報告する。
 	class DirectoryWatcher::DirectoryWatcherDetail
 	{
 	private:
 
+		using Clock = std::chrono::steady_clock;
+
+		static constexpr std::chrono::milliseconds DebounceTime{ 50 };
+
+		static constexpr size_t BufferSize = 64 * 1024;
+
+		struct PendingChange
+		{
+			FileAction action;
+
+			// 最初に変更を受け取った順番
+			uint64 order;
+
+			Clock::time_point lastTime;
+		};
+
+		struct MovedFrom
+		{
+			uint32 cookie;
+
+			FilePath path;
+
+			bool isDirectory;
+		};
+
 		FilePath m_directory;
 
+		int32 m_inotify = -1;
+
+		int32 m_epoll = -1;
+
+		// 監視スレッドに終了を伝える eventfd
+		int32 m_wakeup = -1;
+
+		// watch descriptor と、監視しているディレクトリ（末尾は '/'）
+		HashTable<int32, FilePath> m_watches;
+
+		HashTable<FilePath, PendingChange> m_pendingChanges;
+
+		uint64 m_orderCount = 0;
+
+		std::mutex m_changesMutex;
+
+		Array<std::pair<FilePath, FileAction>> m_changes;
+
+		std::thread m_thread;
+
+		bool init();
+
+		void run();
+
+		void addWatches(const FilePath& directory, bool reportContents);
+
+		void removeWatches(const FilePath& directory);
+
+		void renameWatches(const FilePath& from, const FilePath& to);
+
+		void processEvents(const uint8* buffer, size_t size);
+
+		void addChange(const FilePath& path, FileAction action);
+
+		// DebounceTime が経過した変更を m_changes に移し、次に確認するまでの時間 [ms] を返す（-1 の場合は無期限）
+		int32 flushChanges();
+
 	public:
 
 		explicit DirectoryWatcherDetail(const FilePath& directory);
@@ -0,0 +1,60 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Fwd.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/Optional.hpp>
+# include <Siv3D/Texture.hpp>
+# include <Siv3D/Vertex2D.hpp>
+
+namespace s3d
+{
+	struct DrawList2DData
+	{
+		// 1 つのセグメントの頂点とインデックスの数の上限（GLSpriteBatch / D3D11SpriteBatch のバッファの大きさ以下）
+		static constexpr uint32 MaxSegmentVertexSize = 65536;
+
+		static constexpr uint32 MaxSegmentIndexSize = 65536 * 8;
+
+		// 同じテクスチャで描く、連続した頂点とインデックスの範囲
+		// インデックスはセグメントの先頭の頂点からの相対値
+		struct Segment
+		{
+			// none の場合は図形
+			Optional<Texture> texture;
+
+			uint32 vertexSize = 0;
+
+			uint32 indexSize = 0;
+		};
+
+		Array<Vertex2D> vertices;
+
+		Array<uint32> indices;
+
+		Array<Segment> segments;
+
+		int32 layer = 0;
+
+		// vertexSize 個の頂点と indexSize 個のインデックスの領域を確保し、インデックスに足す値を返す
+		uint32 allocate(uint32 vertexSize, uint32 indexSize, const Texture* texture, Vertex2D** pVertex, uint32** pIndex);
+
+		void clear()
+		{
+			vertices.clear();
+
+			indices.clear();
+
+			segments.clear();
+		}
+	};
+}
@@ -0,0 +1,252 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <algorithm>
+# include <numeric>
+# include <Siv3D/DrawList2D.hpp>
+# include <Siv3D/Triangle.hpp>
+# include <Siv3D/Rectangle.hpp>
+# include <Siv3D/Circle.hpp>
+# include <Siv3D/TextureRegion.hpp>
+# include "DrawList2DData.hpp"
+# include "../Siv3DEngine.hpp"
+# include "../Renderer2D/IRenderer2D.hpp"
+# include "../Renderer2D/Vertex2DBuilder.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		static constexpr uint32 rectIndexTable[6] = { 0, 1, 2, 2, 1, 3 };
+	}
+
+	uint32 DrawList2DData::allocate(const uint32 vertexSize, const uint32 indexSize, const Texture* texture, Vertex2D** pVertex, uint32** pIndex)
+	{
+		const bool newSegment = segments.isEmpty()
+			|| (segments.back().texture.has_value() != (texture != nullptr))
+			|| (texture && (segments.back().texture->id() != texture->id()))
+			|| (MaxSegmentVertexSize < (segments.back().vertexSize + vertexSize))
+			|| (MaxSegmentIndexSize < (segments.back().indexSize + indexSize));
+
+		if (newSegment)
+		{
+			Segment segment;
+
+			if (texture)
+			{
+				segment.texture = *texture;
+			}
+
+			segments.push_back(std::move(segment));
+		}
+
+		Segment& segment = segments.back();
+		const uint32 indexOffset = segment.vertexSize;
+
+		vertices.resize(vertices.size() + vertexSize);
+		indices.resize(indices.size() + indexSize);
+
+		*pVertex = vertices.data() + (vertices.size() - vertexSize);
+		*pIndex = indices.data() + (indices.size() - indexSize);
+
+		segment.vertexSize += vertexSize;
+		segment.indexSize += indexSize;
+
+		return indexOffset;
+	}
+
+	DrawList2D::DrawList2D()
+		: pImpl(std::make_shared<DrawList2DData>())
+	{
+
+	}
+
+	DrawList2D::DrawList2D(const int32 layer)
+		: DrawList2D()
+	{
+		pImpl->layer = layer;
+	}
+
+	DrawList2DData& DrawList2D::mutableData()
+	{
+		// レンダラーが描画を待っている内容や、コピー元と共有している内容は書き換えない
+		if (pImpl.use_count() > 1)
+		{
+			pImpl = std::make_shared<DrawList2DData>(*pImpl);
+		}
+
+		return *pImpl;
+	}
+
+	int32 DrawList2D::layer() const
+	{
+		return pImpl->layer;
+	}
+
+	void DrawList2D::setLayer(const int32 layer)
+	{
+		if (pImpl->layer != layer)
+		{
+			mutableData().layer = layer;
+		}
+	}
+
+	void DrawList2D::clear()
+	{
+		if (pImpl.use_count() > 1)
+		{
+			const int32 layer = pImpl->layer;
+
+			pImpl = std::make_shared<DrawList2DData>();
+
+			pImpl->layer = layer;
+		}
+		else
+		{
+			pImpl->clear();
+		}
+	}
+
+	bool DrawList2D::isEmpty() const
+	{
+		return pImpl->indices.isEmpty();
+	}
+
+	size_t DrawList2D::num_vertices() const
+	{
+		return pImpl->vertices.size();
+	}
+
+	size_t DrawList2D::num_triangles() const
+	{
+		return pImpl->indices.size() / 3;
+	}
+
+	void DrawList2D::addTriangle(const Triangle& triangle, const ColorF& color)
+	{
+		Vertex2D* pVertex;
+		uint32* pIndex;
+		const uint32 indexOffset = mutableData().allocate(3, 3, nullptr, &pVertex, &pIndex);
+		const Float4 colorF = color.toFloat4();
+
+		for (uint32 i = 0; i < 3; ++i)
+		{
+			pVertex[i].pos = triangle.p(i);
+			pVertex[i].color = colorF;
+			pIndex[i] = indexOffset + i;
+		}
+	}
+
+	void DrawList2D::addRect(const RectF& rect, const ColorF& color)
+	{
+		Vertex2D* pVertex;
+		uint32* pIndex;
+		const uint32 indexOffset = mutableData().allocate(4, 6, nullptr, &pVertex, &pIndex);
+		const Float4 colorF = color.toFloat4();
+		const float left = static_cast<float>(rect.x);
+		const float top = static_cast<float>(rect.y);
+		const float right = static_cast<float>(rect.x + rect.w);
+		const float bottom = static_cast<float>(rect.y + rect.h);
+
+		pVertex[0].pos.set(left, top);
+		pVertex[1].pos.set(right, top);
+		pVertex[2].pos.set(left, bottom);
+		pVertex[3].pos.set(right, bottom);
+
+		for (uint32 i = 0; i < 4; ++i)
+		{
+			pVertex[i].color = colorF;
+		}
+
+		for (uint32 i = 0; i < 6; ++i)
+		{
+			pIndex[i] = indexOffset + detail::rectIndexTable[i];
+		}
+	}
+
+	void DrawList2D::addCircle(const Circle& circle, const ColorF& color)
+	{
+		const float r = static_cast<float>(circle.r);
+		const IndexType quality = Vertex2DBuilder::CalculateCircleQuality(std::abs(r));
+
+		Vertex2D* pVertex;
+		uint32* pIndex;
+		const uint32 indexOffset = mutableData().allocate(quality + 1, quality * 3, nullptr, &pVertex, &pIndex);
+
+		Vertex2DBuilder::BuildFan(pVertex, pIndex, indexOffset, circle.center, Float2(r, r),
+			Vertex2DBuilder::GetUnitCircle(quality), quality, color.toFloat4(), true);
+	}
+
+	void DrawList2D::addTextureRegion(const TextureRegion& region, const Vec2& pos, const ColorF& color)
+	{
+		Vertex2D* pVertex;
+		uint32* pIndex;
+		const uint32 indexOffset = mutableData().allocate(4, 6, &region.texture, &pVertex, &pIndex);
+		const Float4 colorF = color.toFloat4();
+		const FloatRect& uv = region.uvRect;
+		const float left = static_cast<float>(pos.x);
+		const float top = static_cast<float>(pos.y);
+		const float right = left + region.size.x;
+		const float bottom = top + region.size.y;
+
+		pVertex[0].pos.set(left, top);
+		pVertex[0].tex.set(uv.left, uv.top);
+
+		pVertex[1].pos.set(right, top);
+		pVertex[1].tex.set(uv.right, uv.top);
+
+		pVertex[2].pos.set(left, bottom);
+		pVertex[2].tex.set(uv.left, uv.bottom);
+
+		pVertex[3].pos.set(right, bottom);
+		pVertex[3].tex.set(uv.right, uv.bottom);
+
+		for (uint32 i = 0; i < 4; ++i)
+		{
+			pVertex[i].color = colorF;
+		}
+
+		for (uint32 i = 0; i < 6; ++i)
+		{
+			pIndex[i] = indexOffset + detail::rectIndexTable[i];
+		}
+	}
+
+	void DrawList2D::draw() const
+	{
+		if (isEmpty())
+		{
+			return;
+		}
+
+		Siv3DEngine::GetRenderer2D()->addDrawList(pImpl);
+	}
+
+	namespace Graphics2D
+	{
+		void DrawLists(const Array<DrawList2D>& lists)
+		{
+			Array<size_t> order(lists.size());
+
+			std::iota(order.begin(), order.end(), 0);
+
+			std::stable_sort(order.begin(), order.end(), [&](const size_t a, const size_t b)
+			{
+				return lists[a].layer() < lists[b].layer();
+			});
+
+			for (const auto index : order)
+			{
+				lists[index].draw();
+			}
+		}
+	}
+}
@@ -76,4 +76,19 @@ namespace s3d
 
 		return Siv3DEngine::GetTexture()->fill(m_handle->id(), image.data(), image.stride(), false);
 	}
+
+	bool DynamicTexture::fillRegion(const Image& image, const Rect& rect)
+	{
+		if (isEmpty())
+		{
+			return false;
+		}
+
+		if (image.size() != size())
+		{
+			return false;
+		}
+
+		return Siv3DEngine::GetTexture()->fillRegion(m_handle->id(), image.data(), image.stride(), rect, true);
+	}
 }
@@ -0,0 +1,270 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <mutex>
+# include <atomic>
+# include <Siv3D/XXHash.hpp>
+# include <Siv3D/ByteArrayView.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/Logger.hpp>
+# include "CFileArchive.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		static std::mutex g_mountMutex;
+
+		static Array<FileArchive> g_mountedArchives;
+
+		// マウントが無い場合にロックを取らずに通常のファイル読み込みへ進むためのカウンタ
+		static std::atomic<size_t> g_numMountedArchives{ 0 };
+
+		std::string NormalizeArchivePath(const FilePath& path)
+		{
+			std::string result = path.toUTF8();
+
+			for (auto& ch : result)
+			{
+				if (ch == '\\')
+				{
+					ch = '/';
+				}
+			}
+
+			size_t begin = 0;
+
+			for (;;)
+			{
+				if (result.compare(begin, 2, "./") == 0)
+				{
+					begin += 2;
+				}
+				else if (result.compare(begin, 1, "/") == 0)
+				{
+					begin += 1;
+				}
+				else
+				{
+					break;
+				}
+			}
+
+			result.erase(0, begin);
+
+			return result;
+		}
+
+		uint64 HashArchivePath(const std::string& normalizedPath)
+		{
+			return Hash::XXHash(ByteArrayView(normalizedPath.data(), normalizedPath.size()));
+		}
+	}
+
+	FileArchive::CFileArchive::CFileArchive()
+	{
+
+	}
+
+	FileArchive::CFileArchive::~CFileArchive()
+	{
+
+	}
+
+	bool FileArchive::CFileArchive::open(const FilePath& path)
+	{
+		close();
+
+		MemoryMapping mapping(path);
+
+		if (!mapping || !mapping.data())
+		{
+			LOG_FAIL(U"❌ FileArchive: Failed to open file \"{0}\""_fmt(path));
+
+			return false;
+		}
+
+		const Byte* const data = mapping.data();
+
+		const uint64 fileSize = mapping.mappedSize();
+
+		detail::FileArchiveHeader header;
+
+		if (fileSize < sizeof(header))
+		{
+			LOG_FAIL(U"❌ FileArchive: \"{0}\" is not a valid archive"_fmt(path));
+
+			return false;
+		}
+
+		std::memcpy(&header, data, sizeof(header));
+
+		if (std::memcmp(header.signature, detail::FileArchiveSignature, sizeof(header.signature)) != 0
+			|| header.version != detail::FileArchiveVersion
+			|| header.indexOffset > fileSize
+			|| (fileSize - header.indexOffset) / sizeof(detail::FileArchiveEntry) < header.numEntries
+			|| header.pathsOffset > fileSize
+			|| header.pathsSize > (fileSize - header.pathsOffset))
+		{
+			LOG_FAIL(U"❌ FileArchive: \"{0}\" is not a valid archive"_fmt(path));
+
+			return false;
+		}
+
+		// 索引はアラインメントを保証しないマップ上に置かれているため、コピーしてから使う
+		Array<detail::FileArchiveEntry> entries(header.numEntries);
+
+		std::memcpy(entries.data(), data + header.indexOffset, entries.size_bytes());
+
+		for (const auto& entry : entries)
+		{
+			if (entry.offset > fileSize
+				|| entry.storedSize > (fileSize - entry.offset)
+				|| (static_cast<uint64>(entry.pathOffset) + entry.pathSize) > header.pathsSize)
+			{
+				LOG_FAIL(U"❌ FileArchive: \"{0}\" is not a valid archive"_fmt(path));
+
+				return false;
+			}
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(detail::g_mountMutex);
+
+			m_mapping = mapping;
+
+			m_entries = std::move(entries);
+
+			m_paths = reinterpret_cast<const char*>(data + header.pathsOffset);
+
+			m_fullPath = m_mapping.path();
+		}
+
+		LOG_DEBUG(U"📤 FileArchive: Opened archive \"{0}\" ({1} files)"_fmt(m_fullPath, m_entries.size()));
+
+		return true;
+	}
+
+	void FileArchive::CFileArchive::close()
+	{
+		if (!isOpened())
+		{
+			return;
+		}
+
+		// 他のスレッドが FindMounted() で索引を参照している可能性があるため、
+		// 同じロックの下でマウントを解除してから索引とファイルを解放する
+		std::lock_guard<std::mutex> lock(detail::g_mountMutex);
+
+		detail::g_mountedArchives.remove_if([this](const FileArchive& archive) { return archive.pImpl.get() == this; });
+
+		detail::g_numMountedArchives.store(detail::g_mountedArchives.size(), std::memory_order_release);
+
+		// ArchivedFileReader がマッピングを共有している場合があるため、close() せずに参照だけを外す
+		m_mapping = MemoryMapping();
+
+		m_entries.clear();
+
+		m_paths = nullptr;
+
+		LOG_DEBUG(U"📥 FileArchive: Closed archive \"{0}\""_fmt(m_fullPath));
+
+		m_fullPath.clear();
+	}
+
+	Array<FilePath> FileArchive::CFileArchive::files() const
+	{
+		Array<FilePath> results;
+
+		results.reserve(m_entries.size());
+
+		for (const auto& entry : m_entries)
+		{
+			results.push_back(Unicode::FromUTF8(std::string_view(m_paths + entry.pathOffset, entry.pathSize)));
+		}
+
+		return results;
+	}
+
+	const detail::FileArchiveEntry* FileArchive::CFileArchive::find(const std::string& normalizedPath, const uint64 pathHash) const
+	{
+		auto it = std::lower_bound(m_entries.begin(), m_entries.end(), pathHash,
+			[](const detail::FileArchiveEntry& entry, const uint64 hash) { return entry.pathHash < hash; });
+
+		// ハッシュが衝突している場合に備えてパスも比較する
+		for (; (it != m_entries.end()) && (it->pathHash == pathHash); ++it)
+		{
+			if ((it->pathSize == normalizedPath.size())
+				&& (std::memcmp(m_paths + it->pathOffset, normalizedPath.data(), it->pathSize) == 0))
+			{
+				return &*it;
+			}
+		}
+
+		return nullptr;
+	}
+
+	bool FileArchive::CFileArchive::FindMounted(const std::string& normalizedPath, const uint64 pathHash, detail::FileArchiveEntry& entry, MemoryMapping& mapping, FilePath& archivePath)
+	{
+		if (detail::g_numMountedArchives.load(std::memory_order_acquire) == 0)
+		{
+			return false;
+		}
+
+		std::lock_guard<std::mutex> lock(detail::g_mountMutex);
+
+		// 後からマウントしたアーカイブを優先する
+		for (auto it = detail::g_mountedArchives.rbegin(); it != detail::g_mountedArchives.rend(); ++it)
+		{
+			if (const auto found = it->pImpl->find(normalizedPath, pathHash))
+			{
+				entry = *found;
+
+				mapping = it->pImpl->m_mapping;
+
+				archivePath = it->pImpl->m_fullPath;
+
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool FileArchive::CFileArchive::Mount(const FileArchive& archive)
+	{
+		std::lock_guard<std::mutex> lock(detail::g_mountMutex);
+
+		detail::g_mountedArchives.push_back(archive);
+
+		detail::g_numMountedArchives.store(detail::g_mountedArchives.size(), std::memory_order_release);
+
+		return true;
+	}
+
+	void FileArchive::CFileArchive::Unmount(const FilePath& fullPath)
+	{
+		std::lock_guard<std::mutex> lock(detail::g_mountMutex);
+
+		detail::g_mountedArchives.remove_if([&](const FileArchive& archive) { return archive.path() == fullPath; });
+
+		detail::g_numMountedArchives.store(detail::g_mountedArchives.size(), std::memory_order_release);
+	}
+
+	void FileArchive::CFileArchive::UnmountAll()
+	{
+		std::lock_guard<std::mutex> lock(detail::g_mountMutex);
+
+		detail::g_mountedArchives.clear();
+
+		detail::g_numMountedArchives.store(0, std::memory_order_release);
+	}
+}
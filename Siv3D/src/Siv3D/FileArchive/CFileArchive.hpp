@@ -0,0 +1,136 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/FileArchive.hpp>
+# include <Siv3D/MemoryMapping.hpp>
+# include <Siv3D/Array.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		//	アーカイブファイルのレイアウト（リトルエンディアン）:
+		//
+		//	FileArchiveHeader
+		//	ファイルデータ（各ファイルの先頭は FileArchiveDataAlignment バイト境界）
+		//	FileArchiveEntry × numEntries（pathHash, パスの順にソート済み）
+		//	パス文字列（UTF-8, '/' 区切り, 終端文字なし）
+
+		constexpr char FileArchiveSignature[8] = { 'S', '3', 'D', 'A', 'R', 'C', 'H', '\0' };
+
+		constexpr uint32 FileArchiveVersion = 1;
+
+		constexpr size_t FileArchiveDataAlignment = 16;
+
+		struct FileArchiveHeader
+		{
+			char signature[8];
+
+			uint32 version;
+
+			uint32 numEntries;
+
+			uint64 indexOffset;
+
+			uint64 pathsOffset;
+
+			uint64 pathsSize;
+		};
+
+		static_assert(sizeof(FileArchiveHeader) == 40);
+
+		// FileArchiveEntry::flags: Zstandard で圧縮されている
+		constexpr uint32 FileArchiveEntryFlag_Compressed = 1;
+
+		struct FileArchiveEntry
+		{
+			uint64 pathHash;
+
+			uint64 offset;
+
+			uint64 storedSize;
+
+			uint64 originalSize;
+
+			uint32 pathOffset;
+
+			uint32 pathSize;
+
+			uint32 flags;
+
+			uint32 reserved;
+		};
+
+		static_assert(sizeof(FileArchiveEntry) == 48);
+
+		// アーカイブ内のパスを正規化した UTF-8 文字列を返す（'\\' → '/', 先頭の "./" と "/" を除去）
+		[[nodiscard]] std::string NormalizeArchivePath(const FilePath& path);
+
+		[[nodiscard]] uint64 HashArchivePath(const std::string& normalizedPath);
+	}
+
+	class FileArchive::CFileArchive
+	{
+	private:
+
+		MemoryMapping m_mapping;
+
+		Array<detail::FileArchiveEntry> m_entries;
+
+		const char* m_paths = nullptr;
+
+		FilePath m_fullPath;
+
+	public:
+
+		CFileArchive();
+
+		~CFileArchive();
+
+		bool open(const FilePath& path);
+
+		void close();
+
+		bool isOpened() const noexcept
+		{
+			return !!m_mapping;
+		}
+
+		size_t num_files() const noexcept
+		{
+			return m_entries.size();
+		}
+
+		Array<FilePath> files() const;
+
+		const detail::FileArchiveEntry* find(const std::string& normalizedPath, uint64 pathHash) const;
+
+		const MemoryMapping& getMapping() const noexcept
+		{
+			return m_mapping;
+		}
+
+		const FilePath& path() const noexcept
+		{
+			return m_fullPath;
+		}
+
+		static bool Mount(const FileArchive& archive);
+
+		static void Unmount(const FilePath& fullPath);
+
+		static void UnmountAll();
+
+		// マウントされているアーカイブからファイルを探し、索引とマッピングをロックの下でコピーして返す
+		static bool FindMounted(const std::string& normalizedPath, uint64 pathHash, detail::FileArchiveEntry& entry, MemoryMapping& mapping, FilePath& archivePath);
+	};
+}
@@ -0,0 +1,294 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/FileArchive.hpp>
+# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/BinaryWriter.hpp>
+# include <Siv3D/Compressor.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/Logger.hpp>
+# include "CFileArchive.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// 既に圧縮されていて、Zstandard でほとんど小さくならない形式
+		static bool IsPrecompressedFormat(const FilePath& path)
+		{
+			static const Array<String> extensions = {
+				U"png", U"jpg", U"jpeg", U"gif", U"webp",
+				U"mp3", U"ogg", U"opus", U"aac", U"m4a", U"mp4",
+				U"zip", U"gz", U"zst", U"s3da" };
+
+			return extensions.includes(FileSystem::Extension(path));
+		}
+
+		static bool WritePadding(BinaryWriter& writer, const size_t alignment)
+		{
+			static constexpr Byte zeros[16] = {};
+
+			const size_t padding = (alignment - static_cast<size_t>(writer.getPos()) % alignment) % alignment;
+
+			return writer.write(zeros, padding) == static_cast<int64>(padding);
+		}
+
+		struct FileArchiveSource
+		{
+			std::string path;
+
+			uint64 pathHash;
+
+			FilePath sourcePath;
+		};
+	}
+
+	FileArchive::FileArchive()
+		: pImpl(std::make_shared<CFileArchive>())
+	{
+
+	}
+
+	bool FileArchive::open(const FilePath& path)
+	{
+		return pImpl->open(path);
+	}
+
+	void FileArchive::close()
+	{
+		pImpl->close();
+	}
+
+	bool FileArchive::isOpened() const
+	{
+		return pImpl->isOpened();
+	}
+
+	size_t FileArchive::num_files() const
+	{
+		return pImpl->num_files();
+	}
+
+	Array<FilePath> FileArchive::files() const
+	{
+		return pImpl->files();
+	}
+
+	bool FileArchive::contains(const FilePath& path) const
+	{
+		const std::string normalizedPath = detail::NormalizeArchivePath(path);
+
+		return pImpl->find(normalizedPath, detail::HashArchivePath(normalizedPath)) != nullptr;
+	}
+
+	int64 FileArchive::fileSize(const FilePath& path) const
+	{
+		const std::string normalizedPath = detail::NormalizeArchivePath(path);
+
+		if (const auto entry = pImpl->find(normalizedPath, detail::HashArchivePath(normalizedPath)))
+		{
+			return static_cast<int64>(entry->originalSize);
+		}
+
+		return 0;
+	}
+
+	const FilePath& FileArchive::path() const
+	{
+		return pImpl->path();
+	}
+
+	bool FileArchive::Build(const FilePath& archivePath, const FilePath& directory, const int32 compressionLevel)
+	{
+		if (!FileSystem::IsDirectory(directory))
+		{
+			LOG_FAIL(U"❌ FileArchive::Build(): \"{0}\" is not a directory"_fmt(directory));
+
+			return false;
+		}
+
+		const FilePath archiveFullPath = FileSystem::FullPath(archivePath);
+
+		const Array<FilePath> files = FileSystem::DirectoryContents(directory, true)
+			.filter([&](const FilePath& path) { return FileSystem::IsFile(path) && (path != archiveFullPath); });
+
+		return Build(archivePath, files, directory, compressionLevel);
+	}
+
+	bool FileArchive::Build(const FilePath& archivePath, const Array<FilePath>& files, const FilePath& baseDirectory, const int32 compressionLevel)
+	{
+		FilePath base = FileSystem::FullPath(baseDirectory);
+
+		if (!base.isEmpty() && !base.ends_with(U'/'))
+		{
+			base.push_back(U'/');
+		}
+
+		Array<detail::FileArchiveSource> sources;
+
+		sources.reserve(files.size());
+
+		for (const auto& file : files)
+		{
+			const FilePath fullPath = FileSystem::FullPath(file);
+
+			if (!fullPath.starts_with(base))
+			{
+				LOG_FAIL(U"❌ FileArchive::Build(): \"{0}\" is not in \"{1}\""_fmt(file, base));
+
+				return false;
+			}
+
+			const std::string path = detail::NormalizeArchivePath(fullPath.substr(base.size()));
+
+			sources.push_back({ path, detail::HashArchivePath(path), fullPath });
+		}
+
+		std::sort(sources.begin(), sources.end(), [](const detail::FileArchiveSource& a, const detail::FileArchiveSource& b)
+		{
+			return (a.pathHash != b.pathHash) ? (a.pathHash < b.pathHash) : (a.path < b.path);
+		});
+
+		for (size_t i = 1; i < sources.size(); ++i)
+		{
+			if (sources[i - 1].path == sources[i].path)
+			{
+				LOG_FAIL(U"❌ FileArchive::Build(): Duplicate path \"{0}\""_fmt(Unicode::FromUTF8(sources[i].path)));
+
+				return false;
+			}
+		}
+
+		BinaryWriter writer(archivePath);
+
+		if (!writer)
+		{
+			return false;
+		}
+
+		detail::FileArchiveHeader header = {};
+
+		writer.write(&header, sizeof(header));
+
+		Compressor compressor(Max(compressionLevel, 1));
+
+		Array<detail::FileArchiveEntry> entries;
+
+		entries.reserve(sources.size());
+
+		std::string paths;
+
+		Array<Byte> data, compressed;
+
+		for (const auto& source : sources)
+		{
+			BinaryReader reader(source.sourcePath);
+
+			if (!reader)
+			{
+				writer.clear();
+
+				return false;
+			}
+
+			data.resize(static_cast<size_t>(reader.size()));
+
+			if (reader.read(data.data(), data.size()) != static_cast<int64>(data.size()))
+			{
+				writer.clear();
+
+				return false;
+			}
+
+			detail::FileArchiveEntry entry = {};
+			entry.pathHash		= source.pathHash;
+			entry.originalSize	= data.size();
+			entry.pathOffset	= static_cast<uint32>(paths.size());
+			entry.pathSize		= static_cast<uint32>(source.path.size());
+
+			paths += source.path;
+
+			// 圧縮によって 1/16 以上小さくなる場合のみ圧縮して格納する
+			const bool useCompressed = (compressionLevel > 0)
+				&& !detail::IsPrecompressedFormat(source.sourcePath)
+				&& compressor.compress(ByteArrayView(data.data(), data.size()), compressed)
+				&& (compressed.size() <= (data.size() - data.size() / 16));
+
+			const Array<Byte>& stored = useCompressed ? compressed : data;
+
+			if (!detail::WritePadding(writer, detail::FileArchiveDataAlignment))
+			{
+				writer.clear();
+
+				return false;
+			}
+
+			entry.offset		= static_cast<uint64>(writer.getPos());
+			entry.storedSize	= stored.size();
+			entry.flags			= useCompressed ? detail::FileArchiveEntryFlag_Compressed : 0;
+
+			if (writer.write(stored.data(), stored.size()) != static_cast<int64>(stored.size()))
+			{
+				writer.clear();
+
+				return false;
+			}
+
+			entries.push_back(entry);
+		}
+
+		detail::WritePadding(writer, alignof(detail::FileArchiveEntry));
+
+		std::memcpy(header.signature, detail::FileArchiveSignature, sizeof(header.signature));
+		header.version		= detail::FileArchiveVersion;
+		header.numEntries	= static_cast<uint32>(entries.size());
+		header.indexOffset	= static_cast<uint64>(writer.getPos());
+		header.pathsOffset	= header.indexOffset + entries.size_bytes();
+		header.pathsSize	= paths.size();
+
+		if ((writer.write(entries.data(), entries.size_bytes()) != static_cast<int64>(entries.size_bytes()))
+			|| (writer.write(paths.data(), paths.size()) != static_cast<int64>(paths.size())))
+		{
+			writer.clear();
+
+			return false;
+		}
+
+		writer.setPos(0);
+
+		writer.write(&header, sizeof(header));
+
+		LOG_INFO(U"ℹ️ FileArchive: Created archive \"{0}\" ({1} files)"_fmt(FileSystem::FullPath(archivePath), entries.size()));
+
+		return true;
+	}
+
+	bool FileArchive::Mount(const FileArchive& archive)
+	{
+		if (!archive)
+		{
+			return false;
+		}
+
+		return CFileArchive::Mount(archive);
+	}
+
+	void FileArchive::Unmount(const FilePath& archivePath)
+	{
+		CFileArchive::Unmount(FileSystem::FullPath(archivePath));
+	}
+
+	void FileArchive::UnmountAll()
+	{
+		CFileArchive::UnmountAll();
+	}
+}
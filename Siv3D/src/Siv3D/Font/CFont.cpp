@@ -113,23 +113,23 @@ namespace s3d
 		return true;
 	}
 
-	FontID CFont::create(const Typeface typeface, const int32 fontSize, const FontStyle style)
+	FontID CFont::create(const Typeface typeface, const int32 fontSize, const FontStyle style, const FontMethod method)
 	{
-		return create(detail::GetEngineFontPath(typeface), fontSize, style);
+		return create(detail::GetEngineFontPath(typeface), fontSize, style, method);
 	}
 
-	FontID CFont::create(const FilePath& path, const int32 fontSize, const FontStyle style)
+	FontID CFont::create(const FilePath& path, const int32 fontSize, const FontStyle style, const FontMethod method)
 	{
 		const FilePath emojiPath = detail::GetEngineFontDirectory() + U"noto/NotoEmoji-Regular.ttf";
 
-		const auto font = std::make_shared<FontData>(m_library, path, emojiPath, fontSize, style);
+		const auto font = std::make_shared<FontData>(m_library, path, emojiPath, fontSize, style, method);
 
 		if (!font->isInitialized())
 		{
 			return FontID::NullAsset();
 		}
 
-		return m_fonts.add(font, U"(`{0} {1}` size: {2})"_fmt(font->getFamilyName(), font->getStyleName(),fontSize));
+		return m_fonts.add(font, U"(`{0} {1}` size: {2}{3})"_fmt(font->getFamilyName(), font->getStyleName(), fontSize, (method == FontMethod::SDF) ? U" SDF" : U""));
 	}
 
 	void CFont::release(const FontID handleID)
@@ -152,6 +152,11 @@ namespace s3d
 		return m_fonts[handleID]->getFontSize();
 	}
 
+	FontMethod CFont::getMethod(const FontID handleID)
+	{
+		return m_fonts[handleID]->getMethod();
+	}
+
 	int32 CFont::getAscent(const FontID handleID)
 	{
 		return m_fonts[handleID]->getAscent();
@@ -194,7 +199,19 @@ namespace s3d
 
 	RectF CFont::draw(const FontID handleID, const String& codePoints, const Vec2& pos, const ColorF& color, const double lineSpacingScale)
 	{
-		return m_fonts[handleID]->draw(codePoints, pos, color, lineSpacingScale);
+		return m_fonts[handleID]->draw(codePoints, pos, color, lineSpacingScale, 1.0);
+	}
+
+	RectF CFont::draw(const FontID handleID, const String& codePoints, const double fontSize, const Vec2& pos, const ColorF& color, const double lineSpacingScale)
+	{
+		const auto& font = m_fonts[handleID];
+
+		if (font->getFontSize() == 0)
+		{
+			return RectF(pos, 0);
+		}
+
+		return font->draw(codePoints, pos, color, lineSpacingScale, fontSize / font->getFontSize());
 	}
 
 	bool CFont::draw(const FontID handleID, const String& codePoints, const RectF& area, const ColorF& color, const double lineSpacingScale)
@@ -212,6 +229,31 @@ namespace s3d
 		return m_fonts[handleID]->paint(dst, true, codePoints, pos, color, lineSpacingScale);
 	}
 
+	void CFont::setLayoutCacheBudget(const FontID handleID, const size_t bytes)
+	{
+		m_fonts[handleID]->setLayoutCacheBudget(bytes);
+	}
+
+	size_t CFont::getLayoutCacheBytes(const FontID handleID)
+	{
+		return m_fonts[handleID]->getLayoutCacheBytes();
+	}
+
+	void CFont::clearLayoutCache(const FontID handleID)
+	{
+		m_fonts[handleID]->clearLayoutCache();
+	}
+
+	bool CFont::saveSDFAtlas(const FontID handleID, const FilePath& path, const String& codePoints)
+	{
+		return m_fonts[handleID]->saveSDFAtlas(path, codePoints);
+	}
+
+	bool CFont::loadSDFAtlas(const FontID handleID, const FilePath& path)
+	{
+		return m_fonts[handleID]->loadSDFAtlas(path);
+	}
+
 	Image CFont::getColorEmoji(const StringView emoji)
 	{
 		if (!m_colorEmoji)
@@ -46,9 +46,9 @@ namespace s3d
 
 		bool init() override;
 
-		FontID create(Typeface typeface, int32 fontSize, FontStyle style) override;
+		FontID create(Typeface typeface, int32 fontSize, FontStyle style, FontMethod method) override;
 
-		FontID create(const FilePath& path, int32 fontSize, FontStyle style) override;
+		FontID create(const FilePath& path, int32 fontSize, FontStyle style, FontMethod method) override;
 
 		void release(FontID handleID) override;
 
@@ -58,6 +58,8 @@ namespace s3d
 
 		int32 getFontSize(FontID handleID) override;
 
+		FontMethod getMethod(FontID handleID) override;
+
 		int32 getAscent(FontID handleID) override;
 
 		int32 getDescent(FontID handleID) override;
@@ -76,12 +78,24 @@ namespace s3d
 
 		RectF draw(FontID handleID, const String& codePoints, const Vec2& pos, const ColorF& color, double lineSpacingScale) override;
 
+		RectF draw(FontID handleID, const String& codePoints, double fontSize, const Vec2& pos, const ColorF& color, double lineSpacingScale) override;
+
 		bool draw(FontID handleID, const String& codePoints, const RectF& area, const ColorF& color, double lineSpacingScale) override;
 
 		Rect paint(FontID handleID, Image& dst, const String& codePoints, const Point& pos, const Color& color, double lineSpacingScale) override;
 
 		Rect overwrite(FontID handleID, Image& dst, const String& codePoints, const Point& pos, const Color& color, double lineSpacingScale) override;
 
+		void setLayoutCacheBudget(FontID handleID, size_t bytes) override;
+
+		size_t getLayoutCacheBytes(FontID handleID) override;
+
+		void clearLayoutCache(FontID handleID) override;
+
+		bool saveSDFAtlas(FontID handleID, const FilePath& path, const String& codePoints) override;
+
+		bool loadSDFAtlas(FontID handleID, const FilePath& path) override;
+
 		Image getColorEmoji(StringView emoji) override;
 
 		Image getColorEmojiSilhouette(StringView emoji) override;
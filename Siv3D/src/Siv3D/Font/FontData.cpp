@@ -17,7 +17,12 @@
 # include <Siv3D/TextureRegion.hpp>
 # include <Siv3D/FileSystem.hpp>
 # include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/BinaryWriter.hpp>
+# include <Siv3D/ArchivedFileReader.hpp>
 # include <Siv3D/Logger.hpp>
+# include <Siv3D/System.hpp>
+# include <Siv3D/XXHash.hpp>
+# include <Siv3D/ByteArrayView.hpp>
 
 namespace s3d
 {
@@ -84,6 +89,196 @@ namespace s3d
 		{
 			return uint16(((uint16)p[0] << 8) + (uint16)p[1]);
 		}
+
+		// SDF グリフのアウトライン（26.6 固定小数点）を線分に分割したもの
+		struct SDFOutlineData
+		{
+			Array<Line> edges;
+
+			Vec2 currentPos = Vec2(0, 0);
+		};
+
+		// 制御点を結んだ長さ（26.6 固定小数点）から曲線の分割数を決める
+		static int32 CurveSegments(const double length)
+		{
+			return Clamp(static_cast<int32>(std::ceil(length / (64.0 * 2.0))), 2, 16);
+		}
+
+		static int32 SDFMoveTo(const FT_Vector* to, void* user)
+		{
+			SDFOutlineData* data = static_cast<SDFOutlineData*>(user);
+
+			data->currentPos.set(to->x, to->y);
+
+			return 0;
+		}
+
+		static int32 SDFLineTo(const FT_Vector* to, void* user)
+		{
+			SDFOutlineData* data = static_cast<SDFOutlineData*>(user);
+
+			const Vec2 p(to->x, to->y);
+
+			data->edges.emplace_back(data->currentPos, p);
+
+			data->currentPos = p;
+
+			return 0;
+		}
+
+		static int32 SDFConicTo(const FT_Vector* c, const FT_Vector* to, void* user)
+		{
+			SDFOutlineData* data = static_cast<SDFOutlineData*>(user);
+
+			const Vec2 p0 = data->currentPos, p1(c->x, c->y), p2(to->x, to->y);
+			const int32 segments = CurveSegments(p0.distanceFrom(p1) + p1.distanceFrom(p2));
+			Vec2 previous = p0;
+
+			for (int32 i = 1; i <= segments; ++i)
+			{
+				const double t = static_cast<double>(i) / segments;
+				const double s = 1.0 - t;
+				const Vec2 p = (s * s) * p0 + (2.0 * s * t) * p1 + (t * t) * p2;
+
+				data->edges.emplace_back(previous, p);
+
+				previous = p;
+			}
+
+			data->currentPos = p2;
+
+			return 0;
+		}
+
+		static int32 SDFCubicTo(const FT_Vector* c1, const FT_Vector* c2, const FT_Vector* to, void* user)
+		{
+			SDFOutlineData* data = static_cast<SDFOutlineData*>(user);
+
+			const Vec2 p0 = data->currentPos, p1(c1->x, c1->y), p2(c2->x, c2->y), p3(to->x, to->y);
+			const int32 segments = CurveSegments(p0.distanceFrom(p1) + p1.distanceFrom(p2) + p2.distanceFrom(p3));
+			Vec2 previous = p0;
+
+			for (int32 i = 1; i <= segments; ++i)
+			{
+				const double t = static_cast<double>(i) / segments;
+				const double s = 1.0 - t;
+				const Vec2 p = (s * s * s) * p0 + (3.0 * s * s * t) * p1 + (3.0 * s * t * t) * p2 + (t * t * t) * p3;
+
+				data->edges.emplace_back(previous, p);
+
+				previous = p;
+			}
+
+			data->currentPos = p3;
+
+			return 0;
+		}
+
+		// 各ピクセルの中心から輪郭までの符号付き距離を求め、輪郭を 0.5, 内側に spread 離れた位置を 1.0 として格納する
+		static void GenerateDistanceField(const Array<Line>& edges, const Size& size, const int32 spread, Array<uint8>& distances)
+		{
+			distances.resize(size.x * size.y);
+
+			const double scale = 1.0 / (2.0 * spread);
+			uint8* pDst = distances.data();
+
+			for (int32 y = 0; y < size.y; ++y)
+			{
+				const double py = y + 0.5;
+
+				for (int32 x = 0; x < size.x; ++x)
+				{
+					const double px = x + 0.5;
+					double minDistanceSq = DBL_MAX;
+					int32 winding = 0;
+
+					for (const auto& edge : edges)
+					{
+						const Vec2 ab = edge.end - edge.begin;
+						const Vec2 ap(px - edge.begin.x, py - edge.begin.y);
+						const double lengthSq = ab.lengthSq();
+						const double t = (lengthSq > 0.0) ? Clamp(ap.dot(ab) / lengthSq, 0.0, 1.0) : 0.0;
+
+						minDistanceSq = std::min(minDistanceSq, (ap - ab * t).lengthSq());
+
+						// 非ゼロ回転数規則で内外を判定する
+						const double cross = ab.x * ap.y - ap.x * ab.y;
+
+						if (edge.begin.y <= py)
+						{
+							if (edge.end.y > py && cross > 0.0)
+							{
+								++winding;
+							}
+						}
+						else if (edge.end.y <= py && cross < 0.0)
+						{
+							--winding;
+						}
+					}
+
+					const double distance = (winding != 0) ? std::sqrt(minDistanceSq) : -std::sqrt(minDistanceSq);
+
+					*pDst++ = static_cast<uint8>(Clamp(0.5 + distance * scale, 0.0, 1.0) * 255.0 + 0.5);
+				}
+			}
+		}
+
+		//	SDF グリフアトラスのファイルのレイアウト（リトルエンディアン）:
+		//
+		//	SDFAtlasHeader
+		//	ファミリー名, スタイル名（UTF-8, 終端文字なし）
+		//	SDFAtlasGlyph × numGlyphs
+		//	各グリフの距離場（width × height バイト, SDFAtlasGlyph の順）
+
+		constexpr char SDFAtlasSignature[8] = { 'S', '3', 'D', 'S', 'D', 'F', 'A', '\0' };
+
+		constexpr uint32 SDFAtlasVersion = 1;
+
+		struct SDFAtlasHeader
+		{
+			char signature[8];
+
+			uint32 version;
+
+			int32 fontSize;
+
+			int32 spread;
+
+			// bit 0: Bold, bit 1: Italic
+			uint32 style;
+
+			uint32 numGlyphs;
+
+			uint32 familyNameSize;
+
+			uint32 styleNameSize;
+
+			uint32 reserved;
+		};
+
+		static_assert(sizeof(SDFAtlasHeader) == 40);
+
+		struct SDFAtlasGlyph
+		{
+			uint32 codePoint;
+
+			int32 width;
+
+			int32 height;
+
+			int32 offsetX;
+
+			int32 offsetY;
+
+			int32 bearingY;
+
+			int32 xAdvance;
+
+			int32 yAdvance;
+		};
+
+		static_assert(sizeof(SDFAtlasGlyph) == 32);
 	}
 
 	FontData::FontData(Null, FT_Library)
@@ -91,16 +286,34 @@ namespace s3d
 		m_initialized = true;
 	}
 
-	FontData::FontData(const FT_Library library, const FilePath& filePath, const FilePath& emojiFilePath, const int32 fontSize, const FontStyle style)
+	FontData::FontData(const FT_Library library, const FilePath& filePath, const FilePath& emojiFilePath, const int32 fontSize, const FontStyle style, const FontMethod method)
 	{
 		if (!InRange(fontSize, 1, 256))
 		{
 			return;
 		}
 
+		// マウントされているアーカイブ内のフォントはメモリ上から開く
+		if (m_archived.open(filePath))
+		{
+			if (const FT_Error error = ::FT_New_Memory_Face(library, reinterpret_cast<const FT_Byte*>(m_archived.view().data()), static_cast<FT_Long>(m_archived.size()), 0, &m_faceText.face))
+			{
+				if (error == FT_Err_Unknown_File_Format)
+				{
+					LOG_FAIL(U"❌ Font: `{0}` in the mounted archive is not a supported font format"_fmt(filePath));
+				}
+				else
+				{
+					LOG_FAIL(U"❌ Font: Failed to load `{0}` from the mounted archive (FT_Error: {1})"_fmt(filePath, error));
+				}
+
+				return;
+			}
+		}
+
 	# if defined(SIV3D_TARGET_WINDOWS)
 
-		if (FileSystem::IsResource(filePath))
+		else if (FileSystem::IsResource(filePath))
 		{
 			m_resource = FontResourceHolder(filePath);
 
@@ -124,11 +337,11 @@ namespace s3d
 			{
 				if (error == FT_Err_Unknown_File_Format)
 				{
-					// unsupported format
+					LOG_FAIL(U"❌ Font: `{0}` is not a supported font format"_fmt(filePath));
 				}
 				else if (error)
 				{
-					// failed to open or load
+					LOG_FAIL(U"❌ Font: Failed to load `{0}` (FT_Error: {1})"_fmt(filePath, error));
 				}
 
 				return;
@@ -137,15 +350,15 @@ namespace s3d
 
 	# else
 
-		if (const FT_Error error = ::FT_New_Face(library, filePath.narrow().c_str(), 0, &m_faceText.face))
+		else if (const FT_Error error = ::FT_New_Face(library, filePath.narrow().c_str(), 0, &m_faceText.face))
 		{
 			if (error == FT_Err_Unknown_File_Format)
 			{
-				// unsupported format
+				LOG_FAIL(U"❌ Font: `{0}` is not a supported font format"_fmt(filePath));
 			}
 			else if (error)
 			{
-				// failed to open or load
+				LOG_FAIL(U"❌ Font: Failed to load `{0}` (FT_Error: {1})"_fmt(filePath, error));
 			}
 
 			return;
@@ -200,6 +413,20 @@ namespace s3d
 			m_tabWidth = static_cast<int32>(m_faceText.face->glyph->metrics.horiAdvance * 4 / 64);
 		}	
 
+		m_method		= method;
+
+		if (m_method == FontMethod::SDF)
+		{
+			m_sdfSpread = std::max(MinSDFSpread, fontSize / 8);
+		}
+
+		const int32 cellSize = m_fontSize + m_sdfSpread * 2;
+		const int32 atlasPageSize =
+			cellSize <= 16 ? 512 :
+			cellSize <= 32 ? 1024 : 2048;
+
+		m_atlas.init(atlasPageSize, MaxAtlasPages, (m_method == FontMethod::SDF) ? TextureDesc::SDF : TextureDesc::Unmipped);
+
 		m_initialized	= true;
 	}
 
@@ -239,8 +466,8 @@ namespace s3d
 			else
 			{
 				const char32VH indexVH = codePoint | Horizontal;
-				const auto& glyphInfo	= m_glyphs[m_glyphVHIndexTable[indexVH]];
-				glyph.texture			= m_texture(glyphInfo.bitmapRect);
+				const auto& glyphInfo	= getGlyphInfo(indexVH);
+				glyph.texture			= getGlyphTexture(glyphInfo);
 				glyph.offset			= glyphInfo.offset;
 				glyph.bearingY			= glyphInfo.bearingY;
 				glyph.xAdvance			= glyphInfo.xAdvance;
@@ -286,8 +513,8 @@ namespace s3d
 			else
 			{
 				const char32VH indexVH = codePoint | Vertical;
-				const auto& glyphInfo = m_glyphs[m_glyphVHIndexTable[indexVH]];
-				glyph.texture = m_texture(glyphInfo.bitmapRect);
+				const auto& glyphInfo = getGlyphInfo(indexVH);
+				glyph.texture = getGlyphTexture(glyphInfo);
 				glyph.offset = glyphInfo.offset;
 				glyph.bearingY = glyphInfo.bearingY;
 				glyph.xAdvance = glyphInfo.xAdvance;
@@ -352,6 +579,11 @@ namespace s3d
 
 	RectF FontData::getBoundingRect(const String& codePoints, const double lineSpacingScale)
 	{
+		if (const TextLayout* layout = getLayout(codePoints, lineSpacingScale))
+		{
+			return layout->boundingRect;
+		}
+
 		if (!render(codePoints))
 		{
 			return RectF(0);
@@ -379,7 +611,7 @@ namespace s3d
 			else if (!IsControl(codePoint))
 			{
 				const char32VH indexVH = codePoint | Horizontal;
-				const auto& glyphInfo = m_glyphs[m_glyphVHIndexTable[indexVH]];
+				const auto& glyphInfo = getGlyphInfo(indexVH);
 				const RectF region(penPos + glyphInfo.offset, glyphInfo.bitmapRect.size);
 				const int32 characterWidth = glyphInfo.bitmapRect.size.isZero() ? glyphInfo.xAdvance : glyphInfo.bitmapRect.size.x;
 				minPos.x = std::min(minPos.x, region.x);
@@ -400,6 +632,11 @@ namespace s3d
 
 	RectF FontData::getRegion(const String& codePoints, const double lineSpacingScale)
 	{
+		if (const TextLayout* layout = getLayout(codePoints, lineSpacingScale))
+		{
+			return layout->region;
+		}
+
 		if (!render(codePoints))
 		{
 			return RectF(0);
@@ -434,7 +671,7 @@ namespace s3d
 				}
 
 				const char32VH indexVH = codePoint | Horizontal;
-				const auto& glyphInfo = m_glyphs[m_glyphVHIndexTable[indexVH]];
+				const auto& glyphInfo = getGlyphInfo(indexVH);
 				const RectF region(penPos + glyphInfo.offset, glyphInfo.bitmapRect.size);
 				const int32 characterWidth = glyphInfo.xAdvance;
 				minPos.x = std::min(minPos.x, region.x);
@@ -455,6 +692,11 @@ namespace s3d
 
 	Array<int32> FontData::getXAdvances(const String& codePoints)
 	{
+		if (const TextLayout* layout = getLayout(codePoints, 1.0))
+		{
+			return layout->xAdvances;
+		}
+
 		if (!render(codePoints))
 		{
 			return Array<int32>();
@@ -475,7 +717,7 @@ namespace s3d
 			else
 			{
 				const char32VH indexVH = codePoint | Horizontal;
-				const auto& glyphInfo = m_glyphs[m_glyphVHIndexTable[indexVH]];
+				const auto& glyphInfo = getGlyphInfo(indexVH);
 				xAdvabces.push_back(glyphInfo.xAdvance);
 			}
 		}
@@ -483,8 +725,18 @@ namespace s3d
 		return xAdvabces;
 	}
 
-	RectF FontData::draw(const String& codePoints, const Vec2& pos, const ColorF& color, double lineSpacingScale)
+	RectF FontData::draw(const String& codePoints, const Vec2& pos, const ColorF& color, double lineSpacingScale, const double scale)
 	{
+		if (const TextLayout* layout = getLayout(codePoints, lineSpacingScale))
+		{
+			for (const auto& quad : layout->quads)
+			{
+				m_atlas.texture(quad.page)(quad.bitmapRect).scaled(scale).draw(pos + quad.pos * scale, color);
+			}
+
+			return RectF(pos + layout->drawRegion.pos * scale, layout->drawRegion.size * scale);
+		}
+
 		if (!render(codePoints))
 		{
 			return RectF(pos, 0);
@@ -499,14 +751,14 @@ namespace s3d
 			if (codePoint == U'\n')
 			{
 				penPos.x = pos.x;
-				penPos.y += m_lineSpacing * lineSpacingScale;
+				penPos.y += m_lineSpacing * lineSpacingScale * scale;
 				++lineCount;
 				continue;
 			}
 			else if (codePoint == U'\t')
 			{
-				maxPosX = std::max(maxPosX, penPos.x + m_tabWidth);
-				penPos.x += m_tabWidth;
+				maxPosX = std::max(maxPosX, penPos.x + m_tabWidth * scale);
+				penPos.x += m_tabWidth * scale;
 				continue;
 			}
 			else if (!IsControl(codePoint))
@@ -517,11 +769,11 @@ namespace s3d
 				}
 
 				const char32VH indexVH = codePoint | Horizontal;
-				const auto& glyphInfo = m_glyphs[m_glyphVHIndexTable[indexVH]];
-				const RectF region = m_texture(glyphInfo.bitmapRect).draw(penPos + glyphInfo.offset, color);
-				const int32 characterWidth = glyphInfo.xAdvance;
+				const auto& glyphInfo = getGlyphInfo(indexVH);
+				const RectF region = getGlyphTexture(glyphInfo).scaled(scale).draw(penPos + glyphInfo.offset * scale, color);
+				const double characterWidth = glyphInfo.xAdvance * scale;
 				maxPosX = std::max(maxPosX, region.x + characterWidth);
-				penPos.x += glyphInfo.xAdvance;
+				penPos.x += glyphInfo.xAdvance * scale;
 			}
 		}
 
@@ -530,7 +782,7 @@ namespace s3d
 			return RectF(pos, 0);
 		}
 		
-		return RectF(pos, maxPosX - pos.x, lineCount * m_lineSpacing * lineSpacingScale);
+		return RectF(pos, maxPosX - pos.x, lineCount * m_lineSpacing * lineSpacingScale * scale);
 	}
 
 	bool FontData::draw(const String& codePoints, const RectF& area, const ColorF& color, const double lineSpacingScale)
@@ -611,7 +863,7 @@ namespace s3d
 				}
 
 				const char32VH indexVH = codePoint | Horizontal;
-				const auto& glyphInfo = m_glyphs[m_glyphVHIndexTable[indexVH]];
+				const auto& glyphInfo = getGlyphInfo(indexVH);
 				const int32 characterWidth = glyphInfo.offset.x + glyphInfo.bitmapRect.w;
 
 				if (penPos.x + characterWidth <= width)
@@ -651,7 +903,7 @@ namespace s3d
 					return false;
 				}
 
-				const auto& dotGlyph = m_glyphs[m_glyphVHIndexTable[U'.' | Horizontal]];
+				const auto& dotGlyph = getGlyphInfo(U'.' | Horizontal);
 				const int32 dotWidth = dotGlyph.offset.x + dotGlyph.bitmapRect.w;
 				const int32 dotsWidth = dotGlyph.xAdvance * 2 + dotWidth;
 
@@ -670,7 +922,7 @@ namespace s3d
 					}
 
 					const char32VH indexVH = codePoint | Horizontal;
-					const auto& glyphInfo = m_glyphs[m_glyphVHIndexTable[indexVH]];
+					const auto& glyphInfo = getGlyphInfo(indexVH);
 					penPos.x -= glyphInfo.xAdvance;
 					adjustedText.pop_back();
 				}
@@ -712,8 +964,8 @@ namespace s3d
 				}
 
 				const char32VH indexVH = codePoint | Horizontal;
-				const auto& glyphInfo = m_glyphs[m_glyphVHIndexTable[indexVH]];
-				m_texture(glyphInfo.bitmapRect).draw(penPos + glyphInfo.offset, color);
+				const auto& glyphInfo = getGlyphInfo(indexVH);
+				getGlyphTexture(glyphInfo).draw(penPos + glyphInfo.offset, color);
 				penPos.x += glyphInfo.xAdvance;
 			}
 		}
@@ -894,14 +1146,18 @@ namespace s3d
 			return false;
 		}
 
+		m_currentFrame = System::FrameCount();
+
 		bool hasDirty = false;
 
 		for (const auto& codePoint : codePoints)
 		{
 			const char32VH indexVH = codePoint | Horizontal;
 
-			if (m_glyphVHIndexTable.find(indexVH) != m_glyphVHIndexTable.end())
+			if (const auto it = m_glyphVHIndexTable.find(indexVH); it != m_glyphVHIndexTable.end())
 			{
+				useGlyph(it->second);
+
 				continue;
 			}
 
@@ -912,14 +1168,20 @@ namespace s3d
 			{
 				if (!m_tofuIndex)
 				{
-					if (!renderGlyph(m_faceText.face, 0))
+					const auto index = renderGlyph(m_faceText.face, 0);
+
+					if (!index)
 					{
 						continue;
 					}
 
 					hasDirty = true;
 
-					m_tofuIndex = static_cast<CommonGlyphIndex>(m_glyphs.size() - 1);
+					m_tofuIndex = index;
+				}
+				else
+				{
+					useGlyph(m_tofuIndex.value());
 				}
 
 				m_glyphVHIndexTable.emplace(indexVH, m_tofuIndex.value());
@@ -929,37 +1191,24 @@ namespace s3d
 				const FT_Face face = (glyphIndexText != 0) ? m_faceText.face : m_faceEmoji.face;
 				const FT_UInt glyphIndex = (glyphIndexText != 0) ? glyphIndexText : glyphIndexEmoji;
 
-				renderGlyph(face, glyphIndex);
+				const auto index = renderGlyph(face, glyphIndex);
+
+				if (!index)
+				{
+					continue;
+				}
 
 				hasDirty = true;
 
-				m_glyphVHIndexTable.emplace(indexVH, static_cast<uint32>(m_glyphs.size() - 1));
+				m_glyphVHIndexTable.emplace(indexVH, index.value());
 			}
 		}
 
 		if (hasDirty)
 		{
-			if (m_image.size() == m_texture.size())
-			{
-				m_texture.fill(m_image);
-			}
-			else
-			{
-				const bool hasTexture = !!m_texture;
-				[[maybe_unused]] const Size previousSize = m_texture.size();
-				[[maybe_unused]] const Size newSize = m_image.size();
-
-				m_texture = DynamicTexture(m_image);
+			generateSDFGlyphs();
 
-				if (hasTexture)
-				{
-					LOG_DEBUG(U"ℹ️ Font texture resized ({0}x{1} -> {2}x{3})"_fmt(previousSize.x, previousSize.y, newSize.x, newSize.y));
-				}
-				else
-				{
-					LOG_DEBUG(U"ℹ️ Created font texture (size: {0}x{1})"_fmt(newSize.x, newSize.y));
-				}
-			}
+			m_atlas.upload();
 		}
 
 		return true;
@@ -977,14 +1226,18 @@ namespace s3d
 			generateVerticalTable();
 		}
 
+		m_currentFrame = System::FrameCount();
+
 		bool hasDirty = false;
 
 		for (const auto& codePoint : codePoints)
 		{
 			const char32VH indexVH = codePoint | Vertical;
 
-			if (m_glyphVHIndexTable.find(indexVH) != m_glyphVHIndexTable.end())
+			if (const auto it = m_glyphVHIndexTable.find(indexVH); it != m_glyphVHIndexTable.end())
 			{
+				useGlyph(it->second);
+
 				continue;
 			}
 
@@ -996,14 +1249,20 @@ namespace s3d
 			{
 				if (!m_tofuIndex)
 				{
-					if (!renderGlyph(m_faceText.face, 0))
+					const auto index = renderGlyph(m_faceText.face, 0);
+
+					if (!index)
 					{
 						continue;
 					}
 
 					hasDirty = true;
 
-					m_tofuIndex = static_cast<CommonGlyphIndex>(m_glyphs.size() - 1);
+					m_tofuIndex = index;
+				}
+				else
+				{
+					useGlyph(m_tofuIndex.value());
 				}
 
 				m_glyphVHIndexTable.emplace(indexVH, m_tofuIndex.value());
@@ -1014,18 +1273,22 @@ namespace s3d
 
 				if (it == m_glyphVHIndexTable.end())
 				{
-					renderGlyph(m_faceEmoji.face, glyphIndexEmoji);
+					const auto index = renderGlyph(m_faceEmoji.face, glyphIndexEmoji);
 
-					hasDirty = true;
+					if (!index)
+					{
+						continue;
+					}
 
-					const CommonGlyphIndex index = static_cast<uint32>(m_glyphs.size() - 1);
+					hasDirty = true;
 
-					m_glyphVHIndexTable.emplace(codePoint | Horizontal, index);
-					m_glyphVHIndexTable.emplace(codePoint | Vertical, index);
+					m_glyphVHIndexTable.emplace(codePoint | Horizontal, index.value());
+					m_glyphVHIndexTable.emplace(codePoint | Vertical, index.value());
 				}
 				else
 				{
 					const CommonGlyphIndex index = it->second;
+					useGlyph(index);
 					m_glyphVHIndexTable.emplace(codePoint | Vertical, index);
 				}
 			}
@@ -1036,13 +1299,16 @@ namespace s3d
 
 				if (hasVerticalGlyph)
 				{
-					renderGlyph(m_faceText.face, itV->second);
+					const auto index = renderGlyph(m_faceText.face, itV->second);
 
-					hasDirty = true;
+					if (!index)
+					{
+						continue;
+					}
 
-					const CommonGlyphIndex index = static_cast<uint32>(m_glyphs.size() - 1);
+					hasDirty = true;
 
-					m_glyphVHIndexTable.emplace(codePoint | Vertical, index);
+					m_glyphVHIndexTable.emplace(codePoint | Vertical, index.value());
 				}
 				else
 				{
@@ -1050,18 +1316,22 @@ namespace s3d
 
 					if (it == m_glyphVHIndexTable.end())
 					{
-						renderGlyph(m_faceText.face, glyphIndexText);
+						const auto index = renderGlyph(m_faceText.face, glyphIndexText);
 
-						hasDirty = true;
+						if (!index)
+						{
+							continue;
+						}
 
-						const CommonGlyphIndex index = static_cast<uint32>(m_glyphs.size() - 1);
+						hasDirty = true;
 
-						m_glyphVHIndexTable.emplace(codePoint | Horizontal, index);
-						m_glyphVHIndexTable.emplace(codePoint | Vertical, index);
+						m_glyphVHIndexTable.emplace(codePoint | Horizontal, index.value());
+						m_glyphVHIndexTable.emplace(codePoint | Vertical, index.value());
 					}
 					else
 					{
 						const CommonGlyphIndex index = it->second;
+						useGlyph(index);
 						m_glyphVHIndexTable.emplace(codePoint | Vertical, index);
 					}
 				}
@@ -1070,37 +1340,24 @@ namespace s3d
 
 		if (hasDirty)
 		{
-			if (m_image.size() == m_texture.size())
-			{
-				m_texture.fill(m_image);
-			}
-			else
-			{
-				const bool hasTexture = !!m_texture;
-				[[maybe_unused]] const Size previousSize = m_texture.size();
-				[[maybe_unused]] const Size newSize = m_image.size();
-
-				m_texture = DynamicTexture(m_image);
+			generateSDFGlyphs();
 
-				if (hasTexture)
-				{
-					LOG_DEBUG(U"ℹ️ Font texture resized ({0}x{1} -> {2}x{3})"_fmt(previousSize.x, previousSize.y, newSize.x, newSize.y));
-				}
-				else
-				{
-					LOG_DEBUG(U"ℹ️ Created font texture (size: {0}x{1})"_fmt(newSize.x, newSize.y));
-				}
-			}
+			m_atlas.upload();
 		}
 
 		return true;
 	}
 
-	bool FontData::renderGlyph(const FT_Face face, const FT_UInt glyphIndex)
+	Optional<FontData::CommonGlyphIndex> FontData::renderGlyph(const FT_Face face, const FT_UInt glyphIndex)
 	{
+		if (m_method == FontMethod::SDF)
+		{
+			return renderSDFGlyph(face, glyphIndex);
+		}
+
 		if (const FT_Error error = ::FT_Load_Glyph(face, glyphIndex, FT_LOAD_DEFAULT | (m_noBitmap ? FT_LOAD_NO_BITMAP : 0)))
 		{
-			return false;
+			return none;
 		}
 
 		if (m_bold)
@@ -1120,7 +1377,7 @@ namespace s3d
 		{
 			if (const FT_Error error = ::FT_Render_Glyph(slot, FT_RENDER_MODE_NORMAL))
 			{
-				return false;
+				return none;
 			}
 		}
 		else
@@ -1128,50 +1385,46 @@ namespace s3d
 			isBitmap = true;
 		}
 
-		if (!m_image)
-		{
-			const int32 baseWidth =
-				m_fontSize <= 16 ? 512 :
-				m_fontSize <= 32 ? 768 :
-				m_fontSize <= 48 ? 1024 :
-				m_fontSize <= 64 ? 1536 : 2048;
-
-			m_image.resize(baseWidth, 256, Color(255, 0));
-		}
-
-		m_penPos.x += padding;
-	
 		const int32 bitmapWidth = slot->bitmap.width;
 		const int32 bitmapHeight = slot->bitmap.rows;
 		const int32 bitmapStride = slot->bitmap.pitch;
+		const CommonGlyphIndex index = reserveGlyphIndex();
 
-		if (m_penPos.x + (bitmapWidth + padding) > m_image.width())
+		GlyphInfo info;
+		info.offset.set(slot->bitmap_left, m_ascender - slot->bitmap_top);
+		info.bearingY = static_cast<int32>(slot->bitmap_top);
+		info.xAdvance = static_cast<int32>(slot->metrics.horiAdvance / 64);
+		info.yAdvance = static_cast<int32>(slot->metrics.vertAdvance / 64);
+
+		// 空白などのビットマップが空のグリフはアトラスに配置しない
+		if (bitmapWidth == 0 || bitmapHeight == 0)
 		{
-			m_penPos.x = padding;
+			info.page = GlyphInfo::NoPage;
 
-			const int32 advanceY = static_cast<int32>(slot->metrics.vertAdvance / 64);
+			m_glyphs[index] = info;
 
-			m_penPos.y += advanceY + padding * 2;
+			return index;
 		}
 
-		if (m_penPos.y + (bitmapHeight + padding) > m_image.height())
-		{
-			const int32 newHeight = ((m_penPos.y + (bitmapHeight + padding)) + 255) / 256 * 256;
+		Array<GlyphAtlas::GlyphID> evicted;
 
-			if (newHeight > 4096)
-			{
-				return false;
-			}
+		const auto location = m_atlas.allocate(Size(bitmapWidth, bitmapHeight), index, m_currentFrame, evicted);
+
+		releaseGlyphs(evicted);
+
+		if (!location)
+		{
+			m_freeGlyphIndices.push_back(index);
 
-			m_image.resizeRows(newHeight, Color(255, 0));
+			return none;
 		}
 
-		GlyphInfo info;
-		info.bitmapRect.set(m_penPos, bitmapWidth, bitmapHeight);
-		info.offset.set(slot->bitmap_left, m_ascender - slot->bitmap_top);
-		info.bearingY = static_cast<int32>(slot->bitmap_top);
-		info.xAdvance = static_cast<int32>(slot->metrics.horiAdvance / 64);
-		info.yAdvance = static_cast<int32>(slot->metrics.vertAdvance / 64);
+		const Point penPos = location->rect.pos;
+		Image& image = m_atlas.image(location->page);
+
+		info.bitmapRect = location->rect;
+		info.page = location->page;
+		info.shelf = location->shelf;
 
 		const uint8* bitmapBuffer = slot->bitmap.buffer;
 
@@ -1186,7 +1439,7 @@ namespace s3d
 					const uint32 offsetI = x / 8;
 					const uint32 offsetB = 7 - x % 8;
 
-					m_image[m_penPos.y + y][m_penPos.x + x] = Color(255, ((pSrcLine[offsetI] >> offsetB) & 0x1) ? 255: 0);
+					image[penPos.y + y][penPos.x + x] = Color(255, ((pSrcLine[offsetI] >> offsetB) & 0x1) ? 255: 0);
 				}
 
 				pSrcLine += bitmapStride;
@@ -1198,14 +1451,725 @@ namespace s3d
 			{
 				for (int32 x = 0; x < bitmapWidth; ++x)
 				{
-					m_image[m_penPos.y + y][m_penPos.x + x] = Color(255, bitmapBuffer[y * bitmapWidth + x]);
+					image[penPos.y + y][penPos.x + x] = Color(255, bitmapBuffer[y * bitmapWidth + x]);
 				}
 			}
 		}
 
-		m_penPos.x += bitmapWidth + padding;
+		m_glyphs[index] = info;
+
+		return index;
+	}
+
+	Optional<FontData::CommonGlyphIndex> FontData::renderSDFGlyph(const FT_Face face, const FT_UInt glyphIndex)
+	{
+		// 拡大して描画するため、ヒンティングをせずにアウトラインを取得する
+		if (const FT_Error error = ::FT_Load_Glyph(face, glyphIndex, FT_LOAD_NO_HINTING | FT_LOAD_NO_BITMAP))
+		{
+			return none;
+		}
+
+		if (m_bold)
+		{
+			::FT_GlyphSlot_Embolden(face->glyph);
+		}
+
+		if (m_italic)
+		{
+			::FT_GlyphSlot_Oblique(face->glyph);
+		}
+
+		const FT_GlyphSlot slot = face->glyph;
+
+		if (slot->format != FT_GLYPH_FORMAT_OUTLINE)
+		{
+			return none;
+		}
+
+		FT_BBox box;
+		::FT_Outline_Get_CBox(&slot->outline, &box);
+
+		const int32 left	= static_cast<int32>(std::floor(box.xMin / 64.0)) - m_sdfSpread;
+		const int32 top		= static_cast<int32>(std::ceil(box.yMax / 64.0)) + m_sdfSpread;
+		const int32 right	= static_cast<int32>(std::ceil(box.xMax / 64.0)) + m_sdfSpread;
+		const int32 bottom	= static_cast<int32>(std::floor(box.yMin / 64.0)) - m_sdfSpread;
+
+		const CommonGlyphIndex index = reserveGlyphIndex();
+
+		GlyphInfo info;
+		info.offset.set(left, m_ascender - top);
+		info.bearingY = top;
+		info.xAdvance = static_cast<int32>(slot->metrics.horiAdvance / 64);
+		info.yAdvance = static_cast<int32>(slot->metrics.vertAdvance / 64);
+
+		// 距離場を計算してアトラスに配置するまでは NoPage
+		m_glyphs[index] = info;
+
+		// 空白などのアウトラインが空のグリフはアトラスに配置しない
+		if (slot->outline.n_points == 0)
+		{
+			return index;
+		}
+
+		FT_Outline_Funcs funcs;
+		funcs.move_to	= detail::SDFMoveTo;
+		funcs.line_to	= detail::SDFLineTo;
+		funcs.conic_to	= detail::SDFConicTo;
+		funcs.cubic_to	= detail::SDFCubicTo;
+		funcs.shift		= 0;
+		funcs.delta		= 0;
+
+		detail::SDFOutlineData outlineData;
+		::FT_Outline_Decompose(&slot->outline, &funcs, &outlineData);
+
+		for (auto& edge : outlineData.edges)
+		{
+			edge.begin.set(edge.begin.x / 64.0 - left, top - edge.begin.y / 64.0);
+			edge.end.set(edge.end.x / 64.0 - left, top - edge.end.y / 64.0);
+		}
+
+		SDFGlyphRequest request;
+		request.index = index;
+		request.size.set(right - left, top - bottom);
+		request.edges = std::move(outlineData.edges);
+
+		m_sdfRequests.push_back(std::move(request));
+
+		return index;
+	}
+
+	void FontData::generateSDFGlyphs()
+	{
+		if (!m_sdfRequests)
+		{
+			return;
+		}
+
+		// FreeType を使わない距離場の計算だけを並列化する
+		m_sdfRequests.parallel_each([spread = m_sdfSpread](SDFGlyphRequest& request)
+		{
+			detail::GenerateDistanceField(request.edges, request.size, spread, request.distances);
+		});
+
+		Array<GlyphAtlas::GlyphID> evicted, failed;
+
+		for (const auto& request : m_sdfRequests)
+		{
+			const auto location = m_atlas.allocate(request.size, request.index, m_currentFrame, evicted);
+
+			releaseGlyphs(evicted);
+
+			evicted.clear();
+
+			if (!location)
+			{
+				failed.push_back(request.index);
+
+				continue;
+			}
+
+			const Point penPos = location->rect.pos;
+			Image& image = m_atlas.image(location->page);
+			const uint8* pSrc = request.distances.data();
+
+			for (int32 y = 0; y < request.size.y; ++y)
+			{
+				for (int32 x = 0; x < request.size.x; ++x)
+				{
+					image[penPos.y + y][penPos.x + x] = Color(255, *pSrc++);
+				}
+			}
+
+			GlyphInfo& info = m_glyphs[request.index];
+			info.bitmapRect = location->rect;
+			info.page = location->page;
+			info.shelf = location->shelf;
+		}
+
+		m_sdfRequests.clear();
+
+		// アトラスに配置できなかったグリフは、次に使われたときに生成し直す
+		releaseGlyphs(failed);
+	}
+
+	FontData::CommonGlyphIndex FontData::reserveGlyphIndex()
+	{
+		if (m_freeGlyphIndices)
+		{
+			const CommonGlyphIndex index = m_freeGlyphIndices.back();
+
+			m_freeGlyphIndices.pop_back();
+
+			return index;
+		}
+
+		m_glyphs.emplace_back();
+
+		return static_cast<CommonGlyphIndex>(m_glyphs.size() - 1);
+	}
+
+	void FontData::useGlyph(const CommonGlyphIndex index)
+	{
+		const GlyphInfo& glyphInfo = m_glyphs[index];
+
+		if (glyphInfo.page != GlyphInfo::NoPage)
+		{
+			m_atlas.touch(glyphInfo.page, glyphInfo.shelf, m_currentFrame);
+		}
+	}
+
+	void FontData::releaseGlyphs(Array<GlyphAtlas::GlyphID>& evicted)
+	{
+		if (!evicted)
+		{
+			return;
+		}
+
+		std::sort(evicted.begin(), evicted.end());
+
+		++m_atlasGeneration;
+
+		for (const auto index : evicted)
+		{
+			m_glyphs[index] = GlyphInfo();
+
+			m_freeGlyphIndices.push_back(index);
+
+			if (m_tofuIndex == index)
+			{
+				m_tofuIndex.reset();
+			}
+		}
+
+		// 追い出したグリフを指すすべての文字（横書き・縦書き・豆腐）の対応を削除する
+		for (auto it = m_glyphVHIndexTable.begin(); it != m_glyphVHIndexTable.end();)
+		{
+			if (std::binary_search(evicted.begin(), evicted.end(), it->second))
+			{
+				it = m_glyphVHIndexTable.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+	const GlyphInfo& FontData::getGlyphInfo(const char32VH indexVH) const
+	{
+		static const GlyphInfo emptyGlyph;
+
+		const auto it = m_glyphVHIndexTable.find(indexVH);
+
+		if (it == m_glyphVHIndexTable.end())
+		{
+			return emptyGlyph;
+		}
+
+		return m_glyphs[it->second];
+	}
+
+	TextureRegion FontData::getGlyphTexture(const GlyphInfo& glyphInfo) const
+	{
+		if (glyphInfo.page >= m_atlas.num_pages())
+		{
+			return TextureRegion();
+		}
+
+		return m_atlas.texture(glyphInfo.page)(glyphInfo.bitmapRect);
+	}
+
+	bool FontData::buildLayout(const String& codePoints, const double lineSpacingScale, TextLayout& layout)
+	{
+		if (!render(codePoints))
+		{
+			return false;
+		}
+
+		layout.text = codePoints;
+		layout.lineSpacingScale = lineSpacingScale;
+		layout.quads.clear();
+		layout.xAdvances.clear();
+		layout.xAdvances.reserve(codePoints.size());
+
+		// draw(), getRegion(), getBoundingRect(), getXAdvances() と同じ計算を 1 回の走査で行う
+		Vec2 penPos(0, 0);
+		Vec2 minPos(DBL_MAX, DBL_MAX);
+		Vec2 maxPos(DBL_MIN, DBL_MIN);
+		double maxDrawX = DBL_MIN;
+		double maxRegionX = DBL_MIN;
+		int32 lineCount = 0;
+
+		for (const auto codePoint : codePoints)
+		{
+			if (codePoint == U'\n')
+			{
+				penPos.x = 0;
+				penPos.y += m_lineSpacing * lineSpacingScale;
+				++lineCount;
+				layout.xAdvances.push_back(0);
+			}
+			else if (codePoint == U'\t')
+			{
+				minPos.x = std::min(minPos.x, penPos.x);
+				minPos.y = std::min(minPos.y, penPos.y + m_ascender);
+				maxPos.x = std::max(maxPos.x, penPos.x + m_tabWidth);
+				maxPos.y = std::max(maxPos.y, penPos.y);
+				maxRegionX = std::max(maxRegionX, penPos.x + m_tabWidth);
+				maxDrawX = std::max(maxDrawX, penPos.x + m_tabWidth);
+				penPos.x += m_tabWidth;
+				layout.xAdvances.push_back(m_tabWidth);
+			}
+			else if (IsControl(codePoint))
+			{
+				layout.xAdvances.push_back(0);
+			}
+			else
+			{
+				if (lineCount == 0)
+				{
+					++lineCount;
+				}
+
+				const char32VH indexVH = codePoint | Horizontal;
+				const auto& glyphInfo = getGlyphInfo(indexVH);
+				const RectF region(penPos + glyphInfo.offset, glyphInfo.bitmapRect.size);
+				const int32 characterWidth = glyphInfo.bitmapRect.size.isZero() ? glyphInfo.xAdvance : glyphInfo.bitmapRect.size.x;
+				minPos.x = std::min(minPos.x, region.x);
+				minPos.y = std::min(minPos.y, region.y);
+				maxPos.x = std::max(maxPos.x, region.x + characterWidth);
+				maxPos.y = std::max(maxPos.y, region.y + region.h);
+				maxRegionX = std::max(maxRegionX, penPos.x + glyphInfo.xAdvance);
+				maxDrawX = std::max(maxDrawX, region.x + glyphInfo.xAdvance);
+
+				if (glyphInfo.page != GlyphInfo::NoPage)
+				{
+					layout.quads.push_back({ glyphInfo.bitmapRect, glyphInfo.page, glyphInfo.shelf, region.pos });
+				}
+
+				penPos.x += glyphInfo.xAdvance;
+				layout.xAdvances.push_back(glyphInfo.xAdvance);
+			}
+		}
+
+		if (minPos == Vec2(DBL_MAX, DBL_MAX))
+		{
+			layout.region = RectF(0);
+			layout.boundingRect = RectF(0);
+		}
+		else
+		{
+			layout.region = RectF(0, 0, maxRegionX, lineCount * m_lineSpacing * lineSpacingScale);
+			layout.boundingRect = RectF(minPos, maxPos - minPos);
+		}
+
+		layout.drawRegion = (lineCount == 0) ? RectF(0) : RectF(0, 0, maxDrawX, lineCount * m_lineSpacing * lineSpacingScale);
+
+		layout.quads.shrink_to_fit();
+		layout.atlasGeneration = m_atlasGeneration;
+		layout.lastUsedFrame = m_currentFrame;
+		layout.bytes = sizeof(TextLayout)
+			+ layout.text.capacity() * sizeof(char32)
+			+ layout.quads.capacity() * sizeof(TextLayout::GlyphQuad)
+			+ layout.xAdvances.capacity() * sizeof(int32);
+
+		return true;
+	}
+
+	const TextLayout* FontData::getLayout(const String& codePoints, const double lineSpacingScale)
+	{
+		if (m_layoutCacheBudget == 0 || !m_faceText)
+		{
+			return nullptr;
+		}
+
+		uint64 seed = 0;
+		std::memcpy(&seed, &lineSpacingScale, sizeof(seed));
+		const uint64 key = Hash::XXHash(ByteArrayView(codePoints.data(), codePoints.size_bytes()), Hash::DefaultXXHSeed ^ seed);
+
+		if (auto it = m_layouts.find(key); it != m_layouts.end())
+		{
+			TextLayout& layout = it.value();
+
+			// ハッシュの衝突
+			if (layout.lineSpacingScale != lineSpacingScale || layout.text != codePoints)
+			{
+				return nullptr;
+			}
+
+			m_currentFrame = System::FrameCount();
+
+			if (layout.atlasGeneration != m_atlasGeneration)
+			{
+				// レイアウトのグリフがアトラスから追い出された可能性があるので作り直す
+				m_layoutCacheBytes -= layout.bytes;
+
+				if (!buildLayout(codePoints, lineSpacingScale, layout))
+				{
+					m_layouts.erase(it);
+
+					return nullptr;
+				}
+
+				m_layoutCacheBytes += layout.bytes;
+			}
+			else
+			{
+				for (const auto& quad : layout.quads)
+				{
+					m_atlas.touch(quad.page, quad.shelf, m_currentFrame);
+				}
+
+				layout.lastUsedFrame = m_currentFrame;
+			}
+
+			return &layout;
+		}
+
+		// 一度しか使われない文字列はキャッシュしない
+		if (m_layoutCandidates.find(key) == m_layoutCandidates.end())
+		{
+			if (m_layoutCandidates.size() >= MaxLayoutCandidates)
+			{
+				m_layoutCandidates.clear();
+			}
+
+			m_layoutCandidates.insert(key);
+
+			return nullptr;
+		}
+
+		TextLayout layout;
+
+		if (!buildLayout(codePoints, lineSpacingScale, layout))
+		{
+			return nullptr;
+		}
+
+		if (layout.bytes > m_layoutCacheBudget)
+		{
+			return nullptr;
+		}
+
+		m_layoutCandidates.erase(key);
+
+		trimLayoutCache(layout.bytes);
+
+		m_layoutCacheBytes += layout.bytes;
+
+		return &m_layouts.emplace(key, std::move(layout)).first.value();
+	}
+
+	void FontData::trimLayoutCache(const size_t bytesToAdd)
+	{
+		if ((m_layoutCacheBytes + bytesToAdd) <= m_layoutCacheBudget)
+		{
+			return;
+		}
+
+		// 毎回ソートしないよう、上限の 3/4 まで減らす
+		const size_t target = (m_layoutCacheBudget / 4 * 3);
+
+		Array<std::pair<int32, uint64>> entries;
+		entries.reserve(m_layouts.size());
+
+		for (const auto& layout : m_layouts)
+		{
+			entries.emplace_back(layout.second.lastUsedFrame, layout.first);
+		}
+
+		std::sort(entries.begin(), entries.end());
+
+		for (const auto& entry : entries)
+		{
+			if ((m_layoutCacheBytes + bytesToAdd) <= target)
+			{
+				break;
+			}
+
+			const auto it = m_layouts.find(entry.second);
+
+			m_layoutCacheBytes -= it->second.bytes;
+
+			m_layouts.erase(it);
+		}
+	}
+
+	void FontData::setLayoutCacheBudget(const size_t bytes)
+	{
+		m_layoutCacheBudget = bytes;
+
+		if (m_layoutCacheBudget == 0)
+		{
+			clearLayoutCache();
+		}
+		else
+		{
+			trimLayoutCache(0);
+		}
+	}
+
+	void FontData::clearLayoutCache()
+	{
+		m_layouts.clear();
+
+		m_layoutCandidates.clear();
+
+		m_layoutCacheBytes = 0;
+	}
+
+	bool FontData::saveSDFAtlas(const FilePath& path, const String& codePoints)
+	{
+		if (m_method != FontMethod::SDF)
+		{
+			LOG_FAIL(U"❌ Font::saveSDFAtlas(): The font is not an SDF font");
+
+			return false;
+		}
+
+		String characters = codePoints.removed_if(IsControl);
+		std::sort(characters.begin(), characters.end());
+		characters.erase(std::unique(characters.begin(), characters.end()), characters.end());
+
+		if (!render(characters))
+		{
+			return false;
+		}
+
+		Array<detail::SDFAtlasGlyph> glyphs;
+		Array<uint8> distances;
+
+		for (const auto codePoint : characters)
+		{
+			const auto it = m_glyphVHIndexTable.find(codePoint | Horizontal);
+
+			if (it == m_glyphVHIndexTable.end())
+			{
+				continue;
+			}
+
+			const GlyphInfo& glyphInfo = m_glyphs[it->second];
+			const bool hasBitmap = (glyphInfo.page != GlyphInfo::NoPage);
+
+			detail::SDFAtlasGlyph glyph;
+			glyph.codePoint	= codePoint;
+			glyph.width		= hasBitmap ? glyphInfo.bitmapRect.w : 0;
+			glyph.height	= hasBitmap ? glyphInfo.bitmapRect.h : 0;
+			glyph.offsetX	= glyphInfo.offset.x;
+			glyph.offsetY	= glyphInfo.offset.y;
+			glyph.bearingY	= glyphInfo.bearingY;
+			glyph.xAdvance	= glyphInfo.xAdvance;
+			glyph.yAdvance	= glyphInfo.yAdvance;
+			glyphs.push_back(glyph);
+
+			if (!hasBitmap)
+			{
+				continue;
+			}
+
+			const Image& image = m_atlas.image(glyphInfo.page);
+			const Rect& rect = glyphInfo.bitmapRect;
+
+			for (int32 y = 0; y < rect.h; ++y)
+			{
+				for (int32 x = 0; x < rect.w; ++x)
+				{
+					distances.push_back(image[rect.y + y][rect.x + x].a);
+				}
+			}
+		}
+
+		const std::string familyName = m_familyName.toUTF8();
+		const std::string styleName = m_styleName.toUTF8();
+
+		detail::SDFAtlasHeader header = {};
+		std::memcpy(header.signature, detail::SDFAtlasSignature, sizeof(header.signature));
+		header.version			= detail::SDFAtlasVersion;
+		header.fontSize			= m_fontSize;
+		header.spread			= m_sdfSpread;
+		header.style			= (m_bold ? 0x1 : 0x0) | (m_italic ? 0x2 : 0x0);
+		header.numGlyphs		= static_cast<uint32>(glyphs.size());
+		header.familyNameSize	= static_cast<uint32>(familyName.size());
+		header.styleNameSize	= static_cast<uint32>(styleName.size());
+
+		BinaryWriter writer(path);
+
+		if (!writer)
+		{
+			LOG_FAIL(U"❌ Font::saveSDFAtlas(): Failed to open `{0}`"_fmt(path));
+
+			return false;
+		}
+
+		writer.write(&header, sizeof(header));
+		writer.write(familyName.data(), familyName.size());
+		writer.write(styleName.data(), styleName.size());
+		writer.write(glyphs.data(), glyphs.size_bytes());
+		writer.write(distances.data(), distances.size_bytes());
+
+		LOG_DEBUG(U"ℹ️ SDF atlas saved to `{0}` ({1} glyphs, {2} bytes)"_fmt(path, glyphs.size(), writer.size()));
+
+		return true;
+	}
+
+	bool FontData::loadSDFAtlas(const FilePath& path)
+	{
+		if (m_method != FontMethod::SDF)
+		{
+			LOG_FAIL(U"❌ Font::loadSDFAtlas(): The font is not an SDF font");
+
+			return false;
+		}
+
+		BinaryReader reader(path);
+
+		if (!reader)
+		{
+			LOG_FAIL(U"❌ Font::loadSDFAtlas(): Failed to open `{0}`"_fmt(path));
+
+			return false;
+		}
+
+		detail::SDFAtlasHeader header;
+
+		if ((reader.read(&header, sizeof(header)) != sizeof(header))
+			|| (std::memcmp(header.signature, detail::SDFAtlasSignature, sizeof(header.signature)) != 0)
+			|| (header.version != detail::SDFAtlasVersion))
+		{
+			LOG_FAIL(U"❌ Font::loadSDFAtlas(): `{0}` is not a valid SDF atlas file"_fmt(path));
+
+			return false;
+		}
+
+		// 壊れたファイルの件数でメモリを確保しないように、確保する前にファイルの残りのサイズと比べる
+		const int64 recordsSize = static_cast<int64>(header.familyNameSize)
+			+ static_cast<int64>(header.styleNameSize)
+			+ static_cast<int64>(header.numGlyphs) * static_cast<int64>(sizeof(detail::SDFAtlasGlyph));
+
+		if ((reader.size() - reader.getPos()) < recordsSize)
+		{
+			LOG_FAIL(U"❌ Font::loadSDFAtlas(): `{0}` is not a valid SDF atlas file"_fmt(path));
+
+			return false;
+		}
+
+		std::string familyName(header.familyNameSize, '\0');
+		std::string styleName(header.styleNameSize, '\0');
+		Array<detail::SDFAtlasGlyph> glyphs(header.numGlyphs);
+
+		if ((reader.read(familyName.data(), familyName.size()) != static_cast<int64>(familyName.size()))
+			|| (reader.read(styleName.data(), styleName.size()) != static_cast<int64>(styleName.size()))
+			|| (reader.read(glyphs.data(), glyphs.size_bytes()) != static_cast<int64>(glyphs.size_bytes())))
+		{
+			LOG_FAIL(U"❌ Font::loadSDFAtlas(): `{0}` is not a valid SDF atlas file"_fmt(path));
+
+			return false;
+		}
+
+		// 距離場は作成したときのフォントとフォントサイズ、スタイルでしか正しく描画できない
+		if ((header.fontSize != m_fontSize)
+			|| (header.spread != m_sdfSpread)
+			|| (header.style != static_cast<uint32>((m_bold ? 0x1 : 0x0) | (m_italic ? 0x2 : 0x0)))
+			|| (Unicode::FromUTF8(familyName) != m_familyName)
+			|| (Unicode::FromUTF8(styleName) != m_styleName))
+		{
+			LOG_FAIL(U"❌ Font::loadSDFAtlas(): `{0}` was created from a different font"_fmt(path));
+
+			return false;
+		}
+
+		int64 distancesSize = 0;
+
+		for (const auto& glyph : glyphs)
+		{
+			if (!InRange(glyph.width, 0, m_atlas.pageSize()) || !InRange(glyph.height, 0, m_atlas.pageSize()))
+			{
+				LOG_FAIL(U"❌ Font::loadSDFAtlas(): `{0}` is not a valid SDF atlas file"_fmt(path));
+
+				return false;
+			}
+
+			distancesSize += static_cast<int64>(glyph.width) * glyph.height;
+		}
+
+		if ((reader.size() - reader.getPos()) < distancesSize)
+		{
+			LOG_FAIL(U"❌ Font::loadSDFAtlas(): `{0}` is not a valid SDF atlas file"_fmt(path));
+
+			return false;
+		}
+
+		Array<uint8> distances(static_cast<size_t>(distancesSize));
+
+		if (reader.read(distances.data(), distancesSize) != distancesSize)
+		{
+			LOG_FAIL(U"❌ Font::loadSDFAtlas(): `{0}` is not a valid SDF atlas file"_fmt(path));
+
+			return false;
+		}
+
+		m_currentFrame = System::FrameCount();
+
+		const uint8* pSrc = distances.data();
+		Array<GlyphAtlas::GlyphID> evicted;
+
+		for (const auto& glyph : glyphs)
+		{
+			const uint8* pGlyphSrc = pSrc;
+			pSrc += glyph.width * glyph.height;
+
+			const char32VH indexVH = glyph.codePoint | Horizontal;
+
+			if (m_glyphVHIndexTable.find(indexVH) != m_glyphVHIndexTable.end())
+			{
+				continue;
+			}
+
+			const CommonGlyphIndex index = reserveGlyphIndex();
+
+			GlyphInfo info;
+			info.offset.set(glyph.offsetX, glyph.offsetY);
+			info.bearingY = glyph.bearingY;
+			info.xAdvance = glyph.xAdvance;
+			info.yAdvance = glyph.yAdvance;
+
+			if (glyph.width != 0 && glyph.height != 0)
+			{
+				const auto location = m_atlas.allocate(Size(glyph.width, glyph.height), index, m_currentFrame, evicted);
+
+				releaseGlyphs(evicted);
+
+				evicted.clear();
+
+				if (!location)
+				{
+					m_freeGlyphIndices.push_back(index);
+
+					continue;
+				}
+
+				const Point penPos = location->rect.pos;
+				Image& image = m_atlas.image(location->page);
+
+				for (int32 y = 0; y < glyph.height; ++y)
+				{
+					for (int32 x = 0; x < glyph.width; ++x)
+					{
+						image[penPos.y + y][penPos.x + x] = Color(255, *pGlyphSrc++);
+					}
+				}
+
+				info.bitmapRect = location->rect;
+				info.page = location->page;
+				info.shelf = location->shelf;
+			}
+
+			m_glyphs[index] = info;
+
+			m_glyphVHIndexTable.emplace(indexVH, index);
+		}
 
-		m_glyphs.push_back(info);
+		m_atlas.upload();
 
 		return true;
 	}
@@ -19,10 +19,13 @@
 # include "../../ThirdParty/harfbuzz/hb-ft.h"
 # include <Siv3D/Windows.hpp>
 # include <Siv3D/HashTable.hpp>
+# include <Siv3D/HashSet.hpp>
 # include <Siv3D/Image.hpp>
+# include <Siv3D/Line.hpp>
 # include <Siv3D/Font.hpp>
 # include <Siv3D/ByteArray.hpp>
-# include <Siv3D/DynamicTexture.hpp>
+# include <Siv3D/ArchivedFileReader.hpp>
+# include "GlyphAtlas.hpp"
 
 namespace s3d
 {
@@ -76,8 +79,16 @@ namespace s3d
 
 	struct GlyphInfo
 	{
+		// アトラスに配置されていない（ビットマップが空の）グリフの page
+		static constexpr uint32 NoPage = UINT32_MAX;
+
 		Rect bitmapRect = { 0,0,0,0 };
 
+		// グリフアトラス内のページと棚
+		uint32 page = NoPage;
+
+		uint32 shelf = 0;
+
 		Point offset = { 0,0 };
 
 		int32 bearingY = 0;
@@ -89,6 +100,44 @@ namespace s3d
 		int32 width = 0;
 	};
 
+	// キャッシュした文字列のレイアウト
+	struct TextLayout
+	{
+		struct GlyphQuad
+		{
+			Rect bitmapRect = { 0,0,0,0 };
+
+			uint32 page = 0;
+
+			uint32 shelf = 0;
+
+			// 描画位置からの相対位置
+			Vec2 pos = { 0,0 };
+		};
+
+		String text;
+
+		double lineSpacingScale = 1.0;
+
+		Array<GlyphQuad> quads;
+
+		Array<int32> xAdvances;
+
+		// 原点に描画したときに draw() が返す領域
+		RectF drawRegion = { 0,0,0,0 };
+
+		RectF region = { 0,0,0,0 };
+
+		RectF boundingRect = { 0,0,0,0 };
+
+		// レイアウトを作成したときのグリフアトラスの世代
+		uint64 atlasGeneration = 0;
+
+		int32 lastUsedFrame = 0;
+
+		size_t bytes = 0;
+	};
+
 	struct FontFace
 	{
 		FT_Face face = nullptr;
@@ -168,12 +217,39 @@ namespace s3d
 
 		using CommonGlyphIndex = uint32;
 
+		// 追い出しを始めるまでに使うグリフアトラスのページ数
+		static constexpr size_t MaxAtlasPages = 4;
+
+		static constexpr size_t DefaultLayoutCacheBudget = 1024 * 1024;
+
+		// 1 回だけ使われた文字列として記録するハッシュの最大数
+		static constexpr size_t MaxLayoutCandidates = 4096;
+
+		// SDF グリフの輪郭の外側と内側に確保する距離場の幅の最小値（ピクセル）
+		static constexpr int32 MinSDFSpread = 4;
+
+		// 距離場の計算を待っている SDF グリフ
+		struct SDFGlyphRequest
+		{
+			CommonGlyphIndex index = 0;
+
+			Size size = { 0,0 };
+
+			// セルの左上を原点とする輪郭の線分
+			Array<Line> edges;
+
+			Array<uint8> distances;
+		};
+
 	# if defined(SIV3D_TARGET_WINDOWS)
 
 		FontResourceHolder m_resource;
 
 	# endif
 
+		// アーカイブ内のフォントのデータ。FT_Face より先に破棄されないよう、m_faceText より前に置く
+		ArchivedFileReader m_archived;
+
 		HashTable<char32VH, CommonGlyphIndex> m_glyphVHIndexTable;
 
 		HashTable<uint16, uint16> m_verticalTable;
@@ -188,7 +264,8 @@ namespace s3d
 
 		Optional<CommonGlyphIndex> m_tofuIndex;
 
-		static constexpr int32 padding = 2;
+		// グリフアトラスから追い出されて再利用できる m_glyphs のインデックス
+		Array<CommonGlyphIndex> m_freeGlyphIndices;
 
 		String m_familyName;
 
@@ -210,11 +287,28 @@ namespace s3d
 
 		bool m_noBitmap = true;
 
-		Point m_penPos = { 0, padding };
+		FontMethod m_method = FontMethod::Bitmap;
+
+		int32 m_sdfSpread = 0;
+
+		Array<SDFGlyphRequest> m_sdfRequests;
+
+		GlyphAtlas m_atlas;
+
+		// render() または renderVertical() を最後に呼び出したフレーム
+		int32 m_currentFrame = 0;
+
+		// グリフを追い出すたびに増え、キャッシュしたレイアウトが古くなったことを示す
+		uint64 m_atlasGeneration = 0;
+
+		// 2 回以上使われた文字列のレイアウトのキャッシュ。キーは文字列と行間の倍率のハッシュ
+		HashTable<uint64, TextLayout> m_layouts;
 
-		Image m_image;
+		HashSet<uint64> m_layoutCandidates;
 
-		DynamicTexture m_texture;
+		size_t m_layoutCacheBudget = DefaultLayoutCacheBudget;
+
+		size_t m_layoutCacheBytes = 0;
 
 		bool m_initialized = false;
 
@@ -234,7 +328,32 @@ namespace s3d
 
 		bool renderVertical(const String& codePoints);
 
-		bool renderGlyph(FT_Face face, FT_UInt glyphIndex);
+		Optional<CommonGlyphIndex> renderGlyph(FT_Face face, FT_UInt glyphIndex);
+
+		// グリフの寸法とアウトラインを取得し、距離場の計算を m_sdfRequests に追加する
+		Optional<CommonGlyphIndex> renderSDFGlyph(FT_Face face, FT_UInt glyphIndex);
+
+		// m_sdfRequests の距離場をワーカースレッドで計算し、グリフアトラスに配置する
+		void generateSDFGlyphs();
+
+		CommonGlyphIndex reserveGlyphIndex();
+
+		// グリフを現在のフレームで使ったことを記録し、追い出されないようにする
+		void useGlyph(CommonGlyphIndex index);
+
+		void releaseGlyphs(Array<GlyphAtlas::GlyphID>& evicted);
+
+		const GlyphInfo& getGlyphInfo(char32VH indexVH) const;
+
+		TextureRegion getGlyphTexture(const GlyphInfo& glyphInfo) const;
+
+		bool buildLayout(const String& codePoints, double lineSpacingScale, TextLayout& layout);
+
+		// キャッシュしたレイアウトを返す。キャッシュの対象にならない場合は nullptr
+		const TextLayout* getLayout(const String& codePoints, double lineSpacingScale);
+
+		// 新しいレイアウトのために bytesToAdd バイトを空ける。長い間使われていないものから破棄する
+		void trimLayoutCache(size_t bytesToAdd);
 
 		void paintGlyph(FT_Face face, FT_UInt glyphIndex, Image& image, Image& tmpImage, bool overwrite, const Point& penPos, const Color& color, int32& width, int32& xAdvance) const;
 
@@ -246,7 +365,7 @@ namespace s3d
 
 		FontData(Null, FT_Library library);
 
-		FontData(FT_Library library, const FilePath& filePath, const FilePath& emojiFilePath, const int32 fontSize, FontStyle style);
+		FontData(FT_Library library, const FilePath& filePath, const FilePath& emojiFilePath, const int32 fontSize, FontStyle style, FontMethod method);
 
 		~FontData();
 
@@ -270,6 +389,11 @@ namespace s3d
 			return m_fontSize;
 		}
 
+		FontMethod getMethod() const noexcept
+		{
+			return m_method;
+		}
+
 		int32 getAscent() const noexcept
 		{
 			return m_ascender;
@@ -292,10 +416,23 @@ namespace s3d
 
 		Array<int32> getXAdvances(const String& codePoints);
 
-		RectF draw(const String& codePoints, const Vec2& pos, const ColorF& color, double lineSpacingScale);
+		RectF draw(const String& codePoints, const Vec2& pos, const ColorF& color, double lineSpacingScale, double scale);
 
 		bool draw(const String& codePoints, const RectF& area, const ColorF& color, double lineSpacingScale);
 
 		Rect paint(Image& dst, bool overwrite, const String& codePoints, const Point& pos, const Color& color, double lineSpacingScale) const;
+
+		void setLayoutCacheBudget(size_t bytes);
+
+		size_t getLayoutCacheBytes() const noexcept
+		{
+			return m_layoutCacheBytes;
+		}
+
+		void clearLayoutCache();
+
+		bool saveSDFAtlas(const FilePath& path, const String& codePoints);
+
+		bool loadSDFAtlas(const FilePath& path);
 	};
 }
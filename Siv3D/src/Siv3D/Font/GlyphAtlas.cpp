@@ -0,0 +1,348 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <cassert>
+# include "GlyphAtlas.hpp"
+# include "../Siv3DEngine.hpp"
+# include "../Profiler/IProfiler.hpp"
+# include <Siv3D/Logger.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		[[nodiscard]] static constexpr int32 AlignShelfHeight(const int32 height) noexcept
+		{
+			return (height + (GlyphAtlas::ShelfHeightAlignment - 1)) / GlyphAtlas::ShelfHeightAlignment * GlyphAtlas::ShelfHeightAlignment;
+		}
+	}
+
+	GlyphAtlas::~GlyphAtlas()
+	{
+		for (size_t i = 0; i < m_pages.size(); ++i)
+		{
+			Siv3DEngine::GetProfiler()->reportFontAtlasPageRelease(pageBytes());
+		}
+	}
+
+	void GlyphAtlas::init(const int32 pageSize, const size_t maxPages, const TextureDesc desc)
+	{
+		assert(m_pages.isEmpty());
+
+		m_pageSize = pageSize;
+
+		m_maxPages = std::max<size_t>(maxPages, 1);
+
+		m_desc = desc;
+	}
+
+	Optional<GlyphAtlasLocation> GlyphAtlas::allocate(const Size& size, const GlyphID id, const int32 frame, Array<GlyphID>& evicted)
+	{
+		const int32 cellWidth = size.x + Padding * 2;
+		const int32 cellHeight = size.y + Padding * 2;
+
+		if (cellWidth > m_pageSize || cellHeight > m_pageSize)
+		{
+			return none;
+		}
+
+		// 1. 既存の棚の空き
+		if (const auto shelf = findShelf(cellWidth, cellHeight))
+		{
+			return place(shelf->first, shelf->second, size, id, frame);
+		}
+
+		// 2. ページの未使用の領域に新しい棚
+		if (const auto shelf = addShelf(cellHeight))
+		{
+			return place(shelf->first, shelf->second, size, id, frame);
+		}
+
+		// 3. 新しいページ
+		if (m_pages.size() < m_maxPages)
+		{
+			addPage();
+
+			if (const auto shelf = addShelf(cellHeight))
+			{
+				return place(shelf->first, shelf->second, size, id, frame);
+			}
+		}
+
+		// 4. 最も長い間使われていない棚を追い出す
+		if (const auto shelf = evictShelf(cellHeight, frame, evicted))
+		{
+			return place(shelf->first, shelf->second, size, id, frame);
+		}
+
+		// 5. 十分な高さの棚がなければ、最も長い間使われていないページを丸ごと追い出す
+		if (const auto shelf = evictPage(cellHeight, frame, evicted))
+		{
+			return place(shelf->first, shelf->second, size, id, frame);
+		}
+
+		// 6. すべてのグリフが現在のフレームで使われている場合は、上限を超えてページを追加する
+		if (!m_overBudgetReported)
+		{
+			LOG_DEBUG(U"ℹ️ Glyph atlas exceeded its page budget ({0} pages of {1}x{1})"_fmt(m_maxPages, m_pageSize));
+
+			m_overBudgetReported = true;
+		}
+
+		addPage();
+
+		if (const auto shelf = addShelf(cellHeight))
+		{
+			return place(shelf->first, shelf->second, size, id, frame);
+		}
+
+		return none;
+	}
+
+	void GlyphAtlas::upload()
+	{
+		auto p = Siv3DEngine::GetProfiler();
+
+		for (auto& page : m_pages)
+		{
+			if (!page.texture)
+			{
+				page.texture = DynamicTexture(page.image, TextureFormat::R8G8B8A8_Unorm, m_desc);
+
+				for (auto& shelf : page.shelves)
+				{
+					shelf.dirtyBegin = shelf.dirtyEnd = 0;
+				}
+
+				p->reportFontAtlasUpload(page.image.size_bytes());
+
+				continue;
+			}
+
+			for (auto& shelf : page.shelves)
+			{
+				if (shelf.dirtyBegin == shelf.dirtyEnd)
+				{
+					continue;
+				}
+
+				const Rect rect(shelf.dirtyBegin, shelf.y, (shelf.dirtyEnd - shelf.dirtyBegin), shelf.height);
+
+				page.texture.fillRegion(page.image, rect);
+
+				p->reportFontAtlasUpload(rect.area() * sizeof(Color));
+
+				shelf.dirtyBegin = shelf.dirtyEnd = 0;
+			}
+		}
+	}
+
+	size_t GlyphAtlas::pageBytes() const noexcept
+	{
+		return static_cast<size_t>(m_pageSize) * m_pageSize * sizeof(Color);
+	}
+
+	void GlyphAtlas::addPage()
+	{
+		Page page;
+
+		page.image.resize(m_pageSize, m_pageSize, Color(255, 0));
+
+		m_pages.push_back(std::move(page));
+
+		Siv3DEngine::GetProfiler()->reportFontAtlasPageCreation(pageBytes());
+
+		LOG_DEBUG(U"ℹ️ Created glyph atlas page #{0} (size: {1}x{1})"_fmt(m_pages.size() - 1, m_pageSize));
+	}
+
+	Optional<std::pair<uint32, uint32>> GlyphAtlas::findShelf(const int32 width, const int32 height) const
+	{
+		Optional<std::pair<uint32, uint32>> result;
+		int32 bestWaste = INT32_MAX;
+
+		for (uint32 pageIndex = 0; pageIndex < m_pages.size(); ++pageIndex)
+		{
+			const auto& shelves = m_pages[pageIndex].shelves;
+
+			for (uint32 shelfIndex = 0; shelfIndex < shelves.size(); ++shelfIndex)
+			{
+				const Shelf& shelf = shelves[shelfIndex];
+
+				if (shelf.height < height || (shelf.penX + width) > m_pageSize)
+				{
+					continue;
+				}
+
+				// 高さの無駄が最も少ない棚を選ぶ
+				if (const int32 waste = shelf.height - height; waste < bestWaste)
+				{
+					result.emplace(pageIndex, shelfIndex);
+
+					if (waste < ShelfHeightAlignment)
+					{
+						return result;
+					}
+
+					bestWaste = waste;
+				}
+			}
+		}
+
+		return result;
+	}
+
+	Optional<std::pair<uint32, uint32>> GlyphAtlas::addShelf(const int32 height)
+	{
+		const int32 shelfHeight = std::min(detail::AlignShelfHeight(height), m_pageSize);
+
+		for (uint32 pageIndex = 0; pageIndex < m_pages.size(); ++pageIndex)
+		{
+			Page& page = m_pages[pageIndex];
+
+			if ((page.nextShelfY + shelfHeight) > m_pageSize)
+			{
+				continue;
+			}
+
+			Shelf shelf;
+			shelf.y = page.nextShelfY;
+			shelf.height = shelfHeight;
+
+			page.shelves.push_back(std::move(shelf));
+
+			page.nextShelfY += shelfHeight;
+
+			return std::make_pair(pageIndex, static_cast<uint32>(page.shelves.size() - 1));
+		}
+
+		return none;
+	}
+
+	Optional<std::pair<uint32, uint32>> GlyphAtlas::evictShelf(const int32 height, const int32 frame, Array<GlyphID>& evicted)
+	{
+		Optional<std::pair<uint32, uint32>> result;
+		int32 oldestFrame = frame;
+		int32 bestHeight = INT32_MAX;
+
+		for (uint32 pageIndex = 0; pageIndex < m_pages.size(); ++pageIndex)
+		{
+			const auto& shelves = m_pages[pageIndex].shelves;
+
+			for (uint32 shelfIndex = 0; shelfIndex < shelves.size(); ++shelfIndex)
+			{
+				const Shelf& shelf = shelves[shelfIndex];
+
+				if (shelf.height < height || shelf.lastUsedFrame >= frame)
+				{
+					continue;
+				}
+
+				if (shelf.lastUsedFrame < oldestFrame
+					|| (shelf.lastUsedFrame == oldestFrame && shelf.height < bestHeight))
+				{
+					result.emplace(pageIndex, shelfIndex);
+					oldestFrame = shelf.lastUsedFrame;
+					bestHeight = shelf.height;
+				}
+			}
+		}
+
+		if (!result)
+		{
+			return none;
+		}
+
+		Shelf& shelf = m_pages[result->first].shelves[result->second];
+
+		evicted.append(shelf.glyphs);
+
+		shelf.glyphs.clear();
+
+		// 古いピクセルは、新しいグリフを配置するときにパディングを含めて上書きされる
+		shelf.penX = 0;
+
+		return result;
+	}
+
+	Optional<std::pair<uint32, uint32>> GlyphAtlas::evictPage(const int32 height, const int32 frame, Array<GlyphID>& evicted)
+	{
+		Optional<uint32> result;
+		int32 oldestFrame = frame;
+
+		for (uint32 pageIndex = 0; pageIndex < m_pages.size(); ++pageIndex)
+		{
+			if (m_pages[pageIndex].lastUsedFrame < oldestFrame)
+			{
+				result = pageIndex;
+				oldestFrame = m_pages[pageIndex].lastUsedFrame;
+			}
+		}
+
+		if (!result)
+		{
+			return none;
+		}
+
+		Page& page = m_pages[*result];
+
+		for (const auto& shelf : page.shelves)
+		{
+			evicted.append(shelf.glyphs);
+		}
+
+		page.shelves.clear();
+
+		page.nextShelfY = 0;
+
+		return addShelf(height);
+	}
+
+	GlyphAtlasLocation GlyphAtlas::place(const uint32 pageIndex, const uint32 shelfIndex, const Size& size, const GlyphID id, const int32 frame)
+	{
+		Page& page = m_pages[pageIndex];
+		Shelf& shelf = page.shelves[shelfIndex];
+
+		const int32 cellX = shelf.penX;
+		const int32 cellWidth = size.x + Padding * 2;
+
+		// 前に配置されていたグリフのピクセルが残らないよう、棚の高さ全体を透明にする
+		for (int32 y = shelf.y; y < (shelf.y + shelf.height); ++y)
+		{
+			Color* const pLine = page.image[y];
+
+			std::fill(pLine + cellX, pLine + cellX + cellWidth, Color(255, 0));
+		}
+
+		if (shelf.dirtyBegin == shelf.dirtyEnd)
+		{
+			shelf.dirtyBegin = cellX;
+			shelf.dirtyEnd = cellX + cellWidth;
+		}
+		else
+		{
+			shelf.dirtyBegin = std::min(shelf.dirtyBegin, cellX);
+			shelf.dirtyEnd = std::max(shelf.dirtyEnd, cellX + cellWidth);
+		}
+
+		shelf.penX += cellWidth;
+
+		shelf.glyphs.push_back(id);
+
+		GlyphAtlasLocation location;
+		location.page = pageIndex;
+		location.shelf = shelfIndex;
+		location.rect.set(cellX + Padding, shelf.y + Padding, size);
+
+		touch(pageIndex, shelfIndex, frame);
+
+		return location;
+	}
+}
@@ -0,0 +1,156 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Fwd.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/Optional.hpp>
+# include <Siv3D/Image.hpp>
+# include <Siv3D/DynamicTexture.hpp>
+
+namespace s3d
+{
+	// アトラス内のグリフの位置
+	struct GlyphAtlasLocation
+	{
+		uint32 page = 0;
+
+		uint32 shelf = 0;
+
+		// パディングを含まないグリフの領域
+		Rect rect = { 0,0,0,0 };
+	};
+
+	// 固定サイズのページに棚（shelf）詰めでグリフを配置するアトラス
+	//
+	// ページがいっぱいになると、現在のフレームで使われていない棚のうち、
+	// 最も長い間使われていないものから順にグリフを追い出して再利用する。
+	// 画像の変更は棚ごとの範囲として記録し、upload() で変更された範囲だけをテクスチャに転送する。
+	class GlyphAtlas
+	{
+	public:
+
+		using GlyphID = uint32;
+
+		// グリフの周囲に確保する透明な余白（バイリニアフィルタで隣のグリフがにじまないようにする）
+		static constexpr int32 Padding = 2;
+
+		// 棚の高さの単位。近い高さのグリフが同じ棚を共有できるようにする
+		static constexpr int32 ShelfHeightAlignment = 4;
+
+	private:
+
+		struct Shelf
+		{
+			int32 y = 0;
+
+			int32 height = 0;
+
+			int32 penX = 0;
+
+			int32 lastUsedFrame = -1;
+
+			// まだテクスチャに転送していない範囲 [dirtyBegin, dirtyEnd)
+			int32 dirtyBegin = 0;
+
+			int32 dirtyEnd = 0;
+
+			Array<GlyphID> glyphs;
+		};
+
+		struct Page
+		{
+			Image image;
+
+			DynamicTexture texture;
+
+			Array<Shelf> shelves;
+
+			int32 nextShelfY = 0;
+
+			int32 lastUsedFrame = -1;
+		};
+
+		Array<Page> m_pages;
+
+		int32 m_pageSize = 0;
+
+		size_t m_maxPages = 0;
+
+		TextureDesc m_desc = TextureDesc::Unmipped;
+
+		bool m_overBudgetReported = false;
+
+		size_t pageBytes() const noexcept;
+
+		void addPage();
+
+		Optional<std::pair<uint32, uint32>> findShelf(int32 width, int32 height) const;
+
+		Optional<std::pair<uint32, uint32>> addShelf(int32 height);
+
+		Optional<std::pair<uint32, uint32>> evictShelf(int32 height, int32 frame, Array<GlyphID>& evicted);
+
+		Optional<std::pair<uint32, uint32>> evictPage(int32 height, int32 frame, Array<GlyphID>& evicted);
+
+		GlyphAtlasLocation place(uint32 pageIndex, uint32 shelfIndex, const Size& size, GlyphID id, int32 frame);
+
+	public:
+
+		GlyphAtlas() = default;
+
+		~GlyphAtlas();
+
+		GlyphAtlas(const GlyphAtlas&) = delete;
+
+		GlyphAtlas& operator =(const GlyphAtlas&) = delete;
+
+		// pageSize x pageSize のページを、追い出しを始めるまでに最大 maxPages 枚使う
+		// ページのテクスチャは desc で作成する（SDF フォントでは TextureDesc::SDF）
+		void init(int32 pageSize, size_t maxPages, TextureDesc desc = TextureDesc::Unmipped);
+
+		[[nodiscard]] int32 pageSize() const noexcept
+		{
+			return m_pageSize;
+		}
+
+		[[nodiscard]] size_t num_pages() const noexcept
+		{
+			return m_pages.size();
+		}
+
+		// size の大きさのグリフの領域を確保する。
+		// 領域を空けるために追い出したグリフは evicted に追加される。
+		// 確保した領域はパディングを含めて透明で初期化され、image() に書き込んだ内容が次の upload() で転送される。
+		Optional<GlyphAtlasLocation> allocate(const Size& size, GlyphID id, int32 frame, Array<GlyphID>& evicted);
+
+		// グリフが frame で使われたことを記録する。同じフレームで使われたグリフは追い出されない
+		void touch(const uint32 page, const uint32 shelf, const int32 frame) noexcept
+		{
+			m_pages[page].shelves[shelf].lastUsedFrame = frame;
+
+			m_pages[page].lastUsedFrame = frame;
+		}
+
+		[[nodiscard]] Image& image(uint32 page)
+		{
+			return m_pages[page].image;
+		}
+
+		[[nodiscard]] const DynamicTexture& texture(uint32 page) const
+		{
+			return m_pages[page].texture;
+		}
+
+		// 変更された範囲をテクスチャに転送する
+		void upload();
+	};
+}
@@ -25,9 +25,9 @@ namespace s3d
 
 		virtual bool init() = 0;
 
-		virtual FontID create(Typeface typeface, int32 fontSize, FontStyle style) = 0;
+		virtual FontID create(Typeface typeface, int32 fontSize, FontStyle style, FontMethod method) = 0;
 
-		virtual FontID create(const FilePath& path, int32 fontSize, FontStyle style) = 0;
+		virtual FontID create(const FilePath& path, int32 fontSize, FontStyle style, FontMethod method) = 0;
 
 		virtual void release(FontID handleID) = 0;
 
@@ -37,6 +37,8 @@ namespace s3d
 
 		virtual int32 getFontSize(FontID handleID) = 0;
 
+		virtual FontMethod getMethod(FontID handleID) = 0;
+
 		virtual int32 getAscent(FontID handleID) = 0;
 
 		virtual int32 getDescent(FontID handleID) = 0;
@@ -55,12 +57,24 @@ namespace s3d
 
 		virtual RectF draw(FontID handleID, const String& codePoints, const Vec2& pos, const ColorF& color, double lineSpacingScale) = 0;
 
+		virtual RectF draw(FontID handleID, const String& codePoints, double fontSize, const Vec2& pos, const ColorF& color, double lineSpacingScale) = 0;
+
 		virtual bool draw(FontID handleID, const String& codePoints, const RectF& area, const ColorF& color, double lineSpacingScale) = 0;
 
 		virtual Rect paint(FontID handleID, Image& dst, const String& codePoints, const Point& pos, const Color& color, double lineSpacingScale) = 0;
 
 		virtual Rect overwrite(FontID handleID, Image& dst, const String& codePoints, const Point& pos, const Color& color, double lineSpacingScale) = 0;
 
+		virtual void setLayoutCacheBudget(FontID handleID, size_t bytes) = 0;
+
+		virtual size_t getLayoutCacheBytes(FontID handleID) = 0;
+
+		virtual void clearLayoutCache(FontID handleID) = 0;
+
+		virtual bool saveSDFAtlas(FontID handleID, const FilePath& path, const String& codePoints) = 0;
+
+		virtual bool loadSDFAtlas(FontID handleID, const FilePath& path) = 0;
+
 		virtual Image getColorEmoji(StringView emoji) = 0;
 
 		virtual Image getColorEmojiSilhouette(StringView emoji) = 0;
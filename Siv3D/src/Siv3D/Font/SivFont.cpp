@@ -37,13 +37,25 @@ namespace s3d
 	}
 
 	Font::Font(const int32 fontSize, const Typeface typeface, const FontStyle style)
-		: m_handle(std::make_shared<FontHandle>(Siv3DEngine::GetFont()->create(typeface, fontSize, style)))
+		: m_handle(std::make_shared<FontHandle>(Siv3DEngine::GetFont()->create(typeface, fontSize, style, FontMethod::Bitmap)))
 	{
 		ASSET_CREATION();
 	}
 
 	Font::Font(const int32 fontSize, const FilePath& path, const FontStyle style)
-		: m_handle(std::make_shared<FontHandle>(Siv3DEngine::GetFont()->create(path, fontSize, style)))
+		: m_handle(std::make_shared<FontHandle>(Siv3DEngine::GetFont()->create(path, fontSize, style, FontMethod::Bitmap)))
+	{
+		ASSET_CREATION();
+	}
+
+	Font::Font(const FontMethod method, const int32 fontSize, const Typeface typeface, const FontStyle style)
+		: m_handle(std::make_shared<FontHandle>(Siv3DEngine::GetFont()->create(typeface, fontSize, style, method)))
+	{
+		ASSET_CREATION();
+	}
+
+	Font::Font(const FontMethod method, const int32 fontSize, const FilePath& path, const FontStyle style)
+		: m_handle(std::make_shared<FontHandle>(Siv3DEngine::GetFont()->create(path, fontSize, style, method)))
 	{
 		ASSET_CREATION();
 	}
@@ -93,6 +105,11 @@ namespace s3d
 		return Siv3DEngine::GetFont()->getFontSize(m_handle->id());
 	}
 
+	FontMethod Font::method() const
+	{
+		return Siv3DEngine::GetFont()->getMethod(m_handle->id());
+	}
+
 	int32 Font::ascent() const
 	{
 		return Siv3DEngine::GetFont()->getAscent(m_handle->id());
@@ -128,6 +145,31 @@ namespace s3d
 		return Siv3DEngine::GetFont()->getOutlineGlyph(m_handle->id(), codePoint);
 	}
 
+	void Font::setLayoutCacheBudget(const size_t bytes) const
+	{
+		Siv3DEngine::GetFont()->setLayoutCacheBudget(m_handle->id(), bytes);
+	}
+
+	size_t Font::layoutCacheBytes() const
+	{
+		return Siv3DEngine::GetFont()->getLayoutCacheBytes(m_handle->id());
+	}
+
+	void Font::clearLayoutCache() const
+	{
+		Siv3DEngine::GetFont()->clearLayoutCache(m_handle->id());
+	}
+
+	bool Font::saveSDFAtlas(const FilePath& path, const String& text) const
+	{
+		return Siv3DEngine::GetFont()->saveSDFAtlas(m_handle->id(), path, text);
+	}
+
+	bool Font::loadSDFAtlas(const FilePath& path) const
+	{
+		return Siv3DEngine::GetFont()->loadSDFAtlas(m_handle->id(), path);
+	}
+
 	RectF DrawableText::boundingRect(const Vec2& pos) const
 	{
 		return Siv3DEngine::GetFont()->getBoundingRect(font.id(), text, 1.0).moveBy(pos);
@@ -143,6 +185,20 @@ namespace s3d
 		return Siv3DEngine::GetFont()->getRegion(font.id(), text, 1.0).moveBy(pos);
 	}
 
+	RectF DrawableText::region(const double fontSize, const Vec2& pos) const
+	{
+		const int32 baseSize = Siv3DEngine::GetFont()->getFontSize(font.id());
+
+		if (baseSize == 0)
+		{
+			return RectF(pos, 0);
+		}
+
+		const RectF rect = Siv3DEngine::GetFont()->getRegion(font.id(), text, 1.0);
+
+		return RectF(pos, rect.size * (fontSize / baseSize));
+	}
+
 	Array<int32> DrawableText::getXAdvances() const
 	{
 		return Siv3DEngine::GetFont()->getXAdvances(font.id(), text);
@@ -153,6 +209,11 @@ namespace s3d
 		return Siv3DEngine::GetFont()->draw(font.id(), text, pos, color, 1.0);
 	}
 
+	RectF DrawableText::draw(const double fontSize, const Vec2& pos, const ColorF& color) const
+	{
+		return Siv3DEngine::GetFont()->draw(font.id(), text, fontSize, pos, color, 1.0);
+	}
+
 	bool DrawableText::draw(const RectF& area, const ColorF& color) const
 	{
 		return Siv3DEngine::GetFont()->draw(font.id(), text, area, color, 1.0);
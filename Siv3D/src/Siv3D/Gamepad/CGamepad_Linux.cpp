@@ -14,6 +14,8 @@
 
 # include <GL/glew.h>
 # include "../../ThirdParty/GLFW/include/GLFW/glfw3.h"
+# include "../Siv3DEngine.hpp"
+# include "../Window/IWindow.hpp"
 # include "CGamepad_Linux.hpp"
 # include <Siv3D/Unicode.hpp>
 # include <Siv3D/Logger.hpp>
@@ -45,6 +47,8 @@ namespace s3d
 
 	bool CGamepad::init()
 	{
+		m_headless = !Siv3DEngine::GetWindow()->getHandle();
+
 		LOG_INFO(U"ℹ️ Gamepad initialized");
 
 		update(true);
@@ -54,6 +58,12 @@ namespace s3d
 
 	void CGamepad::update(const bool)
 	{
+		// ヘッドレスモード
+		if (m_headless)
+		{
+			return;
+		}
+
 		for (uint32 userIndex = 0; userIndex < Gamepad.MaxUserCount; ++userIndex)
 		{
 			auto& state = m_states[userIndex];
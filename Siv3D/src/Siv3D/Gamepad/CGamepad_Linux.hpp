@@ -62,6 +62,9 @@ namespace s3d
 
 		std::array<detail::Gamepad_impl, Gamepad.MaxUserCount> m_inputs;
 
+		// ヘッドレスモードでは GLFW が初期化されていないため、ゲームパッドを検出しない
+		bool m_headless = false;
+
 	public:
 
 		CGamepad();
@@ -210,6 +210,7 @@ namespace s3d
 # include <GL/glew.h>
 # include "../../ThirdParty/GLFW/include/GLFW/glfw3.h"
 # include <Siv3D/Unicode.hpp>
+# include "../Window/IWindow.hpp"
 
 extern "C" {
 GLFWAPI const char* siv3dGetJoystickInfo(int joy, unsigned* vendorID, unsigned* productID, unsigned* version);
@@ -222,6 +223,12 @@ namespace s3d
 		Array<GamepadInfo> EnumerateGamepads()
 		{
 			Array<GamepadInfo> results;
+
+			// ヘッドレスモードでは GLFW が初期化されていない
+			if (!Siv3DEngine::GetWindow()->getHandle())
+			{
+				return results;
+			}
 			
 			unsigned vendorID = 0, productID = 0, version = 0;
 			
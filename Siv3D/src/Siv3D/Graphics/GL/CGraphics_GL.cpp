@@ -21,6 +21,7 @@
 # include <Siv3D/Unicode.hpp>
 # include <Siv3D/System.hpp>
 # include <Siv3D/Time.hpp>
+# include <Siv3D/Logger.hpp>
 
 namespace s3d
 {
@@ -38,7 +39,16 @@ namespace s3d
 	{
 		m_glfwWindow = Siv3DEngine::GetWindow()->getHandle();
 		
-		::glfwSwapInterval(true);
+		if (m_glfwWindow)
+		{
+			::glfwSwapInterval(true);
+		}
+		else if (!m_headlessFramebuffer.init(m_currentRenderTargetSize))
+		{
+			LOG_FAIL(U"❌ CGraphics_GL: Failed to create a headless framebuffer");
+
+			return false;
+		}
 
 		//////////////////////////////////////////////////////
 		//
@@ -113,6 +123,12 @@ namespace s3d
 	Array<DisplayOutput> CGraphics_GL::enumOutputs()
 	{
 		Array<DisplayOutput> outputs;
+
+		// ヘッドレスモードでは GLFW が初期化されていない
+		if (!m_glfwWindow)
+		{
+			return outputs;
+		}
 		
 		int32 numMonitors;
 		GLFWmonitor** monitors = ::glfwGetMonitors(&numMonitors);
@@ -163,7 +179,14 @@ namespace s3d
 	
 	bool CGraphics_GL::setFullScreen(const bool fullScreen, const Size& size, const size_t displayIndex, const double refreshRateHz)
 	{
-		if (!fullScreen)
+		if (!m_glfwWindow)
+		{
+			// ヘッドレスモードではフルスクリーンを区別せず、描画先の大きさだけを変更する
+			m_headlessFramebuffer.resize(size);
+
+			Siv3DEngine::GetWindow()->updateClientSize(fullScreen, size);
+		}
+		else if (!fullScreen)
 		{
 			::glfwSetWindowMonitor(m_glfwWindow, nullptr, 0, 0, size.x, size.y, GLFW_DONT_CARE);
 			::glfwSetWindowSize(m_glfwWindow, size.x, size.y);
@@ -198,7 +221,25 @@ namespace s3d
 	{
 		const bool vSync = !m_targetFrameRateHz.has_value();
 		
-		if (vSync)
+		if (!m_glfwWindow)
+		{
+			// ヘッドレスモードでは、フレーム時間に GPU の処理時間が含まれるよう完了を待つ
+			::glFinish();
+			
+			if (!vSync)
+			{
+				const double targetRefreshPeriodMillisec = (1000.0 / m_targetFrameRateHz.value());
+				const double timeToSleepMillisec = targetRefreshPeriodMillisec - ((Time::GetMicrosec() / 1000.0) - m_lastFlipTimeMillisec);
+				
+				if (timeToSleepMillisec > 0.0)
+				{
+					::usleep(static_cast<uint32>(std::floor(timeToSleepMillisec) * 1000));
+				}
+				
+				m_lastFlipTimeMillisec = (Time::GetMicrosec() / 1000.0);
+			}
+		}
+		else if (vSync)
 		{
 			::glfwSwapBuffers(m_glfwWindow);
 			
@@ -242,7 +283,7 @@ namespace s3d
 		
 		if (m_screenCapture.isRequested())
 		{
-			m_screenCapture.capture(m_currentRenderTargetSize);
+			m_screenCapture.capture(m_currentRenderTargetSize, m_headlessFramebuffer.id());
 		}
 		
 		return true;
@@ -261,7 +302,7 @@ namespace s3d
 	
 	void CGraphics_GL::setTargetFrameRateHz(const Optional<double>& targetFrameRateHz)
 	{
-		if (m_targetFrameRateHz != targetFrameRateHz)
+		if (m_glfwWindow && (m_targetFrameRateHz != targetFrameRateHz))
 		{
 			::glfwSwapInterval(!targetFrameRateHz.has_value());
 		}
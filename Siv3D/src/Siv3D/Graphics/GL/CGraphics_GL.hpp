@@ -67,7 +67,8 @@ namespace s3d
 			return m_requested;
 		}
 		
-		void capture(const Size& size)
+		// sourceFramebuffer: 画面として使っているフレームバッファ（ウィンドウの場合は 0）
+		void capture(const Size& size, const GLuint sourceFramebuffer = 0)
 		{
 			m_requested = false;
 			
@@ -88,7 +89,7 @@ namespace s3d
 				m_image.resize(size);
 			}
 			
-			::glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+			::glBindFramebuffer(GL_READ_FRAMEBUFFER, sourceFramebuffer);
 			::glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_fbo);
 			
 			::glBlitFramebuffer(0, 0, size.x, size.y, 0, 0, size.x, size.y, GL_COLOR_BUFFER_BIT, GL_LINEAR);
@@ -98,7 +99,7 @@ namespace s3d
 
 			::glReadPixels(0, 0, size.x, size.y, GL_RGBA, GL_UNSIGNED_BYTE, m_image.data());
 			
-			::glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			::glBindFramebuffer(GL_FRAMEBUFFER, sourceFramebuffer);
 				
 			m_image.flip();
 		}
@@ -109,6 +110,59 @@ namespace s3d
 		}
 	};
 	
+	// ヘッドレスモードで、ウィンドウの代わりに描画先とするフレームバッファ
+	class HeadlessFramebuffer
+	{
+	private:
+
+		GLuint m_fbo = 0;
+
+		GLuint m_colorBuffer = 0;
+
+	public:
+
+		HeadlessFramebuffer() = default;
+
+		~HeadlessFramebuffer()
+		{
+			if (m_colorBuffer)
+			{
+				::glDeleteRenderbuffers(1, &m_colorBuffer);
+			}
+
+			if (m_fbo)
+			{
+				::glDeleteFramebuffers(1, &m_fbo);
+			}
+		}
+
+		bool init(const Size& size)
+		{
+			::glGenFramebuffers(1, &m_fbo);
+			::glGenRenderbuffers(1, &m_colorBuffer);
+
+			resize(size);
+
+			return (::glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE);
+		}
+
+		// フレームバッファの大きさを変更し、描画先としてバインドする
+		void resize(const Size& size)
+		{
+			::glBindRenderbuffer(GL_RENDERBUFFER, m_colorBuffer);
+			::glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, size.x, size.y);
+			::glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+			::glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+			::glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, m_colorBuffer);
+		}
+
+		GLuint id() const
+		{
+			return m_fbo;
+		}
+	};
+	
 	class CGraphics_GL : public ISiv3DGraphics
 	{
 	private:
@@ -138,6 +192,9 @@ namespace s3d
 		RenderTexture* m_unused = nullptr;
 		
 		ScreenCaptureManager m_screenCapture;
+
+		// ヘッドレスモード（m_glfwWindow が nullptr）の場合のみ使用
+		HeadlessFramebuffer m_headlessFramebuffer;
 		
 	public:
 
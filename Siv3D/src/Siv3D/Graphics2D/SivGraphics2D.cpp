@@ -103,5 +103,25 @@ namespace s3d
 		{
 			return Siv3DEngine::GetRenderer2D()->getMaxScaling();
 		}
+
+		void EnableInstancing(const bool enabled)
+		{
+			Siv3DEngine::GetRenderer2D()->setInstancingEnabled(enabled);
+		}
+
+		bool IsInstancingEnabled()
+		{
+			return Siv3DEngine::GetRenderer2D()->isInstancingEnabled();
+		}
+
+		void EnableDrawCallSorting(const bool enabled)
+		{
+			Siv3DEngine::GetRenderer2D()->setDrawCallSortingEnabled(enabled);
+		}
+
+		bool IsDrawCallSortingEnabled()
+		{
+			return Siv3DEngine::GetRenderer2D()->isDrawCallSortingEnabled();
+		}
 	}
 }
@@ -0,0 +1,855 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Color.hpp>
+# include <Siv3D/CPU.hpp>
+# include "PixelKernel.hpp"
+
+# if defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+	# define SIV3D_PIXELKERNEL_NEON
+	# include <arm_neon.h>
+
+# else
+
+	# include <immintrin.h>
+
+	# if defined(__GNUC__) || defined(__clang__)
+
+		# define SIV3D_TARGET_AVX2 __attribute__((target("avx2")))
+
+	# else
+
+		# define SIV3D_TARGET_AVX2
+
+	# endif
+
+# endif
+
+namespace s3d
+{
+	namespace detail
+	{
+		// グレースケール・セピア・二値化の係数
+		// 参照実装（Color::grayscale0_255(), Color::grayscale()）と同じ値・同じ演算順序で double で計算することで、SIMD 版でも結果が一致する
+		static constexpr double GrayR = 0.299, GrayG = 0.587, GrayB = 0.114;
+
+		static constexpr double GrayR255 = 0.299 / 255.0, GrayG255 = 0.587 / 255.0, GrayB255 = 0.114 / 255.0;
+
+		static constexpr uint32 RGBMask = 0x00FFffFF;
+
+		static constexpr uint32 AlphaMask = 0xFF000000;
+
+		inline uint32* AsUintPtr(Color* p)
+		{
+			return static_cast<uint32*>(static_cast<void*>(p));
+		}
+
+		struct SepiaLevel
+		{
+			double r, g, b;
+
+			explicit SepiaLevel(const int32 level)
+			{
+				const double levn = Clamp(level, 0, 255);
+				r = 0.956 * levn;
+				g = 0.274 * levn;
+				b = -1.108 * levn;
+			}
+		};
+
+		// 明るさの変化量（RGB の各バイトに加算・減算する値）, level は [-255, 255]
+		inline uint32 BrightenDelta(const int32 level)
+		{
+			const uint32 v = static_cast<uint32>(level < 0 ? -level : level);
+
+			return (v | (v << 8) | (v << 16));
+		}
+
+		//////////////////////////////////////////////////
+		//
+		//	Reference
+		//
+		//////////////////////////////////////////////////
+
+		static void NegateReference(Color* pixels, const size_t count)
+		{
+			for (Color* const pEnd = pixels + count; pixels != pEnd; ++pixels)
+			{
+				*pixels = ~*pixels;
+			}
+		}
+
+		static void GrayscaleReference(Color* pixels, const size_t count)
+		{
+			for (Color* const pEnd = pixels + count; pixels != pEnd; ++pixels)
+			{
+				pixels->r = pixels->g = pixels->b = pixels->grayscale0_255();
+			}
+		}
+
+		static void SepiaReference(Color* pixels, const size_t count, const SepiaLevel& lev)
+		{
+			for (Color* const pEnd = pixels + count; pixels != pEnd; ++pixels)
+			{
+				Color& pixel = *pixels;
+				const double y = (GrayR * pixel.r + GrayG * pixel.g + GrayB * pixel.b);
+				const double r = lev.r + y;
+				const double g = lev.g + y;
+				const double b = lev.b + y;
+				pixel.r = r >= 255.0 ? 255 : r <= 0.0 ? 0 : static_cast<uint8>(r);
+				pixel.g = g >= 255.0 ? 255 : g <= 0.0 ? 0 : static_cast<uint8>(g);
+				pixel.b = b >= 255.0 ? 255 : b <= 0.0 ? 0 : static_cast<uint8>(b);
+			}
+		}
+
+		static void BrightenReference(Color* pixels, const size_t count, const int32 level)
+		{
+			Color* const pEnd = pixels + count;
+
+			if (level < 0)
+			{
+				for (; pixels != pEnd; ++pixels)
+				{
+					pixels->r = std::max(static_cast<int32>(pixels->r) + level, 0);
+					pixels->g = std::max(static_cast<int32>(pixels->g) + level, 0);
+					pixels->b = std::max(static_cast<int32>(pixels->b) + level, 0);
+				}
+			}
+			else if (level > 0)
+			{
+				for (; pixels != pEnd; ++pixels)
+				{
+					pixels->r = std::min(static_cast<int32>(pixels->r) + level, 255);
+					pixels->g = std::min(static_cast<int32>(pixels->g) + level, 255);
+					pixels->b = std::min(static_cast<int32>(pixels->b) + level, 255);
+				}
+			}
+		}
+
+		static void ThresholdReference(Color* pixels, const size_t count, const uint8 threshold, const bool inverse)
+		{
+			const uint32 a = inverse ? 0 : RGBMask, b = inverse ? RGBMask : 0;
+
+			const double thresholdF = threshold / 255.0;
+
+			for (Color* const pEnd = pixels + count; pixels != pEnd; ++pixels)
+			{
+				*AsUintPtr(pixels) = (thresholdF < pixels->grayscale() ? a : b) | (pixels->a << 24);
+			}
+		}
+
+		static void SwapRBReference(Color* pixels, const size_t count)
+		{
+			for (Color* const pEnd = pixels + count; pixels != pEnd; ++pixels)
+			{
+				const uint8 t = pixels->r;
+				pixels->r = pixels->b;
+				pixels->b = t;
+			}
+		}
+
+	# if defined(SIV3D_PIXELKERNEL_NEON)
+
+		//////////////////////////////////////////////////
+		//
+		//	NEON
+		//
+		//////////////////////////////////////////////////
+
+		inline uint32x4_t LoadPixels4(const Color* p)
+		{
+			return ::vld1q_u32(static_cast<const uint32*>(static_cast<const void*>(p)));
+		}
+
+		inline void StorePixels4(Color* p, const uint32x4_t v)
+		{
+			::vst1q_u32(AsUintPtr(p), v);
+		}
+
+		static void NegateNEON(Color* pixels, const size_t count)
+		{
+			const size_t count4 = (count & ~size_t(3));
+			const uint32x4_t mask = ::vdupq_n_u32(RGBMask);
+
+			for (size_t i = 0; i < count4; i += 4)
+			{
+				StorePixels4(pixels + i, ::veorq_u32(LoadPixels4(pixels + i), mask));
+			}
+
+			NegateReference(pixels + count4, count - count4);
+		}
+
+		static void BrightenNEON(Color* pixels, const size_t count, const int32 level)
+		{
+			if (level == 0)
+			{
+				return;
+			}
+
+			const size_t count4 = (count & ~size_t(3));
+			const uint8x16_t delta = ::vreinterpretq_u8_u32(::vdupq_n_u32(BrightenDelta(level)));
+
+			for (size_t i = 0; i < count4; i += 4)
+			{
+				const uint8x16_t v = ::vreinterpretq_u8_u32(LoadPixels4(pixels + i));
+				const uint8x16_t result = (level < 0) ? ::vqsubq_u8(v, delta) : ::vqaddq_u8(v, delta);
+				StorePixels4(pixels + i, ::vreinterpretq_u32_u8(result));
+			}
+
+			BrightenReference(pixels + count4, count - count4, level);
+		}
+
+		static void SwapRBNEON(Color* pixels, const size_t count)
+		{
+			const size_t count16 = (count & ~size_t(15));
+
+			for (size_t i = 0; i < count16; i += 16)
+			{
+				uint8* p = static_cast<uint8*>(static_cast<void*>(pixels + i));
+				uint8x16x4_t v = ::vld4q_u8(p);
+				const uint8x16_t t = v.val[0];
+				v.val[0] = v.val[2];
+				v.val[2] = t;
+				::vst4q_u8(p, v);
+			}
+
+			SwapRBReference(pixels + count16, count - count16);
+		}
+
+		# if defined(__aarch64__)
+
+		// 4 画素の R, G, B を倍精度で取り出す
+		struct RGBF64x4
+		{
+			float64x2_t r[2], g[2], b[2];
+
+			explicit RGBF64x4(const uint32x4_t v)
+			{
+				const uint32x4_t mask = ::vdupq_n_u32(0xFF);
+				const uint32x4_t ri = ::vandq_u32(v, mask);
+				const uint32x4_t gi = ::vandq_u32(::vshrq_n_u32(v, 8), mask);
+				const uint32x4_t bi = ::vandq_u32(::vshrq_n_u32(v, 16), mask);
+				r[0] = ::vcvtq_f64_u64(::vmovl_u32(::vget_low_u32(ri)));
+				r[1] = ::vcvtq_f64_u64(::vmovl_u32(::vget_high_u32(ri)));
+				g[0] = ::vcvtq_f64_u64(::vmovl_u32(::vget_low_u32(gi)));
+				g[1] = ::vcvtq_f64_u64(::vmovl_u32(::vget_high_u32(gi)));
+				b[0] = ::vcvtq_f64_u64(::vmovl_u32(::vget_low_u32(bi)));
+				b[1] = ::vcvtq_f64_u64(::vmovl_u32(::vget_high_u32(bi)));
+			}
+
+			// (cr * r + cg * g) + cb * b（FMA を使わない）
+			float64x2_t dot(const size_t i, const float64x2_t cr, const float64x2_t cg, const float64x2_t cb) const
+			{
+				return ::vaddq_f64(::vaddq_f64(::vmulq_f64(cr, r[i]), ::vmulq_f64(cg, g[i])), ::vmulq_f64(cb, b[i]));
+			}
+		};
+
+		inline uint32x4_t TruncateToU32(const float64x2_t lo, const float64x2_t hi)
+		{
+			return ::vcombine_u32(::vmovn_u64(::vcvtq_u64_f64(lo)), ::vmovn_u64(::vcvtq_u64_f64(hi)));
+		}
+
+		inline float64x2_t Clamp0_255(const float64x2_t v)
+		{
+			return ::vminq_f64(::vmaxq_f64(v, ::vdupq_n_f64(0.0)), ::vdupq_n_f64(255.0));
+		}
+
+		static void GrayscaleNEON(Color* pixels, const size_t count)
+		{
+			const size_t count4 = (count & ~size_t(3));
+			const float64x2_t cr = ::vdupq_n_f64(GrayR), cg = ::vdupq_n_f64(GrayG), cb = ::vdupq_n_f64(GrayB);
+
+			for (size_t i = 0; i < count4; i += 4)
+			{
+				const uint32x4_t v = LoadPixels4(pixels + i);
+				const RGBF64x4 rgb(v);
+				const uint32x4_t y = TruncateToU32(rgb.dot(0, cr, cg, cb), rgb.dot(1, cr, cg, cb));
+				const uint32x4_t result = ::vorrq_u32(::vandq_u32(v, ::vdupq_n_u32(AlphaMask)),
+					::vorrq_u32(y, ::vorrq_u32(::vshlq_n_u32(y, 8), ::vshlq_n_u32(y, 16))));
+				StorePixels4(pixels + i, result);
+			}
+
+			GrayscaleReference(pixels + count4, count - count4);
+		}
+
+		static void SepiaNEON(Color* pixels, const size_t count, const SepiaLevel& lev)
+		{
+			const size_t count4 = (count & ~size_t(3));
+			const float64x2_t cr = ::vdupq_n_f64(GrayR), cg = ::vdupq_n_f64(GrayG), cb = ::vdupq_n_f64(GrayB);
+			const float64x2_t lr = ::vdupq_n_f64(lev.r), lg = ::vdupq_n_f64(lev.g), lb = ::vdupq_n_f64(lev.b);
+
+			for (size_t i = 0; i < count4; i += 4)
+			{
+				const uint32x4_t v = LoadPixels4(pixels + i);
+				const RGBF64x4 rgb(v);
+				const float64x2_t y0 = rgb.dot(0, cr, cg, cb), y1 = rgb.dot(1, cr, cg, cb);
+				const uint32x4_t r = TruncateToU32(Clamp0_255(::vaddq_f64(lr, y0)), Clamp0_255(::vaddq_f64(lr, y1)));
+				const uint32x4_t g = TruncateToU32(Clamp0_255(::vaddq_f64(lg, y0)), Clamp0_255(::vaddq_f64(lg, y1)));
+				const uint32x4_t b = TruncateToU32(Clamp0_255(::vaddq_f64(lb, y0)), Clamp0_255(::vaddq_f64(lb, y1)));
+				const uint32x4_t result = ::vorrq_u32(::vandq_u32(v, ::vdupq_n_u32(AlphaMask)),
+					::vorrq_u32(r, ::vorrq_u32(::vshlq_n_u32(g, 8), ::vshlq_n_u32(b, 16))));
+				StorePixels4(pixels + i, result);
+			}
+
+			SepiaReference(pixels + count4, count - count4, lev);
+		}
+
+		static void ThresholdNEON(Color* pixels, const size_t count, const uint8 threshold, const bool inverse)
+		{
+			const size_t count4 = (count & ~size_t(3));
+			const float64x2_t cr = ::vdupq_n_f64(GrayR255), cg = ::vdupq_n_f64(GrayG255), cb = ::vdupq_n_f64(GrayB255);
+			const float64x2_t thresholdF = ::vdupq_n_f64(threshold / 255.0);
+			const uint32x4_t a = ::vdupq_n_u32(inverse ? 0 : RGBMask), b = ::vdupq_n_u32(inverse ? RGBMask : 0);
+
+			for (size_t i = 0; i < count4; i += 4)
+			{
+				const uint32x4_t v = LoadPixels4(pixels + i);
+				const RGBF64x4 rgb(v);
+				const uint32x4_t mask = ::vcombine_u32(
+					::vmovn_u64(::vcltq_f64(thresholdF, rgb.dot(0, cr, cg, cb))),
+					::vmovn_u64(::vcltq_f64(thresholdF, rgb.dot(1, cr, cg, cb))));
+				const uint32x4_t result = ::vorrq_u32(::vbslq_u32(mask, a, b), ::vandq_u32(v, ::vdupq_n_u32(AlphaMask)));
+				StorePixels4(pixels + i, result);
+			}
+
+			ThresholdReference(pixels + count4, count - count4, threshold, inverse);
+		}
+
+		# endif
+
+	# else
+
+		//////////////////////////////////////////////////
+		//
+		//	SSE2
+		//
+		//////////////////////////////////////////////////
+
+		inline __m128i LoadPixels4(const Color* p)
+		{
+			return ::_mm_loadu_si128(static_cast<const __m128i*>(static_cast<const void*>(p)));
+		}
+
+		inline void StorePixels4(Color* p, const __m128i v)
+		{
+			::_mm_storeu_si128(static_cast<__m128i*>(static_cast<void*>(p)), v);
+		}
+
+		// 4 画素の R, G, B を倍精度で取り出す
+		struct RGBF64x4_SSE2
+		{
+			__m128d r[2], g[2], b[2];
+
+			explicit RGBF64x4_SSE2(const __m128i v)
+			{
+				const __m128i mask = ::_mm_set1_epi32(0xFF);
+				const __m128i ri = ::_mm_and_si128(v, mask);
+				const __m128i gi = ::_mm_and_si128(::_mm_srli_epi32(v, 8), mask);
+				const __m128i bi = ::_mm_and_si128(::_mm_srli_epi32(v, 16), mask);
+				r[0] = ::_mm_cvtepi32_pd(ri);
+				r[1] = ::_mm_cvtepi32_pd(_mm_srli_si128(ri, 8));
+				g[0] = ::_mm_cvtepi32_pd(gi);
+				g[1] = ::_mm_cvtepi32_pd(_mm_srli_si128(gi, 8));
+				b[0] = ::_mm_cvtepi32_pd(bi);
+				b[1] = ::_mm_cvtepi32_pd(_mm_srli_si128(bi, 8));
+			}
+
+			// (cr * r + cg * g) + cb * b
+			__m128d dot(const size_t i, const __m128d cr, const __m128d cg, const __m128d cb) const
+			{
+				return ::_mm_add_pd(::_mm_add_pd(::_mm_mul_pd(cr, r[i]), ::_mm_mul_pd(cg, g[i])), ::_mm_mul_pd(cb, b[i]));
+			}
+		};
+
+		inline __m128i TruncateToI32(const __m128d lo, const __m128d hi)
+		{
+			return ::_mm_unpacklo_epi64(::_mm_cvttpd_epi32(lo), ::_mm_cvttpd_epi32(hi));
+		}
+
+		inline __m128d Clamp0_255(const __m128d v)
+		{
+			return ::_mm_min_pd(::_mm_max_pd(v, ::_mm_setzero_pd()), ::_mm_set1_pd(255.0));
+		}
+
+		// 各 32-bit レーンの下位 8-bit を R, G, B に複製し、元の A と合成する
+		inline __m128i MergeGray(const __m128i v, const __m128i y)
+		{
+			return ::_mm_or_si128(::_mm_and_si128(v, ::_mm_set1_epi32(AlphaMask)),
+				::_mm_or_si128(y, ::_mm_or_si128(::_mm_slli_epi32(y, 8), ::_mm_slli_epi32(y, 16))));
+		}
+
+		static void NegateSSE2(Color* pixels, const size_t count)
+		{
+			const size_t count4 = (count & ~size_t(3));
+			const __m128i mask = ::_mm_set1_epi32(RGBMask);
+
+			for (size_t i = 0; i < count4; i += 4)
+			{
+				StorePixels4(pixels + i, ::_mm_xor_si128(LoadPixels4(pixels + i), mask));
+			}
+
+			NegateReference(pixels + count4, count - count4);
+		}
+
+		static void GrayscaleSSE2(Color* pixels, const size_t count)
+		{
+			const size_t count4 = (count & ~size_t(3));
+			const __m128d cr = ::_mm_set1_pd(GrayR), cg = ::_mm_set1_pd(GrayG), cb = ::_mm_set1_pd(GrayB);
+
+			for (size_t i = 0; i < count4; i += 4)
+			{
+				const __m128i v = LoadPixels4(pixels + i);
+				const RGBF64x4_SSE2 rgb(v);
+				const __m128i y = TruncateToI32(rgb.dot(0, cr, cg, cb), rgb.dot(1, cr, cg, cb));
+				StorePixels4(pixels + i, MergeGray(v, y));
+			}
+
+			GrayscaleReference(pixels + count4, count - count4);
+		}
+
+		static void SepiaSSE2(Color* pixels, const size_t count, const SepiaLevel& lev)
+		{
+			const size_t count4 = (count & ~size_t(3));
+			const __m128d cr = ::_mm_set1_pd(GrayR), cg = ::_mm_set1_pd(GrayG), cb = ::_mm_set1_pd(GrayB);
+			const __m128d lr = ::_mm_set1_pd(lev.r), lg = ::_mm_set1_pd(lev.g), lb = ::_mm_set1_pd(lev.b);
+			const __m128i alphaMask = ::_mm_set1_epi32(AlphaMask);
+
+			for (size_t i = 0; i < count4; i += 4)
+			{
+				const __m128i v = LoadPixels4(pixels + i);
+				const RGBF64x4_SSE2 rgb(v);
+				const __m128d y0 = rgb.dot(0, cr, cg, cb), y1 = rgb.dot(1, cr, cg, cb);
+				const __m128i r = TruncateToI32(Clamp0_255(::_mm_add_pd(lr, y0)), Clamp0_255(::_mm_add_pd(lr, y1)));
+				const __m128i g = TruncateToI32(Clamp0_255(::_mm_add_pd(lg, y0)), Clamp0_255(::_mm_add_pd(lg, y1)));
+				const __m128i b = TruncateToI32(Clamp0_255(::_mm_add_pd(lb, y0)), Clamp0_255(::_mm_add_pd(lb, y1)));
+				const __m128i result = ::_mm_or_si128(::_mm_and_si128(v, alphaMask),
+					::_mm_or_si128(r, ::_mm_or_si128(::_mm_slli_epi32(g, 8), ::_mm_slli_epi32(b, 16))));
+				StorePixels4(pixels + i, result);
+			}
+
+			SepiaReference(pixels + count4, count - count4, lev);
+		}
+
+		static void BrightenSSE2(Color* pixels, const size_t count, const int32 level)
+		{
+			if (level == 0)
+			{
+				return;
+			}
+
+			const size_t count4 = (count & ~size_t(3));
+			const __m128i delta = ::_mm_set1_epi32(BrightenDelta(level));
+
+			if (level < 0)
+			{
+				for (size_t i = 0; i < count4; i += 4)
+				{
+					StorePixels4(pixels + i, ::_mm_subs_epu8(LoadPixels4(pixels + i), delta));
+				}
+			}
+			else
+			{
+				for (size_t i = 0; i < count4; i += 4)
+				{
+					StorePixels4(pixels + i, ::_mm_adds_epu8(LoadPixels4(pixels + i), delta));
+				}
+			}
+
+			BrightenReference(pixels + count4, count - count4, level);
+		}
+
+		static void ThresholdSSE2(Color* pixels, const size_t count, const uint8 threshold, const bool inverse)
+		{
+			const size_t count4 = (count & ~size_t(3));
+			const __m128d cr = ::_mm_set1_pd(GrayR255), cg = ::_mm_set1_pd(GrayG255), cb = ::_mm_set1_pd(GrayB255);
+			const __m128d thresholdF = ::_mm_set1_pd(threshold / 255.0);
+			const __m128i a = ::_mm_set1_epi32(inverse ? 0 : RGBMask), b = ::_mm_set1_epi32(inverse ? RGBMask : 0);
+			const __m128i alphaMask = ::_mm_set1_epi32(AlphaMask);
+
+			for (size_t i = 0; i < count4; i += 4)
+			{
+				const __m128i v = LoadPixels4(pixels + i);
+				const RGBF64x4_SSE2 rgb(v);
+
+				// 64-bit のマスク 2 つ × 2 を 32-bit のマスク 4 つに詰める
+				const __m128i mask = ::_mm_packs_epi32(
+					::_mm_castpd_si128(::_mm_cmplt_pd(thresholdF, rgb.dot(0, cr, cg, cb))),
+					::_mm_castpd_si128(::_mm_cmplt_pd(thresholdF, rgb.dot(1, cr, cg, cb))));
+				const __m128i rgb_ = ::_mm_or_si128(::_mm_and_si128(mask, a), ::_mm_andnot_si128(mask, b));
+				StorePixels4(pixels + i, ::_mm_or_si128(rgb_, ::_mm_and_si128(v, alphaMask)));
+			}
+
+			ThresholdReference(pixels + count4, count - count4, threshold, inverse);
+		}
+
+		static void SwapRBSSE2(Color* pixels, const size_t count)
+		{
+			const size_t count4 = (count & ~size_t(3));
+			const __m128i gaMask = ::_mm_set1_epi32(0xFF00FF00);
+			const __m128i lowMask = ::_mm_set1_epi32(0xFF);
+
+			for (size_t i = 0; i < count4; i += 4)
+			{
+				const __m128i v = LoadPixels4(pixels + i);
+				const __m128i r = ::_mm_slli_epi32(::_mm_and_si128(v, lowMask), 16);
+				const __m128i b = ::_mm_and_si128(::_mm_srli_epi32(v, 16), lowMask);
+				StorePixels4(pixels + i, ::_mm_or_si128(::_mm_and_si128(v, gaMask), ::_mm_or_si128(r, b)));
+			}
+
+			SwapRBReference(pixels + count4, count - count4);
+		}
+
+		//////////////////////////////////////////////////
+		//
+		//	AVX2
+		//
+		//////////////////////////////////////////////////
+
+		SIV3D_TARGET_AVX2
+		inline __m256i LoadPixels8(const Color* p)
+		{
+			return ::_mm256_loadu_si256(static_cast<const __m256i*>(static_cast<const void*>(p)));
+		}
+
+		SIV3D_TARGET_AVX2
+		inline void StorePixels8(Color* p, const __m256i v)
+		{
+			::_mm256_storeu_si256(static_cast<__m256i*>(static_cast<void*>(p)), v);
+		}
+
+		// 4 画素分の (cr * r + cg * g) + cb * b
+		SIV3D_TARGET_AVX2
+		inline __m256d Dot4(const __m128i v, const __m256d cr, const __m256d cg, const __m256d cb)
+		{
+			const __m128i mask = ::_mm_set1_epi32(0xFF);
+			const __m256d r = ::_mm256_cvtepi32_pd(::_mm_and_si128(v, mask));
+			const __m256d g = ::_mm256_cvtepi32_pd(::_mm_and_si128(::_mm_srli_epi32(v, 8), mask));
+			const __m256d b = ::_mm256_cvtepi32_pd(::_mm_and_si128(::_mm_srli_epi32(v, 16), mask));
+			return ::_mm256_add_pd(::_mm256_add_pd(::_mm256_mul_pd(cr, r), ::_mm256_mul_pd(cg, g)), ::_mm256_mul_pd(cb, b));
+		}
+
+		SIV3D_TARGET_AVX2
+		inline __m128i Clamp0_255ToI32(const __m256d v)
+		{
+			return ::_mm256_cvttpd_epi32(::_mm256_min_pd(::_mm256_max_pd(v, ::_mm256_setzero_pd()), ::_mm256_set1_pd(255.0)));
+		}
+
+		SIV3D_TARGET_AVX2
+		static void NegateAVX2(Color* pixels, const size_t count)
+		{
+			const size_t count8 = (count & ~size_t(7));
+			const __m256i mask = ::_mm256_set1_epi32(RGBMask);
+
+			for (size_t i = 0; i < count8; i += 8)
+			{
+				StorePixels8(pixels + i, ::_mm256_xor_si256(LoadPixels8(pixels + i), mask));
+			}
+
+			NegateReference(pixels + count8, count - count8);
+		}
+
+		SIV3D_TARGET_AVX2
+		static void GrayscaleAVX2(Color* pixels, const size_t count)
+		{
+			const size_t count4 = (count & ~size_t(3));
+			const __m256d cr = ::_mm256_set1_pd(GrayR), cg = ::_mm256_set1_pd(GrayG), cb = ::_mm256_set1_pd(GrayB);
+
+			for (size_t i = 0; i < count4; i += 4)
+			{
+				const __m128i v = LoadPixels4(pixels + i);
+				const __m128i y = ::_mm256_cvttpd_epi32(Dot4(v, cr, cg, cb));
+				StorePixels4(pixels + i, MergeGray(v, y));
+			}
+
+			GrayscaleReference(pixels + count4, count - count4);
+		}
+
+		SIV3D_TARGET_AVX2
+		static void SepiaAVX2(Color* pixels, const size_t count, const SepiaLevel& lev)
+		{
+			const size_t count4 = (count & ~size_t(3));
+			const __m256d cr = ::_mm256_set1_pd(GrayR), cg = ::_mm256_set1_pd(GrayG), cb = ::_mm256_set1_pd(GrayB);
+			const __m256d lr = ::_mm256_set1_pd(lev.r), lg = ::_mm256_set1_pd(lev.g), lb = ::_mm256_set1_pd(lev.b);
+			const __m128i alphaMask = ::_mm_set1_epi32(AlphaMask);
+
+			for (size_t i = 0; i < count4; i += 4)
+			{
+				const __m128i v = LoadPixels4(pixels + i);
+				const __m256d y = Dot4(v, cr, cg, cb);
+				const __m128i r = Clamp0_255ToI32(::_mm256_add_pd(lr, y));
+				const __m128i g = Clamp0_255ToI32(::_mm256_add_pd(lg, y));
+				const __m128i b = Clamp0_255ToI32(::_mm256_add_pd(lb, y));
+				const __m128i result = ::_mm_or_si128(::_mm_and_si128(v, alphaMask),
+					::_mm_or_si128(r, ::_mm_or_si128(::_mm_slli_epi32(g, 8), ::_mm_slli_epi32(b, 16))));
+				StorePixels4(pixels + i, result);
+			}
+
+			SepiaReference(pixels + count4, count - count4, lev);
+		}
+
+		SIV3D_TARGET_AVX2
+		static void BrightenAVX2(Color* pixels, const size_t count, const int32 level)
+		{
+			if (level == 0)
+			{
+				return;
+			}
+
+			const size_t count8 = (count & ~size_t(7));
+			const __m256i delta = ::_mm256_set1_epi32(BrightenDelta(level));
+
+			if (level < 0)
+			{
+				for (size_t i = 0; i < count8; i += 8)
+				{
+					StorePixels8(pixels + i, ::_mm256_subs_epu8(LoadPixels8(pixels + i), delta));
+				}
+			}
+			else
+			{
+				for (size_t i = 0; i < count8; i += 8)
+				{
+					StorePixels8(pixels + i, ::_mm256_adds_epu8(LoadPixels8(pixels + i), delta));
+				}
+			}
+
+			BrightenReference(pixels + count8, count - count8, level);
+		}
+
+		SIV3D_TARGET_AVX2
+		static void ThresholdAVX2(Color* pixels, const size_t count, const uint8 threshold, const bool inverse)
+		{
+			const size_t count4 = (count & ~size_t(3));
+			const __m256d cr = ::_mm256_set1_pd(GrayR255), cg = ::_mm256_set1_pd(GrayG255), cb = ::_mm256_set1_pd(GrayB255);
+			const __m256d thresholdF = ::_mm256_set1_pd(threshold / 255.0);
+			const __m128i a = ::_mm_set1_epi32(inverse ? 0 : RGBMask), b = ::_mm_set1_epi32(inverse ? RGBMask : 0);
+			const __m128i alphaMask = ::_mm_set1_epi32(AlphaMask);
+
+			for (size_t i = 0; i < count4; i += 4)
+			{
+				const __m128i v = LoadPixels4(pixels + i);
+				const __m256i mask64 = ::_mm256_castpd_si256(_mm256_cmp_pd(thresholdF, Dot4(v, cr, cg, cb), _CMP_LT_OQ));
+				const __m128i mask = ::_mm_packs_epi32(::_mm256_castsi256_si128(mask64), _mm256_extracti128_si256(mask64, 1));
+				const __m128i rgb = ::_mm_or_si128(::_mm_and_si128(mask, a), ::_mm_andnot_si128(mask, b));
+				StorePixels4(pixels + i, ::_mm_or_si128(rgb, ::_mm_and_si128(v, alphaMask)));
+			}
+
+			ThresholdReference(pixels + count4, count - count4, threshold, inverse);
+		}
+
+		SIV3D_TARGET_AVX2
+		static void SwapRBAVX2(Color* pixels, const size_t count)
+		{
+			const size_t count8 = (count & ~size_t(7));
+			const __m256i shuffle = ::_mm256_setr_epi8(
+				2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+				2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+			for (size_t i = 0; i < count8; i += 8)
+			{
+				StorePixels8(pixels + i, ::_mm256_shuffle_epi8(LoadPixels8(pixels + i), shuffle));
+			}
+
+			SwapRBReference(pixels + count8, count - count8);
+		}
+
+	# endif
+	}
+
+	namespace PixelKernel
+	{
+	# if defined(SIV3D_PIXELKERNEL_NEON)
+
+		void Negate(Color* pixels, const size_t count)
+		{
+			detail::NegateNEON(pixels, count);
+		}
+
+		void Grayscale(Color* pixels, const size_t count)
+		{
+		# if defined(__aarch64__)
+			detail::GrayscaleNEON(pixels, count);
+		# else
+			detail::GrayscaleReference(pixels, count);
+		# endif
+		}
+
+		void Sepia(Color* pixels, const size_t count, const int32 level)
+		{
+		# if defined(__aarch64__)
+			detail::SepiaNEON(pixels, count, detail::SepiaLevel(level));
+		# else
+			detail::SepiaReference(pixels, count, detail::SepiaLevel(level));
+		# endif
+		}
+
+		void Brighten(Color* pixels, const size_t count, int32 level)
+		{
+			// ±255 を超える値は結果が変わらないので丸める（int32 のオーバーフローも防ぐ）
+			level = Clamp(level, -255, 255);
+
+			detail::BrightenNEON(pixels, count, level);
+		}
+
+		void Threshold(Color* pixels, const size_t count, const uint8 threshold, const bool inverse)
+		{
+		# if defined(__aarch64__)
+			detail::ThresholdNEON(pixels, count, threshold, inverse);
+		# else
+			detail::ThresholdReference(pixels, count, threshold, inverse);
+		# endif
+		}
+
+		void SwapRB(Color* pixels, const size_t count)
+		{
+			detail::SwapRBNEON(pixels, count);
+		}
+
+	# else
+
+		void Negate(Color* pixels, const size_t count)
+		{
+			const CPUFeature& cpu = CPU::GetFeature();
+
+			if (cpu.AVX2)
+			{
+				detail::NegateAVX2(pixels, count);
+			}
+			else if (cpu.SSE2)
+			{
+				detail::NegateSSE2(pixels, count);
+			}
+			else
+			{
+				detail::NegateReference(pixels, count);
+			}
+		}
+
+		void Grayscale(Color* pixels, const size_t count)
+		{
+			const CPUFeature& cpu = CPU::GetFeature();
+
+			if (cpu.AVX2)
+			{
+				detail::GrayscaleAVX2(pixels, count);
+			}
+			else if (cpu.SSE2)
+			{
+				detail::GrayscaleSSE2(pixels, count);
+			}
+			else
+			{
+				detail::GrayscaleReference(pixels, count);
+			}
+		}
+
+		void Sepia(Color* pixels, const size_t count, const int32 level)
+		{
+			const CPUFeature& cpu = CPU::GetFeature();
+			const detail::SepiaLevel lev(level);
+
+			if (cpu.AVX2)
+			{
+				detail::SepiaAVX2(pixels, count, lev);
+			}
+			else if (cpu.SSE2)
+			{
+				detail::SepiaSSE2(pixels, count, lev);
+			}
+			else
+			{
+				detail::SepiaReference(pixels, count, lev);
+			}
+		}
+
+		void Brighten(Color* pixels, const size_t count, int32 level)
+		{
+			// ±255 を超える値は結果が変わらないので丸める（int32 のオーバーフローも防ぐ）
+			level = Clamp(level, -255, 255);
+
+			const CPUFeature& cpu = CPU::GetFeature();
+
+			if (cpu.AVX2)
+			{
+				detail::BrightenAVX2(pixels, count, level);
+			}
+			else if (cpu.SSE2)
+			{
+				detail::BrightenSSE2(pixels, count, level);
+			}
+			else
+			{
+				detail::BrightenReference(pixels, count, level);
+			}
+		}
+
+		void Threshold(Color* pixels, const size_t count, const uint8 threshold, const bool inverse)
+		{
+			const CPUFeature& cpu = CPU::GetFeature();
+
+			if (cpu.AVX2)
+			{
+				detail::ThresholdAVX2(pixels, count, threshold, inverse);
+			}
+			else if (cpu.SSE2)
+			{
+				detail::ThresholdSSE2(pixels, count, threshold, inverse);
+			}
+			else
+			{
+				detail::ThresholdReference(pixels, count, threshold, inverse);
+			}
+		}
+
+		void SwapRB(Color* pixels, const size_t count)
+		{
+			const CPUFeature& cpu = CPU::GetFeature();
+
+			if (cpu.AVX2)
+			{
+				detail::SwapRBAVX2(pixels, count);
+			}
+			else if (cpu.SSE2)
+			{
+				detail::SwapRBSSE2(pixels, count);
+			}
+			else
+			{
+				detail::SwapRBReference(pixels, count);
+			}
+		}
+
+	# endif
+
+		void ApplyTable(Color* pixels, const size_t count, const uint8 table[256])
+		{
+			// 256 要素のテーブル引きは SIMD の gather より、
+			// チャンネルごとのビット位置に合わせた 32-bit テーブルを OR で合成するほうが速い
+			uint32 tableR[256], tableG[256], tableB[256];
+
+			for (size_t i = 0; i < 256; ++i)
+			{
+				tableR[i] = table[i];
+				tableG[i] = (table[i] << 8);
+				tableB[i] = (table[i] << 16);
+			}
+
+			uint32* p = detail::AsUintPtr(pixels);
+
+			for (uint32* const pEnd = p + count; p != pEnd; ++p)
+			{
+				const uint32 c = *p;
+				*p = (c & detail::AlphaMask) | tableR[c & 0xFF] | tableG[(c >> 8) & 0xFF] | tableB[(c >> 16) & 0xFF];
+			}
+		}
+	}
+}
@@ -0,0 +1,36 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Fwd.hpp>
+
+namespace s3d
+{
+	// 画素ごとの Image 処理
+	// CPU::GetFeature() に応じて AVX2 / SSE2 / NEON / 参照実装 を選択する。
+	// どの実装も参照実装とビット単位で同じ結果を返す。
+	namespace PixelKernel
+	{
+		void Negate(Color* pixels, size_t count);
+
+		void Grayscale(Color* pixels, size_t count);
+
+		void Sepia(Color* pixels, size_t count, int32 level);
+
+		void ApplyTable(Color* pixels, size_t count, const uint8 table[256]);
+
+		void Brighten(Color* pixels, size_t count, int32 level);
+
+		void Threshold(Color* pixels, size_t count, uint8 threshold, bool inverse);
+
+		void SwapRB(Color* pixels, size_t count);
+	}
+}
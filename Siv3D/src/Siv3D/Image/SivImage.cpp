@@ -12,12 +12,16 @@
 # include "../Siv3DEngine.hpp"
 # include "../ImageFormat/IImageFormat.hpp"
 # include "../ObjectDetection/IObjectDetection.hpp"
+# include "PixelKernel.hpp"
 
+# include <atomic>
+# include <numeric>
 # include <opencv2/imgproc.hpp>
 # include <opencv2/photo.hpp>
 # include <Siv3D/Image.hpp>
 # include <Siv3D/OpenCV_Bridge.hpp>
 # include <Siv3D/ImageRegion.hpp>
+# include <Siv3D/ImageView.hpp>
 # include <Siv3D/ImageProcessing.hpp>
 # include <Siv3D/BinaryWriter.hpp>
 # include <Siv3D/MemoryWriter.hpp>
@@ -26,6 +30,7 @@
 # include <Siv3D/Emoji.hpp>
 # include <Siv3D/Icon.hpp>
 # include <Siv3D/Dialog.hpp>
+# include <Siv3D/Threading.hpp>
 
 namespace s3d
 {
@@ -53,17 +58,6 @@ namespace s3d
 			}
 		}
 
-		static void MakeSepia(const double levr, const double levg, const double levb, Color& pixel)
-		{
-			const double y = (0.299 * pixel.r + 0.587 * pixel.g + 0.114 * pixel.b);
-			const double r = levr + y;
-			const double g = levg + y;
-			const double b = levb + y;
-			pixel.r = r >= 255.0 ? 255 : r <= 0.0 ? 0 : static_cast<uint8>(r);
-			pixel.g = g >= 255.0 ? 255 : g <= 0.0 ? 0 : static_cast<uint8>(g);
-			pixel.b = b >= 255.0 ? 255 : b <= 0.0 ? 0 : static_cast<uint8>(b);
-		}
-
 		static void SetupPostarizeTable(const int32 level, uint8 table[256])
 		{
 			const int32 levN = Clamp(level, 2, 256) - 1;
@@ -84,7 +78,7 @@ namespace s3d
 			}
 		}
 
-		static Color GetAverage(const Image& src, const Rect& rect)
+		static Color GetAverage(const ImageConstView& src, const Rect& rect)
 		{
 			const int32 count = rect.area();
 
@@ -95,15 +89,12 @@ namespace s3d
 
 			int32 sumR = 0, sumG = 0, sumB = 0, sumA = 0;
 
-			const size_t imgWidth = src.width();
 			const int32 height = rect.h;
 			const int32 width = rect.w;
 
-			const Color* pLine = &src[rect.y][rect.x];
-
 			for (int32 y = 0; y < height; ++y)
 			{
-				const Color* pDst = pLine;
+				const Color* pDst = &src[rect.y + y][rect.x];
 
 				for (int32 x = 0; x < width; ++x)
 				{
@@ -113,31 +104,325 @@ namespace s3d
 					sumA += pDst->a;
 					++pDst;
 				}
-
-				pLine += imgWidth;
 			}
 
 			return Color(sumR / count, sumG / count, sumB / count, sumA / count);
 		}
 
-		static void FillRect(Image& dst, const Rect& rect, const Color& color)
+		static void FillRect(const ImageView& dst, const Rect& rect, const Color& color)
 		{
-			const size_t imgWidth = dst.width();
-			const int32 height = rect.h;
-			const int32 width = rect.w;
+			dst(rect).fill(color);
+		}
 
-			Color* pLine = &dst[rect.y][rect.x];
+		static std::atomic<ImageExecution> g_defaultExecution = { ImageExecution::Sequential };
 
-			for (int32 y = 0; y < height; ++y)
+		// これより小さな画像は、帯に分割するコストに見合わないので並列化しない
+		static constexpr size_t MinParallelPixels = (128 * 128);
+
+		static bool IsParallel(ImageExecution execution, const size_t numPixels)
+		{
+			if (execution == ImageExecution::Default)
+			{
+				execution = g_defaultExecution.load(std::memory_order_relaxed);
+			}
+
+			return (execution == ImageExecution::Parallel)
+				&& (MinParallelPixels <= numPixels)
+				&& (1 < Threading::GetConcurrency());
+		}
+
+		static size_t GetBandCount(const size_t unitCount, const size_t minUnitsPerBand)
+		{
+			return Clamp<size_t>(unitCount / std::max<size_t>(minUnitsPerBand, 1), 1, Threading::GetConcurrency() * 2);
+		}
+
+		// [0, unitCount) を帯に分割し、各帯 [beginUnit, endUnit) について f を呼ぶ
+		// parallel が true の場合はスレッドプールで並列に、false の場合は全体を 1 つの帯として処理する
+		template <class Fty>
+		static void ForEachBand(const bool parallel, const size_t unitCount, const size_t minUnitsPerBand, Fty f)
+		{
+			const size_t bandCount = parallel ? GetBandCount(unitCount, minUnitsPerBand) : 1;
+
+			if (bandCount == 1)
+			{
+				f(size_t(0), unitCount);
+
+				return;
+			}
+
+			Threading::ParallelFor(bandCount, [&](const size_t beginBand, const size_t endBand)
+			{
+				for (size_t i = beginBand; i < endBand; ++i)
+				{
+					f(unitCount * i / bandCount, unitCount * (i + 1) / bandCount);
+				}
+			});
+		}
+
+		inline cv::Mat_<cv::Vec4b> RowsToMat(const ImageConstView& image, const int32 beginY, const int32 endY)
+		{
+			return cv::Mat_<cv::Vec4b>(endY - beginY, image.width(), const_cast<cv::Vec4b*>(static_cast<const cv::Vec4b*>(static_cast<const void*>(image[beginY]))), image.stride());
+		}
+
+		// src に filter を適用した結果のうち、行 [beginY, endY) を dst に書き込む
+		// 上下に halo 行広げた範囲を入力にするので、halo がカーネルの半径以上であれば画像全体に適用した場合と同じ結果になる
+		template <class Filter>
+		static void FilterRows(const ImageConstView& src, const ImageView& dst, const int32 beginY, const int32 endY, const int32 halo, Filter filter)
+		{
+			const int32 srcBeginY = std::max(beginY - halo, 0);
+			const int32 srcEndY = std::min(endY + halo, static_cast<int32>(src.height()));
+
+			const cv::Mat_<cv::Vec4b> matSrc = RowsToMat(src, srcBeginY, srcEndY);
+			cv::Mat_<cv::Vec4b> matDst = RowsToMat(dst, beginY, endY);
+
+			if ((srcBeginY == beginY) && (srcEndY == endY))
+			{
+				filter(matSrc, matDst);
+			}
+			else
+			{
+				cv::Mat_<cv::Vec4b> matBand(srcEndY - srcBeginY, src.width());
+				filter(matSrc, matBand);
+				matBand.rowRange(beginY - srcBeginY, endY - srcBeginY).copyTo(matDst);
+			}
+		}
+
+		template <class Filter>
+		static void ApplyFilter(const ImageConstView& src, const ImageView& dst, const int32 halo, const bool parallel, Filter filter)
+		{
+			ForEachBand(parallel, src.height(), std::max(halo * 2, 16), [&](const size_t beginY, const size_t endY)
+			{
+				FilterRows(src, dst, static_cast<int32>(beginY), static_cast<int32>(endY), halo, filter);
+			});
+		}
+
+		static void Rotate90(const Image& src, Image& dst, const bool parallel)
+		{
+			const int32 width = src.width(), height = src.height();
+
+			ForEachBand(parallel, height, 16, [&](const size_t beginY, const size_t endY)
+			{
+				for (int32 y = static_cast<int32>(beginY); y < static_cast<int32>(endY); ++y)
+				{
+					for (int32 x = 0; x < width; ++x)
+					{
+						dst[x][height - y - 1] = src[y][x];
+					}
+				}
+			});
+		}
+
+		static void Mosaic(const ImageView& image, const int32 horizontal, const int32 vertical, const bool parallel)
+		{
+			const int32 width = image.width(), height = image.height();
+			const int32 xPiece = width / horizontal;
+			const size_t blockRows = (height + vertical - 1) / vertical;
+
+			// ブロックの行単位で分割する
+			ForEachBand(parallel, blockRows, std::max(16 / vertical, 1), [&](const size_t beginBlock, const size_t endBlock)
 			{
-				Color* pDst = pLine;
+				for (int32 yP = static_cast<int32>(beginBlock); yP < static_cast<int32>(endBlock); ++yP)
+				{
+					const int32 y = yP * vertical;
+					const int32 h = std::min(vertical, height - y);
+					int32 xP = 0;
+
+					for (; xP < xPiece; ++xP)
+					{
+						const Rect rc(xP * horizontal, y, horizontal, h);
+						FillRect(image, rc, GetAverage(image, rc));
+					}
+
+					const Rect rc(xP * horizontal, y, width - xP * horizontal, h);
+					FillRect(image, rc, GetAverage(image, rc));
+				}
+			});
+		}
+
+		static void SpreadRows(const Image& src, Image& dst, DefaultRNGType& rng, const int32 horizontal, const int32 vertical, const int32 beginY, const int32 endY)
+		{
+			const int32 width = src.width();
+
+			const int32 h2 = horizontal * 2;
+
+			const int32 v2 = vertical * 2;
 
+			for (int32 y = beginY; y < endY; ++y)
+			{
 				for (int32 x = 0; x < width; ++x)
 				{
-					(*pDst++) = color;
+					const int32 xpos = x + int32(rng() % (h2 + 1)) - horizontal;
+
+					const int32 ypos = y + int32(rng() % (v2 + 1)) - vertical;
+
+					dst[y][x] = src.getPixel_Mirror(xpos, ypos);
+				}
+			}
+		}
+
+		static void Spread(const Image& src, Image& dst, const int32 horizontal, const int32 vertical, const bool parallel)
+		{
+			DefaultRNGType rng(12345);
+
+			const size_t height = src.height();
+			const size_t bandCount = parallel ? GetBandCount(height, 16) : 1;
+
+			if (bandCount == 1)
+			{
+				SpreadRows(src, dst, rng, horizontal, vertical, 0, static_cast<int32>(height));
+
+				return;
+			}
+
+			// 1 画素あたり 2 回乱数を使うので、各帯の先頭での乱数エンジンの状態を先に求めておく
+			Array<DefaultRNGType> rngs;
+			rngs.reserve(bandCount);
+
+			for (size_t i = 0; i < bandCount; ++i)
+			{
+				rngs.push_back(rng);
+
+				if (i + 1 < bandCount)
+				{
+					const size_t rows = (height * (i + 1) / bandCount) - (height * i / bandCount);
+
+					for (size_t k = 0; k < rows * src.width() * 2; ++k)
+					{
+						rng();
+					}
+				}
+			}
+
+			Threading::ParallelFor(bandCount, [&](const size_t beginBand, const size_t endBand)
+			{
+				for (size_t i = beginBand; i < endBand; ++i)
+				{
+					SpreadRows(src, dst, rngs[i], horizontal, vertical,
+						static_cast<int32>(height * i / bandCount), static_cast<int32>(height * (i + 1) / bandCount));
+				}
+			});
+		}
+
+		// 行の帯ごとに拡大縮小しても画像全体の場合と結果が一致する比率か
+		// 整数分の 1 の縮小と 2 の累乗倍の拡大では、帯の境界でのサンプリング位置と補間係数が画像全体の場合と一致する
+		static bool IsBandAlignedScaling(const int32 srcHeight, const int32 dstHeight)
+		{
+			if (srcHeight % dstHeight == 0)
+			{
+				return true;
+			}
+
+			if (dstHeight % srcHeight == 0)
+			{
+				const int32 n = dstHeight / srcHeight;
+
+				return ((n & (n - 1)) == 0);
+			}
+
+			return false;
+		}
+
+		static void Resize(const ImageConstView& src, const ImageView& dst, const Interpolation interpolation, bool parallel)
+		{
+			const int32 srcHeight = src.height(), dstHeight = dst.height();
+
+			parallel = parallel && IsBandAlignedScaling(srcHeight, dstHeight);
+
+			// 元画像の srcUnit 行が結果の dstUnit 行に対応する
+			const int32 g = std::gcd(srcHeight, dstHeight);
+			const int32 srcUnit = srcHeight / g, dstUnit = dstHeight / g;
+
+			// Lanczos の上下 4 行を覆う余白
+			const int32 haloUnits = (4 + srcUnit - 1) / srcUnit + 1;
+
+			ForEachBand(parallel, g, std::max(16 / dstUnit, 1), [&](const size_t beginUnit, const size_t endUnit)
+			{
+				const int32 u0 = static_cast<int32>(beginUnit), u1 = static_cast<int32>(endUnit);
+				const int32 h0 = std::max(u0 - haloUnits, 0), h1 = std::min(u1 + haloUnits, g);
+
+				const cv::Mat_<cv::Vec4b> matSrc = RowsToMat(src, h0 * srcUnit, h1 * srcUnit);
+				cv::Mat_<cv::Vec4b> matDst = RowsToMat(dst, u0 * dstUnit, u1 * dstUnit);
+
+				if ((h0 == u0) && (h1 == u1))
+				{
+					cv::resize(matSrc, matDst, matDst.size(), 0, 0, static_cast<int32>(interpolation));
+				}
+				else
+				{
+					cv::Mat_<cv::Vec4b> matBand((h1 - h0) * dstUnit, dst.width());
+					cv::resize(matSrc, matBand, matBand.size(), 0, 0, static_cast<int32>(interpolation));
+					matBand.rowRange((u0 - h0) * dstUnit, (u1 - h0) * dstUnit).copyTo(matDst);
 				}
+			});
+		}
+
+		static Interpolation SelectInterpolation(const Interpolation interpolation, const uint32 srcWidth, const uint32 srcHeight, const uint32 targetWidth, const uint32 targetHeight)
+		{
+			if (interpolation != Interpolation::Unspecified)
+			{
+				return interpolation;
+			}
+
+			// TODO 再検討
+			if (targetWidth >= srcWidth && targetHeight >= srcHeight)
+			{
+				return Interpolation::Lanczos;
+			}
+			else if (targetWidth < srcWidth / 2 || targetHeight < srcHeight / 2)
+			{
+				return Interpolation::Area;
+			}
+			else
+			{
+				return Interpolation::Lanczos;
+			}
+		}
+
+		inline bool IsSameView(const ImageConstView& a, const ImageConstView& b) noexcept
+		{
+			return (a.data() == b.data()) && (a.size() == b.size()) && (a.stride() == b.stride());
+		}
 
-				pLine += imgWidth;
+		// src と dst のメモリが重なっていると、処理中に入力が書き換わってしまうので、一時的な画像に書き込んでからコピーする
+		// inPlace が true の場合、src と dst が同じ領域であれば f は直接 dst に書き込む
+		template <class Fty>
+		static void ProcessViews(const ImageConstView& src, const ImageView& dst, const bool inPlace, Fty f)
+		{
+			if (!src.overlaps(dst) || (inPlace && IsSameView(src, dst)))
+			{
+				f(dst);
+			}
+			else
+			{
+				Image tmp(dst.size());
+
+				f(ImageView(tmp));
+
+				dst.copyFrom(tmp);
+			}
+		}
+
+		// src を dst にコピーしてから、各行に kernel(pixels, count) を適用する
+		template <class Kernel>
+		static void ApplyPixelKernel(const ImageConstView& src, const ImageView& dst, Kernel kernel)
+		{
+			if (!src || (src.size() != dst.size()))
+			{
+				return;
+			}
+
+			dst.copyFrom(src);
+
+			if (dst.isContinuous())
+			{
+				kernel(dst.data(), dst.num_pixels());
+			}
+			else
+			{
+				for (int32 y = 0; y < dst.height(); ++y)
+				{
+					kernel(dst[y], dst.width());
+				}
 			}
 		}
 
@@ -453,6 +738,17 @@ namespace s3d
 		}
 	}
 
+	Image::Image(const ImageConstView& view)
+		: Image(view.width(), view.height())
+	{
+		if (m_data.empty())
+		{
+			return;
+		}
+
+		ImageView(*this).copyFrom(view);
+	}
+
 	Image& Image::operator =(Image&& image)
 	{
 		m_data = std::move(image.m_data);
@@ -761,6 +1057,23 @@ namespace s3d
 		return Siv3DEngine::GetImageFormat()->encode(*this, format);
 	}
 
+	void Image::SetDefaultExecution(const ImageExecution execution) noexcept
+	{
+		detail::g_defaultExecution = ((execution == ImageExecution::Default) ? ImageExecution::Sequential : execution);
+	}
+
+	ImageExecution Image::GetDefaultExecution() noexcept
+	{
+		return detail::g_defaultExecution;
+	}
+
+	Image& Image::swapRB()
+	{
+		PixelKernel::SwapRB(m_data.data(), m_data.size());
+
+		return *this;
+	}
+
 	Image& Image::negate()
 	{
 		// 1. パラメータチェック
@@ -773,10 +1086,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			for (auto& pixel : m_data)
-			{
-				pixel = ~pixel;
-			}
+			PixelKernel::Negate(m_data.data(), m_data.size());
 		}
 
 		return *this;
@@ -794,10 +1104,7 @@ namespace s3d
 
 		Image image(*this);
 
-		for (auto& pixel : image)
-		{
-			pixel = ~pixel;
-		}
+		PixelKernel::Negate(image.data(), image.num_pixels());
 
 		return image;
 	}
@@ -814,10 +1121,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			for (auto& pixel : m_data)
-			{
-				pixel.r = pixel.g = pixel.b = pixel.grayscale0_255();
-			}
+			PixelKernel::Grayscale(m_data.data(), m_data.size());
 		}
 
 		return *this;
@@ -835,10 +1139,7 @@ namespace s3d
 
 		Image image(*this);
 
-		for (auto& pixel : image)
-		{
-			pixel.r = pixel.g = pixel.b = pixel.grayscale0_255();
-		}
+		PixelKernel::Grayscale(image.data(), image.num_pixels());
 
 		return image;
 	}
@@ -855,15 +1156,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			const double levn = Clamp(level, 0, 255);
-			const double levr = 0.956*levn;
-			const double levg = 0.274*levn;
-			const double levb = -1.108*levn;
-
-			for (auto& pixel : m_data)
-			{
-				detail::MakeSepia(levr, levg, levb, pixel);
-			}
+			PixelKernel::Sepia(m_data.data(), m_data.size(), level);
 		}
 
 		return *this;
@@ -881,15 +1174,7 @@ namespace s3d
 
 		Image image(*this);
 
-		const double levn = Clamp(level, 0, 255);
-		const double levr = 0.956*levn;
-		const double levg = 0.274*levn;
-		const double levb = -1.108*levn;
-
-		for (auto& pixel : image)
-		{
-			detail::MakeSepia(levr, levg, levb, pixel);
-		}
+		PixelKernel::Sepia(image.data(), image.num_pixels(), level);
 
 		return image;
 	}
@@ -910,12 +1195,7 @@ namespace s3d
 
 			detail::SetupPostarizeTable(level, colorTable);
 
-			for (auto& pixel : m_data)
-			{
-				pixel.r = colorTable[pixel.r];
-				pixel.g = colorTable[pixel.g];
-				pixel.b = colorTable[pixel.b];
-			}
+			PixelKernel::ApplyTable(m_data.data(), m_data.size(), colorTable);
 		}
 
 		return *this;
@@ -937,12 +1217,7 @@ namespace s3d
 
 		detail::SetupPostarizeTable(level, colorTable);
 
-		for (auto& pixel : image)
-		{
-			pixel.r = colorTable[pixel.r];
-			pixel.g = colorTable[pixel.g];
-			pixel.b = colorTable[pixel.b];
-		}
+		PixelKernel::ApplyTable(image.data(), image.num_pixels(), colorTable);
 
 		return image;
 	}
@@ -959,24 +1234,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			if (level < 0)
-			{
-				for (auto& pixel : m_data)
-				{
-					pixel.r = std::max(static_cast<int32>(pixel.r) + level, 0);
-					pixel.g = std::max(static_cast<int32>(pixel.g) + level, 0);
-					pixel.b = std::max(static_cast<int32>(pixel.b) + level, 0);
-				}
-			}
-			else if (level > 0)
-			{
-				for (auto& pixel : m_data)
-				{
-					pixel.r = std::min(static_cast<int32>(pixel.r) + level, 255);
-					pixel.g = std::min(static_cast<int32>(pixel.g) + level, 255);
-					pixel.b = std::min(static_cast<int32>(pixel.b) + level, 255);
-				}
-			}
+			PixelKernel::Brighten(m_data.data(), m_data.size(), level);
 		}
 
 		return *this;
@@ -994,24 +1252,7 @@ namespace s3d
 
 		Image image(*this);
 
-		if (level < 0)
-		{
-			for (auto& pixel : image)
-			{
-				pixel.r = std::max(static_cast<int32>(pixel.r) + level, 0);
-				pixel.g = std::max(static_cast<int32>(pixel.g) + level, 0);
-				pixel.b = std::max(static_cast<int32>(pixel.b) + level, 0);
-			}
-		}
-		else if (level > 0)
-		{
-			for (auto& pixel : image)
-			{
-				pixel.r = std::min(static_cast<int32>(pixel.r) + level, 255);
-				pixel.g = std::min(static_cast<int32>(pixel.g) + level, 255);
-				pixel.b = std::min(static_cast<int32>(pixel.b) + level, 255);
-			}
-		}
+		PixelKernel::Brighten(image.data(), image.num_pixels(), level);
 
 		return image;
 	}
@@ -1134,7 +1375,7 @@ namespace s3d
 		return image;
 	}
 
-	Image& Image::rotate90()
+	Image& Image::rotate90(const ImageExecution execution)
 	{
 		// 1. パラメータチェック
 		{
@@ -1149,13 +1390,7 @@ namespace s3d
 		{
 			Image tmp(m_height, m_width);
 
-			for (uint32 y = 0; y < m_height; ++y)
-			{
-				for (uint32 x = 0; x < m_width; ++x)
-				{
-					tmp[x][m_height - y - 1] = (*this)[y][x];
-				}
-			}
+			detail::Rotate90(*this, tmp, detail::IsParallel(execution, num_pixels()));
 
 			swap(tmp);
 		}
@@ -1163,7 +1398,7 @@ namespace s3d
 		return *this;
 	}
 
-	Image Image::rotated90() const
+	Image Image::rotated90(const ImageExecution execution) const
 	{
 		// 1. パラメータチェック
 		{
@@ -1176,13 +1411,7 @@ namespace s3d
 		Image image(m_height, m_width);
 
 		// [Siv3D ToDo] 最適化
-		for (uint32 y = 0; y < m_height; ++y)
-		{
-			for (uint32 x = 0; x < m_width; ++x)
-			{
-				image[x][m_height - y - 1] = (*this)[y][x];
-			}
-		}
+		detail::Rotate90(*this, image, detail::IsParallel(execution, num_pixels()));
 
 		return image;
 	}
@@ -1292,12 +1521,7 @@ namespace s3d
 
 			detail::SetupGammmaTable(gamma, colorTable);
 
-			for (auto& pixel : m_data)
-			{
-				pixel.r = colorTable[pixel.r];
-				pixel.g = colorTable[pixel.g];
-				pixel.b = colorTable[pixel.b];
-			}
+			PixelKernel::ApplyTable(m_data.data(), m_data.size(), colorTable);
 		}
 
 		return *this;
@@ -1319,12 +1543,7 @@ namespace s3d
 
 		detail::SetupGammmaTable(gamma, colorTable);
 
-		for (auto& pixel : image)
-		{
-			pixel.r = colorTable[pixel.r];
-			pixel.g = colorTable[pixel.g];
-			pixel.b = colorTable[pixel.b];
-		}
+		PixelKernel::ApplyTable(image.data(), image.num_pixels(), colorTable);
 
 		return image;
 	}
@@ -1341,20 +1560,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			const uint32 a = inverse ? 0 : 0x00FFffFF, b = inverse ? 0x00FFffFF : 0;
-
-			Color* pDst = data();
-
-			const Color* pDstEnd = pDst + num_pixels();
-
-			const double thresholdF = threshold / 255.0;
-
-			while (pDst != pDstEnd)
-			{
-				*static_cast<uint32*>(static_cast<void*>(pDst)) = (thresholdF < pDst->grayscale() ? a : b) | (pDst->a << 24);
-
-				++pDst;
-			}
+			PixelKernel::Threshold(m_data.data(), m_data.size(), threshold, inverse);
 		}
 
 		return *this;
@@ -1372,20 +1578,7 @@ namespace s3d
 
 		Image image(*this);
 
-		const unsigned a = inverse ? 0 : 0x00FFffFF, b = inverse ? 0x00FFffFF : 0;
-
-		Color* pDst = image.data();
-
-		const Color* pDstEnd = pDst + num_pixels();
-
-		const double thresholdF = threshold / 255.0;
-
-		while (pDst != pDstEnd)
-		{
-			*static_cast<uint32*>(static_cast<void*>(pDst)) = (thresholdF < pDst->grayscale() ? a : b) | (pDst->a << 24);
-
-			++pDst;
-		}
+		PixelKernel::Threshold(image.data(), image.num_pixels(), threshold, inverse);
 
 		return image;
 	}
@@ -1453,12 +1646,12 @@ namespace s3d
 		return image;
 	}
 
-	Image& Image::mosaic(const int32 size)
+	Image& Image::mosaic(const int32 size, const ImageExecution execution)
 	{
-		return mosaic(size, size);
+		return mosaic(size, size, execution);
 	}
 
-	Image& Image::mosaic(const int32 horizontal, const int32 vertical)
+	Image& Image::mosaic(const int32 horizontal, const int32 vertical, const ImageExecution execution)
 	{
 		// 1. パラメータチェック
 		{
@@ -1475,46 +1668,18 @@ namespace s3d
 
 		// 2. 処理
 		{
-			const uint32 xPiece = m_width / horizontal;
-			const uint32 yPiece = m_height / vertical;
-			uint32 yP = 0, xP = 0;
-
-			for (yP = 0; yP < yPiece; ++yP)
-			{
-				for (xP = 0; xP < xPiece; ++xP)
-				{
-					const Rect rc(xP*horizontal, yP*vertical, horizontal, vertical);
-					detail::FillRect(*this, rc, detail::GetAverage(*this, rc));
-				}
-
-				const Rect rc(xP*horizontal, yP*vertical, m_width - xP * horizontal, vertical);
-				detail::FillRect(*this, rc, detail::GetAverage(*this, rc));
-			}
-
-			if (yP * vertical < m_height)
-			{
-				const int32 tY = m_height - yP * vertical;
-
-				for (xP = 0; xP < xPiece; ++xP)
-				{
-					const Rect rc(xP*horizontal, yP*vertical, horizontal, tY);
-					detail::FillRect(*this, rc, detail::GetAverage(*this, rc));
-				}
-
-				const Rect rc(xP*horizontal, yP*vertical, m_width - xP * horizontal, tY);
-				detail::FillRect(*this, rc, detail::GetAverage(*this, rc));
-			}
-		}
+			detail::Mosaic(*this, horizontal, vertical, detail::IsParallel(execution, num_pixels()));
+		}
 
 		return *this;
 	}
 
-	Image Image::mosaiced(const int32 size) const
+	Image Image::mosaiced(const int32 size, const ImageExecution execution) const
 	{
-		return mosaiced(size, size);
+		return mosaiced(size, size, execution);
 	}
 
-	Image Image::mosaiced(const int32 horizontal, const int32 vertical) const
+	Image Image::mosaiced(const int32 horizontal, const int32 vertical, const ImageExecution execution) const
 	{
 		// 1. パラメータチェック
 		{
@@ -1531,45 +1696,17 @@ namespace s3d
 
 		Image image(*this);
 
-		const uint32 xPiece = m_width / horizontal;
-		const uint32 yPiece = m_height / vertical;
-		uint32 yP = 0, xP = 0;
-
-		for (yP = 0; yP < yPiece; ++yP)
-		{
-			for (xP = 0; xP < xPiece; ++xP)
-			{
-				const Rect rc(xP*horizontal, yP*vertical, horizontal, vertical);
-				detail::FillRect(image, rc, detail::GetAverage(image, rc));
-			}
-
-			const Rect rc(xP*horizontal, yP*vertical, m_width - xP * horizontal, vertical);
-			detail::FillRect(image, rc, detail::GetAverage(image, rc));
-		}
-
-		if (yP*vertical < m_height)
-		{
-			const int32 tY = m_height - yP * vertical;
-
-			for (xP = 0; xP < xPiece; ++xP)
-			{
-				const Rect rc(xP*horizontal, yP*vertical, horizontal, tY);
-				detail::FillRect(image, rc, detail::GetAverage(image, rc));
-			}
-
-			const Rect rc(xP*horizontal, yP*vertical, m_width - xP * horizontal, tY);
-			detail::FillRect(image, rc, detail::GetAverage(image, rc));
-		}
+		detail::Mosaic(image, horizontal, vertical, detail::IsParallel(execution, num_pixels()));
 
 		return image;
 	}
 
-	Image& Image::spread(const int32 size)
+	Image& Image::spread(const int32 size, const ImageExecution execution)
 	{
-		return spread(size, size);
+		return spread(size, size, execution);
 	}
 
-	Image& Image::spread(const int32 horizontal, const int32 vertical)
+	Image& Image::spread(const int32 horizontal, const int32 vertical, const ImageExecution execution)
 	{
 		// 1. パラメータチェック
 		{
@@ -1589,23 +1726,7 @@ namespace s3d
 		{
 			Image tmp(m_width, m_height);
 
-			DefaultRNGType rng(12345);
-
-			const int32 h2 = horizontal * 2;
-
-			const int32 v2 = vertical * 2;
-
-			for (int32 y = 0; y < static_cast<int32>(m_height); ++y)
-			{
-				for (int32 x = 0; x < static_cast<int32>(m_width); ++x)
-				{
-					const int32 xpos = x + int32(rng() % (h2 + 1)) - horizontal;
-
-					const int32 ypos = y + int32(rng() % (v2 + 1)) - vertical;
-
-					tmp[y][x] = getPixel_Mirror(xpos, ypos);
-				}
-			}
+			detail::Spread(*this, tmp, horizontal, vertical, detail::IsParallel(execution, num_pixels()));
 
 			swap(tmp);
 		}
@@ -1613,12 +1734,12 @@ namespace s3d
 		return *this;
 	}
 
-	Image Image::spreaded(const int32 size) const
+	Image Image::spreaded(const int32 size, const ImageExecution execution) const
 	{
-		return spreaded(size, size);
+		return spreaded(size, size, execution);
 	}
 
-	Image Image::spreaded(const int32 horizontal, const int32 vertical) const
+	Image Image::spreaded(const int32 horizontal, const int32 vertical, const ImageExecution execution) const
 	{
 		// 1. パラメータチェック
 		{
@@ -1635,34 +1756,18 @@ namespace s3d
 
 		Image image(m_width, m_height);
 
-		DefaultRNGType rng(12345);
-
-		const int32 h2 = horizontal * 2;
-
-		const int32 v2 = vertical * 2;
-
 		// [Siv3D ToDo] 最適化
-		for (int32 y = 0; y < static_cast<int32>(m_height); ++y)
-		{
-			for (int32 x = 0; x < static_cast<int32>(m_width); ++x)
-			{
-				const int32 xpos = x + int32(rng() % (h2 + 1)) - horizontal;
-
-				const int32 ypos = y + int32(rng() % (v2 + 1)) - vertical;
-
-				image[y][x] = getPixel_Mirror(xpos, ypos);
-			}
-		}
+		detail::Spread(*this, image, horizontal, vertical, detail::IsParallel(execution, num_pixels()));
 
 		return image;
 	}
 
-	Image& Image::blur(const int32 size)
+	Image& Image::blur(const int32 size, const ImageExecution execution)
 	{
-		return blur(size, size);
+		return blur(size, size, execution);
 	}
 
-	Image& Image::blur(const int32 horizontal, const int32 vertical)
+	Image& Image::blur(const int32 horizontal, const int32 vertical, const ImageExecution execution)
 	{
 		// 1. パラメータチェック
 		{
@@ -1681,11 +1786,10 @@ namespace s3d
 		{
 			Image tmp(m_width, m_height);
 
-			cv::Mat_<cv::Vec4b> matSrc(m_height, m_width, static_cast<cv::Vec4b*>(static_cast<void*>(data())), stride());
-
-			cv::Mat_<cv::Vec4b> matDst(tmp.height(), tmp.width(), static_cast<cv::Vec4b*>(static_cast<void*>(tmp.data())), tmp.stride());
-
-			cv::blur(matSrc, matDst, cv::Size(horizontal * 2 + 1, vertical * 2 + 1));
+			detail::ApplyFilter(*this, tmp, vertical, detail::IsParallel(execution, num_pixels()), [=](const cv::Mat_<cv::Vec4b>& matSrc, cv::Mat_<cv::Vec4b>& matDst)
+			{
+				cv::blur(matSrc, matDst, cv::Size(horizontal * 2 + 1, vertical * 2 + 1));
+			});
 
 			swap(tmp);
 		}
@@ -1693,12 +1797,12 @@ namespace s3d
 		return *this;
 	}
 
-	Image Image::blurred(const int32 size) const
+	Image Image::blurred(const int32 size, const ImageExecution execution) const
 	{
-		return blurred(size, size);
+		return blurred(size, size, execution);
 	}
 
-	Image Image::blurred(const int32 horizontal, const int32 vertical) const
+	Image Image::blurred(const int32 horizontal, const int32 vertical, const ImageExecution execution) const
 	{
 		// 1. パラメータチェック
 		{
@@ -1715,16 +1819,15 @@ namespace s3d
 
 		Image image(m_width, m_height);
 
-		cv::Mat_<cv::Vec4b> matSrc(m_height, m_width, const_cast<cv::Vec4b*>(static_cast<const cv::Vec4b*>(static_cast<const void*>(data()))), stride());
-
-		cv::Mat_<cv::Vec4b> matDst(image.height(), image.width(), static_cast<cv::Vec4b*>(static_cast<void*>(image.data())), image.stride());
-
-		cv::blur(matSrc, matDst, cv::Size(horizontal * 2 + 1, vertical * 2 + 1));
+		detail::ApplyFilter(*this, image, vertical, detail::IsParallel(execution, num_pixels()), [=](const cv::Mat_<cv::Vec4b>& matSrc, cv::Mat_<cv::Vec4b>& matDst)
+		{
+			cv::blur(matSrc, matDst, cv::Size(horizontal * 2 + 1, vertical * 2 + 1));
+		});
 
 		return image;
 	}
 
-	Image& Image::medianBlur(int32 apertureSize)
+	Image& Image::medianBlur(int32 apertureSize, const ImageExecution execution)
 	{
 		// 1. パラメータチェック
 		{
@@ -1748,11 +1851,10 @@ namespace s3d
 		{
 			Image tmp(m_width, m_height);
 
-			cv::Mat_<cv::Vec4b> matSrc(m_height, m_width, static_cast<cv::Vec4b*>(static_cast<void*>(data())), stride());
-
-			cv::Mat_<cv::Vec4b> matDst(tmp.height(), tmp.width(), static_cast<cv::Vec4b*>(static_cast<void*>(tmp.data())), tmp.stride());
-
-			cv::medianBlur(matSrc, matDst, apertureSize);
+			detail::ApplyFilter(*this, tmp, apertureSize / 2, detail::IsParallel(execution, num_pixels()), [=](const cv::Mat_<cv::Vec4b>& matSrc, cv::Mat_<cv::Vec4b>& matDst)
+			{
+				cv::medianBlur(matSrc, matDst, apertureSize);
+			});
 
 			swap(tmp);
 		}
@@ -1760,7 +1862,7 @@ namespace s3d
 		return *this;
 	}
 
-	Image Image::medianBlurred(int32 apertureSize) const
+	Image Image::medianBlurred(int32 apertureSize, const ImageExecution execution) const
 	{
 		// 1. パラメータチェック
 		{
@@ -1782,21 +1884,20 @@ namespace s3d
 
 		Image image(m_width, m_height);
 
-		cv::Mat_<cv::Vec4b> matSrc(m_height, m_width, const_cast<cv::Vec4b*>(static_cast<const cv::Vec4b*>(static_cast<const void*>(data()))), stride());
-
-		cv::Mat_<cv::Vec4b> matDst(image.height(), image.width(), static_cast<cv::Vec4b*>(static_cast<void*>(image.data())), image.stride());
-
-		cv::medianBlur(matSrc, matDst, apertureSize);
+		detail::ApplyFilter(*this, image, apertureSize / 2, detail::IsParallel(execution, num_pixels()), [=](const cv::Mat_<cv::Vec4b>& matSrc, cv::Mat_<cv::Vec4b>& matDst)
+		{
+			cv::medianBlur(matSrc, matDst, apertureSize);
+		});
 
 		return image;
 	}
 
-	Image& Image::gaussianBlur(const int32 size, const BorderType borderType)
+	Image& Image::gaussianBlur(const int32 size, const BorderType borderType, const ImageExecution execution)
 	{
-		return gaussianBlur(size, size, borderType);
+		return gaussianBlur(size, size, borderType, execution);
 	}
 
-	Image& Image::gaussianBlur(const int32 horizontal, const int32 vertical, const BorderType borderType)
+	Image& Image::gaussianBlur(const int32 horizontal, const int32 vertical, const BorderType borderType, const ImageExecution execution)
 	{
 		// 1. パラメータチェック
 		{
@@ -1815,11 +1916,10 @@ namespace s3d
 		{
 			Image tmp(m_width, m_height);
 
-			cv::Mat_<cv::Vec4b> matSrc(m_height, m_width, static_cast<cv::Vec4b*>(static_cast<void*>(data())), stride());
-
-			cv::Mat_<cv::Vec4b> matDst(tmp.height(), tmp.width(), static_cast<cv::Vec4b*>(static_cast<void*>(tmp.data())), tmp.stride());
-
-			cv::GaussianBlur(matSrc, matDst, cv::Size(horizontal * 2 + 1, vertical * 2 + 1), 0.0, 0.0, detail::ConvertBorderType(borderType));
+			detail::ApplyFilter(*this, tmp, vertical, detail::IsParallel(execution, num_pixels()), [=](const cv::Mat_<cv::Vec4b>& matSrc, cv::Mat_<cv::Vec4b>& matDst)
+			{
+				cv::GaussianBlur(matSrc, matDst, cv::Size(horizontal * 2 + 1, vertical * 2 + 1), 0.0, 0.0, detail::ConvertBorderType(borderType));
+			});
 
 			swap(tmp);
 		}
@@ -1827,12 +1927,12 @@ namespace s3d
 		return *this;
 	}
 
-	Image Image::gaussianBlurred(const int32 size, const BorderType borderType) const
+	Image Image::gaussianBlurred(const int32 size, const BorderType borderType, const ImageExecution execution) const
 	{
-		return gaussianBlurred(size, size, borderType);
+		return gaussianBlurred(size, size, borderType, execution);
 	}
 
-	Image Image::gaussianBlurred(const int32 horizontal, const int32 vertical, const BorderType borderType) const
+	Image Image::gaussianBlurred(const int32 horizontal, const int32 vertical, const BorderType borderType, const ImageExecution execution) const
 	{
 		// 1. パラメータチェック
 		{
@@ -1849,16 +1949,15 @@ namespace s3d
 
 		Image image(m_width, m_height);
 
-		cv::Mat_<cv::Vec4b> matSrc(m_height, m_width, const_cast<cv::Vec4b*>(static_cast<const cv::Vec4b*>(static_cast<const void*>(data()))), stride());
-
-		cv::Mat_<cv::Vec4b> matDst(image.height(), image.width(), static_cast<cv::Vec4b*>(static_cast<void*>(image.data())), image.stride());
-
-		cv::GaussianBlur(matSrc, matDst, cv::Size(horizontal * 2 + 1, vertical * 2 + 1), 0.0, 0.0, detail::ConvertBorderType(borderType));
+		detail::ApplyFilter(*this, image, vertical, detail::IsParallel(execution, num_pixels()), [=](const cv::Mat_<cv::Vec4b>& matSrc, cv::Mat_<cv::Vec4b>& matDst)
+		{
+			cv::GaussianBlur(matSrc, matDst, cv::Size(horizontal * 2 + 1, vertical * 2 + 1), 0.0, 0.0, detail::ConvertBorderType(borderType));
+		});
 
 		return image;
 	}
 
-	Image& Image::dilate(const int32 iterations)
+	Image& Image::dilate(const int32 iterations, const ImageExecution execution)
 	{
 		// 1. パラメータチェック
 		{
@@ -1869,6 +1968,19 @@ namespace s3d
 		}
 
 		// 2. 処理
+		if (detail::IsParallel(execution, num_pixels()) && (0 < iterations))
+		{
+			// 3x3 のカーネルを iterations 回適用するので、半径は iterations
+			Image tmp(m_width, m_height);
+
+			detail::ApplyFilter(*this, tmp, iterations, true, [=](const cv::Mat_<cv::Vec4b>& matSrc, cv::Mat_<cv::Vec4b>& matDst)
+			{
+				cv::dilate(matSrc, matDst, cv::Mat(), cv::Point(-1, -1), iterations);
+			});
+
+			swap(tmp);
+		}
+		else
 		{
 			cv::Mat_<cv::Vec4b> mat(m_height, m_width, static_cast<cv::Vec4b*>(static_cast<void*>(data())), stride());
 			cv::dilate(mat, mat, cv::Mat(), cv::Point(-1, -1), iterations);
@@ -1877,7 +1989,7 @@ namespace s3d
 		return *this;
 	}
 
-	Image Image::dilated(const int32 iterations) const
+	Image Image::dilated(const int32 iterations, const ImageExecution execution) const
 	{
 		// 1. パラメータチェック
 		{
@@ -1887,6 +1999,18 @@ namespace s3d
 			}
 		}
 
+		if (detail::IsParallel(execution, num_pixels()) && (0 < iterations))
+		{
+			Image image(m_width, m_height);
+
+			detail::ApplyFilter(*this, image, iterations, true, [=](const cv::Mat_<cv::Vec4b>& matSrc, cv::Mat_<cv::Vec4b>& matDst)
+			{
+				cv::dilate(matSrc, matDst, cv::Mat(), cv::Point(-1, -1), iterations);
+			});
+
+			return image;
+		}
+
 		Image image(*this);
 
 		cv::Mat_<cv::Vec4b> mat(image.height(), image.width(), static_cast<cv::Vec4b*>(static_cast<void*>(image.data())), image.stride());
@@ -1895,7 +2019,7 @@ namespace s3d
 		return image;
 	}
 
-	Image& Image::erode(const int32 iterations)
+	Image& Image::erode(const int32 iterations, const ImageExecution execution)
 	{
 		// 1. パラメータチェック
 		{
@@ -1906,6 +2030,19 @@ namespace s3d
 		}
 
 		// 2. 処理
+		if (detail::IsParallel(execution, num_pixels()) && (0 < iterations))
+		{
+			// 3x3 のカーネルを iterations 回適用するので、半径は iterations
+			Image tmp(m_width, m_height);
+
+			detail::ApplyFilter(*this, tmp, iterations, true, [=](const cv::Mat_<cv::Vec4b>& matSrc, cv::Mat_<cv::Vec4b>& matDst)
+			{
+				cv::erode(matSrc, matDst, cv::Mat(), cv::Point(-1, -1), iterations);
+			});
+
+			swap(tmp);
+		}
+		else
 		{
 			cv::Mat_<cv::Vec4b> mat(m_height, m_width, static_cast<cv::Vec4b*>(static_cast<void*>(data())), stride());
 			cv::erode(mat, mat, cv::Mat(), cv::Point(-1, -1), iterations);
@@ -1914,7 +2051,7 @@ namespace s3d
 		return *this;
 	}
 
-	Image Image::eroded(const int32 iterations) const
+	Image Image::eroded(const int32 iterations, const ImageExecution execution) const
 	{
 		// 1. パラメータチェック
 		{
@@ -1924,6 +2061,18 @@ namespace s3d
 			}
 		}
 
+		if (detail::IsParallel(execution, num_pixels()) && (0 < iterations))
+		{
+			Image image(m_width, m_height);
+
+			detail::ApplyFilter(*this, image, iterations, true, [=](const cv::Mat_<cv::Vec4b>& matSrc, cv::Mat_<cv::Vec4b>& matDst)
+			{
+				cv::erode(matSrc, matDst, cv::Mat(), cv::Point(-1, -1), iterations);
+			});
+
+			return image;
+		}
+
 		Image image(*this);
 
 		cv::Mat_<cv::Vec4b> mat(image.height(), image.width(), static_cast<cv::Vec4b*>(static_cast<void*>(image.data())), image.stride());
@@ -2038,7 +2187,7 @@ namespace s3d
 		return image;
 	}
 
-	Image& Image::scale(int32 width, int32 height, Interpolation interpolation)
+	Image& Image::scale(int32 width, int32 height, Interpolation interpolation, const ImageExecution execution)
 	{
 		// 1. パラメータチェック
 		{
@@ -2061,29 +2210,11 @@ namespace s3d
 
 		// 3. 処理
 		{
-			// TODO 再検討
-			if (interpolation == Interpolation::Unspecified)
-			{
-				if (targetWidth >= m_width && targetHeight >= m_height)
-				{
-					interpolation = Interpolation::Lanczos;
-				}
-				else if (targetWidth < m_width / 2 || targetHeight < m_height / 2)
-				{
-					interpolation = Interpolation::Area;
-				}
-				else
-				{
-					interpolation = Interpolation::Lanczos;
-				}
-			}
+			interpolation = detail::SelectInterpolation(interpolation, m_width, m_height, targetWidth, targetHeight);
 
 			Image tmp(targetWidth, targetHeight);
 
-			cv::Mat_<cv::Vec4b> matSrc(m_height, m_width, const_cast<cv::Vec4b*>(static_cast<const cv::Vec4b*>(static_cast<const void*>(data()))), stride());
-			cv::Mat_<cv::Vec4b> matDst(tmp.height(), tmp.width(), static_cast<cv::Vec4b*>(static_cast<void*>(tmp.data())), tmp.stride());
-
-			cv::resize(matSrc, matDst, matDst.size(), 0, 0, static_cast<int32>(interpolation));
+			detail::Resize(*this, tmp, interpolation, detail::IsParallel(execution, std::max(num_pixels(), tmp.num_pixels())));
 
 			swap(tmp);
 		}
@@ -2091,7 +2222,7 @@ namespace s3d
 		return *this;
 	}
 
-	Image Image::scaled(int32 width, int32 height, Interpolation interpolation) const
+	Image Image::scaled(int32 width, int32 height, Interpolation interpolation, const ImageExecution execution) const
 	{
 		// 1. パラメータチェック
 		{
@@ -2114,52 +2245,34 @@ namespace s3d
 
 		// 3. 処理
 		{
-			// TODO 再検討
-			if (interpolation == Interpolation::Unspecified)
-			{
-				if (targetWidth >= m_width && targetHeight >= m_height)
-				{
-					interpolation = Interpolation::Lanczos;
-				}
-				else if (targetWidth < m_width / 2 || targetHeight < m_height / 2)
-				{
-					interpolation = Interpolation::Area;
-				}
-				else
-				{
-					interpolation = Interpolation::Lanczos;
-				}
-			}
+			interpolation = detail::SelectInterpolation(interpolation, m_width, m_height, targetWidth, targetHeight);
 
 			Image image(targetWidth, targetHeight);
 
-			cv::Mat_<cv::Vec4b> matSrc(m_height, m_width, const_cast<cv::Vec4b*>(static_cast<const cv::Vec4b*>(static_cast<const void*>(data()))), stride());
-			cv::Mat_<cv::Vec4b> matDst(image.height(), image.width(), static_cast<cv::Vec4b*>(static_cast<void*>(image.data())), image.stride());
-
-			cv::resize(matSrc, matDst, matDst.size(), 0, 0, static_cast<int32>(interpolation));
+			detail::Resize(*this, image, interpolation, detail::IsParallel(execution, std::max(num_pixels(), image.num_pixels())));
 
 			return image;
 		}
 	}
 
-	Image& Image::scale(const Size& size, const Interpolation interpolation)
+	Image& Image::scale(const Size& size, const Interpolation interpolation, const ImageExecution execution)
 	{
-		return scale(size.x, size.y, interpolation);
+		return scale(size.x, size.y, interpolation, execution);
 	}
 
-	Image Image::scaled(const Size& size, const Interpolation interpolation) const
+	Image Image::scaled(const Size& size, const Interpolation interpolation, const ImageExecution execution) const
 	{
-		return scaled(size.x, size.y, interpolation);
+		return scaled(size.x, size.y, interpolation, execution);
 	}
 
-	Image& Image::scale(const double scaling, const Interpolation interpolation)
+	Image& Image::scale(const double scaling, const Interpolation interpolation, const ImageExecution execution)
 	{
-		return scale(static_cast<int32>(m_width * scaling), static_cast<int32>(m_height * scaling), interpolation);
+		return scale(static_cast<int32>(m_width * scaling), static_cast<int32>(m_height * scaling), interpolation, execution);
 	}
 
-	Image Image::scaled(const double scaling, const Interpolation interpolation) const
+	Image Image::scaled(const double scaling, const Interpolation interpolation, const ImageExecution execution) const
 	{
-		return scaled(static_cast<int32>(m_width * scaling), static_cast<int32>(m_height * scaling), interpolation);
+		return scaled(static_cast<int32>(m_width * scaling), static_cast<int32>(m_height * scaling), interpolation, execution);
 	}
 
 	Image& Image::fit(int32 width, int32 height, const bool scaleUp, const Interpolation interpolation)
@@ -2479,7 +2592,7 @@ namespace s3d
 			return result;
 		}
 
-		Polygon FindContour(const Image& image, bool useAlpha, uint32 threshold)
+		Polygon FindContour(const ImageConstView& image, bool useAlpha, uint32 threshold)
 		{
 			const auto polygons = ImageProcessing::FindContours(image, useAlpha, threshold);
 
@@ -2512,7 +2625,7 @@ namespace s3d
 			return polygons[index];
 		}
 
-		MultiPolygon FindContours(const Image& image, bool useAlpha, uint32 threshold)
+		MultiPolygon FindContours(const ImageConstView& image, bool useAlpha, uint32 threshold)
 		{
 			if (!image)
 			{
@@ -2618,7 +2731,7 @@ namespace s3d
 			return result;
 		}
 
-		void Sobel(const Image& src, Image& dst, const int32 dx, const int32 dy, int32 apertureSize)
+		void Sobel(const Image& src, Image& dst, const int32 dx, const int32 dy, const int32 apertureSize)
 		{
 			// 1. パラメータチェック
 			{
@@ -2631,21 +2744,35 @@ namespace s3d
 				{
 					return;
 				}
-
-				if (apertureSize % 2 == 0)
-				{
-					++apertureSize;
-				}
 			}
 
 			// 2. 出力画像のサイズ変更
 			{
 				dst.resize(src.size());
-
-				::memcpy(dst.data(), src.data(), dst.size_bytes());
 			}
 
 			// 3. 処理
+			{
+				Sobel(ImageConstView(src), ImageView(dst), dx, dy, apertureSize);
+			}
+		}
+
+		void Sobel(const ImageConstView& src, const ImageView& dst, const int32 dx, const int32 dy, int32 apertureSize)
+		{
+			// 1. パラメータチェック
+			{
+				if (!src || (src.size() != dst.size()))
+				{
+					return;
+				}
+
+				if (apertureSize % 2 == 0)
+				{
+					++apertureSize;
+				}
+			}
+
+			// 2. 処理
 			{
 				cv::Mat_<uint8> gray(src.height(), src.width());
 
@@ -2655,11 +2782,13 @@ namespace s3d
 
 				cv::Sobel(gray, detected_edges, CV_8U, dx, dy, apertureSize);
 
+				dst.copyFrom(src);
+
 				OpenCV_Bridge::FromGrayScale(detected_edges, dst, true);
 			}
 		}
 
-		void Laplacian(const Image& src, Image& dst, int32 apertureSize)
+		void Laplacian(const Image& src, Image& dst, const int32 apertureSize)
 		{
 			// 1. パラメータチェック
 			{
@@ -2672,21 +2801,35 @@ namespace s3d
 				{
 					return;
 				}
-
-				if (apertureSize % 2 == 0)
-				{
-					++apertureSize;
-				}
 			}
 
 			// 2. 出力画像のサイズ変更
 			{
 				dst.resize(src.size());
-
-				::memcpy(dst.data(), src.data(), dst.size_bytes());
 			}
 
 			// 3. 処理
+			{
+				Laplacian(ImageConstView(src), ImageView(dst), apertureSize);
+			}
+		}
+
+		void Laplacian(const ImageConstView& src, const ImageView& dst, int32 apertureSize)
+		{
+			// 1. パラメータチェック
+			{
+				if (!src || (src.size() != dst.size()))
+				{
+					return;
+				}
+
+				if (apertureSize % 2 == 0)
+				{
+					++apertureSize;
+				}
+			}
+
+			// 2. 処理
 			{
 				cv::Mat_<uint8> gray(src.height(), src.width());
 
@@ -2696,11 +2839,13 @@ namespace s3d
 
 				cv::Laplacian(gray, detected_edges, CV_8U, apertureSize);
 
+				dst.copyFrom(src);
+
 				OpenCV_Bridge::FromGrayScale(detected_edges, dst, true);
 			}
 		}
 
-		void Canny(const Image& src, Image& dst, const uint8 lowThreshold, const uint8 highThreshold, int32 apertureSize, const bool useL2Gradient)
+		void Canny(const Image& src, Image& dst, const uint8 lowThreshold, const uint8 highThreshold, const int32 apertureSize, const bool useL2Gradient)
 		{
 			// 1. パラメータチェック
 			{
@@ -2713,21 +2858,35 @@ namespace s3d
 				{
 					return;
 				}
-
-				if (apertureSize % 2 == 0)
-				{
-					++apertureSize;
-				}
 			}
 
 			// 2. 出力画像のサイズ変更
 			{
 				dst.resize(src.size());
-
-				::memcpy(dst.data(), src.data(), dst.size_bytes());
 			}
 
 			// 3. 処理
+			{
+				Canny(ImageConstView(src), ImageView(dst), lowThreshold, highThreshold, apertureSize, useL2Gradient);
+			}
+		}
+
+		void Canny(const ImageConstView& src, const ImageView& dst, const uint8 lowThreshold, const uint8 highThreshold, int32 apertureSize, const bool useL2Gradient)
+		{
+			// 1. パラメータチェック
+			{
+				if (!src || (src.size() != dst.size()))
+				{
+					return;
+				}
+
+				if (apertureSize % 2 == 0)
+				{
+					++apertureSize;
+				}
+			}
+
+			// 2. 処理
 			{
 				cv::Mat_<uint8> gray(src.height(), src.width());
 
@@ -2739,11 +2898,13 @@ namespace s3d
 
 				cv::Canny(detected_edges, detected_edges, lowThreshold, highThreshold, apertureSize, useL2Gradient);
 
+				dst.copyFrom(src);
+
 				OpenCV_Bridge::FromGrayScale(detected_edges, dst, true);
 			}
 		}
 
-		void EdgePreservingFilter(const Image& src, Image& dst, EdgePreservingFilterType filterType, double sigma_s, double sigma_r)
+		void EdgePreservingFilter(const Image& src, Image& dst, const EdgePreservingFilterType filterType, const double sigma_s, const double sigma_r)
 		{
 			// 1. パラメータチェック
 			{
@@ -2756,11 +2917,25 @@ namespace s3d
 			// 2. 出力画像のサイズ変更
 			{
 				dst.resize(src.size());
-
-				::memcpy(dst.data(), src.data(), dst.size_bytes());
 			}
 
 			// 3. 処理
+			{
+				EdgePreservingFilter(ImageConstView(src), ImageView(dst), filterType, sigma_s, sigma_r);
+			}
+		}
+
+		void EdgePreservingFilter(const ImageConstView& src, const ImageView& dst, const EdgePreservingFilterType filterType, const double sigma_s, const double sigma_r)
+		{
+			// 1. パラメータチェック
+			{
+				if (!src || (src.size() != dst.size()))
+				{
+					return;
+				}
+			}
+
+			// 2. 処理
 			{
 				cv::Mat_<cv::Vec3b> matSrc(src.height(), src.width());
 
@@ -2773,11 +2948,13 @@ namespace s3d
 					? cv::RECURS_FILTER : cv::NORMCONV_FILTER,
 					static_cast<float>(sigma_s), static_cast<float>(sigma_r));
 
+				dst.copyFrom(src);
+
 				OpenCV_Bridge::FromMat(matDst, dst, true);
 			}
 		}
 
-		void DetailEnhance(const Image& src, Image& dst, double sigma_s, double sigma_r)
+		void DetailEnhance(const Image& src, Image& dst, const double sigma_s, const double sigma_r)
 		{
 			// 1. パラメータチェック
 			{
@@ -2790,11 +2967,25 @@ namespace s3d
 			// 2. 出力画像のサイズ変更
 			{
 				dst.resize(src.size());
-
-				::memcpy(dst.data(), src.data(), dst.size_bytes());
 			}
 
 			// 3. 処理
+			{
+				DetailEnhance(ImageConstView(src), ImageView(dst), sigma_s, sigma_r);
+			}
+		}
+
+		void DetailEnhance(const ImageConstView& src, const ImageView& dst, const double sigma_s, const double sigma_r)
+		{
+			// 1. パラメータチェック
+			{
+				if (!src || (src.size() != dst.size()))
+				{
+					return;
+				}
+			}
+
+			// 2. 処理
 			{
 				cv::Mat_<cv::Vec3b> matSrc(src.height(), src.width());
 
@@ -2804,11 +2995,13 @@ namespace s3d
 
 				cv::detailEnhance(matSrc, matDst, static_cast<float>(sigma_s), static_cast<float>(sigma_r));
 
+				dst.copyFrom(src);
+
 				OpenCV_Bridge::FromMat(matDst, dst, true);
 			}
 		}
 
-		void Stylization(const Image& src, Image& dst, double sigma_s, double sigma_r)
+		void Stylization(const Image& src, Image& dst, const double sigma_s, const double sigma_r)
 		{
 			// 1. パラメータチェック
 			{
@@ -2821,11 +3014,25 @@ namespace s3d
 			// 2. 出力画像のサイズ変更
 			{
 				dst.resize(src.size());
-
-				::memcpy(dst.data(), src.data(), dst.size_bytes());
 			}
 
 			// 3. 処理
+			{
+				Stylization(ImageConstView(src), ImageView(dst), sigma_s, sigma_r);
+			}
+		}
+
+		void Stylization(const ImageConstView& src, const ImageView& dst, const double sigma_s, const double sigma_r)
+		{
+			// 1. パラメータチェック
+			{
+				if (!src || (src.size() != dst.size()))
+				{
+					return;
+				}
+			}
+
+			// 2. 処理
 			{
 				cv::Mat_<cv::Vec3b> matSrc(src.height(), src.width());
 
@@ -2835,11 +3042,13 @@ namespace s3d
 
 				cv::stylization(matSrc, matDst, static_cast<float>(sigma_s), static_cast<float>(sigma_r));
 
+				dst.copyFrom(src);
+
 				OpenCV_Bridge::FromMat(matDst, dst, true);
 			}
 		}
 
-		ColorF SSIM(const Image& image1, const Image& image2)
+		ColorF SSIM(const ImageConstView& image1, const ImageConstView& image2)
 		{
 			if (image1.size() != image2.size())
 			{
@@ -2964,5 +3173,293 @@ namespace s3d
 				OpenCV_Bridge::FromMat(matDst, result, true);
 			}
 		}
+
+		void SwapRB(const ImageConstView& src, const ImageView& dst)
+		{
+			detail::ApplyPixelKernel(src, dst, [&](Color* pixels, const size_t count)
+			{
+				PixelKernel::SwapRB(pixels, count);
+			});
+		}
+
+		void Negate(const ImageConstView& src, const ImageView& dst)
+		{
+			detail::ApplyPixelKernel(src, dst, [&](Color* pixels, const size_t count)
+			{
+				PixelKernel::Negate(pixels, count);
+			});
+		}
+
+		void Grayscale(const ImageConstView& src, const ImageView& dst)
+		{
+			detail::ApplyPixelKernel(src, dst, [&](Color* pixels, const size_t count)
+			{
+				PixelKernel::Grayscale(pixels, count);
+			});
+		}
+
+		void Sepia(const ImageConstView& src, const ImageView& dst, const int32 level)
+		{
+			detail::ApplyPixelKernel(src, dst, [&](Color* pixels, const size_t count)
+			{
+				PixelKernel::Sepia(pixels, count, level);
+			});
+		}
+
+		void Postarize(const ImageConstView& src, const ImageView& dst, const int32 level)
+		{
+			uint8 colorTable[256];
+
+			detail::SetupPostarizeTable(level, colorTable);
+
+			detail::ApplyPixelKernel(src, dst, [&](Color* pixels, const size_t count)
+			{
+				PixelKernel::ApplyTable(pixels, count, colorTable);
+			});
+		}
+
+		void Brighten(const ImageConstView& src, const ImageView& dst, const int32 level)
+		{
+			detail::ApplyPixelKernel(src, dst, [&](Color* pixels, const size_t count)
+			{
+				PixelKernel::Brighten(pixels, count, level);
+			});
+		}
+
+		void GammaCorrect(const ImageConstView& src, const ImageView& dst, const double gamma)
+		{
+			uint8 colorTable[256];
+
+			detail::SetupGammmaTable(gamma, colorTable);
+
+			detail::ApplyPixelKernel(src, dst, [&](Color* pixels, const size_t count)
+			{
+				PixelKernel::ApplyTable(pixels, count, colorTable);
+			});
+		}
+
+		void Threshold(const ImageConstView& src, const ImageView& dst, const uint8 threshold, const bool inverse)
+		{
+			detail::ApplyPixelKernel(src, dst, [&](Color* pixels, const size_t count)
+			{
+				PixelKernel::Threshold(pixels, count, threshold, inverse);
+			});
+		}
+
+		void Mosaic(const ImageConstView& src, const ImageView& dst, const int32 size, const ImageExecution execution)
+		{
+			Mosaic(src, dst, size, size, execution);
+		}
+
+		void Mosaic(const ImageConstView& src, const ImageView& dst, const int32 horizontal, const int32 vertical, const ImageExecution execution)
+		{
+			// 1. パラメータチェック
+			{
+				if (!src || (src.size() != dst.size()))
+				{
+					return;
+				}
+
+				dst.copyFrom(src);
+
+				if ((horizontal < 1 || vertical < 1) || (horizontal == 1 && vertical == 1))
+				{
+					return;
+				}
+			}
+
+			// 2. 処理
+			{
+				detail::Mosaic(dst, horizontal, vertical, detail::IsParallel(execution, dst.num_pixels()));
+			}
+		}
+
+		void Blur(const ImageConstView& src, const ImageView& dst, const int32 size, const ImageExecution execution)
+		{
+			Blur(src, dst, size, size, execution);
+		}
+
+		void Blur(const ImageConstView& src, const ImageView& dst, const int32 horizontal, const int32 vertical, const ImageExecution execution)
+		{
+			// 1. パラメータチェック
+			{
+				if (!src || (src.size() != dst.size()))
+				{
+					return;
+				}
+
+				if ((horizontal < 0 || vertical < 0) || (horizontal == 0 && vertical == 0))
+				{
+					return dst.copyFrom(src);
+				}
+			}
+
+			// 2. 処理
+			{
+				const bool parallel = detail::IsParallel(execution, src.num_pixels());
+
+				detail::ProcessViews(src, dst, !parallel, [&](const ImageView& out)
+				{
+					detail::ApplyFilter(src, out, vertical, parallel, [=](const cv::Mat_<cv::Vec4b>& matSrc, cv::Mat_<cv::Vec4b>& matDst)
+					{
+						cv::blur(matSrc, matDst, cv::Size(horizontal * 2 + 1, vertical * 2 + 1));
+					});
+				});
+			}
+		}
+
+		void MedianBlur(const ImageConstView& src, const ImageView& dst, int32 apertureSize, const ImageExecution execution)
+		{
+			// 1. パラメータチェック
+			{
+				if (!src || (src.size() != dst.size()))
+				{
+					return;
+				}
+
+				if (apertureSize < 1)
+				{
+					return dst.copyFrom(src);
+				}
+
+				if (apertureSize % 2 == 0)
+				{
+					++apertureSize;
+				}
+			}
+
+			// 2. 処理
+			{
+				const bool parallel = detail::IsParallel(execution, src.num_pixels());
+
+				detail::ProcessViews(src, dst, false, [&](const ImageView& out)
+				{
+					detail::ApplyFilter(src, out, apertureSize / 2, parallel, [=](const cv::Mat_<cv::Vec4b>& matSrc, cv::Mat_<cv::Vec4b>& matDst)
+					{
+						cv::medianBlur(matSrc, matDst, apertureSize);
+					});
+				});
+			}
+		}
+
+		void GaussianBlur(const ImageConstView& src, const ImageView& dst, const int32 size, const BorderType borderType, const ImageExecution execution)
+		{
+			GaussianBlur(src, dst, size, size, borderType, execution);
+		}
+
+		void GaussianBlur(const ImageConstView& src, const ImageView& dst, const int32 horizontal, const int32 vertical, const BorderType borderType, const ImageExecution execution)
+		{
+			// 1. パラメータチェック
+			{
+				if (!src || (src.size() != dst.size()))
+				{
+					return;
+				}
+
+				if ((horizontal < 0 || vertical < 0) || (horizontal == 0 && vertical == 0))
+				{
+					return dst.copyFrom(src);
+				}
+			}
+
+			// 2. 処理
+			{
+				const bool parallel = detail::IsParallel(execution, src.num_pixels());
+
+				detail::ProcessViews(src, dst, !parallel, [&](const ImageView& out)
+				{
+					detail::ApplyFilter(src, out, vertical, parallel, [=](const cv::Mat_<cv::Vec4b>& matSrc, cv::Mat_<cv::Vec4b>& matDst)
+					{
+						cv::GaussianBlur(matSrc, matDst, cv::Size(horizontal * 2 + 1, vertical * 2 + 1), 0.0, 0.0, detail::ConvertBorderType(borderType));
+					});
+				});
+			}
+		}
+
+		void Dilate(const ImageConstView& src, const ImageView& dst, const int32 iterations, const ImageExecution execution)
+		{
+			// 1. パラメータチェック
+			{
+				if (!src || (src.size() != dst.size()))
+				{
+					return;
+				}
+
+				if (iterations < 1)
+				{
+					return dst.copyFrom(src);
+				}
+			}
+
+			// 2. 処理
+			{
+				const bool parallel = detail::IsParallel(execution, src.num_pixels());
+
+				detail::ProcessViews(src, dst, !parallel, [&](const ImageView& out)
+				{
+					detail::ApplyFilter(src, out, iterations, parallel, [=](const cv::Mat_<cv::Vec4b>& matSrc, cv::Mat_<cv::Vec4b>& matDst)
+					{
+						cv::dilate(matSrc, matDst, cv::Mat(), cv::Point(-1, -1), iterations);
+					});
+				});
+			}
+		}
+
+		void Erode(const ImageConstView& src, const ImageView& dst, const int32 iterations, const ImageExecution execution)
+		{
+			// 1. パラメータチェック
+			{
+				if (!src || (src.size() != dst.size()))
+				{
+					return;
+				}
+
+				if (iterations < 1)
+				{
+					return dst.copyFrom(src);
+				}
+			}
+
+			// 2. 処理
+			{
+				const bool parallel = detail::IsParallel(execution, src.num_pixels());
+
+				detail::ProcessViews(src, dst, !parallel, [&](const ImageView& out)
+				{
+					detail::ApplyFilter(src, out, iterations, parallel, [=](const cv::Mat_<cv::Vec4b>& matSrc, cv::Mat_<cv::Vec4b>& matDst)
+					{
+						cv::erode(matSrc, matDst, cv::Mat(), cv::Point(-1, -1), iterations);
+					});
+				});
+			}
+		}
+
+		void Resize(const ImageConstView& src, const ImageView& dst, Interpolation interpolation, const ImageExecution execution)
+		{
+			// 1. パラメータチェック
+			{
+				if (!src || !dst)
+				{
+					return;
+				}
+
+				if (src.size() == dst.size())
+				{
+					return dst.copyFrom(src);
+				}
+			}
+
+			// 2. 処理
+			{
+				interpolation = detail::SelectInterpolation(interpolation, src.width(), src.height(), dst.width(), dst.height());
+
+				const bool parallel = detail::IsParallel(execution, std::max(src.num_pixels(), dst.num_pixels()));
+
+				detail::ProcessViews(src, dst, false, [&](const ImageView& out)
+				{
+					detail::Resize(src, out, interpolation, parallel);
+				});
+			}
+		}
 	}
 }
@@ -0,0 +1,127 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/ImageView.hpp>
+# include <Siv3D/Image.hpp>
+# include <Siv3D/ImageRegion.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		// rect を [0, width) × [0, height) の範囲に収める
+		static Rect ClipRect(const Rect& rect, const int32 width, const int32 height) noexcept
+		{
+			const int32 x0 = Clamp(rect.x, 0, width);
+			const int32 y0 = Clamp(rect.y, 0, height);
+			const int32 x1 = Clamp(rect.x + rect.w, x0, width);
+			const int32 y1 = Clamp(rect.y + rect.h, y0, height);
+
+			return Rect(x0, y0, x1 - x0, y1 - y0);
+		}
+
+		static const uint8* GetEnd(const ImageConstView& view) noexcept
+		{
+			return static_cast<const uint8*>(static_cast<const void*>(view[view.height() - 1] + view.width()));
+		}
+	}
+
+	ImageConstView::ImageConstView(const Image& image) noexcept
+		: ImageConstView(image.data(), image.width(), image.height(), image.stride()) {}
+
+	ImageConstView::ImageConstView(const Image& image, const Rect& rect) noexcept
+		: ImageConstView(ImageConstView(image)(rect)) {}
+
+	ImageConstView::ImageConstView(const ImageRegion& region) noexcept
+		: ImageConstView(region.m_imageRef, region.m_rect) {}
+
+	ImageConstView ImageConstView::operator ()(const Rect& rect) const noexcept
+	{
+		const Rect rc = detail::ClipRect(rect, m_width, m_height);
+
+		if (rc.area() == 0)
+		{
+			return ImageConstView();
+		}
+
+		return ImageConstView(operator[](rc.y) + rc.x, rc.w, rc.h, m_stride);
+	}
+
+	bool ImageConstView::overlaps(const ImageConstView& other) const noexcept
+	{
+		if (isEmpty() || other.isEmpty())
+		{
+			return false;
+		}
+
+		const uint8* const begin = static_cast<const uint8*>(static_cast<const void*>(m_data));
+		const uint8* const otherBegin = static_cast<const uint8*>(static_cast<const void*>(other.m_data));
+
+		return (begin < detail::GetEnd(other)) && (otherBegin < detail::GetEnd(*this));
+	}
+
+	ImageView::ImageView(Image& image) noexcept
+		: ImageView(image.data(), image.width(), image.height(), image.stride()) {}
+
+	ImageView::ImageView(Image& image, const Rect& rect) noexcept
+		: ImageView(ImageView(image)(rect)) {}
+
+	ImageView ImageView::operator ()(const Rect& rect) const noexcept
+	{
+		const Rect rc = detail::ClipRect(rect, m_width, m_height);
+
+		if (rc.area() == 0)
+		{
+			return ImageView();
+		}
+
+		return ImageView(operator[](rc.y) + rc.x, rc.w, rc.h, m_stride);
+	}
+
+	void ImageView::fill(const Color& color) const noexcept
+	{
+		for (int32 y = 0; y < m_height; ++y)
+		{
+			Color* pDst = operator[](y);
+
+			for (int32 x = 0; x < m_width; ++x)
+			{
+				pDst[x] = color;
+			}
+		}
+	}
+
+	void ImageView::copyFrom(const ImageConstView& src) const noexcept
+	{
+		if ((src.size() != size()) || (src.data() == m_data))
+		{
+			return;
+		}
+
+		const size_t rowBytes = m_width * sizeof(Color);
+
+		// 領域が重なっている場合でも正しくコピーされるよう、行をたどる向きを選ぶ
+		if (src.data() < m_data)
+		{
+			for (int32 y = m_height - 1; 0 <= y; --y)
+			{
+				::memmove(operator[](y), src[y], rowBytes);
+			}
+		}
+		else
+		{
+			for (int32 y = 0; y < m_height; ++y)
+			{
+				::memmove(operator[](y), src[y], rowBytes);
+			}
+		}
+	}
+}
@@ -18,6 +18,7 @@
 # include "TGA/ImageFormat_TGA.hpp"
 # include <Siv3D/IReader.hpp>
 # include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/ArchivedFileReader.hpp>
 # include <Siv3D/MemoryWriter.hpp>
 # include <Siv3D/FileSystem.hpp>
 # include <Siv3D/Logger.hpp>
@@ -92,6 +93,14 @@ namespace s3d
 
 	Image CImageFormat::load(const FilePath& path) const
 	{
+		// マウントされているアーカイブ内のファイルを優先する
+		if (ArchivedFileReader archived{ path })
+		{
+			const ImageFormat format = getFormatFromReader(archived, path);
+
+			return decode(std::move(archived), format);
+		}
+
 		BinaryReader reader(path);
 
 		const auto it = findFormat(reader, path);
@@ -12,46 +12,518 @@
 # define RAPIDJSON_SSE2
 # include "../../ThirdParty/rapidjson/rapidjson.h"
 # include "../../ThirdParty/rapidjson/document.h"
+# include "../../ThirdParty/rapidjson/reader.h"
 # include <Siv3D/JSONReader.hpp>
 # include <Siv3D/TextReader.hpp>
+# include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/Unicode.hpp>
 
 namespace s3d
 {
 	namespace detail
 	{
+		// DOM は UTF-8 のまま保持し、String への変換は値を取得するときに行う
+		using RapidJSONValue = rapidjson::GenericValue<rapidjson::UTF8<char>>;
+
+		using RapidJSONDocument = rapidjson::GenericDocument<rapidjson::UTF8<char>>;
+
+		constexpr uint32 JSONParseFlags = rapidjson::kParseCommentsFlag
+			| rapidjson::kParseTrailingCommasFlag
+			| rapidjson::kParseNanAndInfFlag;
+
+		[[nodiscard]] static String ToString(const RapidJSONValue& value)
+		{
+			return Unicode::FromUTF8(std::string_view(value.GetString(), value.GetStringLength()));
+		}
+
+		[[nodiscard]] static RapidJSONValue::ConstMemberIterator FindMember(const RapidJSONValue& object, const String& name)
+		{
+			const std::string key = Unicode::ToUTF8(name);
+
+			return object.FindMember(RapidJSONValue(rapidjson::StringRef(key.data(), key.size())));
+		}
+
+		[[nodiscard]] static bool HasUTF8BOM(const char* text, const size_t size)
+		{
+			return (size >= 3) && (static_cast<uint8>(text[0]) == 0xEF) && (static_cast<uint8>(text[1]) == 0xBB) && (static_cast<uint8>(text[2]) == 0xBF);
+		}
+
+		[[nodiscard]] static bool HasUTF16BOM(const char* text, const size_t size)
+		{
+			return (size >= 2) && (((static_cast<uint8>(text[0]) == 0xFF) && (static_cast<uint8>(text[1]) == 0xFE))
+				|| ((static_cast<uint8>(text[0]) == 0xFE) && (static_cast<uint8>(text[1]) == 0xFF)));
+		}
+
 		struct JSONArrayIteratorDetail
 		{
-			const rapidjson::GenericValue<rapidjson::UTF32<char32>>* pValue = nullptr;
+			const detail::RapidJSONValue* pValue = nullptr;
 
 			JSONArrayIteratorDetail() = default;
 
-			explicit constexpr JSONArrayIteratorDetail(const rapidjson::GenericValue<rapidjson::UTF32<char32>>* p) noexcept
+			explicit constexpr JSONArrayIteratorDetail(const detail::RapidJSONValue* p) noexcept
 				: pValue(p) {}
 		};
 
 		struct JSONMemberIteratorDetail
 		{
-			rapidjson::GenericValue<rapidjson::UTF32<char32>>::ConstMemberIterator it;
+			detail::RapidJSONValue::ConstMemberIterator it;
 
 			JSONMemberIteratorDetail() = default;
 
-			JSONMemberIteratorDetail(const rapidjson::GenericValue<rapidjson::UTF32<char32>>::ConstMemberIterator& _it)
+			JSONMemberIteratorDetail(const detail::RapidJSONValue::ConstMemberIterator& _it)
 				: it(_it) {}
 		};
 
 		struct JSONValueDetail
 		{
-			Optional<const rapidjson::GenericValue<rapidjson::UTF32<char32>>&> value;
+			Optional<const detail::RapidJSONValue&> value;
 
 			JSONValueDetail() = default;
 
-			JSONValueDetail(const Optional<const rapidjson::GenericValue<rapidjson::UTF32<char32>>&>& _value)
+			JSONValueDetail(const Optional<const detail::RapidJSONValue&>& _value)
 				: value(_value) {}
 		};
 
 		struct JSONDocumentDetail
 		{
-			rapidjson::GenericDocument<rapidjson::UTF32<char32>> document;
+			RapidJSONDocument document;
+
+			// in-situ で解析した UTF-8 のテキスト。document の文字列はこの中を指す
+			Array<char> buffer;
+		};
+
+		// buffer の UTF-8 のテキストを、文字列をコピーせずにその場で解析する
+		static bool ParseInsitu(JSONDocumentDetail& document)
+		{
+			const size_t bomSize = HasUTF8BOM(document.buffer.data(), document.buffer.size()) ? 3 : 0;
+
+			document.buffer.push_back('\0');
+
+			document.document.ParseInsitu<JSONParseFlags>(document.buffer.data() + bomSize);
+
+			return !document.document.HasParseError();
+		}
+
+		// IReader から一定の大きさのバッファ単位で読み込む、rapidjson の入力ストリーム
+		class ReaderInputStream
+		{
+		public:
+
+			using Ch = char;
+
+			explicit ReaderInputStream(IReader& reader)
+				: m_reader(reader)
+				, m_buffer(BufferSize + 1)
+			{
+				fill();
+
+				if (HasUTF8BOM(m_buffer.data(), m_size))
+				{
+					m_pos = 3;
+				}
+			}
+
+			Ch Peek() const
+			{
+				return m_buffer[m_pos];
+			}
+
+			Ch Take()
+			{
+				const Ch c = m_buffer[m_pos];
+
+				if ((m_pos + 1) < m_size)
+				{
+					++m_pos;
+				}
+				else if (!m_eof)
+				{
+					fill();
+				}
+
+				return c;
+			}
+
+			size_t Tell() const
+			{
+				return (m_count + m_pos);
+			}
+
+			// 以下は出力ストリーム用で、使用しない
+			Ch* PutBegin() { RAPIDJSON_ASSERT(false); return nullptr; }
+			void Put(Ch) { RAPIDJSON_ASSERT(false); }
+			void Flush() { RAPIDJSON_ASSERT(false); }
+			size_t PutEnd(Ch*) { RAPIDJSON_ASSERT(false); return 0; }
+
+		private:
+
+			static constexpr size_t BufferSize = 64 * 1024;
+
+			IReader& m_reader;
+
+			Array<Ch> m_buffer;
+
+			// バッファ内の有効な文字数（終端の '\0' を含む）
+			size_t m_size = 0;
+
+			size_t m_pos = 0;
+
+			// 現在のバッファより前に読み込んだ文字数
+			size_t m_count = 0;
+
+			bool m_eof = false;
+
+			void fill()
+			{
+				m_count += m_size;
+
+				const int64 readSize = std::max<int64>(m_reader.read(m_buffer.data(), BufferSize), 0);
+
+				m_size = static_cast<size_t>(readSize);
+				m_pos = 0;
+
+				// ファイルの終わりに '\0' を置き、以降はそこにとどまる
+				if (m_size < BufferSize)
+				{
+					m_buffer[m_size++] = '\0';
+					m_eof = true;
+				}
+			}
+		};
+
+		struct JSONStreamReaderDetail
+		{
+			std::shared_ptr<IReader> reader;
+		};
+
+		template <class Handler>
+		static bool ParseStream(IReader& reader, Handler& handler)
+		{
+			char bom[2] = {};
+
+			// UTF-16 には対応しない
+			if (reader.read(bom, 0, 2) == 2 && HasUTF16BOM(bom, 2))
+			{
+				return false;
+			}
+
+			reader.setPos(0);
+
+			ReaderInputStream stream(reader);
+
+			rapidjson::Reader parser;
+
+			return !parser.Parse<JSONParseFlags>(stream, handler).IsError();
+		}
+
+		// すべてのイベントを JSONStreamEvent として通知する
+		class StreamEventHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<char>, StreamEventHandler>
+		{
+		private:
+
+			const std::function<bool(const JSONStreamEvent&)>& m_handler;
+
+			JSONStreamEvent m_event;
+
+			size_t m_depth = 0;
+
+			bool emit(const JSONStreamEventType type)
+			{
+				m_event.type = type;
+				m_event.depth = m_depth;
+
+				return m_handler(m_event);
+			}
+
+			bool number(const double value, const Optional<int64>& integer)
+			{
+				m_event.number = value;
+				m_event.integer = integer;
+
+				return emit(JSONStreamEventType::Number);
+			}
+
+		public:
+
+			explicit StreamEventHandler(const std::function<bool(const JSONStreamEvent&)>& handler)
+				: m_handler(handler) {}
+
+			bool Null() { return emit(JSONStreamEventType::Null); }
+
+			bool Bool(const bool b)
+			{
+				m_event.boolValue = b;
+
+				return emit(JSONStreamEventType::Bool);
+			}
+
+			bool Int(const int i) { return number(i, int64(i)); }
+
+			bool Uint(const unsigned u) { return number(u, int64(u)); }
+
+			bool Int64(const int64_t i) { return number(static_cast<double>(i), int64(i)); }
+
+			bool Uint64(const uint64_t u)
+			{
+				return number(static_cast<double>(u), (u <= static_cast<uint64>(std::numeric_limits<int64>::max())) ? Optional<int64>(static_cast<int64>(u)) : none);
+			}
+
+			bool Double(const double d) { return number(d, none); }
+
+			bool String(const char* str, const rapidjson::SizeType length, bool)
+			{
+				m_event.utf8 = std::string_view(str, length);
+
+				return emit(JSONStreamEventType::String);
+			}
+
+			bool Key(const char* str, const rapidjson::SizeType length, bool)
+			{
+				m_event.utf8 = std::string_view(str, length);
+
+				return emit(JSONStreamEventType::Key);
+			}
+
+			bool StartObject()
+			{
+				const bool result = emit(JSONStreamEventType::StartObject);
+
+				++m_depth;
+
+				return result;
+			}
+
+			bool EndObject(rapidjson::SizeType)
+			{
+				--m_depth;
+
+				return emit(JSONStreamEventType::EndObject);
+			}
+
+			bool StartArray()
+			{
+				const bool result = emit(JSONStreamEventType::StartArray);
+
+				++m_depth;
+
+				return result;
+			}
+
+			bool EndArray(rapidjson::SizeType)
+			{
+				--m_depth;
+
+				return emit(JSONStreamEventType::EndArray);
+			}
+		};
+
+		// path にある配列の要素ごとに小さな DOM を作って通知する
+		class ArrayElementHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<char>, ArrayElementHandler>
+		{
+		private:
+
+			const Array<std::string>& m_path;
+
+			const std::function<bool(const JSONValue&)>& m_handler;
+
+			// 要素の DOM。要素ごとにアロケータを空にして使い回す
+			RapidJSONDocument m_element;
+
+			// 開いているコンテナがオブジェクトであるか
+			Array<bool> m_isObject;
+
+			// 開いているコンテナのうち、先頭から path に沿っているものの数
+			size_t m_onPath = 0;
+
+			std::string m_key;
+
+			bool m_inTarget = false;
+
+			bool m_capturing = false;
+
+			size_t m_elementDepth = 0;
+
+			bool finishElement()
+			{
+				struct NoEvent
+				{
+					bool operator()(RapidJSONDocument&) const { return true; }
+				} noEvent;
+
+				// スタックに積まれた要素の値を DOM のルートに移す
+				m_element.Populate(noEvent);
+
+				const bool result = m_handler(JSONValue(detail::JSONValueDetail(Optional<const RapidJSONValue&>(m_element))));
+
+				m_element.SetNull();
+				m_element.GetAllocator().Clear();
+				m_capturing = false;
+
+				if (!result)
+				{
+					stopped = true;
+				}
+
+				return result;
+			}
+
+			// 値の始まり。要素の値であれば DOM の構築を始める
+			void beginValue()
+			{
+				if (m_inTarget && !m_capturing && (m_isObject.size() == m_elementDepth))
+				{
+					m_capturing = true;
+				}
+			}
+
+			bool scalar(const bool forwarded)
+			{
+				if (!m_capturing)
+				{
+					return true;
+				}
+
+				if (!forwarded)
+				{
+					return false;
+				}
+
+				return (m_isObject.size() == m_elementDepth) ? finishElement() : true;
+			}
+
+			bool startContainer(const bool isObject)
+			{
+				const size_t depth = m_isObject.size();
+
+				// このコンテナが path に沿っているか
+				const bool onPath = (m_onPath == depth) && (depth <= m_path.size())
+					&& ((depth == 0) || (m_isObject.back() && (m_key == m_path[depth - 1])));
+
+				if (!m_capturing && onPath && !isObject && (depth == m_path.size()))
+				{
+					m_inTarget = true;
+					m_elementDepth = depth + 1;
+				}
+
+				if (onPath)
+				{
+					++m_onPath;
+				}
+
+				m_isObject.push_back(isObject);
+
+				return true;
+			}
+
+			bool endContainer()
+			{
+				m_isObject.pop_back();
+
+				m_onPath = std::min(m_onPath, m_isObject.size());
+
+				if (m_capturing && (m_isObject.size() == m_elementDepth))
+				{
+					return finishElement();
+				}
+
+				// 配列を読み終えたら、残りは解析しない
+				if (m_inTarget && (m_isObject.size() + 1 == m_elementDepth))
+				{
+					m_inTarget = false;
+					completed = true;
+
+					return false;
+				}
+
+				return true;
+			}
+
+		public:
+
+			bool completed = false;
+
+			bool stopped = false;
+
+			ArrayElementHandler(const Array<std::string>& path, const std::function<bool(const JSONValue&)>& handler)
+				: m_path(path)
+				, m_handler(handler) {}
+
+			bool Null() { beginValue(); return scalar(!m_capturing || m_element.Null()); }
+
+			bool Bool(const bool b) { beginValue(); return scalar(!m_capturing || m_element.Bool(b)); }
+
+			bool Int(const int i) { beginValue(); return scalar(!m_capturing || m_element.Int(i)); }
+
+			bool Uint(const unsigned u) { beginValue(); return scalar(!m_capturing || m_element.Uint(u)); }
+
+			bool Int64(const int64_t i) { beginValue(); return scalar(!m_capturing || m_element.Int64(i)); }
+
+			bool Uint64(const uint64_t u) { beginValue(); return scalar(!m_capturing || m_element.Uint64(u)); }
+
+			bool Double(const double d) { beginValue(); return scalar(!m_capturing || m_element.Double(d)); }
+
+			bool String(const char* str, const rapidjson::SizeType length, const bool copy)
+			{
+				beginValue();
+
+				return scalar(!m_capturing || m_element.String(str, length, copy));
+			}
+
+			bool Key(const char* str, const rapidjson::SizeType length, const bool copy)
+			{
+				if (m_capturing)
+				{
+					return m_element.Key(str, length, copy);
+				}
+
+				m_key.assign(str, length);
+
+				return true;
+			}
+
+			bool StartObject()
+			{
+				beginValue();
+
+				if (m_capturing && !m_element.StartObject())
+				{
+					return false;
+				}
+
+				return startContainer(true);
+			}
+
+			bool EndObject(const rapidjson::SizeType memberCount)
+			{
+				if (m_capturing && !m_element.EndObject(memberCount))
+				{
+					return false;
+				}
+
+				return endContainer();
+			}
+
+			bool StartArray()
+			{
+				beginValue();
+
+				if (m_capturing && !m_element.StartArray())
+				{
+					return false;
+				}
+
+				return startContainer(false);
+			}
+
+			bool EndArray(const rapidjson::SizeType elementCount)
+			{
+				if (m_capturing && !m_element.EndArray(elementCount))
+				{
+					return false;
+				}
+
+				return endContainer();
+			}
 		};
 	}
 
@@ -95,7 +567,7 @@ namespace s3d
 
 	JSONValue JSONArrayIterator::operator *() const
 	{
-		return JSONValue(Optional<const rapidjson::GenericValue<rapidjson::UTF32<char32>>&>(*(m_detail->pValue)));
+		return JSONValue(Optional<const detail::RapidJSONValue&>(*(m_detail->pValue)));
 	}
 
 	bool JSONArrayIterator::operator ==(const JSONArrayIterator& other) const noexcept
@@ -143,8 +615,8 @@ namespace s3d
 
 	JSONObjectMember JSONObjectIterator::operator *() const
 	{
-		return{ String(m_detail->it->name.GetString(), m_detail->it->name.GetStringLength()),
-			JSONValue(Optional<const rapidjson::GenericValue<rapidjson::UTF32<char32>>&>(m_detail->it->value)) };
+		return{ detail::ToString(m_detail->it->name),
+			JSONValue(Optional<const detail::RapidJSONValue&>(m_detail->it->value)) };
 	}
 
 	bool JSONObjectIterator::operator ==(const JSONObjectIterator& other) const noexcept
@@ -195,12 +667,19 @@ namespace s3d
 
 		for (const auto& p : path.split(U'.'))
 		{
-			if (!value->HasMember(p.c_str()))
+			if (!value->IsObject())
+			{
+				return JSONValue();
+			}
+
+			const auto it = detail::FindMember(*value, p);
+
+			if (it == value->MemberEnd())
 			{
 				return JSONValue();
 			}
 
-			value = Optional<const rapidjson::GenericValue<rapidjson::UTF32<char32>>&>((*value)[p.c_str()]);
+			value = Optional<const detail::RapidJSONValue&>(it->value);
 		}
 
 		return JSONValue(detail::JSONValueDetail(value));
@@ -262,7 +741,7 @@ namespace s3d
 			return false;
 		}
 
-		return m_detail->value->HasMember(name.c_str());
+		return detail::FindMember(*m_detail->value, name) != m_detail->value->MemberEnd();
 	}
 
 	JSONObjectView JSONValue::objectView() const
@@ -316,7 +795,7 @@ namespace s3d
 			return String();
 		}
 
-		return String(m_detail->value->GetString(), m_detail->value->GetStringLength());
+		return detail::ToString(*m_detail->value);
 	}
 
 	template <>
@@ -327,7 +806,7 @@ namespace s3d
 			return none;
 		}
 
-		return Optional<String>(InPlace, m_detail->value->GetString(), m_detail->value->GetStringLength());
+		return detail::ToString(*m_detail->value);
 	}
 
 	template Optional<String> JSONValue::getOpt<String>() const;
@@ -458,18 +937,41 @@ namespace s3d
 			close();
 		}
 
-		const String text = TextReader(path).readAll();
+		{
+			BinaryReader reader(path, ReadAccessHint::Sequential);
+
+			if (!reader)
+			{
+				return false;
+			}
 
-		rapidjson::GenericStringStream<rapidjson::UTF32<char32>> m_stream(text.c_str());
+			// in-situ で解析するバッファへ直接読み込む（終端文字の分も確保しておく）
+			const size_t size = static_cast<size_t>(reader.size());
 
-		constexpr uint32 flags = rapidjson::kParseCommentsFlag
-			| rapidjson::kParseTrailingCommasFlag
-			| rapidjson::kParseNanAndInfFlag;
+			m_document->buffer.reserve(size + 1);
 
-		m_document->document.ParseStream<flags>(m_stream);
+			m_document->buffer.resize(size);
 
-		if (m_document->document.HasParseError())
+			if (reader.read(m_document->buffer.data(), size) != static_cast<int64>(size))
+			{
+				close();
+
+				return false;
+			}
+		}
+
+		// UTF-16 のファイルは UTF-8 に変換してから解析する
+		if (detail::HasUTF16BOM(m_document->buffer.data(), m_document->buffer.size()))
 		{
+			const std::string text = Unicode::ToUTF8(TextReader(path).readAll());
+
+			m_document->buffer.assign(text.begin(), text.end());
+		}
+
+		if (!detail::ParseInsitu(*m_document))
+		{
+			close();
+
 			return false;
 		}
 
@@ -485,18 +987,33 @@ namespace s3d
 			close();
 		}
 
-		const String text = TextReader(reader).readAll();
+		if (!reader || !reader->isOpened())
+		{
+			return false;
+		}
 
-		rapidjson::GenericStringStream<rapidjson::UTF32<char32>> m_stream(text.c_str());
+		m_document->buffer.resize(static_cast<size_t>(reader->size()));
 
-		constexpr uint32 flags = rapidjson::kParseCommentsFlag
-			| rapidjson::kParseTrailingCommasFlag
-			| rapidjson::kParseNanAndInfFlag;
+		if (reader->read(m_document->buffer.data(), 0, reader->size()) != reader->size())
+		{
+			close();
 
-		m_document->document.ParseStream<flags>(m_stream);
+			return false;
+		}
+
+		if (detail::HasUTF16BOM(m_document->buffer.data(), m_document->buffer.size()))
+		{
+			reader->setPos(0);
+
+			const std::string text = Unicode::ToUTF8(TextReader(reader).readAll());
+
+			m_document->buffer.assign(text.begin(), text.end());
+		}
 
-		if (m_document->document.HasParseError())
+		if (!detail::ParseInsitu(*m_document))
 		{
+			close();
+
 			return false;
 		}
 
@@ -509,11 +1026,114 @@ namespace s3d
 	{
 		m_detail->value.reset();
 
-		m_document->document = rapidjson::GenericDocument<rapidjson::UTF32<char32>>{};
+		m_document->document = detail::RapidJSONDocument{};
+
+		m_document->buffer.release();
 	}
 
 	bool JSONReader::isOpened() const
 	{
 		return m_detail->value.has_value();
 	}
+
+	////////////////////////////////
+	//
+	//	JSONStreamEvent
+	//
+
+	String JSONStreamEvent::getString() const
+	{
+		return Unicode::FromUTF8(utf8);
+	}
+
+	////////////////////////////////
+	//
+	//	JSONStreamReader
+	//
+
+	JSONStreamReader::JSONStreamReader()
+		: m_detail(std::make_shared<detail::JSONStreamReaderDetail>())
+	{
+
+	}
+
+	JSONStreamReader::JSONStreamReader(const FilePath& path)
+		: JSONStreamReader()
+	{
+		open(path);
+	}
+
+	JSONStreamReader::JSONStreamReader(const std::shared_ptr<IReader>& reader)
+		: JSONStreamReader()
+	{
+		open(reader);
+	}
+
+	bool JSONStreamReader::open(const FilePath& path)
+	{
+		return open(std::make_shared<BinaryReader>(path));
+	}
+
+	bool JSONStreamReader::open(const std::shared_ptr<IReader>& reader)
+	{
+		if (isOpened())
+		{
+			close();
+		}
+
+		if (!reader || !reader->isOpened())
+		{
+			return false;
+		}
+
+		m_detail->reader = reader;
+
+		return true;
+	}
+
+	void JSONStreamReader::close()
+	{
+		m_detail->reader.reset();
+	}
+
+	bool JSONStreamReader::isOpened() const
+	{
+		return static_cast<bool>(m_detail->reader);
+	}
+
+	bool JSONStreamReader::read(const std::function<bool(const JSONStreamEvent&)>& handler)
+	{
+		if (!isOpened())
+		{
+			return false;
+		}
+
+		detail::StreamEventHandler eventHandler(handler);
+
+		return detail::ParseStream(*m_detail->reader, eventHandler);
+	}
+
+	bool JSONStreamReader::readArray(const String& path, const std::function<bool(const JSONValue&)>& handler)
+	{
+		if (!isOpened())
+		{
+			return false;
+		}
+
+		Array<std::string> keys;
+
+		if (path)
+		{
+			for (const auto& key : path.split(U'.'))
+			{
+				keys.push_back(Unicode::ToUTF8(key));
+			}
+		}
+
+		detail::ArrayElementHandler elementHandler(keys, handler);
+
+		detail::ParseStream(*m_detail->reader, elementHandler);
+
+		return elementHandler.completed;
+	}
 }
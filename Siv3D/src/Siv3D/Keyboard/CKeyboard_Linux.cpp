@@ -173,6 +173,12 @@ namespace s3d
 
 	void CKeyboard_Linux::update()
 	{
+		// ヘッドレスモード
+		if (!m_glfwWindow)
+		{
+			return;
+		}
+
 		bool anyKeyDown = false;
 
 		const char* keys = ::glfwGetKeysSiv3D(m_glfwWindow);
@@ -9,77 +9,22 @@
 //
 //-----------------------------------------------
 
+# include <csignal>
+# include <exception>
 # include <Siv3D/Logger.hpp>
+# include <Siv3D/Profiler.hpp>
+# include <Siv3D/Time.hpp>
+# include <Siv3D/Unicode.hpp>
 # include "CLogger.hpp"
+# include "LogHTML.hpp"
 # include "../Siv3DEngine.hpp"
 # include "../LicenseManager/ILicenseManager.hpp"
-
-namespace s3d
-{
-constexpr static char headerA[] =
-u8R"(<!DOCTYPE html>
-<html lang="ja">
-<head>
-<meta charset="UTF-8" />
-<title>)";
-
-constexpr static char headerB[] =
-u8R"(</title>
-<style>
-body		{ background-color: #f9f9f9; font-family: 'Segoe UI','メイリオ','Meiryo','ヒラギノ角ゴ Pro W3','Hiragino Kaku Gothic Pro','Osaka','ＭＳ Ｐゴシック','MS PGothic','Arial',sans-serif; }
-h2			{ color: #333333; text-align: center; font-size: 28px; }
-h3			{ color: #333333; text-align: center; font-size: 24px; }
-div			{ font-size: 14px; line-height: 2; word-wrap: break-word; }
-div.error	{ padding-left: 14px; background: #f44336; color: #ffffff; }
-div.fail	{ padding-left: 14px; background: #ff9800; color: #ffffff; }
-div.warning	{ padding-left: 14px; background: #ff9800; color: #ffffff; }
-div.script	{ padding-left: 14px; background: #d9eeda; color: #333333; }
-div.app		{ padding-left: 14px; background: #ffffff; color: #333333; }
-div.info	{ padding-left: 14px; background: #e3f2fd; color: #333333; }
-div.debug	{ padding-left: 14px; background: #f5f5f5; color: #333333; }
-div.c0		{ color: #333333; text-align: center; font-size: 20px; }
-div.c1		{ padding-bottom: 8px; color: #555555; text-align: center; font-size: 12px; }
-div.c2		{ padding-bottom: 24px; color: #888888; text-align: center; font-size: 9px; }
-div.messages { margin: 0 10% 28px; padding 0 0 28px; border: 1px solid; border-color: #dddddd; border-radius: 2px; box-shadow: 0 1px 1px rgba(0,0,0,.05); }
-</style>
-</head>
-<body>
-<h2>)";
-
-constexpr static char headerC[] =
-u8R"(</h2>
-<div class="messages">
-)";
-
-const static std::string logLevel[]{
-	u8R"(<div class="error">)",
-	u8R"(<div class="fail">)",
-	u8R"(<div class="warning">)",
-	u8R"(<div class="script">)",
-	u8R"(<div class="app">)",
-	u8R"(<div class="info">)",
-	u8R"(<div class="debug">)",
-};
-
-constexpr static char8 divEnd[] = u8"</div>\n";
-
-constexpr static char8 licenseC0[] = u8R"-(<div class="c0">)-";
-
-constexpr static char8 licenseC1[] = u8R"-(<div class="c1">)-";
-
-constexpr static char8 licenseC2[] = u8R"-(<div class="c2">)-";
-
-constexpr static char8 footerA[] =
-u8R"-(</div><br>
-<h3>Licenses</h3>)-";
-
-constexpr static char8 footerB[] =
-u8R"-(</body>
-</html>)-";
-}
+# include "../System/ISystem.hpp"
 
 # if defined(SIV3D_TARGET_WINDOWS)
 
+# include <io.h>
+# include <fcntl.h>
 # include <Siv3D/Windows.hpp>
 
 namespace s3d
@@ -97,9 +42,14 @@ namespace s3d
 			L"[debug] ",
 		};
 
-		static void OutputDebug(const LogDescription desc, const String& text)
+		static uint64 GetCurrentThreadID()
+		{
+			return ::GetCurrentThreadId();
+		}
+
+		static void OutputDebug(const LogDescription desc, const StringView text)
 		{
-			const std::wstring textW = text.toWstr();
+			const std::wstring textW = Unicode::ToWString(text);
 			
 			std::wstring output;
 			output.reserve(logLevelStr[static_cast<size_t>(desc)].length() + textW.length() + 1);
@@ -109,6 +59,21 @@ namespace s3d
 
 			::OutputDebugStringW(output.c_str());
 		}
+
+		static int OpenCrashFile(const FilePath& path)
+		{
+			return ::_wopen(path.toWstr().c_str(), (_O_WRONLY | _O_APPEND | _O_BINARY));
+		}
+
+		static void CloseCrashFile(const int fd)
+		{
+			::_close(fd);
+		}
+
+		static void WriteCrashFile(const int fd, const char* data, const size_t size) noexcept
+		{
+			::_write(fd, data, static_cast<unsigned>(size));
+		}
 	}
 }
 
@@ -116,7 +81,17 @@ namespace s3d
 
 # include <iostream>
 # include <locale>
-# include <Siv3D/Unicode.hpp>
+# include <cerrno>
+# include <fcntl.h>
+# include <signal.h>
+# include <unistd.h>
+# include <pthread.h>
+
+# if defined(SIV3D_TARGET_LINUX)
+
+	# include <sys/syscall.h>
+
+# endif
 
 namespace s3d
 {
@@ -133,7 +108,24 @@ namespace s3d
 			"[debug]",
 		};
 
-		static void OutputDebug(const LogDescription desc, const String& text)
+		static uint64 GetCurrentThreadID()
+		{
+		# if defined(SIV3D_TARGET_LINUX)
+
+			return static_cast<uint64>(::syscall(SYS_gettid));
+
+		# else
+
+			uint64 id = 0;
+
+			::pthread_threadid_np(nullptr, &id);
+
+			return id;
+
+		# endif
+		}
+
+		static void OutputDebug(const LogDescription desc, const StringView text)
 		{
 			if (desc != LogDescription::App)
 			{
@@ -142,6 +134,38 @@ namespace s3d
 
 			std::cout << Unicode::ToUTF8(text) << '\n';
 		}
+
+		static int OpenCrashFile(const FilePath& path)
+		{
+			return ::open(path.narrow().c_str(), (O_WRONLY | O_APPEND | O_CLOEXEC));
+		}
+
+		static void CloseCrashFile(const int fd)
+		{
+			::close(fd);
+		}
+
+		static void WriteCrashFile(const int fd, const char* data, size_t size) noexcept
+		{
+			while (size)
+			{
+				const ssize_t written = ::write(fd, data, size);
+
+				if (written < 0)
+				{
+					if (errno == EINTR)
+					{
+						continue;
+					}
+
+					return;
+				}
+
+				data += written;
+
+				size -= written;
+			}
+		}
 	}
 }
 
@@ -149,6 +173,251 @@ namespace s3d
 
 namespace s3d
 {
+	namespace detail
+	{
+		static LogEntry MakeEntry(const LogDescription desc, const StringView text)
+		{
+			thread_local const uint64 threadID = GetCurrentThreadID();
+
+			uint64 frameCount = 0;
+
+			if (Siv3DEngine::isActive())
+			{
+				if (const auto system = Siv3DEngine::GetSystem())
+				{
+					frameCount = system->getSystemFrameCount();
+				}
+			}
+
+			return LogEntry{ Time::GetMicrosecSinceEpoch(), threadID, frameCount, desc, text };
+		}
+
+		// ログファイルと同じ形式の 1 行を dst に書き込む（収まらない部分は切り詰める）
+		static size_t FormatCrashText(char (&dst)[LogRingBuffer::CrashTextSize], const LogDescription desc, const StringView text)
+		{
+			const std::string& prefix = logLevel[static_cast<size_t>(desc)];
+
+			constexpr size_t suffixLength = (std::size(divEnd) - 1);
+
+			constexpr size_t limit = (LogRingBuffer::CrashTextSize - suffixLength);
+
+			size_t length = std::min(prefix.size(), limit);
+
+			std::memcpy(dst, prefix.data(), length);
+
+			Unicode::Translator_UTF32toUTF8 translator;
+
+			for (const char32 ch : text)
+			{
+				std::string_view escaped;
+
+				switch (ch)
+				{
+				case U'\"':
+					escaped = "&quot;";
+					break;
+				case U'&':
+					escaped = "&amp;";
+					break;
+				case U'\'':
+					escaped = "&apos;";
+					break;
+				case U'<':
+					escaped = "&lt;";
+					break;
+				case U'>':
+					escaped = "&gt;";
+					break;
+				default:
+					escaped = std::string_view(translator.get().data(), translator.put(ch));
+					break;
+				}
+
+				if (limit < (length + escaped.size()))
+				{
+					break;
+				}
+
+				std::memcpy(dst + length, escaped.data(), escaped.size());
+
+				length += escaped.size();
+			}
+
+			std::memcpy(dst + length, divEnd, suffixLength);
+
+			return (length + suffixLength);
+		}
+
+		static std::atomic<CLogger*> g_crashLogger = { nullptr };
+
+		static constexpr int CrashSignals[] = { SIGSEGV, SIGABRT, SIGFPE, SIGILL };
+
+		static std::terminate_handler g_previousTerminateHandler = nullptr;
+
+		// シグナルハンドラでは、非同期シグナル安全な処理（ロックフリーの atomic の読み書きと write）だけを行う
+	# if defined(SIV3D_TARGET_WINDOWS)
+
+		using SignalHandler = void(*)(int);
+
+		static SignalHandler g_previousSignalHandlers[std::size(CrashSignals)];
+
+		static void OnCrashSignal(const int sig)
+		{
+			if (CLogger* logger = g_crashLogger.load())
+			{
+				logger->writeOnCrashSignal();
+			}
+
+			for (size_t i = 0; i < std::size(CrashSignals); ++i)
+			{
+				if (CrashSignals[i] != sig)
+				{
+					continue;
+				}
+
+				// 元のハンドラに処理を引き継ぐ
+				const SignalHandler previous = g_previousSignalHandlers[i];
+
+				if ((previous != SIG_ERR) && (previous != SIG_DFL) && (previous != SIG_IGN))
+				{
+					previous(sig);
+
+					return;
+				}
+			}
+
+			std::signal(sig, SIG_DFL);
+
+			std::raise(sig);
+		}
+
+		static void InstallSignalHandlers()
+		{
+			for (size_t i = 0; i < std::size(CrashSignals); ++i)
+			{
+				g_previousSignalHandlers[i] = std::signal(CrashSignals[i], OnCrashSignal);
+			}
+		}
+
+		static void UninstallSignalHandlers()
+		{
+			for (size_t i = 0; i < std::size(CrashSignals); ++i)
+			{
+				const SignalHandler previous = g_previousSignalHandlers[i];
+
+				std::signal(CrashSignals[i], (previous == SIG_ERR) ? SIG_DFL : previous);
+			}
+		}
+
+	# else
+
+		static struct sigaction g_previousSignalActions[std::size(CrashSignals)];
+
+		static void OnCrashSignal(const int sig, siginfo_t* const info, void* const context)
+		{
+			if (CLogger* logger = g_crashLogger.load())
+			{
+				logger->writeOnCrashSignal();
+			}
+
+			for (size_t i = 0; i < std::size(CrashSignals); ++i)
+			{
+				if (CrashSignals[i] != sig)
+				{
+					continue;
+				}
+
+				// アプリケーションが先に登録したハンドラがあれば、処理を引き継ぐ
+				const struct sigaction& previous = g_previousSignalActions[i];
+
+				if (previous.sa_flags & SA_SIGINFO)
+				{
+					if (previous.sa_sigaction)
+					{
+						previous.sa_sigaction(sig, info, context);
+
+						return;
+					}
+				}
+				else if ((previous.sa_handler != SIG_DFL) && (previous.sa_handler != SIG_IGN))
+				{
+					previous.sa_handler(sig);
+
+					return;
+				}
+
+				// 元の動作に戻して、同じシグナルを送り直す
+				::sigaction(sig, &previous, nullptr);
+
+				break;
+			}
+
+			::raise(sig);
+		}
+
+		static void InstallSignalHandlers()
+		{
+			struct sigaction action = {};
+
+			action.sa_sigaction = OnCrashSignal;
+
+			action.sa_flags = SA_SIGINFO;
+
+			::sigemptyset(&action.sa_mask);
+
+			for (size_t i = 0; i < std::size(CrashSignals); ++i)
+			{
+				::sigaction(CrashSignals[i], &action, &g_previousSignalActions[i]);
+			}
+		}
+
+		static void UninstallSignalHandlers()
+		{
+			for (size_t i = 0; i < std::size(CrashSignals); ++i)
+			{
+				::sigaction(CrashSignals[i], &g_previousSignalActions[i], nullptr);
+			}
+		}
+
+	# endif
+
+		static void OnTerminate()
+		{
+			if (CLogger* logger = g_crashLogger.load())
+			{
+				logger->flushOnCrash();
+			}
+
+			if (g_previousTerminateHandler)
+			{
+				g_previousTerminateHandler();
+			}
+
+			std::abort();
+		}
+
+		static void InstallCrashHandlers(CLogger* logger)
+		{
+			g_crashLogger = logger;
+
+			InstallSignalHandlers();
+
+			g_previousTerminateHandler = std::set_terminate(OnTerminate);
+		}
+
+		static void UninstallCrashHandlers()
+		{
+			if (!g_crashLogger.exchange(nullptr))
+			{
+				return;
+			}
+
+			UninstallSignalHandlers();
+
+			std::set_terminate(g_previousTerminateHandler);
+		}
+	}
+
 	CLogger::CLogger()
 	{
 
@@ -156,6 +425,20 @@ namespace s3d
 
 	CLogger::~CLogger()
 	{
+		setAsync(false, LogOverflowPolicy::Block);
+
+		detail::UninstallCrashHandlers();
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			drainLocked();
+
+			flushLocked();
+
+			m_sinks.clear();
+		}
+
 		m_initialized = false;
 
 		m_writer.writeUTF8(footerA);
@@ -164,6 +447,13 @@ namespace s3d
 
 		m_writer.writeUTF8(footerB);
 
+		if (m_crashFile != -1)
+		{
+			detail::CloseCrashFile(m_crashFile);
+
+			m_crashFile = -1;
+		}
+
 		const FilePath path = m_writer.path();
 
 		m_writer.close();
@@ -214,6 +504,13 @@ namespace s3d
 
 		m_initialized = true;
 
+		// シグナルハンドラではファイルを開けないので、あらかじめ開いておく
+		m_writer.flush();
+
+		m_crashFile = detail::OpenCrashFile(m_writer.path());
+
+		detail::InstallCrashHandlers(this);
+
 		LOG_INFO(U"ℹ️ Logger initialized");
 
 		return true;
@@ -224,63 +521,147 @@ namespace s3d
 		m_outputLevel = level;
 	}
 
-	void CLogger::write(const LogDescription desc, const String& text)
+	void CLogger::setAsync(const bool enabled, const LogOverflowPolicy policy)
 	{
-		if (suppressed(desc))
+		std::lock_guard<std::mutex> modeLock(m_modeMutex);
+
+		m_overflowPolicy = policy;
+
+		if (enabled == m_async)
 		{
 			return;
 		}
 
+		if (enabled)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+
+				if (!m_buffer)
+				{
+					m_buffer = std::make_unique<LogRingBuffer>(AsyncBufferCapacity);
+				}
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(m_wakeMutex);
+
+				m_exitThread = false;
+			}
+
+			m_thread = std::thread(&CLogger::threadMain, this);
+
+			m_async.store(true, std::memory_order_release);
+		}
+		else
+		{
+			m_async.store(false, std::memory_order_release);
+
+			stopThread();
+		}
+	}
+
+	bool CLogger::isAsync() const
+	{
+		return m_async;
+	}
+
+	void CLogger::flush()
+	{
 		std::lock_guard<std::mutex> lock(m_mutex);
 
-		detail::OutputDebug(desc, text);
+		drainLocked();
 
-		if (m_initialized)
+		flushLocked();
+	}
+
+	size_t CLogger::getDroppedCount() const
+	{
+		return m_droppedCount;
+	}
+
+	void CLogger::addSink(const std::shared_ptr<ILogSink>& sink)
+	{
+		if (!sink)
 		{
-			m_writer.writeUTF8(logLevel[static_cast<size_t>(desc)]);
+			return;
+		}
 
-			m_writer.write(text.xml_escaped());
+		std::lock_guard<std::mutex> lock(m_mutex);
 
-			m_writer.writeUTF8(divEnd);
+		// 追加する前のログが新しい出力先に書き込まれないようにする
+		drainLocked();
+
+		if (!m_sinks.includes(sink))
+		{
+			m_sinks.push_back(sink);
 		}
+	}
 
-		if (desc == LogDescription::Error)
+	void CLogger::removeSink(const std::shared_ptr<ILogSink>& sink)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		drainLocked();
+
+		if (m_sinks.includes(sink))
 		{
-			m_hasImportantLog = true;
+			sink->flush();
+
+			m_sinks.remove(sink);
 		}
 	}
 
-	void CLogger::writeOnce(const LogDescription desc, const uint32 id, const String& text)
+	void CLogger::write(const LogDescription desc, const String& text)
 	{
 		if (suppressed(desc))
 		{
 			return;
 		}
 
+		if (m_async.load(std::memory_order_acquire))
+		{
+			const LogEntry entry = detail::MakeEntry(desc, text);
+
+			LogRecord record{ LogRecord::Type::Text, desc, entry.timestamp, entry.threadID, entry.frameCount, text, {} };
+
+			char crashText[LogRingBuffer::CrashTextSize];
+
+			const size_t crashTextLength = detail::FormatCrashText(crashText, desc, text);
+
+			if (push(record, crashText, crashTextLength))
+			{
+				return;
+			}
+		}
+
 		std::lock_guard<std::mutex> lock(m_mutex);
 
-		if (m_onceFlags.find(id) != m_onceFlags.end())
+		// 非同期モードで追加されたログが残っていれば、先に書き込む
+		drainLocked();
+
+		writeTextLocked(detail::MakeEntry(desc, text));
+	}
+
+	void CLogger::writeOnce(const LogDescription desc, const uint32 id, const String& text)
+	{
+		if (suppressed(desc))
 		{
 			return;
 		}
 
-		m_onceFlags.insert(id);
-
-		detail::OutputDebug(desc, text);
-
-		if (m_initialized)
 		{
-			m_writer.writeUTF8(logLevel[static_cast<size_t>(desc)]);
+			std::lock_guard<std::mutex> lock(m_onceMutex);
 
-			m_writer.write(text.xml_escaped());
+			if (m_onceFlags.find(id) != m_onceFlags.end())
+			{
+				return;
+			}
 
-			m_writer.writeUTF8(divEnd);
+			m_onceFlags.insert(id);
 		}
 
-		if (desc == LogDescription::Error)
-		{
-			m_hasImportantLog = true;
-		}
+		write(desc, text);
 	}
 
 	void CLogger::writeRawHTML(const String& htmlText)
@@ -290,8 +671,20 @@ namespace s3d
 			return;
 		}
 
+		if (m_async.load(std::memory_order_acquire))
+		{
+			LogRecord record{ LogRecord::Type::RawHTML, LogDescription::App, 0, 0, 0, htmlText, {} };
+
+			if (push(record))
+			{
+				return;
+			}
+		}
+
 		std::lock_guard<std::mutex> lock(m_mutex);
 
+		drainLocked();
+
 		m_writer.writeln(htmlText);
 	}
 
@@ -302,8 +695,20 @@ namespace s3d
 			return;
 		}
 
+		if (m_async.load(std::memory_order_acquire))
+		{
+			LogRecord record{ LogRecord::Type::RawHTML_UTF8, LogDescription::App, 0, 0, 0, {}, std::string(htmlText) };
+
+			if (push(record))
+			{
+				return;
+			}
+		}
+
 		std::lock_guard<std::mutex> lock(m_mutex);
 
+		drainLocked();
+
 		m_writer.writelnUTF8(htmlText);
 	}
 
@@ -312,6 +717,235 @@ namespace s3d
 		m_removeFileOnExit = true;
 	}
 
+	void CLogger::flushOnCrash()
+	{
+		if (m_crashFlushed.exchange(true))
+		{
+			return;
+		}
+
+		// 異常終了したスレッドがロックを保持している可能性があるので、一定時間で諦める
+		for (int32 i = 0; i < 100; ++i)
+		{
+			if (m_mutex.try_lock())
+			{
+				drainLocked();
+
+				flushLocked();
+
+				m_mutex.unlock();
+
+				return;
+			}
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+	}
+
+	void CLogger::writeOnCrashSignal() noexcept
+	{
+		if (m_crashSignalWritten.exchange(true))
+		{
+			return;
+		}
+
+		const int fd = m_crashFile;
+
+		const LogRingBuffer* buffer = m_buffer.get();
+
+		if ((fd == -1) || (buffer == nullptr))
+		{
+			return;
+		}
+
+		buffer->visitPendingCrashText([fd](const char* text, const size_t length)
+		{
+			detail::WriteCrashFile(fd, text, length);
+		});
+	}
+
+	void CLogger::writeTextLocked(const LogEntry& entry)
+	{
+		detail::OutputDebug(entry.level, entry.text);
+
+		if (m_initialized)
+		{
+			m_writer.writeUTF8(logLevel[static_cast<size_t>(entry.level)]);
+
+			m_writer.write(String(entry.text).xml_escape());
+
+			m_writer.writeUTF8(divEnd);
+		}
+
+		for (const auto& sink : m_sinks)
+		{
+			sink->write(entry);
+		}
+
+		if (entry.level == LogDescription::Error)
+		{
+			m_hasImportantLog = true;
+		}
+	}
+
+	void CLogger::flushLocked()
+	{
+		m_writer.flush();
+
+		for (const auto& sink : m_sinks)
+		{
+			sink->flush();
+		}
+	}
+
+	bool CLogger::drainLocked()
+	{
+		if (!m_buffer)
+		{
+			return false;
+		}
+
+		bool written = false;
+
+		LogRecord record;
+
+		while (m_buffer->tryPop(record))
+		{
+			switch (record.type)
+			{
+			case LogRecord::Type::Text:
+				writeTextLocked(LogEntry{ record.timestamp, record.threadID, record.frameCount, record.desc, record.text });
+				break;
+			case LogRecord::Type::RawHTML:
+				m_writer.writeln(record.text);
+				break;
+			case LogRecord::Type::RawHTML_UTF8:
+				m_writer.writelnUTF8(record.textUTF8);
+				break;
+			}
+
+			written = true;
+		}
+
+		if (const size_t dropped = m_unreportedDropCount.exchange(0))
+		{
+			const String text = U"⚠️ Logger: {0} log messages were dropped because the buffer was full"_fmt(dropped);
+
+			writeTextLocked(detail::MakeEntry(LogDescription::Warning, text));
+
+			written = true;
+		}
+
+		return written;
+	}
+
+	bool CLogger::push(LogRecord& record, const char* const crashText, const size_t crashTextLength)
+	{
+		const bool urgent = (record.type == LogRecord::Type::Text) && (record.desc == LogDescription::Error);
+
+		if (m_buffer->tryPush(record, crashText, crashTextLength))
+		{
+			if (urgent || (WakeThreshold <= m_buffer->size()))
+			{
+				wake();
+			}
+
+			return true;
+		}
+
+		const LogOverflowPolicy policy = m_overflowPolicy;
+
+		if (policy == LogOverflowPolicy::Block)
+		{
+			do
+			{
+				// 非同期モードが終了した場合は、呼び出し元で同期的に書き込む
+				if (!m_async.load(std::memory_order_acquire))
+				{
+					return false;
+				}
+
+				wake();
+
+				std::this_thread::yield();
+			}
+			while (!m_buffer->tryPush(record, crashText, crashTextLength));
+
+			return true;
+		}
+
+		++m_droppedCount;
+
+		if (policy == LogOverflowPolicy::DropAndCount)
+		{
+			++m_unreportedDropCount;
+		}
+
+		return true;
+	}
+
+	void CLogger::wake()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_wakeMutex);
+
+			m_wakeRequested = true;
+		}
+
+		m_wakeCondition.notify_one();
+	}
+
+	void CLogger::threadMain()
+	{
+		Profiler::SetThreadName(U"Siv3D Logger");
+
+		for (;;)
+		{
+			{
+				std::unique_lock<std::mutex> lock(m_wakeMutex);
+
+				m_wakeCondition.wait_for(lock, FlushInterval, [this]() { return (m_wakeRequested || m_exitThread); });
+
+				m_wakeRequested = false;
+
+				if (m_exitThread)
+				{
+					break;
+				}
+			}
+
+			SIV3D_PROFILE_SCOPE("Logger::drain");
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			// まとめて書き込んだ後にファイルへ反映する
+			if (drainLocked())
+			{
+				flushLocked();
+			}
+		}
+	}
+
+	void CLogger::stopThread()
+	{
+		if (!m_thread.joinable())
+		{
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_wakeMutex);
+
+			m_exitThread = true;
+		}
+
+		m_wakeCondition.notify_one();
+
+		m_thread.join();
+
+		flush();
+	}
+
 	void CLogger::outputLicenses()
 	{
 		if (m_removeFileOnExit)
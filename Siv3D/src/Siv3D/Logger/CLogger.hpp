@@ -10,11 +10,19 @@
 //-----------------------------------------------
 
 # pragma once
+# include <atomic>
+# include <chrono>
+# include <condition_variable>
+# include <memory>
 # include <mutex>
+# include <thread>
 # include <Siv3D/TextWriter.hpp>
 # include <Siv3D/Logger.hpp>
+# include <Siv3D/LogSink.hpp>
+# include <Siv3D/Array.hpp>
 # include <Siv3D/HashSet.hpp>
 # include "ILogger.hpp"
+# include "LogRingBuffer.hpp"
 
 namespace s3d
 {
@@ -22,10 +30,22 @@ namespace s3d
 	{
 	private:
 
+		// 非同期モードのバッファに格納できるログの件数
+		static constexpr size_t AsyncBufferCapacity = 8192;
+
+		// バッファの件数がこれを超えたら、書き込みスレッドをすぐに起こす
+		static constexpr size_t WakeThreshold = AsyncBufferCapacity / 4;
+
+		// 書き込みスレッドがバッファを確認する間隔
+		static constexpr std::chrono::milliseconds FlushInterval{ 50 };
+
 		TextWriter m_writer;
 
 		HashSet<uint32> m_onceFlags;
 
+		std::mutex m_onceMutex;
+
+		// m_writer への書き込みと m_buffer からの取り出しを保護する
 		std::mutex m_mutex;
 
 		OutputLevel m_outputLevel = SIV3D_IS_DEBUG ? OutputLevel::More : OutputLevel::Normal;
@@ -36,10 +56,57 @@ namespace s3d
 
 		bool m_removeFileOnExit = false;
 
+		// HTML のログファイル以外の出力先（m_mutex で保護する）
+		Array<std::shared_ptr<ILogSink>> m_sinks;
+
+		std::unique_ptr<LogRingBuffer> m_buffer;
+
+		std::atomic<bool> m_async = { false };
+
+		std::atomic<LogOverflowPolicy> m_overflowPolicy = { LogOverflowPolicy::Block };
+
+		std::atomic<size_t> m_droppedCount = { 0 };
+
+		// まだログファイルに出力していない、破棄したログの件数
+		std::atomic<size_t> m_unreportedDropCount = { 0 };
+
+		std::atomic<bool> m_crashFlushed = { false };
+
+		std::atomic<bool> m_crashSignalWritten = { false };
+
+		// シグナルハンドラから書き込むための、ログファイルを追記モードで開いたファイルディスクリプタ
+		int m_crashFile = -1;
+
+		std::mutex m_modeMutex;
+
+		std::thread m_thread;
+
+		std::mutex m_wakeMutex;
+
+		std::condition_variable m_wakeCondition;
+
+		bool m_wakeRequested = false;
+
+		bool m_exitThread = false;
+
 		void outputLicenses();
 
 		bool suppressed(LogDescription desc) const;
 
+		void writeTextLocked(const LogEntry& entry);
+
+		void flushLocked();
+
+		bool drainLocked();
+
+		bool push(LogRecord& record, const char* crashText = nullptr, size_t crashTextLength = 0);
+
+		void wake();
+
+		void threadMain();
+
+		void stopThread();
+
 	public:
 
 		CLogger();
@@ -50,6 +117,18 @@ namespace s3d
 
 		void setOutputLevel(OutputLevel level) override;
 
+		void setAsync(bool enabled, LogOverflowPolicy policy) override;
+
+		bool isAsync() const override;
+
+		void flush() override;
+
+		size_t getDroppedCount() const override;
+
+		void addSink(const std::shared_ptr<ILogSink>& sink) override;
+
+		void removeSink(const std::shared_ptr<ILogSink>& sink) override;
+
 		void write(LogDescription desc, const String& text) override;
 
 		void writeOnce(LogDescription desc, uint32 id, const String& text) override;
@@ -59,5 +138,12 @@ namespace s3d
 		void writeRawHTML_UTF8(std::string_view htmlText) override;
 
 		void removeOnExit() override;
+
+		// std::terminate() による異常終了時に、バッファに残っているログを書き込む
+		void flushOnCrash();
+
+		// シグナルによる異常終了時に、バッファに残っているログの整形済みの行を write で書き込む
+		// 非同期シグナル安全な処理だけを行う
+		void writeOnCrashSignal() noexcept;
 	};
 }
@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # pragma once
+# include <memory>
 # include <string>
 # include <Siv3D/Fwd.hpp>
 
@@ -27,6 +28,18 @@ namespace s3d
 
 		virtual void setOutputLevel(OutputLevel level) = 0;
 
+		virtual void setAsync(bool enabled, LogOverflowPolicy policy) = 0;
+
+		virtual bool isAsync() const = 0;
+
+		virtual void flush() = 0;
+
+		virtual size_t getDroppedCount() const = 0;
+
+		virtual void addSink(const std::shared_ptr<ILogSink>& sink) = 0;
+
+		virtual void removeSink(const std::shared_ptr<ILogSink>& sink) = 0;
+
 		virtual void write(LogDescription desc, const String& text) = 0;
 
 		virtual void writeOnce(LogDescription desc, uint32 id, const String& text) = 0;
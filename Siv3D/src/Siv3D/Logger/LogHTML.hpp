@@ -0,0 +1,78 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <string>
+# include <Siv3D/Fwd.hpp>
+
+namespace s3d
+{
+constexpr static char headerA[] =
+u8R"(<!DOCTYPE html>
+<html lang="ja">
+<head>
+<meta charset="UTF-8" />
+<title>)";
+
+constexpr static char headerB[] =
+u8R"(</title>
+<style>
+body		{ background-color: #f9f9f9; font-family: 'Segoe UI','メイリオ','Meiryo','ヒラギノ角ゴ Pro W3','Hiragino Kaku Gothic Pro','Osaka','ＭＳ Ｐゴシック','MS PGothic','Arial',sans-serif; }
+h2			{ color: #333333; text-align: center; font-size: 28px; }
+h3			{ color: #333333; text-align: center; font-size: 24px; }
+div			{ font-size: 14px; line-height: 2; word-wrap: break-word; }
+div.error	{ padding-left: 14px; background: #f44336; color: #ffffff; }
+div.fail	{ padding-left: 14px; background: #ff9800; color: #ffffff; }
+div.warning	{ padding-left: 14px; background: #ff9800; color: #ffffff; }
+div.script	{ padding-left: 14px; background: #d9eeda; color: #333333; }
+div.app		{ padding-left: 14px; background: #ffffff; color: #333333; }
+div.info	{ padding-left: 14px; background: #e3f2fd; color: #333333; }
+div.debug	{ padding-left: 14px; background: #f5f5f5; color: #333333; }
+div.c0		{ color: #333333; text-align: center; font-size: 20px; }
+div.c1		{ padding-bottom: 8px; color: #555555; text-align: center; font-size: 12px; }
+div.c2		{ padding-bottom: 24px; color: #888888; text-align: center; font-size: 9px; }
+div.messages { margin: 0 10% 28px; padding 0 0 28px; border: 1px solid; border-color: #dddddd; border-radius: 2px; box-shadow: 0 1px 1px rgba(0,0,0,.05); }
+</style>
+</head>
+<body>
+<h2>)";
+
+constexpr static char headerC[] =
+u8R"(</h2>
+<div class="messages">
+)";
+
+const static std::string logLevel[]{
+	u8R"(<div class="error">)",
+	u8R"(<div class="fail">)",
+	u8R"(<div class="warning">)",
+	u8R"(<div class="script">)",
+	u8R"(<div class="app">)",
+	u8R"(<div class="info">)",
+	u8R"(<div class="debug">)",
+};
+
+constexpr static char8 divEnd[] = u8"</div>\n";
+
+constexpr static char8 licenseC0[] = u8R"-(<div class="c0">)-";
+
+constexpr static char8 licenseC1[] = u8R"-(<div class="c1">)-";
+
+constexpr static char8 licenseC2[] = u8R"-(<div class="c2">)-";
+
+constexpr static char8 footerA[] =
+u8R"-(</div><br>
+<h3>Licenses</h3>)-";
+
+constexpr static char8 footerB[] =
+u8R"-(</body>
+</html>)-";
+}
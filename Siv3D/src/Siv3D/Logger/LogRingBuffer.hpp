@@ -0,0 +1,194 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <cassert>
+# include <cstring>
+# include <atomic>
+# include <memory>
+# include <string>
+# include <Siv3D/Logger.hpp>
+# include <Siv3D/String.hpp>
+
+namespace s3d
+{
+	struct LogRecord
+	{
+		enum class Type : uint8
+		{
+			Text,
+
+			RawHTML,
+
+			RawHTML_UTF8,
+		};
+
+		Type type = Type::Text;
+
+		LogDescription desc = LogDescription::App;
+
+		uint64 timestamp = 0;
+
+		uint64 threadID = 0;
+
+		uint64 frameCount = 0;
+
+		String text;
+
+		std::string textUTF8;
+	};
+
+	// 複数のスレッドから追加し、1 つのスレッドから取り出す固定長のリングバッファ
+	// 各スロットの sequence で、そのスロットが書き込み可能か読み出し可能かを判定する
+	class LogRingBuffer
+	{
+	public:
+
+		// 異常終了時に書き込む、整形済みの行の最大サイズ（バイト）
+		static constexpr size_t CrashTextSize = 256;
+
+	private:
+
+		struct Slot
+		{
+			std::atomic<size_t> sequence = { 0 };
+
+			LogRecord record;
+
+			// record を整形済みの UTF-8 の行（シグナルハンドラから参照する）
+			char crashText[CrashTextSize];
+
+			size_t crashTextLength = 0;
+		};
+
+		std::unique_ptr<Slot[]> m_slots;
+
+		size_t m_mask = 0;
+
+		alignas(64) std::atomic<size_t> m_writePos = { 0 };
+
+		alignas(64) std::atomic<size_t> m_readPos = { 0 };
+
+	public:
+
+		// capacity は 2 の累乗
+		explicit LogRingBuffer(const size_t capacity)
+			: m_slots(std::make_unique<Slot[]>(capacity))
+			, m_mask(capacity - 1)
+		{
+			assert((capacity & m_mask) == 0);
+
+			for (size_t i = 0; i < capacity; ++i)
+			{
+				m_slots[i].sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+
+		[[nodiscard]] size_t capacity() const noexcept
+		{
+			return m_mask + 1;
+		}
+
+		// 格納されているおおよその件数
+		[[nodiscard]] size_t size() const noexcept
+		{
+			const size_t readPos = m_readPos.load(std::memory_order_relaxed);
+			const size_t writePos = m_writePos.load(std::memory_order_relaxed);
+
+			return (writePos > readPos) ? (writePos - readPos) : 0;
+		}
+
+		// 満杯の場合は false を返し、record は変更しない
+		bool tryPush(LogRecord& record, const char* crashText = nullptr, const size_t crashTextLength = 0)
+		{
+			assert(crashTextLength <= CrashTextSize);
+
+			size_t pos = m_writePos.load(std::memory_order_relaxed);
+
+			for (;;)
+			{
+				Slot& slot = m_slots[pos & m_mask];
+
+				const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+
+				const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+
+				if (diff == 0)
+				{
+					if (m_writePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					{
+						slot.record = std::move(record);
+
+						if (crashTextLength)
+						{
+							std::memcpy(slot.crashText, crashText, crashTextLength);
+						}
+
+						slot.crashTextLength = crashTextLength;
+
+						slot.sequence.store(pos + 1, std::memory_order_release);
+
+						return true;
+					}
+				}
+				else if (diff < 0)
+				{
+					return false;
+				}
+				else
+				{
+					pos = m_writePos.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		// 取り出すスレッドは同時に 1 つだけ
+		bool tryPop(LogRecord& record)
+		{
+			const size_t pos = m_readPos.load(std::memory_order_relaxed);
+
+			Slot& slot = m_slots[pos & m_mask];
+
+			if (slot.sequence.load(std::memory_order_acquire) != (pos + 1))
+			{
+				return false;
+			}
+
+			record = std::move(slot.record);
+
+			slot.sequence.store(pos + m_mask + 1, std::memory_order_release);
+
+			m_readPos.store(pos + 1, std::memory_order_relaxed);
+
+			return true;
+		}
+
+		// まだ取り出されていないログの整形済みの行を順に f に渡す
+		// メモリの確保やロックを行わないので、シグナルハンドラから呼び出せる
+		template <class Fty>
+		void visitPendingCrashText(Fty f) const noexcept
+		{
+			const size_t readPos = m_readPos.load(std::memory_order_relaxed);
+
+			for (size_t pos = readPos; pos < (readPos + capacity()); ++pos)
+			{
+				const Slot& slot = m_slots[pos & m_mask];
+
+				if (slot.sequence.load(std::memory_order_acquire) != (pos + 1))
+				{
+					break;
+				}
+
+				f(slot.crashText, slot.crashTextLength);
+			}
+		}
+	};
+}
@@ -0,0 +1,364 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <ctime>
+# include <cstring>
+# include <Siv3D/LogSink.hpp>
+# include <Siv3D/BinaryWriter.hpp>
+# include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/TextWriter.hpp>
+# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/DateTime.hpp>
+# include <Siv3D/Unicode.hpp>
+# include "LogHTML.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		static constexpr char BinaryLogMagic[6] = { 'S', '3', 'D', 'L', 'O', 'G' };
+
+		static constexpr uint16 BinaryLogVersion = 1;
+
+		// timestamp, threadID, frameCount, level, テキストのバイト数
+		static constexpr size_t BinaryLogRecordHeaderSize = (sizeof(uint64) * 3 + sizeof(uint8) + sizeof(uint32));
+
+		// この大きさを超えたらファイルに書き込む
+		static constexpr size_t LogSinkBufferSize = (64 * 1024);
+
+		static constexpr const char* LogLevelNames[] =
+		{
+			"error",
+			"fail",
+			"warning",
+			"script",
+			"app",
+			"info",
+			"debug",
+		};
+
+		template <class Type>
+		static void AppendValue(std::string& buffer, const Type value)
+		{
+			char bytes[sizeof(Type)];
+
+			std::memcpy(bytes, &value, sizeof(Type));
+
+			buffer.append(bytes, sizeof(Type));
+		}
+
+		template <class Type>
+		static Type ReadValue(const Byte* data)
+		{
+			Type value;
+
+			std::memcpy(&value, data, sizeof(Type));
+
+			return value;
+		}
+
+		static void AppendJSONString(std::string& buffer, const std::string_view text)
+		{
+			static constexpr char hex[] = "0123456789abcdef";
+
+			buffer.push_back('"');
+
+			for (const char ch : text)
+			{
+				switch (ch)
+				{
+				case '"':
+					buffer.append("\\\"");
+					break;
+				case '\\':
+					buffer.append("\\\\");
+					break;
+				case '\n':
+					buffer.append("\\n");
+					break;
+				case '\r':
+					buffer.append("\\r");
+					break;
+				case '\t':
+					buffer.append("\\t");
+					break;
+				default:
+					if (static_cast<unsigned char>(ch) < 0x20)
+					{
+						buffer.append("\\u00");
+						buffer.push_back(hex[(ch >> 4) & 0xF]);
+						buffer.push_back(hex[ch & 0xF]);
+					}
+					else
+					{
+						buffer.push_back(ch);
+					}
+				}
+			}
+
+			buffer.push_back('"');
+		}
+
+		static String FormatTimestamp(const uint64 timestamp)
+		{
+			const std::time_t time = static_cast<std::time_t>(timestamp / 1'000'000);
+
+			std::tm local = {};
+
+		# if defined(SIV3D_TARGET_WINDOWS)
+
+			::localtime_s(&local, &time);
+
+		# else
+
+			::localtime_r(&time, &local);
+
+		# endif
+
+			const DateTime dateTime(local.tm_year + 1900, local.tm_mon + 1, local.tm_mday,
+				local.tm_hour, local.tm_min, local.tm_sec, static_cast<int32>(timestamp / 1'000 % 1'000));
+
+			return dateTime.format(U"yyyy-MM-dd HH:mm:ss.SSS");
+		}
+
+		class LogSinkBase : public ILogSink
+		{
+		protected:
+
+			BinaryWriter m_writer;
+
+			std::string m_buffer;
+
+			void commit()
+			{
+				if (LogSinkBufferSize <= m_buffer.size())
+				{
+					writeBuffer();
+				}
+			}
+
+			void writeBuffer()
+			{
+				if (!m_buffer.empty())
+				{
+					m_writer.write(m_buffer.data(), m_buffer.size());
+
+					m_buffer.clear();
+				}
+			}
+
+		public:
+
+			explicit LogSinkBase(const FilePath& path)
+				: m_writer(path)
+			{
+				m_buffer.reserve(LogSinkBufferSize * 2);
+			}
+
+			~LogSinkBase() override
+			{
+				writeBuffer();
+			}
+
+			[[nodiscard]] bool isOpened() const
+			{
+				return m_writer.isOpened();
+			}
+
+			void flush() override
+			{
+				writeBuffer();
+
+				m_writer.flush();
+			}
+		};
+
+		class BinaryLogSink : public LogSinkBase
+		{
+		public:
+
+			explicit BinaryLogSink(const FilePath& path)
+				: LogSinkBase(path)
+			{
+				m_buffer.append(BinaryLogMagic, sizeof(BinaryLogMagic));
+
+				AppendValue(m_buffer, BinaryLogVersion);
+			}
+
+			void write(const LogEntry& entry) override
+			{
+				const std::string text = Unicode::ToUTF8(entry.text);
+
+				AppendValue(m_buffer, entry.timestamp);
+				AppendValue(m_buffer, entry.threadID);
+				AppendValue(m_buffer, entry.frameCount);
+				AppendValue(m_buffer, static_cast<uint8>(entry.level));
+				AppendValue(m_buffer, static_cast<uint32>(text.size()));
+				m_buffer.append(text);
+
+				commit();
+			}
+		};
+
+		class JSONLinesLogSink : public LogSinkBase
+		{
+		public:
+
+			explicit JSONLinesLogSink(const FilePath& path)
+				: LogSinkBase(path) {}
+
+			void write(const LogEntry& entry) override
+			{
+				m_buffer.append("{\"timestamp\":");
+				m_buffer.append(std::to_string(entry.timestamp));
+				m_buffer.append(",\"thread\":");
+				m_buffer.append(std::to_string(entry.threadID));
+				m_buffer.append(",\"frame\":");
+				m_buffer.append(std::to_string(entry.frameCount));
+				m_buffer.append(",\"level\":\"");
+				m_buffer.append(LogLevelNames[static_cast<size_t>(entry.level)]);
+				m_buffer.append("\",\"text\":");
+				AppendJSONString(m_buffer, Unicode::ToUTF8(entry.text));
+				m_buffer.append("}\n");
+
+				commit();
+			}
+		};
+
+		template <class Sink>
+		static std::shared_ptr<ILogSink> CreateSink(const FilePath& path)
+		{
+			auto sink = std::make_shared<Sink>(path);
+
+			if (!sink->isOpened())
+			{
+				return nullptr;
+			}
+
+			return sink;
+		}
+	}
+
+	namespace LogSink
+	{
+		std::shared_ptr<ILogSink> Binary(const FilePath& path)
+		{
+			return detail::CreateSink<detail::BinaryLogSink>(path);
+		}
+
+		std::shared_ptr<ILogSink> JSONLines(const FilePath& path)
+		{
+			return detail::CreateSink<detail::JSONLinesLogSink>(path);
+		}
+
+		bool LoadBinary(const FilePath& path, Array<LogEntry>& entries, Array<String>& texts)
+		{
+			entries.clear();
+			texts.clear();
+
+			BinaryReader reader(path);
+
+			if (!reader)
+			{
+				return false;
+			}
+
+			Array<Byte> data(static_cast<size_t>(reader.size()));
+
+			if (reader.read(data.data(), data.size()) != static_cast<int64>(data.size()))
+			{
+				return false;
+			}
+
+			const size_t headerSize = sizeof(detail::BinaryLogMagic) + sizeof(detail::BinaryLogVersion);
+
+			if ((data.size() < headerSize)
+				|| (std::memcmp(data.data(), detail::BinaryLogMagic, sizeof(detail::BinaryLogMagic)) != 0)
+				|| (detail::ReadValue<uint16>(data.data() + sizeof(detail::BinaryLogMagic)) != detail::BinaryLogVersion))
+			{
+				return false;
+			}
+
+			const Byte* p = data.data() + headerSize;
+			const Byte* const pEnd = data.data() + data.size();
+
+			while (detail::BinaryLogRecordHeaderSize <= static_cast<size_t>(pEnd - p))
+			{
+				LogEntry entry;
+				entry.timestamp		= detail::ReadValue<uint64>(p);
+				entry.threadID		= detail::ReadValue<uint64>(p + 8);
+				entry.frameCount	= detail::ReadValue<uint64>(p + 16);
+				const uint8 level	= detail::ReadValue<uint8>(p + 24);
+				const uint32 length	= detail::ReadValue<uint32>(p + 25);
+				p += detail::BinaryLogRecordHeaderSize;
+
+				if ((static_cast<size_t>(pEnd - p) < length)
+					|| (static_cast<size_t>(LogDescription::Debug) < level))
+				{
+					// 書き込み途中で終了したファイルは、読み込めたところまでを返す
+					break;
+				}
+
+				entry.level = static_cast<LogDescription>(level);
+
+				entries.push_back(entry);
+				texts.push_back(Unicode::FromUTF8(std::string_view(reinterpret_cast<const char*>(p), length)));
+				p += length;
+			}
+
+			for (size_t i = 0; i < entries.size(); ++i)
+			{
+				entries[i].text = texts[i];
+			}
+
+			return true;
+		}
+
+		bool ConvertBinaryToHTML(const FilePath& binaryLogPath, const FilePath& htmlPath)
+		{
+			Array<LogEntry> entries;
+			Array<String> texts;
+
+			if (!LoadBinary(binaryLogPath, entries, texts))
+			{
+				return false;
+			}
+
+			TextWriter writer(htmlPath, TextEncoding::UTF8);
+
+			if (!writer)
+			{
+				return false;
+			}
+
+			const std::string titleUTF8 = Unicode::ToUTF8(FileSystem::BaseName(binaryLogPath).xml_escaped()) + " Log";
+
+			writer.writeUTF8(headerA);
+			writer.writeUTF8(titleUTF8);
+			writer.writeUTF8(headerB);
+			writer.writeUTF8(titleUTF8);
+			writer.writeUTF8(headerC);
+
+			for (const auto& entry : entries)
+			{
+				writer.writeUTF8(logLevel[static_cast<size_t>(entry.level)]);
+				writer.write(U"[{} | frame {} | thread {}] "_fmt(detail::FormatTimestamp(entry.timestamp), entry.frameCount, entry.threadID));
+				writer.write(String(entry.text).xml_escape());
+				writer.writeUTF8(divEnd);
+			}
+
+			writer.writeUTF8(divEnd);
+			writer.writeUTF8(footerB);
+
+			return true;
+		}
+	}
+}
@@ -27,6 +27,41 @@ namespace s3d
 			Siv3DEngine::GetLogger()->setOutputLevel(level);
 		}
 
+		void Logger_impl::enableAsync(const LogOverflowPolicy policy) const
+		{
+			Siv3DEngine::GetLogger()->setAsync(true, policy);
+		}
+
+		void Logger_impl::disableAsync() const
+		{
+			Siv3DEngine::GetLogger()->setAsync(false, LogOverflowPolicy::Block);
+		}
+
+		bool Logger_impl::isAsync() const
+		{
+			return Siv3DEngine::GetLogger()->isAsync();
+		}
+
+		void Logger_impl::flush() const
+		{
+			Siv3DEngine::GetLogger()->flush();
+		}
+
+		size_t Logger_impl::droppedCount() const
+		{
+			return Siv3DEngine::GetLogger()->getDroppedCount();
+		}
+
+		void Logger_impl::addSink(const std::shared_ptr<ILogSink>& sink) const
+		{
+			Siv3DEngine::GetLogger()->addSink(sink);
+		}
+
+		void Logger_impl::removeSink(const std::shared_ptr<ILogSink>& sink) const
+		{
+			Siv3DEngine::GetLogger()->removeSink(sink);
+		}
+
 		void Logger_impl::_outputLog(const LogDescription desc, const String& text) const
 		{
 			Siv3DEngine::GetLogger()->write(desc, text);
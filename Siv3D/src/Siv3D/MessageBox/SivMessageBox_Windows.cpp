@@ -12,10 +12,10 @@
 # include <Siv3D/Platform.hpp>
 # if defined(SIV3D_TARGET_WINDOWS)
 
+# include <future>
 # include <Siv3D/MessageBox.hpp>
 # include <Siv3D/Windows.hpp>
 # include <Siv3D/Window.hpp>
-# include <Siv3D/ConcurrentTask.hpp>
 
 namespace s3d
 {
@@ -50,7 +50,8 @@ namespace s3d
 			const int32 flag = detail::messageBoxStyleFlags[static_cast<int32>(style)]
 							 | detail::messageBoxButtonFlags[static_cast<int32>(buttons)];
 
-			const int32 result = CreateConcurrentTask([&, flag]()
+			// モーダルダイアログでスレッドプールのワーカーを占有しないよう、専用のスレッドで表示する
+			const int32 result = std::async(std::launch::async, [&, flag]()
 			{
 				return ::MessageBoxW(nullptr, text.toWstr().c_str(), title.toWstr().c_str(), flag);
 			}).get();
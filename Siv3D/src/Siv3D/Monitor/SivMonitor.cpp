@@ -245,8 +245,11 @@ namespace s3d
 
 # elif defined(SIV3D_TARGET_LINUX)
 
+# include <GL/glew.h>
 # include "../../ThirdParty/GLFW/include/GLFW/glfw3.h"
 # include <Siv3D/Window.hpp>
+# include "../Siv3DEngine.hpp"
+# include "../Window/IWindow.hpp"
 
 namespace s3d
 {
@@ -255,6 +258,12 @@ namespace s3d
 		Array<Monitor> EnumerateActiveMonitors()
 		{
 			Array<Monitor> results;
+
+			// ヘッドレスモードでは GLFW が初期化されていない
+			if (!Siv3DEngine::GetWindow()->getHandle())
+			{
+				return results;
+			}
 			
 			int32 numMonitors;
 			GLFWmonitor** monitors = ::glfwGetMonitors(&numMonitors);
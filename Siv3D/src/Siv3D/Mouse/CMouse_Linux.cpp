@@ -34,7 +34,10 @@ namespace s3d
 	{
 		m_glfwWindow = Siv3DEngine::GetWindow()->getHandle();
 
-		::glfwSetScrollCallback(m_glfwWindow, OnScroll);
+		if (m_glfwWindow)
+		{
+			::glfwSetScrollCallback(m_glfwWindow, OnScroll);
+		}
 
 		LOG_INFO(U"ℹ️ Mouse initialized");
 
@@ -43,6 +46,12 @@ namespace s3d
 
 	void CMouse_Linux::update()
 	{
+		// ヘッドレスモード
+		if (!m_glfwWindow)
+		{
+			return;
+		}
+
 		for (uint32 i = 0; i < MouseButtonCount; ++i)
 		{
 			const bool pressed = (::glfwGetMouseButton(m_glfwWindow, i) == GLFW_PRESS);
@@ -16,7 +16,7 @@ namespace s3d
 {
 	namespace OpenCV_Bridge
 	{
-		void RedToBinary(const Image& from, cv::Mat_<uint8>& to, const uint32 threshold)
+		void RedToBinary(const ImageConstView& from, cv::Mat_<uint8>& to, const uint32 threshold)
 		{
 			assert(from.width() == to.cols);
 			assert(from.height() == to.rows);
@@ -29,7 +29,7 @@ namespace s3d
 			const int32 height = from.height();
 			const int32 width = from.width();
 
-			if (to.isContinuous())
+			if (from.isContinuous() && to.isContinuous())
 			{
 				const Color* pSrc = from.data();
 				const Color* pSrcEnd = pSrc + from.num_pixels();
@@ -44,12 +44,12 @@ namespace s3d
 			}
 			else
 			{
-				const Color* pSrc = from.data();
 				uint8* pDstLine = to.data;
 				const size_t dstStepBytes = to.step.p[0];
 
 				for (int32 y = 0; y < height; ++y)
 				{
+					const Color* pSrc = from[y];
 					uint8* pDst = pDstLine;
 
 					for (int32 x = 0; x < width; ++x)
@@ -64,7 +64,7 @@ namespace s3d
 			}
 		}
 
-		void AlphaToBinary(const Image& from, cv::Mat_<uint8>& to, const uint32 threshold)
+		void AlphaToBinary(const ImageConstView& from, cv::Mat_<uint8>& to, const uint32 threshold)
 		{
 			assert(from.width() == to.cols);
 			assert(from.height() == to.rows);
@@ -77,7 +77,7 @@ namespace s3d
 			const int32 height = from.height();
 			const int32 width = from.width();
 
-			if (to.isContinuous())
+			if (from.isContinuous() && to.isContinuous())
 			{
 				const Color* pSrc = from.data();
 				const Color* pSrcEnd = pSrc + from.num_pixels();
@@ -92,12 +92,12 @@ namespace s3d
 			}
 			else
 			{
-				const Color* pSrc = from.data();
 				uint8* pDstLine = to.data;
 				const size_t dstStepBytes = to.step.p[0];
 
 				for (int32 y = 0; y < height; ++y)
 				{
+					const Color* pSrc = from[y];
 					uint8* pDst = pDstLine;
 
 					for (int32 x = 0; x < width; ++x)
@@ -112,7 +112,7 @@ namespace s3d
 			}
 		}
 
-		void ToGrayScale(const Image& from, cv::Mat_<uint8>& to)
+		void ToGrayScale(const ImageConstView& from, cv::Mat_<uint8>& to)
 		{
 			assert(from.width() == to.cols);
 			assert(from.height() == to.rows);
@@ -125,7 +125,7 @@ namespace s3d
 			const int32 height = from.height();
 			const int32 width = from.width();
 
-			if (to.isContinuous())
+			if (from.isContinuous() && to.isContinuous())
 			{
 				const Color* pSrc = from.data();
 				const Color* pSrcEnd = pSrc + from.num_pixels();
@@ -140,12 +140,12 @@ namespace s3d
 			}
 			else
 			{
-				const Color* pSrc = from.data();
 				uint8* pDstLine = to.data;
 				const size_t dstStepBytes = to.step.p[0];
 
 				for (int32 y = 0; y < height; ++y)
 				{
+					const Color* pSrc = from[y];
 					uint8* pDst = pDstLine;
 
 					for (int32 x = 0; x < width; ++x)
@@ -160,7 +160,7 @@ namespace s3d
 			}
 		}
 
-		void ToMatVec3b(const Image& from, cv::Mat_<cv::Vec3b>& to)
+		void ToMatVec3b(const ImageConstView& from, cv::Mat_<cv::Vec3b>& to)
 		{
 			assert(from.width() == to.cols);
 			assert(from.height() == to.rows);
@@ -172,16 +172,14 @@ namespace s3d
 
 			const int32 height = from.height();
 			const int32 width = from.width();
-			const Color* pSrc = from.data();
 
-			uint8* pDstLine = to.data;
-			const size_t dstStepBytes = to.step.p[0];
-
-			for (int32 y = 0; y < height; ++y)
+			if (from.isContinuous() && to.isContinuous())
 			{
-				uint8* pDst = pDstLine;
+				const Color* pSrc = from.data();
+				const Color* pSrcEnd = pSrc + from.num_pixels();
+				uint8* pDst = to.data;
 
-				for (int32 x = 0; x < width; ++x)
+				while (pSrc != pSrcEnd)
 				{
 					*pDst++ = pSrc->b;
 					*pDst++ = pSrc->g;
@@ -189,12 +187,32 @@ namespace s3d
 
 					++pSrc;
 				}
+			}
+			else
+			{
+				uint8* pDstLine = to.data;
+				const size_t dstStepBytes = to.step.p[0];
+
+				for (int32 y = 0; y < height; ++y)
+				{
+					const Color* pSrc = from[y];
+					uint8* pDst = pDstLine;
+
+					for (int32 x = 0; x < width; ++x)
+					{
+						*pDst++ = pSrc->b;
+						*pDst++ = pSrc->g;
+						*pDst++ = pSrc->r;
+
+						++pSrc;
+					}
 
-				pDstLine += dstStepBytes;
+					pDstLine += dstStepBytes;
+				}
 			}
 		}
 
-		void ToMatVec3f255(const Image& from, cv::Mat_<cv::Vec3f>& to)
+		void ToMatVec3f255(const ImageConstView& from, cv::Mat_<cv::Vec3f>& to)
 		{
 			assert(from.width() == to.cols);
 			assert(from.height() == to.rows);
@@ -206,16 +224,14 @@ namespace s3d
 
 			const int32 height = from.height();
 			const int32 width = from.width();
-			const Color* pSrc = from.data();
 
-			uint8* pDstLine = to.data;
-			const size_t dstStepBytes = to.step.p[0];
-
-			for (int32 y = 0; y < height; ++y)
+			if (from.isContinuous() && to.isContinuous())
 			{
-				cv::Vec3f* pDst = static_cast<cv::Vec3f*>(static_cast<void*>(pDstLine));
+				const Color* pSrc = from.data();
+				const Color* pSrcEnd = pSrc + from.num_pixels();
+				cv::Vec3f* pDst = static_cast<cv::Vec3f*>(static_cast<void*>(to.data));
 
-				for (int32 x = 0; x < width; ++x)
+				while (pSrc != pSrcEnd)
 				{
 					(*pDst)[0] = static_cast<float>(pSrc->b);
 					(*pDst)[1] = static_cast<float>(pSrc->g);
@@ -223,69 +239,84 @@ namespace s3d
 
 					++pDst; ++pSrc;
 				}
+			}
+			else
+			{
+				uint8* pDstLine = to.data;
+				const size_t dstStepBytes = to.step.p[0];
+
+				for (int32 y = 0; y < height; ++y)
+				{
+					const Color* pSrc = from[y];
+					cv::Vec3f* pDst = static_cast<cv::Vec3f*>(static_cast<void*>(pDstLine));
 
-				pDstLine += dstStepBytes;
+					for (int32 x = 0; x < width; ++x)
+					{
+						(*pDst)[0] = static_cast<float>(pSrc->b);
+						(*pDst)[1] = static_cast<float>(pSrc->g);
+						(*pDst)[2] = static_cast<float>(pSrc->r);
+
+						++pDst; ++pSrc;
+					}
+
+					pDstLine += dstStepBytes;
+				}
 			}
 		}
 
 		void FromMat(const cv::Mat_<cv::Vec3b>& from, Image& to, const bool preserveAlpha)
 		{
-			const int32 width = from.cols;
-			const int32 height = from.rows;
-			to.resize(width, height);
+			to.resize(from.cols, from.rows);
+
+			if (!to)
+			{
+				return;
+			}
+
+			FromMat(from, ImageView(to), preserveAlpha);
+		}
+
+		void FromMat(const cv::Mat_<cv::Vec3b>& from, const ImageView& to, const bool preserveAlpha)
+		{
+			assert(from.cols == to.width());
+			assert(from.rows == to.height());
 
 			if (!to)
 			{
 				return;
 			}
 
+			const int32 width = to.width();
+			const int32 height = to.height();
+			const uint8* pSrcLine = from.data;
+			const size_t srcStepBytes = from.step.p[0];
+
 			if (preserveAlpha)
 			{
-				if (from.isContinuous())
+				for (int32 y = 0; y < height; ++y)
 				{
-					Color* pDst = to.data();
-					const Color* pDstEnd = pDst + to.num_pixels();
-					const uint8* pSrc = from.data;
+					const uint8* pSrc = pSrcLine;
+					Color* pDst = to[y];
 
-					while (pDst != pDstEnd)
+					for (int32 x = 0; x < width; ++x)
 					{
 						pDst->b = *pSrc++;
 						pDst->g = *pSrc++;
 						pDst->r = *pSrc++;
 						++pDst;
 					}
-				}
-				else
-				{
-					Color* pDst = to.data();
-					uint8* pSrcLine = from.data;
-					const size_t srcStepBytes = from.step.p[0];
-
-					for (int32 y = 0; y < height; ++y)
-					{
-						uint8* pSrc = pSrcLine;
-
-						for (int32 x = 0; x < width; ++x)
-						{
-							pDst->b = *pSrc++;
-							pDst->g = *pSrc++;
-							pDst->r = *pSrc++;
-							++pDst;
-						}
 
-						pSrcLine += srcStepBytes;
-					}
+					pSrcLine += srcStepBytes;
 				}
 			}
 			else
 			{
-				if (from.isContinuous())
+				for (int32 y = 0; y < height; ++y)
 				{
-					Color* pDst = to.data();
-					const Color* pDstEnd = pDst + to.num_pixels();
-					const uint8* pSrc = from.data;
+					const uint8* pSrc = pSrcLine;
+					Color* pDst = to[y];
 
-					while (pDst != pDstEnd)
+					for (int32 x = 0; x < width; ++x)
 					{
 						pDst->b = *pSrc++;
 						pDst->g = *pSrc++;
@@ -293,111 +324,70 @@ namespace s3d
 						pDst->a = 255;
 						++pDst;
 					}
-				}
-				else
-				{
-					Color* pDst = to.data();
-					uint8* pSrcLine = from.data;
-					const size_t srcStepBytes = from.step.p[0];
 
-					for (int32 y = 0; y < height; ++y)
-					{
-						uint8* pSrc = pSrcLine;
-
-						for (int32 x = 0; x < width; ++x)
-						{
-							pDst->b = *pSrc++;
-							pDst->g = *pSrc++;
-							pDst->r = *pSrc++;
-							pDst->a = 255;
-							++pDst;
-						}
-
-						pSrcLine += srcStepBytes;
-					}
+					pSrcLine += srcStepBytes;
 				}
 			}
 		}
 
 		void FromGrayScale(const cv::Mat_<uint8>& from, Image& to, const bool preserveAlpha)
 		{
-			const int32 width = from.cols;
-			const int32 height = from.rows;
-			to.resize(width, height);
+			to.resize(from.cols, from.rows);
 
 			if (!to)
 			{
 				return;
 			}
 
+			FromGrayScale(from, ImageView(to), preserveAlpha);
+		}
+
+		void FromGrayScale(const cv::Mat_<uint8>& from, const ImageView& to, const bool preserveAlpha)
+		{
+			assert(from.cols == to.width());
+			assert(from.rows == to.height());
+
+			if (!to)
+			{
+				return;
+			}
+
+			const int32 width = to.width();
+			const int32 height = to.height();
+			const uint8* pSrcLine = from.data;
+			const size_t srcStepBytes = from.step.p[0];
+
 			if (preserveAlpha)
 			{
-				if (from.isContinuous())
+				for (int32 y = 0; y < height; ++y)
 				{
-					Color* pDst = to.data();
-					const Color* pDstEnd = pDst + to.num_pixels();
-					const uint8* pSrc = from.data;
+					const uint8* pSrc = pSrcLine;
+					Color* pDst = to[y];
 
-					while (pDst != pDstEnd)
+					for (int32 x = 0; x < width; ++x)
 					{
 						pDst->r = pDst->g = pDst->b = *pSrc;
 						++pDst; ++pSrc;
 					}
-				}
-				else
-				{
-					Color* pDst = to.data();
-					uint8* pSrcLine = from.data;
-					const size_t srcStepBytes = from.step.p[0];
 
-					for (int32 y = 0; y < height; ++y)
-					{
-						uint8* pSrc = pSrcLine;
-
-						for (int32 x = 0; x < width; ++x)
-						{
-							pDst->r = pDst->g = pDst->b = *pSrc;
-							++pDst; ++pSrc;
-						}
-
-						pSrcLine += srcStepBytes;
-					}
+					pSrcLine += srcStepBytes;
 				}
 			}
 			else
 			{
-				if (from.isContinuous())
+				for (int32 y = 0; y < height; ++y)
 				{
-					Color* pDst = to.data();
-					const Color* pDstEnd = pDst + to.num_pixels();
-					const uint8* pSrc = from.data;
+					const uint8* pSrc = pSrcLine;
+					Color* pDst = to[y];
 
-					while (pDst != pDstEnd)
+					for (int32 x = 0; x < width; ++x)
 					{
 						pDst->r = pDst->g = pDst->b = *pSrc;
 						pDst->a = 255;
 						++pDst; ++pSrc;
 					}
-				}
-				else
-				{
-					Color* pDst = to.data();
-					uint8* pSrcLine = from.data;
-					const size_t srcStepBytes = from.step.p[0];
-
-					for (int32 y = 0; y < height; ++y)
-					{
-						uint8* pSrc = pSrcLine;
 
-						for (int32 x = 0; x < width; ++x)
-						{
-							pDst->r = pDst->g = pDst->b = *pSrc;
-							pDst->a = 255;
-							++pDst; ++pSrc;
-						}
-
-						pSrcLine += srcStepBytes;
-					}
+					pSrcLine += srcStepBytes;
 				}
 			}
 		}
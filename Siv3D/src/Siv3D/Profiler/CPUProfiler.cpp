@@ -0,0 +1,523 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <chrono>
+# include <string>
+# include <Siv3D/BinaryWriter.hpp>
+# include <Siv3D/Unicode.hpp>
+# include "CPUProfiler.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		static std::atomic<bool> g_profilingEnabled = { false };
+
+		static std::mutex g_registryMutex;
+
+		// 作成されたが、まだ CPUProfiler に渡していないバッファ
+		static std::vector<std::shared_ptr<ProfileThreadBuffer>> g_newBuffers;
+
+		static std::atomic<uint32> g_nextThreadIndex = { 1 };
+
+		struct ProfileThreadState
+		{
+			ProfileThreadBuffer* buffer = nullptr;
+
+			std::shared_ptr<ProfileThreadBuffer> owner;
+
+			// 開いているスコープの深さ（記録していないスコープを含む）
+			uint32 depth = 0;
+
+			// i ビット目が 1 であれば、深さ i のスコープを記録している
+			uint64 recordedMask = 0;
+
+			// 記録している開いたスコープの数
+			uint32 recordedOpen = 0;
+
+			~ProfileThreadState()
+			{
+				if (owner)
+				{
+					owner->finished = true;
+				}
+			}
+		};
+
+		static thread_local ProfileThreadState t_profileState;
+
+		static uint64 GetProfileTime() noexcept
+		{
+			return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+
+		static ProfileThreadBuffer* GetThreadBuffer()
+		{
+			ProfileThreadState& state = t_profileState;
+
+			if (!state.buffer)
+			{
+				state.owner = std::make_shared<ProfileThreadBuffer>(g_nextThreadIndex++);
+
+				state.buffer = state.owner.get();
+
+				std::lock_guard<std::mutex> lock(g_registryMutex);
+
+				g_newBuffers.push_back(state.owner);
+			}
+
+			return state.buffer;
+		}
+
+		static void AppendJSONString(std::string& buffer, const std::string_view text)
+		{
+			static constexpr char hex[] = "0123456789abcdef";
+
+			buffer.push_back('"');
+
+			for (const char ch : text)
+			{
+				if ((ch == '"') || (ch == '\\'))
+				{
+					buffer.push_back('\\');
+					buffer.push_back(ch);
+				}
+				else if (static_cast<unsigned char>(ch) < 0x20)
+				{
+					buffer.append("\\u00");
+					buffer.push_back(hex[(ch >> 4) & 0xF]);
+					buffer.push_back(hex[ch & 0xF]);
+				}
+				else
+				{
+					buffer.push_back(ch);
+				}
+			}
+
+			buffer.push_back('"');
+		}
+
+		static void AppendMicrosec(std::string& buffer, const uint64 nanosec)
+		{
+			buffer.append(std::to_string(nanosec / 1000));
+
+			const uint64 fraction = (nanosec % 1000);
+
+			buffer.push_back('.');
+			buffer.push_back(static_cast<char>('0' + fraction / 100));
+			buffer.push_back(static_cast<char>('0' + fraction / 10 % 10));
+			buffer.push_back(static_cast<char>('0' + fraction % 10));
+		}
+
+		ProfileThreadBuffer::ProfileThreadBuffer(const uint32 _threadIndex)
+			: m_events(std::make_unique<ProfileEvent[]>(Capacity))
+			, threadIndex(_threadIndex) {}
+
+		void ProfileThreadBuffer::setName(const String& name)
+		{
+			std::lock_guard<std::mutex> lock(m_nameMutex);
+
+			m_name = name;
+		}
+
+		String ProfileThreadBuffer::getName() const
+		{
+			std::lock_guard<std::mutex> lock(m_nameMutex);
+
+			if (m_name)
+			{
+				return m_name;
+			}
+
+			return U"Thread {}"_fmt(threadIndex);
+		}
+	}
+
+	void CPUProfiler::BeginScope(const char* name) noexcept
+	{
+		detail::ProfileThreadState& state = detail::t_profileState;
+
+		const uint32 depth = state.depth++;
+
+		const uint64 bit = (depth < 64) ? (uint64(1) << depth) : 0;
+
+		state.recordedMask &= ~bit;
+
+		if (!bit || !detail::g_profilingEnabled.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		detail::ProfileThreadBuffer* buffer = state.buffer;
+
+		if (!buffer)
+		{
+			try
+			{
+				buffer = detail::GetThreadBuffer();
+			}
+			catch (...)
+			{
+				return;
+			}
+		}
+
+		// 開いているスコープの終了を必ず記録できるように、その分の空きを残しておく
+		if (buffer->freeSpace() < (state.recordedOpen + 2))
+		{
+			buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+
+			return;
+		}
+
+		buffer->push({ name, detail::GetProfileTime() });
+
+		state.recordedMask |= bit;
+
+		++state.recordedOpen;
+	}
+
+	void CPUProfiler::EndScope() noexcept
+	{
+		detail::ProfileThreadState& state = detail::t_profileState;
+
+		if (state.depth == 0)
+		{
+			return;
+		}
+
+		const uint32 depth = --state.depth;
+
+		const uint64 bit = (depth < 64) ? (uint64(1) << depth) : 0;
+
+		if (state.recordedMask & bit)
+		{
+			state.buffer->push({ nullptr, detail::GetProfileTime() });
+
+			state.recordedMask &= ~bit;
+
+			--state.recordedOpen;
+		}
+	}
+
+	void CPUProfiler::SetThreadName(const String& name)
+	{
+		detail::GetThreadBuffer()->setName(name);
+	}
+
+	void CPUProfiler::setEnabled(const bool enabled)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (enabled && m_trace.isEmpty())
+		{
+			m_traceStart = detail::GetProfileTime();
+		}
+
+		detail::g_profilingEnabled = enabled;
+	}
+
+	bool CPUProfiler::isEnabled() const
+	{
+		return detail::g_profilingEnabled;
+	}
+
+	void CPUProfiler::endFrame()
+	{
+		const uint32 threadIndex = detail::GetThreadBuffer()->threadIndex;
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		collect();
+
+		if (detail::g_profilingEnabled && (m_trace.size() < MaxTraceEvents))
+		{
+			m_trace.push_back({ nullptr, threadIndex, detail::GetProfileTime(), UINT64_MAX });
+		}
+
+		rebuildNodes();
+
+		++m_frameCount;
+	}
+
+	Array<ProfileScopeStat> CPUProfiler::getFrameScopes() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		return m_previousFrame;
+	}
+
+	bool CPUProfiler::exportChromeTrace(const FilePath& path)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		collect();
+
+		BinaryWriter writer(path);
+
+		if (!writer)
+		{
+			return false;
+		}
+
+		std::string buffer = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+		bool first = true;
+
+		const auto separate = [&]()
+		{
+			if (!first)
+			{
+				buffer.append(",\n");
+			}
+
+			first = false;
+		};
+
+		for (const auto& threadName : m_threadNames)
+		{
+			separate();
+			buffer.append("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":");
+			buffer.append(std::to_string(threadName.first));
+			buffer.append(",\"args\":{\"name\":");
+			detail::AppendJSONString(buffer, threadName.second.toUTF8());
+			buffer.append("}}");
+		}
+
+		uint64 frameIndex = 0;
+
+		for (const auto& event : m_trace)
+		{
+			const uint64 begin = (event.begin > m_traceStart) ? (event.begin - m_traceStart) : 0;
+
+			separate();
+
+			if (event.duration == UINT64_MAX)
+			{
+				buffer.append("{\"name\":\"Frame ");
+				buffer.append(std::to_string(frameIndex++));
+				buffer.append("\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":");
+				buffer.append(std::to_string(event.threadIndex));
+				buffer.append(",\"ts\":");
+				detail::AppendMicrosec(buffer, begin);
+				buffer.push_back('}');
+			}
+			else
+			{
+				buffer.append("{\"name\":");
+				detail::AppendJSONString(buffer, event.name);
+				buffer.append(",\"cat\":\"Siv3D\",\"ph\":\"X\",\"pid\":1,\"tid\":");
+				buffer.append(std::to_string(event.threadIndex));
+				buffer.append(",\"ts\":");
+				detail::AppendMicrosec(buffer, begin);
+				buffer.append(",\"dur\":");
+				detail::AppendMicrosec(buffer, event.duration);
+				buffer.push_back('}');
+			}
+
+			if (buffer.size() >= (1 << 20))
+			{
+				writer.write(buffer.data(), buffer.size());
+
+				buffer.clear();
+			}
+		}
+
+		buffer.append("\n]");
+
+		if (m_droppedTraceEvents)
+		{
+			buffer.append(",\"otherData\":{\"droppedEvents\":");
+			buffer.append(std::to_string(m_droppedTraceEvents));
+			buffer.push_back('}');
+		}
+
+		buffer.append("}\n");
+
+		return (writer.write(buffer.data(), buffer.size()) == static_cast<int64>(buffer.size()));
+	}
+
+	void CPUProfiler::clearTrace()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		collect();
+
+		m_trace.clear();
+
+		m_droppedTraceEvents = 0;
+
+		m_traceStart = detail::GetProfileTime();
+	}
+
+	int32 CPUProfiler::findOrAddNode(const char* name, const uint32 threadIndex, const int32 parent, const int32 depth)
+	{
+		// 子の数は少ないので、親の直後から線形に探す
+		for (size_t i = static_cast<size_t>(parent + 1); i < m_nodes.size(); ++i)
+		{
+			const Node& node = m_nodes[i];
+
+			if ((node.name == name) && (node.parent == parent) && (node.threadIndex == threadIndex))
+			{
+				return static_cast<int32>(i);
+			}
+		}
+
+		m_nodes.push_back({ name, threadIndex, parent, depth, 0, 0, 0 });
+
+		return static_cast<int32>(m_nodes.size() - 1);
+	}
+
+	void CPUProfiler::collect()
+	{
+		{
+			std::lock_guard<std::mutex> lock(detail::g_registryMutex);
+
+			for (auto& buffer : detail::g_newBuffers)
+			{
+				m_threads.push_back({ std::move(buffer), {} });
+			}
+
+			detail::g_newBuffers.clear();
+		}
+
+		for (auto& thread : m_threads)
+		{
+			// 終了を確認してから取り出すと、終了したスレッドのイベントをすべて取り出せる
+			const bool finished = thread.buffer->finished;
+
+			const uint32 threadIndex = thread.buffer->threadIndex;
+
+			thread.buffer->consume([&](const detail::ProfileEvent& event)
+			{
+				if (event.name)
+				{
+					const int32 parent = thread.stack.isEmpty() ? -1 : thread.stack.back().node;
+
+					const int32 node = findOrAddNode(event.name, threadIndex, parent, static_cast<int32>(thread.stack.size()));
+
+					thread.stack.push_back({ event.name, event.time, node });
+
+					return;
+				}
+
+				if (thread.stack.isEmpty())
+				{
+					return;
+				}
+
+				const OpenScope scope = thread.stack.back();
+
+				thread.stack.pop_back();
+
+				const uint64 duration = (event.time - scope.begin);
+
+				Node& node = m_nodes[scope.node];
+
+				++node.count;
+
+				node.total += duration;
+
+				if (node.parent != -1)
+				{
+					m_nodes[node.parent].children += duration;
+				}
+
+				if (m_trace.size() < MaxTraceEvents)
+				{
+					m_trace.push_back({ scope.name, threadIndex, scope.begin, duration });
+				}
+				else
+				{
+					++m_droppedTraceEvents;
+				}
+			});
+
+			m_droppedTraceEvents += thread.buffer->dropped.exchange(0);
+
+			const String name = thread.buffer->getName();
+
+			auto it = std::find_if(m_threadNames.begin(), m_threadNames.end(), [=](const auto& p) { return p.first == threadIndex; });
+
+			if (it == m_threadNames.end())
+			{
+				m_threadNames.emplace_back(threadIndex, name);
+			}
+			else
+			{
+				it->second = name;
+			}
+
+			if (finished)
+			{
+				thread.stack.clear();
+
+				thread.buffer.reset();
+			}
+		}
+
+		m_threads.remove_if([](const ThreadState& thread) { return !thread.buffer; });
+	}
+
+	void CPUProfiler::rebuildNodes()
+	{
+		m_previousFrame.clear();
+
+		// 終了したスコープを含まないノードを除き、親のインデックスを詰め直す
+		Array<int32> indices(m_nodes.size(), -1);
+
+		for (size_t i = 0; i < m_nodes.size(); ++i)
+		{
+			const Node& node = m_nodes[i];
+
+			if ((node.count == 0) && (node.children == 0))
+			{
+				continue;
+			}
+
+			ProfileScopeStat stat;
+			stat.name			= Unicode::FromUTF8(node.name);
+			stat.threadIndex	= node.threadIndex;
+			stat.depth			= node.depth;
+			stat.parentIndex	= (node.parent == -1) ? -1 : indices[node.parent];
+			stat.count			= node.count;
+			stat.totalMillisec	= (node.total / 1'000'000.0);
+			stat.selfMillisec	= ((node.total - std::min(node.children, node.total)) / 1'000'000.0);
+
+			for (const auto& threadName : m_threadNames)
+			{
+				if (threadName.first == node.threadIndex)
+				{
+					stat.threadName = threadName.second;
+				}
+			}
+
+			indices[i] = static_cast<int32>(m_previousFrame.size());
+
+			m_previousFrame.push_back(std::move(stat));
+		}
+
+		// 開いたままのスコープは、次のフレームのノードとして作り直す
+		m_nodes.clear();
+
+		for (auto& thread : m_threads)
+		{
+			int32 parent = -1, depth = 0;
+
+			for (auto& scope : thread.stack)
+			{
+				scope.node = findOrAddNode(scope.name, thread.buffer->threadIndex, parent, depth++);
+
+				parent = scope.node;
+			}
+		}
+	}
+}
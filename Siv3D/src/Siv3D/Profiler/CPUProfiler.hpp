@@ -0,0 +1,195 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <atomic>
+# include <memory>
+# include <mutex>
+# include <Siv3D/Profiler.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/String.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		struct ProfileEvent
+		{
+			// nullptr の場合はスコープの終了
+			const char* name;
+
+			uint64 time;
+		};
+
+		// 1 つのスレッドが追加し、CPUProfiler が取り出す固定長のリングバッファ
+		class ProfileThreadBuffer
+		{
+		private:
+
+			std::unique_ptr<ProfileEvent[]> m_events;
+
+			alignas(64) std::atomic<size_t> m_writePos = { 0 };
+
+			alignas(64) std::atomic<size_t> m_readPos = { 0 };
+
+			mutable std::mutex m_nameMutex;
+
+			String m_name;
+
+		public:
+
+			static constexpr size_t Capacity = (1 << 15);
+
+			const uint32 threadIndex;
+
+			std::atomic<bool> finished = { false };
+
+			// バッファが一杯で記録できなかったスコープの数
+			std::atomic<size_t> dropped = { 0 };
+
+			explicit ProfileThreadBuffer(uint32 _threadIndex);
+
+			[[nodiscard]] size_t freeSpace() const noexcept
+			{
+				return Capacity - (m_writePos.load(std::memory_order_relaxed) - m_readPos.load(std::memory_order_acquire));
+			}
+
+			// freeSpace() で空きを確認してから呼ぶ
+			void push(const ProfileEvent& event) noexcept
+			{
+				const size_t pos = m_writePos.load(std::memory_order_relaxed);
+
+				m_events[pos & (Capacity - 1)] = event;
+
+				m_writePos.store(pos + 1, std::memory_order_release);
+			}
+
+			template <class Fty>
+			void consume(Fty f)
+			{
+				const size_t end = m_writePos.load(std::memory_order_acquire);
+
+				size_t pos = m_readPos.load(std::memory_order_relaxed);
+
+				for (; pos != end; ++pos)
+				{
+					f(m_events[pos & (Capacity - 1)]);
+				}
+
+				m_readPos.store(pos, std::memory_order_release);
+			}
+
+			void setName(const String& name);
+
+			[[nodiscard]] String getName() const;
+		};
+	}
+
+	class CPUProfiler
+	{
+	private:
+
+		struct OpenScope
+		{
+			const char* name;
+
+			uint64 begin;
+
+			int32 node;
+		};
+
+		struct ThreadState
+		{
+			std::shared_ptr<detail::ProfileThreadBuffer> buffer;
+
+			Array<OpenScope> stack;
+		};
+
+		struct Node
+		{
+			const char* name;
+
+			uint32 threadIndex;
+
+			int32 parent;
+
+			int32 depth;
+
+			uint32 count;
+
+			uint64 total;
+
+			uint64 children;
+		};
+
+		struct TraceEvent
+		{
+			const char* name;
+
+			uint32 threadIndex;
+
+			uint64 begin;
+
+			// UINT64_MAX の場合はフレームの区切り
+			uint64 duration;
+		};
+
+		// これ以上のトレースは記録しない
+		static constexpr size_t MaxTraceEvents = (1 << 20);
+
+		mutable std::mutex m_mutex;
+
+		Array<ThreadState> m_threads;
+
+		Array<Node> m_nodes;
+
+		Array<ProfileScopeStat> m_previousFrame;
+
+		Array<TraceEvent> m_trace;
+
+		// スレッド番号と名前（終了したスレッドの名前も保持する）
+		Array<std::pair<uint32, String>> m_threadNames;
+
+		uint64 m_traceStart = 0;
+
+		uint64 m_frameCount = 0;
+
+		size_t m_droppedTraceEvents = 0;
+
+		int32 findOrAddNode(const char* name, uint32 threadIndex, int32 parent, int32 depth);
+
+		void collect();
+
+		void rebuildNodes();
+
+	public:
+
+		// 任意のスレッドから呼ばれる
+		static void BeginScope(const char* name) noexcept;
+
+		static void EndScope() noexcept;
+
+		static void SetThreadName(const String& name);
+
+		void setEnabled(bool enabled);
+
+		bool isEnabled() const;
+
+		// メインスレッドのフレームの終わりに呼ぶ
+		void endFrame();
+
+		Array<ProfileScopeStat> getFrameScopes() const;
+
+		bool exportChromeTrace(const FilePath& path);
+
+		void clearTrace();
+	};
+}
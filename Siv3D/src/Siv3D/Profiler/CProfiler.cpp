@@ -29,6 +29,8 @@ namespace s3d
 	{
 		m_fpsStopwatch.start();
 
+		CPUProfiler::SetThreadName(U"Main");
+
 		LOG_INFO(U"ℹ️ Profiler initialized");
 
 		return true;
@@ -83,7 +85,7 @@ namespace s3d
 
 	void CProfiler::endFrame()
 	{
-
+		m_cpuProfiler.endFrame();
 	}
 
 	int32 CProfiler::getFPS() const
@@ -101,7 +103,42 @@ namespace s3d
 
 	Statistics CProfiler::getStatistics() const
 	{
-		return m_previousStatistics;
+		Statistics statistics = m_previousStatistics;
+
+		statistics.fontAtlasPages = m_fontAtlasPages;
+
+		statistics.fontAtlasBytes = m_fontAtlasBytes;
+
+		return statistics;
+	}
+
+	void CProfiler::reportFontAtlasPageCreation(const size_t bytes)
+	{
+		++m_fontAtlasPages;
+
+		m_fontAtlasBytes += bytes;
+	}
+
+	void CProfiler::reportFontAtlasPageRelease(const size_t bytes)
+	{
+		--m_fontAtlasPages;
+
+		m_fontAtlasBytes -= bytes;
+	}
+
+	void CProfiler::reportFontAtlasUpload(const size_t bytes)
+	{
+		m_currentStatistics.fontUploadBytes += bytes;
+	}
+
+	void CProfiler::reportVertexUpload(const size_t bytes)
+	{
+		m_currentStatistics.vertexUploadBytes += bytes;
+	}
+
+	void CProfiler::reportSavedDrawcalls(const size_t drawcalls)
+	{
+		m_currentStatistics.savedDrawcalls += drawcalls;
 	}
 
 
@@ -119,4 +156,30 @@ namespace s3d
 	{
 		++m_assetReleaseCount[0];
 	}
+
+
+	void CProfiler::setCPUProfilingEnabled(const bool enabled)
+	{
+		m_cpuProfiler.setEnabled(enabled);
+	}
+
+	bool CProfiler::isCPUProfilingEnabled() const
+	{
+		return m_cpuProfiler.isEnabled();
+	}
+
+	Array<ProfileScopeStat> CProfiler::getFrameScopes() const
+	{
+		return m_cpuProfiler.getFrameScopes();
+	}
+
+	bool CProfiler::exportChromeTrace(const FilePath& path)
+	{
+		return m_cpuProfiler.exportChromeTrace(path);
+	}
+
+	void CProfiler::clearTrace()
+	{
+		m_cpuProfiler.clearTrace();
+	}
 }
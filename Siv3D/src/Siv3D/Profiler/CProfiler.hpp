@@ -10,9 +10,11 @@
 //-----------------------------------------------
 
 # pragma once
+# include <atomic>
 # include "IProfiler.hpp"
 # include <Siv3D/Profiler.hpp>
 # include <Siv3D/Stopwatch.hpp>
+# include "CPUProfiler.hpp"
 
 namespace s3d
 {
@@ -36,6 +38,11 @@ namespace s3d
 
 		Statistics m_previousStatistics;
 
+		// グリフアトラスはフォントの破棄に伴って任意のスレッドから解放されうる
+		std::atomic<size_t> m_fontAtlasPages = { 0 };
+
+		std::atomic<size_t> m_fontAtlasBytes = { 0 };
+
 		//
 		// Asset creation
 		//
@@ -47,6 +54,11 @@ namespace s3d
 
 		std::array<int32, ReportFrameCount> m_assetReleaseCount{};
 
+		//
+		// CPU profiling
+		//
+		CPUProfiler m_cpuProfiler;
+
 	public:
 
 		CProfiler();
@@ -71,6 +83,16 @@ namespace s3d
 
 		Statistics getStatistics() const override;
 
+		void reportFontAtlasPageCreation(size_t bytes) override;
+
+		void reportFontAtlasPageRelease(size_t bytes) override;
+
+		void reportFontAtlasUpload(size_t bytes) override;
+
+		void reportVertexUpload(size_t bytes) override;
+
+		void reportSavedDrawcalls(size_t drawcalls) override;
+
 		//
 		// Asset creation
 		//
@@ -79,5 +101,18 @@ namespace s3d
 		void reportAssetCreation() override;
 
 		void reportAssetRelease() override;
+
+		//
+		// CPU profiling
+		//
+		void setCPUProfilingEnabled(bool enabled) override;
+
+		bool isCPUProfilingEnabled() const override;
+
+		Array<ProfileScopeStat> getFrameScopes() const override;
+
+		bool exportChromeTrace(const FilePath& path) override;
+
+		void clearTrace() override;
 	};
 }
@@ -11,6 +11,7 @@
 
 # pragma once
 # include <Siv3D/Fwd.hpp>
+# include <Siv3D/Profiler.hpp>
 
 namespace s3d
 {
@@ -35,12 +36,33 @@ namespace s3d
 
 		virtual Statistics getStatistics() const = 0;
 
+		virtual void reportFontAtlasPageCreation(size_t bytes) = 0;
+
+		virtual void reportFontAtlasPageRelease(size_t bytes) = 0;
+
+		virtual void reportFontAtlasUpload(size_t bytes) = 0;
+
+		virtual void reportVertexUpload(size_t bytes) = 0;
+
+		virtual void reportSavedDrawcalls(size_t drawcalls) = 0;
+
 
 		virtual void setAssetCreationWarningEnabled(bool enabled) = 0;
 
 		virtual void reportAssetCreation() = 0;
 
 		virtual void reportAssetRelease() = 0;
+
+
+		virtual void setCPUProfilingEnabled(bool enabled) = 0;
+
+		virtual bool isCPUProfilingEnabled() const = 0;
+
+		virtual Array<ProfileScopeStat> getFrameScopes() const = 0;
+
+		virtual bool exportChromeTrace(const FilePath& path) = 0;
+
+		virtual void clearTrace() = 0;
 	};
 }
 
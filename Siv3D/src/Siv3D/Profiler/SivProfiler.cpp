@@ -11,6 +11,7 @@
 
 # include "../Siv3DEngine.hpp"
 # include "IProfiler.hpp"
+# include "CPUProfiler.hpp"
 # include <Siv3D/Profiler.hpp>
 
 namespace s3d
@@ -31,5 +32,45 @@ namespace s3d
 		{
 			return Siv3DEngine::GetProfiler()->getStatistics();
 		}
+
+		void EnableCPUProfiling(const bool enabled)
+		{
+			Siv3DEngine::GetProfiler()->setCPUProfilingEnabled(enabled);
+		}
+
+		bool IsCPUProfilingEnabled()
+		{
+			return Siv3DEngine::GetProfiler()->isCPUProfilingEnabled();
+		}
+
+		void SetThreadName(const String& name)
+		{
+			CPUProfiler::SetThreadName(name);
+		}
+
+		void BeginScope(const char* name) noexcept
+		{
+			CPUProfiler::BeginScope(name);
+		}
+
+		void EndScope() noexcept
+		{
+			CPUProfiler::EndScope();
+		}
+
+		Array<ProfileScopeStat> GetFrameScopes()
+		{
+			return Siv3DEngine::GetProfiler()->getFrameScopes();
+		}
+
+		bool ExportChromeTrace(const FilePath& path)
+		{
+			return Siv3DEngine::GetProfiler()->exportChromeTrace(path);
+		}
+
+		void ClearTrace()
+		{
+			Siv3DEngine::GetProfiler()->clearTrace();
+		}
 	}
 }
@@ -17,6 +17,8 @@
 # include "../../Graphics/D3D11/CGraphics_D3D11.hpp"
 # include "../../ConstantBuffer/D3D11/D3D11ConstantBuffer.hpp"
 # include "../../Profiler/IProfiler.hpp"
+# include "../Vertex2DBuilder.hpp"
+# include "../../DrawList2D/DrawList2DData.hpp"
 # include "CRenderer2D_D3D11.hpp"
 # include <Siv3D/Mat3x2.hpp>
 # include <Siv3D/Math.hpp>
@@ -37,18 +39,6 @@ namespace s3d
 
 		static constexpr IndexType rectFrameIndexTable[24] = { 0, 1, 2, 3, 2, 1, 0, 4, 1, 5, 1, 4, 5, 4, 7, 6, 7, 4, 3, 7, 2, 6, 2, 7 };
 
-		static constexpr IndexType CalculateCircleQuality(const float size) noexcept
-		{
-			if (size <= 5.0f)
-			{
-				return static_cast<IndexType>(size + 3) * 2;
-			}
-			else
-			{
-				return static_cast<IndexType>(std::min(18 + (size - 5.0f) / 2.2f, 255.0f));
-			}
-		}
-
 		static constexpr IndexType CalculateCircleFrameQuality(const float size) noexcept
 		{
 			if (size <= 1.0f)
@@ -433,6 +423,26 @@ namespace s3d
 		return m_commandManager.getCurrentMaxScaling();
 	}
 
+	void CRenderer2D_D3D11::setInstancingEnabled(bool)
+	{
+		// [Siv3D ToDo] インスタンス描画
+	}
+
+	bool CRenderer2D_D3D11::isInstancingEnabled() const
+	{
+		return false;
+	}
+
+	void CRenderer2D_D3D11::setDrawCallSortingEnabled(bool)
+	{
+		// [Siv3D ToDo] 描画コマンドの並べ替え
+	}
+
+	bool CRenderer2D_D3D11::isDrawCallSortingEnabled() const
+	{
+		return false;
+	}
+
 	void CRenderer2D_D3D11::addLine(const LineStyle& style, const Float2& begin, const Float2& end, const float thickness, const Float4(&colors)[2])
 	{
 		if (thickness <= 0.0)
@@ -800,15 +810,12 @@ namespace s3d
 		m_commandManager.pushDraw(indexSize, D3D11Render2DPixelShaderType::Shape);
 	}
 
-	// 仮の実装
 	void CRenderer2D_D3D11::addCircle(const Float2& center, const float r, const Float4& color)
 	{
 		const float absR = std::abs(r);
-		const float centerX = center.x;
-		const float centerY = center.y;
 		const float scale = getMaxScaling();
 
-		const IndexType quality = detail::CalculateCircleQuality(absR * scale);
+		const IndexType quality = Vertex2DBuilder::CalculateCircleQuality(absR * scale);
 		const IndexType vertexSize = quality + 1, indexSize = quality * 3;
 		Vertex2D* pVertex;
 		IndexType* pIndex;
@@ -819,29 +826,8 @@ namespace s3d
 			return;
 		}
 
-		// 中心
-		pVertex[0].pos.set(centerX, centerY);
-
-		// 周
-		const float radDelta = Math::TwoPiF / quality;
-
-		for (IndexType i = 1; i <= quality; ++i)
-		{
-			const float rad = radDelta * (i - 1.0f);
-			pVertex[i].pos.set(centerX + r * std::cos(rad), centerY - r * std::sin(rad));
-		}
-
-		for (size_t i = 0; i < vertexSize; ++i)
-		{
-			(pVertex++)->color = color;
-		}
-
-		for (IndexType i = 0; i < quality; ++i)
-		{
-			pIndex[i * 3 + 0] = indexOffset + (i + 0) + 1;
-			pIndex[i * 3 + 1] = indexOffset;
-			pIndex[i * 3 + 2] = indexOffset + (i + 1) % quality + 1;
-		}
+		Vertex2DBuilder::BuildFan(pVertex, pIndex, indexOffset, center, Float2(r, r),
+			Vertex2DBuilder::GetUnitCircle(quality), quality, color, true);
 
 		m_commandManager.pushDraw(indexSize, D3D11Render2DPixelShaderType::Shape);
 	}
@@ -861,32 +847,8 @@ namespace s3d
 			return;
 		}
 
-		const float centerX = center.x;
-		const float centerY = center.y;
-		const float radDelta = Math::TwoPiF / quality;
-
-		for (IndexType i = 0; i < quality; ++i)
-		{
-			const float rad = radDelta * (i - 1.0f);
-			const float c = std::cos(rad);
-			const float s = std::sin(rad);
-
-			pVertex->pos.set(centerX + rt * c, centerY - rt * s);
-			pVertex->color = color;
-			++pVertex;
-
-			pVertex->pos.set(centerX + r * c, centerY - r * s);
-			pVertex->color = color;
-			++pVertex;
-		}
-
-		for (IndexType i = 0; i < quality; ++i)
-		{
-			for (IndexType k = 0; k < 6; ++k)
-			{
-				pIndex[i * 6 + k] = indexOffset + (i * 2 + detail::rectIndexTable[k]) % (quality * 2);
-			}
-		}
+		Vertex2DBuilder::BuildRing(pVertex, pIndex, indexOffset, center, Float2(rt, rt), Float2(r, r),
+			Vertex2DBuilder::GetUnitCircle(quality), quality, color, color, true);
 
 		m_commandManager.pushDraw(indexSize, D3D11Render2DPixelShaderType::Shape);
 	}
@@ -906,32 +868,8 @@ namespace s3d
 			return;
 		}
 
-		const float centerX = center.x;
-		const float centerY = center.y;
-		const float radDelta = Math::TwoPiF / quality;
-
-		for (IndexType i = 0; i < quality; ++i)
-		{
-			const float rad = radDelta * (i - 1.0f);
-			const float c = std::cos(rad);
-			const float s = std::sin(rad);
-
-			pVertex->pos.set(centerX + rt * c, centerY - rt * s);
-			pVertex->color = outerColor;
-			++pVertex;
-
-			pVertex->pos.set(centerX + r * c, centerY - r * s);
-			pVertex->color = innerColor;
-			++pVertex;
-		}
-
-		for (IndexType i = 0; i < quality; ++i)
-		{
-			for (IndexType k = 0; k < 6; ++k)
-			{
-				pIndex[i * 6 + k] = indexOffset + (i * 2 + detail::rectIndexTable[k]) % (quality * 2);
-			}
-		}
+		Vertex2DBuilder::BuildRing(pVertex, pIndex, indexOffset, center, Float2(rt, rt), Float2(r, r),
+			Vertex2DBuilder::GetUnitCircle(quality), quality, outerColor, innerColor, true);
 
 		m_commandManager.pushDraw(indexSize, D3D11Render2DPixelShaderType::Shape);
 	}
@@ -957,34 +895,11 @@ namespace s3d
 			return;
 		}
 
-		const float centerX = center.x;
-		const float centerY = center.y;
-
-		// 中心
-		pVertex[0].pos.set(centerX, centerY);
-
 		// 周
-		const float radDelta = Math::TwoPiF / (quality - 1);
-		const float start = -(startAngle + angle) + Math::HalfPiF;
-		const float angleScale = angle / Math::TwoPiF;
-
-		for (IndexType i = 1; i <= quality; ++i)
-		{
-			const float rad = start + (radDelta * (i - 1.0f)) * angleScale;
-			pVertex[i].pos.set(centerX + r * std::cos(rad), centerY - r * std::sin(rad));
-		}
-
-		for (size_t i = 0; i < vertexSize; ++i)
-		{
-			(pVertex++)->color = color;
-		}
+		Float2 unit[Vertex2DBuilder::MaxCircleQuality];
+		Vertex2DBuilder::GetUnitArc(unit, -(startAngle + angle) + Math::HalfPiF, angle / (quality - 1), quality);
 
-		for (IndexType i = 0; i < quality - 1; ++i)
-		{
-			pIndex[i * 3 + 0] = indexOffset + (i + 0) + 1;
-			pIndex[i * 3 + 1] = indexOffset;
-			pIndex[i * 3 + 2] = indexOffset + (i + 1) + 1;
-		}
+		Vertex2DBuilder::BuildFan(pVertex, pIndex, indexOffset, center, Float2(r, r), unit, quality, color, false);
 
 		m_commandManager.pushDraw(indexSize, D3D11Render2DPixelShaderType::Shape);
 	}
@@ -1011,34 +926,10 @@ namespace s3d
 			return;
 		}
 
-		const float centerX = center.x;
-		const float centerY = center.y;
-		const float radDelta = Math::TwoPiF / (quality - 1);
-		const float start = -(startAngle + angle) + Math::HalfPiF;
-		const float angleScale = angle / Math::TwoPiF;
-
-		for (IndexType i = 0; i < quality; ++i)
-		{
-			const float rad = start + (radDelta * i) * angleScale;
-			const float c = std::cos(rad);
-			const float s = std::sin(rad);
-				
-			pVertex->pos.set(centerX + rt * c, centerY - rt * s);
-			pVertex->color = color;
-			++pVertex;
-
-			pVertex->pos.set(centerX + r * c, centerY - r * s);
-			pVertex->color = color;
-			++pVertex;
-		}
+		Float2 unit[Vertex2DBuilder::MaxCircleQuality];
+		Vertex2DBuilder::GetUnitArc(unit, -(startAngle + angle) + Math::HalfPiF, angle / (quality - 1), quality);
 
-		for (IndexType i = 0; i < quality - 1; ++i)
-		{
-			for (IndexType k = 0; k < 6; ++k)
-			{
-				pIndex[i * 6 + k] = indexOffset + (i * 2 + detail::rectIndexTable[k]);
-			}
-		}
+		Vertex2DBuilder::BuildRing(pVertex, pIndex, indexOffset, center, Float2(rt, rt), Float2(r, r), unit, quality, color, color, false);
 
 		m_commandManager.pushDraw(indexSize, D3D11Render2DPixelShaderType::Shape);
 	}
@@ -1057,32 +948,8 @@ namespace s3d
 			return;
 		}
 
-		const float centerX = center.x;
-		const float centerY = center.y;
-
-		// 中心
-		pVertex[0].pos.set(centerX, centerY);
-
-		// 周
-		const float radDelta = Math::TwoPiF / quality;
-
-		for (IndexType i = 1; i <= quality; ++i)
-		{
-			const float rad = radDelta * (i - 1.0f);
-			pVertex[i].pos.set(centerX + a * std::cos(rad), centerY - b * std::sin(rad));
-		}
-
-		for (size_t i = 0; i < vertexSize; ++i)
-		{
-			(pVertex++)->color = color;
-		}
-
-		for (IndexType i = 0; i < quality; ++i)
-		{
-			pIndex[i * 3 + 0] = indexOffset + (i + 0) + 1;
-			pIndex[i * 3 + 1] = indexOffset;
-			pIndex[i * 3 + 2] = indexOffset + (i + 1) % quality + 1;
-		}
+		Vertex2DBuilder::BuildFan(pVertex, pIndex, indexOffset, center, Float2(a, b),
+			Vertex2DBuilder::GetUnitCircle(quality), quality, color, true);
 
 		m_commandManager.pushDraw(indexSize, D3D11Render2DPixelShaderType::Shape);
 	}
@@ -1104,32 +971,8 @@ namespace s3d
 			return;
 		}
 
-		const float centerX = center.x;
-		const float centerY = center.y;
-		const float radDelta = Math::TwoPiF / quality;
-
-		for (IndexType i = 0; i < quality; ++i)
-		{
-			const float rad = radDelta * (i - 1.0f);
-			const float c = std::cos(rad);
-			const float s = std::sin(rad);
-
-			pVertex->pos.set(centerX + a * c, centerY - b * s);
-			pVertex->color = color;
-			++pVertex;
-
-			pVertex->pos.set(centerX + at * c, centerY - bt * s);
-			pVertex->color = color;
-			++pVertex;
-		}
-
-		for (IndexType i = 0; i < quality; ++i)
-		{
-			for (IndexType k = 0; k < 6; ++k)
-			{
-				pIndex[i * 6 + k] = indexOffset + (i * 2 + detail::rectIndexTable[k]) % (quality * 2);
-			}
-		}
+		Vertex2DBuilder::BuildRing(pVertex, pIndex, indexOffset, center, Float2(a, b), Float2(at, bt),
+			Vertex2DBuilder::GetUnitCircle(quality), quality, color, color, true);
 
 		m_commandManager.pushDraw(indexSize, D3D11Render2DPixelShaderType::Shape);
 	}
@@ -2077,6 +1920,52 @@ namespace s3d
 		}
 	}
 
+	void CRenderer2D_D3D11::addDrawList(const std::shared_ptr<const DrawList2DData>& list)
+	{
+		if (!list)
+		{
+			return;
+		}
+
+		// [Siv3D ToDo] 記録済みのバッファを直接描画する
+		const Vertex2D* pSrcVertex = list->vertices.data();
+		const uint32* pSrcIndex = list->indices.data();
+
+		for (const auto& segment : list->segments)
+		{
+			Vertex2D* pVertex;
+			IndexType* pIndex;
+			IndexType indexOffset;
+
+			if (!m_spriteBatch.getBuffer(segment.vertexSize, segment.indexSize, &pVertex, &pIndex, &indexOffset, m_commandManager))
+			{
+				return;
+			}
+
+			::memcpy(pVertex, pSrcVertex, segment.vertexSize * sizeof(Vertex2D));
+
+			for (uint32 i = 0; i < segment.indexSize; ++i)
+			{
+				pIndex[i] = indexOffset + pSrcIndex[i];
+			}
+
+			pSrcVertex += segment.vertexSize;
+			pSrcIndex += segment.indexSize;
+
+			if (segment.texture)
+			{
+				m_commandManager.pushPSTexture(0, *segment.texture);
+
+				m_commandManager.pushDraw(segment.indexSize, segment.texture->isSDF()
+					? D3D11Render2DPixelShaderType::SpriteSDF : D3D11Render2DPixelShaderType::Sprite);
+			}
+			else
+			{
+				m_commandManager.pushDraw(segment.indexSize, D3D11Render2DPixelShaderType::Shape);
+			}
+		}
+	}
+
 	const Texture& CRenderer2D_D3D11::getBoxShadowTexture() const
 	{
 		return m_boxShadowTexture;
@@ -102,6 +102,14 @@ namespace s3d
 
 		float getMaxScaling() const override;
 
+		void setInstancingEnabled(bool enabled) override;
+
+		bool isInstancingEnabled() const override;
+
+		void setDrawCallSortingEnabled(bool enabled) override;
+
+		bool isDrawCallSortingEnabled() const override;
+
 		void addLine(const LineStyle& style, const Float2& begin, const Float2& end, float thickness, const Float4(&colors)[2]) override;
 
 		void addTriangle(const Float2(&pts)[3], const Float4& color) override;
@@ -151,6 +159,8 @@ namespace s3d
 
 		void addSprite(const Optional<Texture>& texture, const Sprite& sprite, uint32 startIndex, uint32 indexCount) override;
 
+		void addDrawList(const std::shared_ptr<const DrawList2DData>& list) override;
+
 
 		const Texture& getBoxShadowTexture() const override;
 	};
@@ -21,6 +21,8 @@
 # include <Siv3D/Vertex2D.hpp>
 # include <Siv3D/Logger.hpp>
 # include "D3D11Renderer2DCommandManager.hpp"
+# include "../../Siv3DEngine.hpp"
+# include "../../Profiler/IProfiler.hpp"
 
 using namespace Microsoft::WRL;
 
@@ -283,6 +285,8 @@ namespace s3d
 				batchDrawOffset.indexCount = indexSize;
 				batchDrawOffset.indexStartLocation = m_indexBufferWritePos;
 				m_indexBufferWritePos += indexSize;
+
+				Siv3DEngine::GetProfiler()->reportVertexUpload(sizeof(Vertex2D) * m_batches[batchIndex].vertexPos + sizeof(IndexType) * indexSize);
 			}
 
 			ID3D11Buffer* const pBuf[3] = { m_vertexBuffer.Get(), nullptr, nullptr };
@@ -29,6 +29,8 @@
 # include <Siv3D/Logger.hpp>
 # include "../../ConstantBuffer/GL/GLConstantBuffer.hpp"
 # include "../../Profiler/IProfiler.hpp"
+# include "../Vertex2DBuilder.hpp"
+# include "../../DrawList2D/DrawList2DData.hpp"
 
 namespace s3d
 {
@@ -38,18 +40,6 @@ namespace s3d
 		
 		static constexpr IndexType rectFrameIndexTable[24] = { 0, 1, 2, 3, 2, 1, 0, 4, 1, 5, 1, 4, 5, 4, 7, 6, 7, 4, 3, 7, 2, 6, 2, 7 };
 
-		static constexpr IndexType CalculateCircleQuality(const float size) noexcept
-		{
-			if (size <= 5.0f)
-			{
-				return static_cast<IndexType>(size + 3) * 2;
-			}
-			else
-			{
-				return static_cast<IndexType>(std::min(18 + (size - 5.0f) / 2.2f, 255.0f));
-			}
-		}
-
 		static constexpr IndexType CalculateCircleFrameQuality(const float size) noexcept
 		{
 			if (size <= 1.0f)
@@ -115,6 +105,16 @@ namespace s3d
 			return false;
 		}
 
+		if (!m_instanceBatch.init())
+		{
+			return false;
+		}
+
+		if (!m_listBatch.init(false))
+		{
+			return false;
+		}
+
 		m_commandManager.reset();
 
 		{
@@ -144,6 +144,17 @@ namespace s3d
 		
 		const Size currentRenderTargetSize = Siv3DEngine::GetGraphics()->getCurrentRenderTargetSize();
 		
+		// フレームの最後にのみ、描画コマンドを並べ替えてまとめる
+		if (clearGraphics && m_drawCallSortingEnabled)
+		{
+			const size_t savedDrawcalls = m_commandManager.sortAndMerge([this](const size_t index, const Vertex2D** pVertex, IndexType** pIndices)
+			{
+				return m_spriteBatch.getBatchData(index, pVertex, pIndices);
+			}, m_instanceBatch.getInstances());
+
+			Siv3DEngine::GetProfiler()->reportSavedDrawcalls(savedDrawcalls);
+		}
+
 		size_t batchIndex = 0;
 		BatchDrawOffset batchDrawOffset;
 		
@@ -151,13 +162,25 @@ namespace s3d
 		
 		//Log(L"----");
 	
-		m_pipeline.setVS(shader->getVSProgram(shader->getStandardVS(0).id()));
-		m_pipeline.setPS(shader->getPSProgram(shader->getStandardPS(0).id()));
+		const GLuint spriteVS = shader->getVSProgram(shader->getStandardVS(0).id());
+		const GLuint instancedVS = shader->getVSProgram(shader->getStandardVS(1).id());
+		
+		// 描画リストの描画後に戻すため、現在のシェーダとテクスチャを記録しておく
+		PixelShaderID currentPS = shader->getStandardPS(0).id();
+		TextureID currentTexture0 = TextureID::NullAsset();
+
+		m_pipeline.setVS(spriteVS);
+		m_pipeline.setPS(shader->getPSProgram(currentPS));
 		
 		m_pipeline.use();
 		Mat3x2 currentMat = Mat3x2::Identity();
 		Mat3x2 currentScreen;
 
+		// すべてのインスタンスを先に転送し、DrawInstanced ごとに先頭をずらしながら描く
+		m_instanceBatch.upload();
+		bool instanced = false;
+		uint32 instanceIndex = 0;
+
 		size_t pf_drawcalls = 0, pf_vertices = 0;
 		
 		for (size_t commandIndex = 0; commandIndex < m_commandManager.getCount(); ++commandIndex)
@@ -175,6 +198,13 @@ namespace s3d
 				{
 					const auto* command = static_cast<const GLRender2DCommand<GLRender2DInstruction::Draw>*>(static_cast<const void*>(commandPointer));
 					
+					if (instanced)
+					{
+						m_pipeline.setVS(spriteVS);
+						m_spriteBatch.bind();
+						instanced = false;
+					}
+					
 					++pf_drawcalls;
 					pf_vertices += command->indexSize;
 
@@ -185,11 +215,81 @@ namespace s3d
 					
 					break;
 				}
+				case GLRender2DInstruction::DrawInstanced:
+				{
+					const auto* command = static_cast<const GLRender2DCommand<GLRender2DInstruction::DrawInstanced>*>(static_cast<const void*>(commandPointer));
+					
+					if (!instanced)
+					{
+						m_pipeline.setVS(instancedVS);
+						m_instanceBatch.bind();
+						instanced = true;
+					}
+					
+					++pf_drawcalls;
+					pf_vertices += m_instanceBatch.draw(command->mesh, instanceIndex, command->instanceCount);
+					
+					instanceIndex += command->instanceCount;
+					
+					break;
+				}
+				case GLRender2DInstruction::DrawList:
+				{
+					const auto* command = static_cast<const GLRender2DCommand<GLRender2DInstruction::DrawList>*>(static_cast<const void*>(commandPointer));
+					
+					if (instanced)
+					{
+						m_pipeline.setVS(spriteVS);
+						instanced = false;
+					}
+					
+					const DrawList2DData& list = *m_drawLists[command->index];
+					const Vertex2D* pVertex = list.vertices.data();
+					const uint32* pIndex = list.indices.data();
+					
+					for (const auto& segment : list.segments)
+					{
+						// 記録済みのバッファをそのまま転送する
+						const BatchDrawOffset offset = m_listBatch.upload(pVertex, segment.vertexSize, pIndex, segment.indexSize);
+						pVertex += segment.vertexSize;
+						pIndex += segment.indexSize;
+						
+						GLRender2DPixelShaderType type = GLRender2DPixelShaderType::Shape;
+						
+						if (segment.texture)
+						{
+							type = segment.texture->isSDF() ? GLRender2DPixelShaderType::SpriteSDF : GLRender2DPixelShaderType::Sprite;
+							Siv3DEngine::GetTexture()->setPS(0, segment.texture->id());
+						}
+						
+						const PixelShaderID psID = shader->getStandardPS(static_cast<size_t>(type)).id();
+						m_pipeline.setPS(shader->getPSProgram(psID));
+						shader->setPSSamplerUniform(psID);
+						
+						++pf_drawcalls;
+						pf_vertices += segment.indexSize;
+						
+						::glDrawElementsBaseVertex(GL_TRIANGLES, segment.indexSize, GL_UNSIGNED_INT, (uint32*)(nullptr) + offset.indexStartLocation, offset.vertexStartLocation);
+					}
+					
+					m_pipeline.setPS(shader->getPSProgram(currentPS));
+					shader->setPSSamplerUniform(currentPS);
+					Siv3DEngine::GetTexture()->setPS(0, currentTexture0);
+					m_spriteBatch.bind();
+					
+					break;
+				}
 				case GLRender2DInstruction::NextBatch:
 				{
 					//Log(L"NextBatch: ", batchIndex);
 					batchDrawOffset = m_spriteBatch.setBuffers(batchIndex);
 					++batchIndex;
+					
+					if (instanced)
+					{
+						m_instanceBatch.bind();
+					}
+					
 					break;
 				}
 				case GLRender2DInstruction::BlendState:
@@ -279,6 +379,7 @@ namespace s3d
 					//Log(L"PixelShader: id = ", command->psID);
 					m_pipeline.setPS(shader->getPSProgram(command->psID));
 					shader->setPSSamplerUniform(command->psID);
+					currentPS = command->psID;
 					
 					break;
 				}
@@ -289,6 +390,11 @@ namespace s3d
 					//Log(L"PSTexture: slot = ", command->slot, L", id = ", command->textureID);
 					Siv3DEngine::GetTexture()->setPS(command->slot, command->textureID);
 					
+					if (command->slot == 0)
+					{
+						currentTexture0 = command->textureID;
+					}
+					
 					break;
 				}
 			}
@@ -302,6 +408,10 @@ namespace s3d
 		{
 			m_spriteBatch.clear();
 
+			m_instanceBatch.clear();
+
+			m_drawLists.clear();
+
 			m_commandManager.reset();
 		}
 
@@ -400,6 +510,53 @@ namespace s3d
 	{
 		return m_commandManager.getCurrentMaxScaling();
 	}
+
+	void CRenderer2D_GL::setInstancingEnabled(const bool enabled)
+	{
+		m_instancingEnabled = enabled;
+	}
+
+	bool CRenderer2D_GL::isInstancingEnabled() const
+	{
+		return m_instancingEnabled;
+	}
+
+	void CRenderer2D_GL::setDrawCallSortingEnabled(const bool enabled)
+	{
+		m_drawCallSortingEnabled = enabled;
+
+		m_commandManager.setDrawCallSortingEnabled(enabled);
+
+		m_spriteBatch.setPersistentMappingEnabled(!enabled, m_commandManager);
+	}
+
+	bool CRenderer2D_GL::isDrawCallSortingEnabled() const
+	{
+		return m_drawCallSortingEnabled;
+	}
+
+	bool CRenderer2D_GL::addInstance(const InstancedMeshID mesh, const FloatRect& rect, const FloatRect& uv, const Float4& color, const GLRender2DPixelShaderType ps)
+	{
+		if (!m_commandManager.canDrawInstanced(mesh, ps))
+		{
+			return false;
+		}
+
+		Instance2D* pInstance = m_instanceBatch.getInstance();
+
+		if (!pInstance)
+		{
+			return false;
+		}
+
+		pInstance->rect = rect;
+		pInstance->uv = uv;
+		pInstance->color = color;
+
+		m_commandManager.pushDrawInstanced(mesh, ps);
+
+		return true;
+	}
 	
 	void CRenderer2D_GL::addLine(const LineStyle& style, const Float2& begin, const Float2& end, float thickness, const Float4(&colors)[2])
 	{
@@ -639,6 +796,12 @@ namespace s3d
 	
 	void CRenderer2D_GL::addRect(const FloatRect& rect, const Float4& color)
 	{
+		if (m_instancingEnabled
+			&& addInstance(GLInstanceBatch::QuadMesh, rect, FloatRect(0.0f, 0.0f, 0.0f, 0.0f), color, GLRender2DPixelShaderType::Shape))
+		{
+			return;
+		}
+
 		constexpr IndexType vertexSize = 4, indexSize = 6;
 		Vertex2D* pVertex;
 		IndexType* pIndex;
@@ -734,15 +897,19 @@ namespace s3d
 		m_commandManager.pushDraw(indexSize, GLRender2DPixelShaderType::Shape);
 	}
 
-	// 仮の実装
 	void CRenderer2D_GL::addCircle(const Float2& center, const float r, const Float4& color)
 	{
 		const float absR = std::abs(r);
-		const float centerX = center.x;
-		const float centerY = center.y;
 		const float scale = getMaxScaling();
 
-		const IndexType quality = detail::CalculateCircleQuality(absR * scale);
+		const IndexType quality = Vertex2DBuilder::CalculateCircleQuality(absR * scale);
+
+		if (m_instancingEnabled
+			&& addInstance(quality, FloatRect(center.x - r, center.y - r, center.x + r, center.y + r), FloatRect(0.0f, 0.0f, 0.0f, 0.0f), color, GLRender2DPixelShaderType::Shape))
+		{
+			return;
+		}
+
 		const IndexType vertexSize = quality + 1, indexSize = quality * 3;
 		Vertex2D* pVertex;
 		IndexType* pIndex;
@@ -753,30 +920,9 @@ namespace s3d
 			return;
 		}
 
-		// 中心
-		pVertex[0].pos.set(centerX, centerY);
-
-		// 周
-		const float radDelta = Math::TwoPiF / quality;
-
-		for (IndexType i = 1; i <= quality; ++i)
-		{
-			const float rad = radDelta * (i - 1.0f);
-			pVertex[i].pos.set(centerX + r * std::cos(rad), centerY - r * std::sin(rad));
-		}
-
-		for (size_t i = 0; i < vertexSize; ++i)
-		{
-			(pVertex++)->color = color;
-		}
+		Vertex2DBuilder::BuildFan(pVertex, pIndex, indexOffset, center, Float2(r, r),
+			Vertex2DBuilder::GetUnitCircle(quality), quality, color, true);
 
-		for (IndexType i = 0; i < quality; ++i)
-		{
-			pIndex[i * 3 + 0] = indexOffset + (i + 0) + 1;
-			pIndex[i * 3 + 1] = indexOffset;
-			pIndex[i * 3 + 2] = indexOffset + (i + 1) % quality + 1;
-		}
-		
 		m_commandManager.pushDraw(indexSize, GLRender2DPixelShaderType::Shape);
 	}
 
@@ -795,33 +941,9 @@ namespace s3d
 			return;
 		}
 
-		const float centerX = center.x;
-		const float centerY = center.y;
-		const float radDelta = Math::TwoPiF / quality;
+		Vertex2DBuilder::BuildRing(pVertex, pIndex, indexOffset, center, Float2(rt, rt), Float2(r, r),
+			Vertex2DBuilder::GetUnitCircle(quality), quality, color, color, true);
 
-		for (IndexType i = 0; i < quality; ++i)
-		{
-			const float rad = radDelta * (i - 1.0f);
-			const float c = std::cos(rad);
-			const float s = std::sin(rad);
-
-			pVertex->pos.set(centerX + rt * c, centerY - rt * s);
-			pVertex->color = color;
-			++pVertex;
-
-			pVertex->pos.set(centerX + r * c, centerY - r * s);
-			pVertex->color = color;
-			++pVertex;
-		}
-
-		for (IndexType i = 0; i < quality; ++i)
-		{
-			for (IndexType k = 0; k < 6; ++k)
-			{
-				pIndex[i * 6 + k] = indexOffset + (i * 2 + detail::rectIndexTable[k]) % (quality * 2);
-			}
-		}
-		
 		m_commandManager.pushDraw(indexSize, GLRender2DPixelShaderType::Shape);
 	}
 
@@ -840,33 +962,9 @@ namespace s3d
 			return;
 		}
 
-		const float centerX = center.x;
-		const float centerY = center.y;
-		const float radDelta = Math::TwoPiF / quality;
+		Vertex2DBuilder::BuildRing(pVertex, pIndex, indexOffset, center, Float2(rt, rt), Float2(r, r),
+			Vertex2DBuilder::GetUnitCircle(quality), quality, outerColor, innerColor, true);
 
-		for (IndexType i = 0; i < quality; ++i)
-		{
-			const float rad = radDelta * (i - 1.0f);
-			const float c = std::cos(rad);
-			const float s = std::sin(rad);
-
-			pVertex->pos.set(centerX + rt * c, centerY - rt * s);
-			pVertex->color = outerColor;
-			++pVertex;
-
-			pVertex->pos.set(centerX + r * c, centerY - r * s);
-			pVertex->color = innerColor;
-			++pVertex;
-		}
-
-		for (IndexType i = 0; i < quality; ++i)
-		{
-			for (IndexType k = 0; k < 6; ++k)
-			{
-				pIndex[i * 6 + k] = indexOffset + (i * 2 + detail::rectIndexTable[k]) % (quality * 2);
-			}
-		}
-		
 		m_commandManager.pushDraw(indexSize, GLRender2DPixelShaderType::Shape);
 	}
 	
@@ -890,36 +988,13 @@ namespace s3d
 		{
 			return;
 		}
-		
-		const float centerX = center.x;
-		const float centerY = center.y;
-		
-		// 中心
-		pVertex[0].pos.set(centerX, centerY);
-		
+
 		// 周
-		const float radDelta = Math::TwoPiF / (quality - 1);
-		const float start = -(startAngle + angle) + Math::HalfPiF;
-		const float angleScale = angle / Math::TwoPiF;
-		
-		for (IndexType i = 1; i <= quality; ++i)
-		{
-			const float rad = start + (radDelta * (i - 1.0f)) * angleScale;
-			pVertex[i].pos.set(centerX + r * std::cos(rad), centerY - r * std::sin(rad));
-		}
-		
-		for (size_t i = 0; i < vertexSize; ++i)
-		{
-			(pVertex++)->color = color;
-		}
-		
-		for (IndexType i = 0; i < quality - 1; ++i)
-		{
-			pIndex[i * 3 + 0] = indexOffset + (i + 0) + 1;
-			pIndex[i * 3 + 1] = indexOffset;
-			pIndex[i * 3 + 2] = indexOffset + (i + 1) + 1;
-		}
-		
+		Float2 unit[Vertex2DBuilder::MaxCircleQuality];
+		Vertex2DBuilder::GetUnitArc(unit, -(startAngle + angle) + Math::HalfPiF, angle / (quality - 1), quality);
+
+		Vertex2DBuilder::BuildFan(pVertex, pIndex, indexOffset, center, Float2(r, r), unit, quality, color, false);
+
 		m_commandManager.pushDraw(indexSize, GLRender2DPixelShaderType::Shape);
 	}
 	
@@ -944,36 +1019,12 @@ namespace s3d
 		{
 			return;
 		}
-		
-		const float centerX = center.x;
-		const float centerY = center.y;
-		const float radDelta = Math::TwoPiF / (quality - 1);
-		const float start = -(startAngle + angle) + Math::HalfPiF;
-		const float angleScale = angle / Math::TwoPiF;
-		
-		for (IndexType i = 0; i < quality; ++i)
-		{
-			const float rad = start + (radDelta * i) * angleScale;
-			const float c = std::cos(rad);
-			const float s = std::sin(rad);
-			
-			pVertex->pos.set(centerX + rt * c, centerY - rt * s);
-			pVertex->color = color;
-			++pVertex;
-			
-			pVertex->pos.set(centerX + r * c, centerY - r * s);
-			pVertex->color = color;
-			++pVertex;
-		}
-		
-		for (IndexType i = 0; i < quality - 1; ++i)
-		{
-			for (IndexType k = 0; k < 6; ++k)
-			{
-				pIndex[i * 6 + k] = indexOffset + (i * 2 + detail::rectIndexTable[k]);
-			}
-		}
-		
+
+		Float2 unit[Vertex2DBuilder::MaxCircleQuality];
+		Vertex2DBuilder::GetUnitArc(unit, -(startAngle + angle) + Math::HalfPiF, angle / (quality - 1), quality);
+
+		Vertex2DBuilder::BuildRing(pVertex, pIndex, indexOffset, center, Float2(rt, rt), Float2(r, r), unit, quality, color, color, false);
+
 		m_commandManager.pushDraw(indexSize, GLRender2DPixelShaderType::Shape);
 	}
 
@@ -991,32 +1042,8 @@ namespace s3d
 			return;
 		}
 
-		const float centerX = center.x;
-		const float centerY = center.y;
-
-		// 中心
-		pVertex[0].pos.set(centerX, centerY);
-
-		// 周
-		const float radDelta = Math::TwoPiF / quality;
-
-		for (IndexType i = 1; i <= quality; ++i)
-		{
-			const float rad = radDelta * (i - 1.0f);
-			pVertex[i].pos.set(centerX + a * std::cos(rad), centerY - b * std::sin(rad));
-		}
-
-		for (size_t i = 0; i < vertexSize; ++i)
-		{
-			(pVertex++)->color = color;
-		}
-
-		for (IndexType i = 0; i < quality; ++i)
-		{
-			pIndex[i * 3 + 0] = indexOffset + (i + 0) + 1;
-			pIndex[i * 3 + 1] = indexOffset;
-			pIndex[i * 3 + 2] = indexOffset + (i + 1) % quality + 1;
-		}
+		Vertex2DBuilder::BuildFan(pVertex, pIndex, indexOffset, center, Float2(a, b),
+			Vertex2DBuilder::GetUnitCircle(quality), quality, color, true);
 
 		m_commandManager.pushDraw(indexSize, GLRender2DPixelShaderType::Shape);
 	}
@@ -1038,32 +1065,8 @@ namespace s3d
 			return;
 		}
 
-		const float centerX = center.x;
-		const float centerY = center.y;
-		const float radDelta = Math::TwoPiF / quality;
-
-		for (IndexType i = 0; i < quality; ++i)
-		{
-			const float rad = radDelta * (i - 1.0f);
-			const float c = std::cos(rad);
-			const float s = std::sin(rad);
-
-			pVertex->pos.set(centerX + a * c, centerY - b * s);
-			pVertex->color = color;
-			++pVertex;
-
-			pVertex->pos.set(centerX + at * c, centerY - bt * s);
-			pVertex->color = color;
-			++pVertex;
-		}
-
-		for (IndexType i = 0; i < quality; ++i)
-		{
-			for (IndexType k = 0; k < 6; ++k)
-			{
-				pIndex[i * 6 + k] = indexOffset + (i * 2 + detail::rectIndexTable[k]) % (quality * 2);
-			}
-		}
+		Vertex2DBuilder::BuildRing(pVertex, pIndex, indexOffset, center, Float2(a, b), Float2(at, bt),
+			Vertex2DBuilder::GetUnitCircle(quality), quality, color, color, true);
 
 		m_commandManager.pushDraw(indexSize, GLRender2DPixelShaderType::Shape);
 	}
@@ -1787,6 +1790,16 @@ namespace s3d
 	
 	void CRenderer2D_GL::addTextureRegion(const Texture& texture, const FloatRect& rect, const FloatRect& uv, const Float4& color)
 	{
+		if (m_instancingEnabled)
+		{
+			m_commandManager.pushPSTexture(0, texture);
+
+			if (addInstance(GLInstanceBatch::QuadMesh, rect, uv, color, texture.isSDF() ? GLRender2DPixelShaderType::SpriteSDF : GLRender2DPixelShaderType::Sprite))
+			{
+				return;
+			}
+		}
+
 		constexpr IndexType vertexSize = 4, indexSize = 6;
 		Vertex2D* pVertex;
 		IndexType* pIndex;
@@ -2043,6 +2056,19 @@ namespace s3d
 		}
 	}
 
+	void CRenderer2D_GL::addDrawList(const std::shared_ptr<const DrawList2DData>& list)
+	{
+		if (!list || list->segments.isEmpty())
+		{
+			return;
+		}
+		
+		// 頂点は flush() で描画リストのバッファから直接転送する
+		m_commandManager.pushDrawList(static_cast<uint32>(m_drawLists.size()));
+		
+		m_drawLists.push_back(list);
+	}
+
 	const Texture& CRenderer2D_GL::getBoxShadowTexture() const
 	{
 		return m_boxShadowTexture;
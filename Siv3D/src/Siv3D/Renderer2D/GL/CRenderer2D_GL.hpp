@@ -20,6 +20,7 @@
 # include <Siv3D/ConstantBuffer.hpp>
 # include "../IRenderer2D.hpp"
 # include "GLSpriteBatch.hpp"
+# include "GLInstanceBatch.hpp"
 # include "GLRenderer2DCommandManager.hpp"
 
 namespace s3d
@@ -88,10 +89,24 @@ namespace s3d
 		ConstantBuffer<SpriteCB> m_cbSprite;
 		
 		GLSpriteBatch m_spriteBatch;
+
+		GLInstanceBatch m_instanceBatch;
+
+		// 描画リストの頂点を転送するバッファ
+		GLSpriteBatch m_listBatch;
+
+		Array<std::shared_ptr<const DrawList2DData>> m_drawLists;
 		
 		GLRender2DCommandManager m_commandManager;
 
 		Texture m_boxShadowTexture;
+
+		bool m_instancingEnabled = true;
+
+		bool m_drawCallSortingEnabled = false;
+
+		// インスタンスを 1 つ追加する。頂点による描画を使うべき場合は false
+		bool addInstance(InstancedMeshID mesh, const FloatRect& rect, const FloatRect& uv, const Float4& color, GLRender2DPixelShaderType ps);
 		
 	public:
 
@@ -137,6 +152,14 @@ namespace s3d
 
 		float getMaxScaling() const override;
 
+		void setInstancingEnabled(bool enabled) override;
+
+		bool isInstancingEnabled() const override;
+
+		void setDrawCallSortingEnabled(bool enabled) override;
+
+		bool isDrawCallSortingEnabled() const override;
+
 		void addLine(const LineStyle& style, const Float2& begin, const Float2& end, float thickness, const Float4(&colors)[2]) override;
 		
 		void addTriangle(const Float2(&pts)[3], const Float4& color) override;
@@ -186,6 +209,8 @@ namespace s3d
 		
 		void addSprite(const Optional<Texture>& texture, const Sprite& sprite, uint32 startIndex, uint32 indexCount) override;
 
+		void addDrawList(const std::shared_ptr<const DrawList2DData>& list) override;
+
 
 		const Texture& getBoxShadowTexture() const override;
 	};
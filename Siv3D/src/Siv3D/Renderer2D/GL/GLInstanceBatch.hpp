@@ -0,0 +1,251 @@
+//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Platform.hpp>
+# if defined(SIV3D_TARGET_MACOS) || defined(SIV3D_TARGET_LINUX)
+
+# include <GL/glew.h>
+# include "../../../ThirdParty/GLFW/include/GLFW/glfw3.h"
+# include <Siv3D/Array.hpp>
+# include <Siv3D/PointVector.hpp>
+# include <Siv3D/FloatRect.hpp>
+# include <Siv3D/Logger.hpp>
+# include "../../Siv3DEngine.hpp"
+# include "../../Profiler/IProfiler.hpp"
+# include "../Vertex2DBuilder.hpp"
+
+namespace s3d
+{
+	// インスタンス描画の 1 インスタンス分のデータ
+	// 共有メッシュの単位座標 t (0 <= t <= 1) を pos = mix(rect.xy, rect.zw, t), tex = mix(uv.xy, uv.zw, t) に展開する
+	struct Instance2D
+	{
+		FloatRect rect;
+
+		FloatRect uv;
+
+		Float4 color;
+	};
+
+	static_assert(sizeof(Instance2D) == 48);
+
+	// 共有メッシュの番号。0 は四角形、3 以上は分割数 n の円
+	using InstancedMeshID = uint32;
+
+	struct InstancedMeshRange
+	{
+		uint32 indexCount = 0;
+
+		uint32 indexStartLocation = 0;
+
+		uint32 vertexStartLocation = 0;
+	};
+
+	class GLInstanceBatch
+	{
+	public:
+
+		static constexpr InstancedMeshID QuadMesh = 0;
+
+		static constexpr uint32 MinCircleQuality = 3;
+
+	private:
+
+		GLuint m_vao = 0;
+
+		GLuint m_meshVertexBuffer = 0;
+
+		GLuint m_meshIndexBuffer = 0;
+
+		GLuint m_instanceBuffer = 0;
+
+		// m_meshes[0] は四角形、m_meshes[n] は分割数 n の円
+		Array<InstancedMeshRange> m_meshes;
+
+		Array<Instance2D> m_instances;
+
+		uint32 m_instanceWritePos = 0;
+
+		uint32 m_instanceBufferSize = 0;
+
+		bool m_initialized = false;
+
+		static constexpr uint32 InitialInstanceSize = 4096;
+
+		static constexpr uint32 MaxInstanceSize = 65536 * 16;
+
+		// インスタンスごとの属性 (location 3, 4, 5) が first 番目のインスタンスから読まれるようにする
+		void setInstanceAttributes(const uint32 first)
+		{
+			const size_t offset = sizeof(Instance2D) * first;
+
+			::glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, sizeof(Instance2D), (GLubyte*)(offset + 0));
+			::glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(Instance2D), (GLubyte*)(offset + 16));
+			::glVertexAttribPointer(5, 4, GL_FLOAT, GL_FALSE, sizeof(Instance2D), (GLubyte*)(offset + 32));
+		}
+
+	public:
+
+		GLInstanceBatch()
+			: m_instances(InitialInstanceSize)
+		{
+
+		}
+
+		~GLInstanceBatch()
+		{
+			if (m_initialized)
+			{
+				::glDeleteVertexArrays(1, &m_vao);
+				::glDeleteBuffers(1, &m_instanceBuffer);
+				::glDeleteBuffers(1, &m_meshIndexBuffer);
+				::glDeleteBuffers(1, &m_meshVertexBuffer);
+			}
+		}
+
+		bool init()
+		{
+			// 四角形と、分割数 3 ～ 255 の円の扇形を 1 つのバッファにまとめる
+			Array<Float2> vertices = { Float2(0.0f, 0.0f), Float2(1.0f, 0.0f), Float2(0.0f, 1.0f), Float2(1.0f, 1.0f) };
+			Array<uint32> indices = { 0, 1, 2, 2, 1, 3 };
+
+			m_meshes.resize(Vertex2DBuilder::MaxCircleQuality + 1);
+			m_meshes[QuadMesh] = { 6, 0, 0 };
+
+			for (uint32 quality = MinCircleQuality; quality <= Vertex2DBuilder::MaxCircleQuality; ++quality)
+			{
+				const Float2* unit = Vertex2DBuilder::GetUnitCircle(quality);
+
+				m_meshes[quality] = { quality * 3, static_cast<uint32>(indices.size()), static_cast<uint32>(vertices.size()) };
+
+				// 外接する正方形の中での位置
+				vertices.emplace_back(0.5f, 0.5f);
+
+				for (uint32 i = 0; i < quality; ++i)
+				{
+					vertices.emplace_back(0.5f + 0.5f * unit[i].x, 0.5f - 0.5f * unit[i].y);
+				}
+
+				for (uint32 i = 0; i < quality; ++i)
+				{
+					indices.push_back(i + 1);
+					indices.push_back(0);
+					indices.push_back((i + 1) % quality + 1);
+				}
+			}
+
+			::glGenBuffers(1, &m_meshVertexBuffer);
+			::glGenBuffers(1, &m_meshIndexBuffer);
+			::glGenBuffers(1, &m_instanceBuffer);
+
+			::glGenVertexArrays(1, &m_vao);
+
+			::glBindVertexArray(m_vao);
+			{
+				::glBindBuffer(GL_ARRAY_BUFFER, m_meshVertexBuffer);
+				::glBufferData(GL_ARRAY_BUFFER, vertices.size_bytes(), vertices.data(), GL_STATIC_DRAW);
+				::glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Float2), (GLubyte*)0);
+				::glEnableVertexAttribArray(0);
+
+				m_instanceBufferSize = InitialInstanceSize;
+				::glBindBuffer(GL_ARRAY_BUFFER, m_instanceBuffer);
+				::glBufferData(GL_ARRAY_BUFFER, sizeof(Instance2D) * m_instanceBufferSize, nullptr, GL_STREAM_DRAW);
+				setInstanceAttributes(0);
+
+				for (GLuint location = 3; location <= 5; ++location)
+				{
+					::glVertexAttribDivisor(location, 1);
+					::glEnableVertexAttribArray(location);
+				}
+
+				::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_meshIndexBuffer);
+				::glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size_bytes(), indices.data(), GL_STATIC_DRAW);
+			}
+			::glBindVertexArray(0);
+
+			m_initialized = true;
+
+			return true;
+		}
+
+		Instance2D* getInstance()
+		{
+			if (m_instances.size() <= m_instanceWritePos)
+			{
+				if (MaxInstanceSize <= m_instanceWritePos)
+				{
+					return nullptr;
+				}
+
+				LOG_DEBUG(U"ℹ️ Resized 2D instance array (size: {0})"_fmt(m_instances.size() * 2));
+
+				m_instances.resize(m_instances.size() * 2);
+			}
+
+			return &m_instances[m_instanceWritePos++];
+		}
+
+		// 転送前のインスタンスの配列（描画コマンドの並べ替えに使う）
+		Instance2D* getInstances()
+		{
+			return m_instances.data();
+		}
+
+		// 記録されたすべてのインスタンスをインスタンスバッファに転送する
+		void upload()
+		{
+			if (m_instanceWritePos == 0)
+			{
+				return;
+			}
+
+			::glBindBuffer(GL_ARRAY_BUFFER, m_instanceBuffer);
+
+			while (m_instanceBufferSize < m_instanceWritePos)
+			{
+				m_instanceBufferSize *= 2;
+			}
+
+			// 前のフレームの描画が終わるのを待たないよう、バッファを確保し直してから書き込む
+			::glBufferData(GL_ARRAY_BUFFER, sizeof(Instance2D) * m_instanceBufferSize, nullptr, GL_STREAM_DRAW);
+			::glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(Instance2D) * m_instanceWritePos, m_instances.data());
+
+			Siv3DEngine::GetProfiler()->reportVertexUpload(sizeof(Instance2D) * m_instanceWritePos);
+		}
+
+		void bind()
+		{
+			::glBindVertexArray(m_vao);
+		}
+
+		// first 番目から instanceCount 個のインスタンスを mesh で描き、描いたインデックスの数を返す（bind() の後に呼ぶ）
+		uint32 draw(const InstancedMeshID mesh, const uint32 first, const uint32 instanceCount)
+		{
+			const InstancedMeshRange& range = m_meshes[mesh];
+
+			::glBindBuffer(GL_ARRAY_BUFFER, m_instanceBuffer);
+			setInstanceAttributes(first);
+
+			::glDrawElementsInstancedBaseVertex(GL_TRIANGLES, range.indexCount, GL_UNSIGNED_INT,
+				(uint32*)(nullptr) + range.indexStartLocation, instanceCount, range.vertexStartLocation);
+
+			return range.indexCount * instanceCount;
+		}
+
+		void clear()
+		{
+			m_instanceWritePos = 0;
+		}
+	};
+}
+
+# endif
@@ -13,8 +13,11 @@
 # include <Siv3D/Platform.hpp>
 # if defined(SIV3D_TARGET_MACOS) || defined(SIV3D_TARGET_LINUX)
 
+# include <algorithm>
+# include <limits>
 # include <Siv3D/Fwd.hpp>
 # include <Siv3D/Array.hpp>
+# include <Siv3D/Optional.hpp>
 # include <Siv3D/Byte.hpp>
 # include <Siv3D/BlendState.hpp>
 # include <Siv3D/RasterizerState.hpp>
@@ -25,6 +28,7 @@
 # include <Siv3D/HashTable.hpp>
 # include "../../Siv3DEngine.hpp"
 # include "../../Shader/IShader.hpp"
+# include "GLInstanceBatch.hpp"
 
 namespace s3d
 {
@@ -34,6 +38,10 @@ namespace s3d
 
 		Draw,
 
+		DrawInstanced,
+
+		DrawList,
+
 		NextBatch,
 
 		BlendState,
@@ -89,6 +97,36 @@ namespace s3d
 		uint32 indexSize;
 	};
 
+	template <>
+	struct GLRender2DCommand<GLRender2DInstruction::DrawInstanced>
+	{
+		GLRender2DCommandHeader header =
+		{
+			GLRender2DInstruction::DrawInstanced,
+
+			sizeof(GLRender2DCommand<GLRender2DInstruction::DrawInstanced>)
+		};
+
+		// 共有メッシュの番号（GLInstanceBatch を参照）
+		uint32 mesh;
+
+		uint32 instanceCount;
+	};
+
+	template <>
+	struct GLRender2DCommand<GLRender2DInstruction::DrawList>
+	{
+		GLRender2DCommandHeader header =
+		{
+			GLRender2DInstruction::DrawList,
+
+			sizeof(GLRender2DCommand<GLRender2DInstruction::DrawList>)
+		};
+
+		// CRenderer2D_GL が保持する描画リストの番号
+		uint32 index;
+	};
+
 	template <>
 	struct GLRender2DCommand<GLRender2DInstruction::NextBatch>
 	{
@@ -247,23 +285,238 @@ namespace s3d
 		HashTable<TextureID, Texture> m_reservedTextures;
 		
 		std::array<TextureID, MaxSamplerCount> m_currentPSTextures;
-		
-		template <class Command>
-		void writeCommand(const Command& command)
+
+		// 異なるメッシュのインスタンス描画が交互に続いている間は、頂点による描画にまとめる
+		bool m_instancingSuspended = false;
+
+		// sortAndMerge() で並べ替えるため、インスタンス描画を中断しない
+		bool m_drawCallSortingEnabled = false;
+
+		// sortAndMerge() で並べ替える 1 回分の描画
+		struct SortItem
 		{
-			static_assert(sizeof(Command) % 4 == 0);
-			
-			const Byte* dataBegin = static_cast<const Byte*>(static_cast<const void*>(&command));
+			PixelShaderID ps;
+
+			// テクスチャを使わないシェーダの場合は NullAsset
+			TextureID texture;
 
-			const Byte* dataEnd = dataBegin + sizeof(Command);
+			bool usesTexture;
 
-			m_commands.insert(m_commands.end(), dataBegin, dataEnd);
+			// インスタンス描画のメッシュの番号（頂点による描画の場合は VertexDraw）
+			uint32 mesh;
+
+			// バッチ内のインデックスの位置、またはフレーム内のインスタンスの位置
+			uint32 start;
+
+			uint32 count;
+
+			FloatRect bounds;
+
+			// 同じグループの次の描画（無い場合は -1）
+			int32 next;
+		};
+
+		// 1 回のドローコールにまとめる描画のグループ
+		struct SortGroup
+		{
+			int32 first;
+
+			int32 last;
+
+			// グループに含まれる描画全体の範囲
+			FloatRect bounds;
+		};
+
+		static constexpr uint32 VertexDraw = UINT32_MAX;
+
+		// 描画をまとめる先として遡るグループの数の上限
+		static constexpr size_t MaxSortLookback = 64;
+
+		Array<SortItem> m_sortItems;
+
+		Array<SortGroup> m_sortGroups;
+
+		Array<uint32> m_sortIndices;
+
+		Array<Instance2D> m_sortInstances;
+
+		static bool Overlaps(const FloatRect& a, const FloatRect& b)
+		{
+			// 辺が接しているだけの場合は重ならない
+			return (a.left < b.right) && (b.left < a.right)
+				&& (a.top < b.bottom) && (b.top < a.bottom);
+		}
+
+		static void Extend(FloatRect& bounds, const FloatRect& other)
+		{
+			bounds.left = std::min(bounds.left, other.left);
+			bounds.top = std::min(bounds.top, other.top);
+			bounds.right = std::max(bounds.right, other.right);
+			bounds.bottom = std::max(bounds.bottom, other.bottom);
+		}
+
+		static bool SameKey(const SortItem& a, const SortItem& b)
+		{
+			return (a.ps == b.ps) && (a.texture == b.texture) && (a.mesh == b.mesh);
+		}
+
+		// 記録された描画を、重なる描画を越えない範囲で同じキーのグループにまとめ、グループごとに 1 つのコマンドとして書き込む
+		void flushSortRun(uint32* indices, const uint32 runIndexStart, Instance2D* instances, const uint32 runInstanceStart,
+						  Optional<PixelShaderID>& emittedPS, Optional<TextureID>& emittedTexture, size_t& drawCommands)
+		{
+			if (m_sortItems.isEmpty())
+			{
+				return;
+			}
+
+			m_sortGroups.clear();
+
+			bool reordered = false;
+
+			for (int32 i = 0; i < static_cast<int32>(m_sortItems.size()); ++i)
+			{
+				const SortItem& item = m_sortItems[i];
+				int32 target = -1;
+
+				for (size_t n = 0; n < std::min(m_sortGroups.size(), MaxSortLookback); ++n)
+				{
+					const size_t g = (m_sortGroups.size() - 1 - n);
+
+					if (SameKey(m_sortItems[m_sortGroups[g].first], item))
+					{
+						target = static_cast<int32>(g);
+						break;
+					}
+
+					// 重なる描画より前には移動できない
+					if (Overlaps(m_sortGroups[g].bounds, item.bounds))
+					{
+						break;
+					}
+				}
+
+				if (target == -1)
+				{
+					m_sortGroups.push_back({ i, i, item.bounds });
+					continue;
+				}
+
+				SortGroup& group = m_sortGroups[target];
+				m_sortItems[group.last].next = i;
+				group.last = i;
+				Extend(group.bounds, item.bounds);
+
+				reordered |= (target != static_cast<int32>(m_sortGroups.size() - 1));
+			}
+
+			// グループの順にインデックスとインスタンスを並べ直す
+			// 頂点が CPU 側に無いバッチの描画は移動しないため、インデックスはそのままでよい
+			if (reordered)
+			{
+				m_sortIndices.clear();
+				m_sortInstances.clear();
+
+				for (const auto& group : m_sortGroups)
+				{
+					for (int32 i = group.first; i != -1; i = m_sortItems[i].next)
+					{
+						const SortItem& item = m_sortItems[i];
+
+						if (item.mesh == VertexDraw)
+						{
+							if (indices)
+							{
+								m_sortIndices.insert(m_sortIndices.end(), indices + item.start, indices + item.start + item.count);
+							}
+						}
+						else
+						{
+							m_sortInstances.insert(m_sortInstances.end(), instances + item.start, instances + item.start + item.count);
+						}
+					}
+				}
+
+				if (indices)
+				{
+					std::copy(m_sortIndices.begin(), m_sortIndices.end(), indices + runIndexStart);
+				}
+
+				std::copy(m_sortInstances.begin(), m_sortInstances.end(), instances + runInstanceStart);
+			}
+
+			for (const auto& group : m_sortGroups)
+			{
+				const SortItem& first = m_sortItems[group.first];
+
+				if (!emittedPS || (*emittedPS != first.ps))
+				{
+					GLRender2DCommand<GLRender2DInstruction::PixelShader> command;
+					command.psID = first.ps;
+					writeCommand(command);
+
+					emittedPS = first.ps;
+				}
+
+				if (first.usesTexture && (!emittedTexture || (*emittedTexture != first.texture)))
+				{
+					GLRender2DCommand<GLRender2DInstruction::PSTexture> command;
+					command.slot = 0;
+					command.textureID = first.texture;
+					writeCommand(command);
+
+					emittedTexture = first.texture;
+				}
+
+				uint32 count = 0;
+
+				for (int32 i = group.first; i != -1; i = m_sortItems[i].next)
+				{
+					count += m_sortItems[i].count;
+				}
+
+				if (first.mesh == VertexDraw)
+				{
+					GLRender2DCommand<GLRender2DInstruction::Draw> command;
+					command.indexSize = count;
+					writeCommand(command);
+				}
+				else
+				{
+					GLRender2DCommand<GLRender2DInstruction::DrawInstanced> command;
+					command.mesh = first.mesh;
+					command.instanceCount = count;
+					writeCommand(command);
+				}
+
+				++drawCommands;
+			}
+
+			m_sortItems.clear();
+		}
+
+		void writeCommandData(const Byte* data, const size_t size)
+		{
+			m_commands.insert(m_commands.end(), data, data + size);
 
 			++m_commandCount;
 
-			m_lastCommandPointer = m_commands.data() + (m_commands.size() - sizeof(Command));
+			m_lastCommandPointer = m_commands.data() + (m_commands.size() - size);
 
-			m_lastCommand = command.header.instruction;
+			m_lastCommand = static_cast<const GLRender2DCommandHeader*>(static_cast<const void*>(data))->instruction;
+		}
+		
+		template <class Command>
+		void writeCommand(const Command& command)
+		{
+			static_assert(sizeof(Command) % 4 == 0);
+			
+			writeCommandData(static_cast<const Byte*>(static_cast<const void*>(&command)), sizeof(Command));
+
+			if (m_lastCommand != GLRender2DInstruction::Draw
+				&& m_lastCommand != GLRender2DInstruction::DrawInstanced)
+			{
+				m_instancingSuspended = false;
+			}
 		}
 
 		template <GLRender2DInstruction instruction>
@@ -272,6 +525,22 @@ namespace s3d
 			return *static_cast<GLRender2DCommand<instruction>*>(static_cast<void*>(m_lastCommandPointer));
 		}
 
+		bool pushPixelShader(const GLRender2DPixelShaderType ps)
+		{
+			if (ps == m_currentPSType)
+			{
+				return false;
+			}
+
+			GLRender2DCommand<GLRender2DInstruction::PixelShader> command;
+			command.psID = Siv3DEngine::GetShader()->getStandardPS(static_cast<size_t>(ps)).id();
+			writeCommand(command);
+
+			m_currentPSType = ps;
+
+			return true;
+		}
+
 	public:
 		
 		GLRender2DCommandManager()
@@ -351,17 +620,7 @@ namespace s3d
 
 		void pushDraw(const uint32 indexSize, GLRender2DPixelShaderType ps)
 		{
-			bool shaderChanged = false;
-			
-			if (ps != m_currentPSType)
-			{
-				GLRender2DCommand<GLRender2DInstruction::PixelShader> command;
-				command.psID = Siv3DEngine::GetShader()->getStandardPS(static_cast<size_t>(ps)).id();
-				writeCommand(command);
-				
-				m_currentPSType = ps;
-				shaderChanged = true;
-			}
+			const bool shaderChanged = pushPixelShader(ps);
 			
 			if (!shaderChanged && m_lastCommand == GLRender2DInstruction::Draw)
 			{
@@ -375,6 +634,63 @@ namespace s3d
 			writeCommand(command);
 		}
 
+		// mesh のインスタンス描画を追加してよいかを返す
+		// 直前が別のメッシュのインスタンス描画である場合、新しいドローコールを作らずに済むよう頂点による描画を選ぶ
+		bool canDrawInstanced(const uint32 mesh, const GLRender2DPixelShaderType ps)
+		{
+			if (m_instancingSuspended)
+			{
+				return false;
+			}
+
+			if (m_drawCallSortingEnabled)
+			{
+				return true;
+			}
+
+			if (ps == m_currentPSType
+				&& m_lastCommand == GLRender2DInstruction::DrawInstanced
+				&& getLastCommand<GLRender2DInstruction::DrawInstanced>().mesh != mesh)
+			{
+				m_instancingSuspended = true;
+
+				return false;
+			}
+
+			return true;
+		}
+
+		// 直前のコマンドが同じメッシュのインスタンス描画であれば、そのインスタンス数を増やす
+		void pushDrawInstanced(const uint32 mesh, GLRender2DPixelShaderType ps)
+		{
+			const bool shaderChanged = pushPixelShader(ps);
+
+			if (!shaderChanged && m_lastCommand == GLRender2DInstruction::DrawInstanced)
+			{
+				auto& last = getLastCommand<GLRender2DInstruction::DrawInstanced>();
+
+				if (last.mesh == mesh)
+				{
+					++last.instanceCount;
+
+					return;
+				}
+			}
+
+			GLRender2DCommand<GLRender2DInstruction::DrawInstanced> command;
+			command.mesh = mesh;
+			command.instanceCount = 1;
+			writeCommand(command);
+		}
+
+		// 描画リストはシェーダとテクスチャ 0 を自身で切り替え、描画後に元に戻す
+		void pushDrawList(const uint32 index)
+		{
+			GLRender2DCommand<GLRender2DInstruction::DrawList> command;
+			command.index = index;
+			writeCommand(command);
+		}
+
 		void pushNextBatch()
 		{
 			writeCommand(GLRender2DCommand<GLRender2DInstruction::NextBatch>());
@@ -537,6 +853,179 @@ namespace s3d
 			m_currentPSTextures[slot] = id;
 		}
 
+		void setDrawCallSortingEnabled(const bool enabled)
+		{
+			m_drawCallSortingEnabled = enabled;
+		}
+
+		// 描画結果が変わらない範囲で、描画を (シェーダ, テクスチャ, メッシュ) ごとに並べ替えてまとめ、削減したドローコールの数を返す
+		// ブレンドステートや座標変換などの変更は越えない。
+		// getBatchData(batchIndex, &vertices, &indices) は、バッチの頂点とインデックスが CPU 側の配列にある場合に true を返す。
+		// instances はインスタンスを転送する前の配列。reset() の直前のフレームの最後にのみ呼ぶ。
+		template <class GetBatchData>
+		size_t sortAndMerge(GetBatchData getBatchData, Instance2D* instances)
+		{
+			Array<Byte> source;
+			source.swap(m_commands);
+
+			const size_t sourceCount = m_commandCount;
+			m_commandCount = 0;
+			m_commands.reserve(source.size());
+
+			const auto* shader = Siv3DEngine::GetShader();
+			const PixelShaderID shapePS = shader->getStandardPS(static_cast<size_t>(GLRender2DPixelShaderType::Shape)).id();
+			const PixelShaderID lineDotPS = shader->getStandardPS(static_cast<size_t>(GLRender2DPixelShaderType::LineDot)).id();
+			const PixelShaderID lineRoundDotPS = shader->getStandardPS(static_cast<size_t>(GLRender2DPixelShaderType::LineRoundDot)).id();
+
+			PixelShaderID currentPS = shapePS;
+			TextureID currentTexture = TextureID::NullAsset();
+
+			Optional<PixelShaderID> emittedPS;
+			Optional<TextureID> emittedTexture;
+
+			size_t batchIndex = 0;
+			const Vertex2D* vertices = nullptr;
+			uint32* indices = nullptr;
+
+			uint32 indexPos = 0, instancePos = 0;
+			uint32 runIndexStart = 0, runInstanceStart = 0;
+			size_t sourceDraws = 0, drawCommands = 0;
+
+			const auto flushRun = [&]()
+			{
+				flushSortRun(indices, runIndexStart, instances, runInstanceStart, emittedPS, emittedTexture, drawCommands);
+
+				runIndexStart = indexPos;
+				runInstanceStart = instancePos;
+			};
+
+			const auto addItem = [&](const uint32 mesh, const uint32 start, const uint32 count, const FloatRect& bounds)
+			{
+				const bool usesTexture = (currentPS != shapePS) && (currentPS != lineDotPS) && (currentPS != lineRoundDotPS);
+
+				m_sortItems.push_back({ currentPS, (usesTexture ? currentTexture : TextureID::NullAsset()), usesTexture, mesh, start, count, bounds, -1 });
+
+				++sourceDraws;
+			};
+
+			constexpr float Inf = std::numeric_limits<float>::infinity();
+
+			const Byte* commandPointer = source.data();
+
+			for (size_t commandIndex = 0; commandIndex < sourceCount; ++commandIndex)
+			{
+				const GLRender2DCommandHeader* header = static_cast<const GLRender2DCommandHeader*>(static_cast<const void*>(commandPointer));
+
+				switch (header->instruction)
+				{
+					case GLRender2DInstruction::Nop:
+					{
+						break;
+					}
+					case GLRender2DInstruction::Draw:
+					{
+						const auto* command = static_cast<const GLRender2DCommand<GLRender2DInstruction::Draw>*>(static_cast<const void*>(commandPointer));
+
+						// 頂点を読めない場合は、すべてと重なるものとして扱う
+						FloatRect bounds(-Inf, -Inf, Inf, Inf);
+
+						if (vertices)
+						{
+							bounds = FloatRect(Inf, Inf, -Inf, -Inf);
+
+							for (uint32 i = indexPos; i < (indexPos + command->indexSize); ++i)
+							{
+								const Float2& pos = vertices[indices[i]].pos;
+								bounds.left = std::min(bounds.left, pos.x);
+								bounds.top = std::min(bounds.top, pos.y);
+								bounds.right = std::max(bounds.right, pos.x);
+								bounds.bottom = std::max(bounds.bottom, pos.y);
+							}
+						}
+
+						addItem(VertexDraw, indexPos, command->indexSize, bounds);
+
+						indexPos += command->indexSize;
+
+						break;
+					}
+					case GLRender2DInstruction::DrawInstanced:
+					{
+						const auto* command = static_cast<const GLRender2DCommand<GLRender2DInstruction::DrawInstanced>*>(static_cast<const void*>(commandPointer));
+
+						FloatRect bounds(Inf, Inf, -Inf, -Inf);
+
+						for (uint32 i = instancePos; i < (instancePos + command->instanceCount); ++i)
+						{
+							const FloatRect& rect = instances[i].rect;
+							bounds.left = std::min({ bounds.left, rect.left, rect.right });
+							bounds.top = std::min({ bounds.top, rect.top, rect.bottom });
+							bounds.right = std::max({ bounds.right, rect.left, rect.right });
+							bounds.bottom = std::max({ bounds.bottom, rect.top, rect.bottom });
+						}
+
+						addItem(command->mesh, instancePos, command->instanceCount, bounds);
+
+						instancePos += command->instanceCount;
+
+						break;
+					}
+					case GLRender2DInstruction::PixelShader:
+					{
+						currentPS = static_cast<const GLRender2DCommand<GLRender2DInstruction::PixelShader>*>(static_cast<const void*>(commandPointer))->psID;
+
+						break;
+					}
+					case GLRender2DInstruction::PSTexture:
+					{
+						const auto* command = static_cast<const GLRender2DCommand<GLRender2DInstruction::PSTexture>*>(static_cast<const void*>(commandPointer));
+
+						if (command->slot == 0)
+						{
+							currentTexture = command->textureID;
+
+							break;
+						}
+
+						flushRun();
+						writeCommandData(commandPointer, header->commandSize);
+
+						break;
+					}
+					case GLRender2DInstruction::NextBatch:
+					{
+						flushRun();
+						writeCommandData(commandPointer, header->commandSize);
+
+						if (!getBatchData(batchIndex, &vertices, &indices))
+						{
+							vertices = nullptr;
+							indices = nullptr;
+						}
+
+						++batchIndex;
+						indexPos = runIndexStart = 0;
+
+						break;
+					}
+					default:
+					{
+						// ステートの変更や描画リストは越えない
+						flushRun();
+						writeCommandData(commandPointer, header->commandSize);
+
+						break;
+					}
+				}
+
+				commandPointer += header->commandSize;
+			}
+
+			flushRun();
+
+			return (sourceDraws - drawCommands);
+		}
+
 		const BlendState& getCurrentBlendState() const
 		{
 			return m_currentBlendState;
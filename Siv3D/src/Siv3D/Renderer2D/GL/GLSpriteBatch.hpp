@@ -13,12 +13,14 @@
 # include <Siv3D/Platform.hpp>
 # if defined(SIV3D_TARGET_MACOS) || defined(SIV3D_TARGET_LINUX)
 
+# include <array>
 # include <GL/glew.h>
 # include "../../../ThirdParty/GLFW/include/GLFW/glfw3.h"
 # include <Siv3D/Array.hpp>
 # include <Siv3D/Vertex2D.hpp>
 # include <Siv3D/Logger.hpp>
 # include "GLRenderer2DCommandManager.hpp"
+# include "../../Profiler/IProfiler.hpp"
 
 namespace s3d
 {
@@ -30,6 +32,9 @@ namespace s3d
 		uint32 vertexPos = 0;
 		
 		uint32 indexPos = 0;
+
+		// 永続マップされたバッファの領域の番号（CPU 側の配列に書き込む場合は -1）
+		int32 region = -1;
 	};
 	
 	struct BatchDrawOffset
@@ -51,8 +56,30 @@ namespace s3d
 		
 		GLuint m_indexBuffer = 0;
 
-		
-		
+		// 永続マップされたリングバッファ（GL_ARB_buffer_storage が使えない場合は 0）
+		GLuint m_persistentVAO = 0;
+
+		GLuint m_persistentVertexBuffer = 0;
+
+		GLuint m_persistentIndexBuffer = 0;
+
+		Vertex2D* m_mappedVertices = nullptr;
+
+		IndexType* m_mappedIndices = nullptr;
+
+		// 各領域を最後に使ったフレームの描画の完了を待つためのフェンス
+		std::array<GLsync, 3> m_regionFences = {};
+
+		uint32 m_nextRegion = 0;
+
+		// 現在のフレームで使った領域の数
+		uint32 m_regionsInFrame = 0;
+
+		// false の場合、新しいバッチには永続マップされた領域を割り当てない
+		bool m_persistentMappingEnabled = true;
+
+		// bind() でバインドする VAO
+		GLuint m_currentVAO = 0;
 		
 		Array<Vertex2D> m_vertices;
 		
@@ -83,6 +110,112 @@ namespace s3d
 		static constexpr uint32 VertexBufferSize	= 65536;
 		static constexpr uint32 IndexBufferSize		= 65536 * 8;
 
+		// 永続マップされたバッファの領域の数。1 つのバッチが 1 つの領域を使う
+		static constexpr uint32 NumRegions = 3;
+
+		static void SetVertexAttributes()
+		{
+			::glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 32, (GLubyte*)0);
+			::glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 32, (GLubyte*)8);
+			::glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, 32, (GLubyte*)16);
+			
+			::glEnableVertexAttribArray(0);
+			::glEnableVertexAttribArray(1);
+			::glEnableVertexAttribArray(2);
+		}
+
+		bool initPersistentBuffers()
+		{
+			if (!GLEW_ARB_buffer_storage)
+			{
+				return false;
+			}
+
+			const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+			::glGenBuffers(1, &m_persistentVertexBuffer);
+			::glGenBuffers(1, &m_persistentIndexBuffer);
+			
+			::glGenVertexArrays(1, &m_persistentVAO);
+			
+			::glBindVertexArray(m_persistentVAO);
+			{
+				::glBindBuffer(GL_ARRAY_BUFFER, m_persistentVertexBuffer);
+				::glBufferStorage(GL_ARRAY_BUFFER, sizeof(Vertex2D) * VertexBufferSize * NumRegions, nullptr, flags);
+				m_mappedVertices = static_cast<Vertex2D*>(::glMapBufferRange(GL_ARRAY_BUFFER, 0, sizeof(Vertex2D) * VertexBufferSize * NumRegions, flags));
+
+				SetVertexAttributes();
+
+				::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_persistentIndexBuffer);
+				::glBufferStorage(GL_ELEMENT_ARRAY_BUFFER, sizeof(IndexType) * IndexBufferSize * NumRegions, nullptr, flags);
+				m_mappedIndices = static_cast<IndexType*>(::glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, sizeof(IndexType) * IndexBufferSize * NumRegions, flags));
+			}
+			::glBindVertexArray(0);
+
+			if (!m_mappedVertices || !m_mappedIndices)
+			{
+				releasePersistentBuffers();
+
+				return false;
+			}
+
+			return true;
+		}
+
+		void releasePersistentBuffers()
+		{
+			for (auto& fence : m_regionFences)
+			{
+				if (fence)
+				{
+					::glDeleteSync(fence);
+					fence = nullptr;
+				}
+			}
+
+			if (m_persistentVAO)
+			{
+				// バッファを削除すると、マップも解除される
+				::glDeleteVertexArrays(1, &m_persistentVAO);
+				::glDeleteBuffers(1, &m_persistentIndexBuffer);
+				::glDeleteBuffers(1, &m_persistentVertexBuffer);
+			}
+
+			m_persistentVAO = m_persistentVertexBuffer = m_persistentIndexBuffer = 0;
+			m_mappedVertices = nullptr;
+			m_mappedIndices = nullptr;
+		}
+
+		// 新しいバッチに永続マップされた領域を割り当てる
+		// 現在のフレームですべての領域を使い切った場合は CPU 側の配列を使う
+		void beginBatch(BatchBufferPos& batch)
+		{
+			if (!m_mappedVertices || !m_persistentMappingEnabled || NumRegions <= m_regionsInFrame)
+			{
+				batch.region = -1;
+				
+				return;
+			}
+
+			const uint32 region = m_nextRegion;
+
+			// GPU がまだ領域を読んでいる場合は待つ
+			if (GLsync& fence = m_regionFences[region]; fence)
+			{
+				while (::glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000'000) == GL_TIMEOUT_EXPIRED)
+				{
+					LOG_DEBUG(U"ℹ️ Waiting for the GPU to release a 2D vertex buffer region");
+				}
+
+				::glDeleteSync(fence);
+				fence = nullptr;
+			}
+
+			batch.region = static_cast<int32>(region);
+			m_nextRegion = (m_nextRegion + 1) % NumRegions;
+			++m_regionsInFrame;
+		}
+
 		void resizeVertices(const uint32 requiredVertexSize)
 		{
 			size_t newVertexSize = m_vertices.size() * 2;
@@ -125,13 +258,17 @@ namespace s3d
 		{
 			if (m_initialized)
 			{
+				releasePersistentBuffers();
+
 				::glDeleteVertexArrays(1, &m_vao);
 				::glDeleteBuffers(1, &m_indexBuffer);
 				::glDeleteBuffers(1, &m_vertexBuffer);
 			}
 		}
 		
-		bool init()
+		// persistentMapping が true で GL_ARB_buffer_storage が使える場合、getBuffer() は
+		// 永続マップされたバッファへのポインタを直接返す
+		bool init(const bool persistentMapping = true)
 		{
 			::glGenBuffers(1, &m_vertexBuffer);
 			::glGenBuffers(1, &m_indexBuffer);
@@ -143,26 +280,103 @@ namespace s3d
 				::glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
 				::glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex2D) * VertexBufferSize, nullptr, GL_DYNAMIC_DRAW);
 				
-				::glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 32, (GLubyte*)0);
-				::glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 32, (GLubyte*)8);
-				::glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, 32, (GLubyte*)16);
-				
-				::glEnableVertexAttribArray(0);
-				::glEnableVertexAttribArray(1);
-				::glEnableVertexAttribArray(2);
+				SetVertexAttributes();
 				
 				::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer);
 				::glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint32) * IndexBufferSize, nullptr, GL_DYNAMIC_DRAW);
 			}
 			::glBindVertexArray(0);
+
+			m_currentVAO = m_vao;
+
+			if (persistentMapping)
+			{
+				if (initPersistentBuffers())
+				{
+					LOG_INFO(U"ℹ️ 2D vertex buffers are persistently mapped");
+				}
+				else
+				{
+					LOG_INFO(U"ℹ️ GL_ARB_buffer_storage is not available. 2D vertex buffers are copied on upload");
+				}
+			}
 			
 			m_initialized = true;
 
+			beginBatch(m_batches.back());
+
 			return true;
 		}
 
+		[[nodiscard]] bool isPersistentlyMapped() const noexcept
+		{
+			return (m_mappedVertices != nullptr);
+		}
+
+		// 描画コマンドの並べ替えでは頂点を読み返すため、永続マップされたバッファを使わないようにする
+		// 無効にした場合、現在のバッチも CPU 側の配列を使うバッチに切り替え、同じフレームから並べ替えられるようにする
+		void setPersistentMappingEnabled(const bool enabled, GLRender2DCommandManager& commandManager)
+		{
+			m_persistentMappingEnabled = enabled;
+
+			BatchBufferPos& batch = m_batches.back();
+
+			if (enabled || (batch.region == -1))
+			{
+				return;
+			}
+
+			if ((batch.vertexPos == 0) && (batch.indexPos == 0))
+			{
+				// 何も書き込まれていない領域は、最後に割り当てた領域なのでそのまま返す
+				m_nextRegion = (m_nextRegion + NumRegions - 1) % NumRegions;
+				--m_regionsInFrame;
+				batch.region = -1;
+			}
+			else
+			{
+				// 領域は書き込み専用でマップしていて読み返せないため、書き込み済みの頂点はそのまま描画し、以降を新しいバッチにする
+				m_batches.emplace_back();
+
+				beginBatch(m_batches.back());
+
+				commandManager.pushNextBatch();
+			}
+		}
+
 		bool getBuffer(const uint32 vertexSize, const uint32 indexSize, Vertex2D** pVertex, IndexType** pIndices, IndexType* indexOffset, GLRender2DCommandManager& commandManager)
 		{
+			// 1 つのバッチに収まらない
+			if (VertexBufferSize < vertexSize || IndexBufferSize < indexSize)
+			{
+				return false;
+			}
+
+			if (VertexBufferSize < (m_batches.back().vertexPos + vertexSize)
+				|| IndexBufferSize < (m_batches.back().indexPos + indexSize))
+			{
+				m_batches.emplace_back();
+
+				beginBatch(m_batches.back());
+				
+				commandManager.pushNextBatch();
+			}
+
+			BatchBufferPos& batch = m_batches.back();
+
+			if (batch.region != -1)
+			{
+				// GPU から見えるメモリに直接書き込む
+				*pVertex = m_mappedVertices + (VertexBufferSize * batch.region + batch.vertexPos);
+				*pIndices = m_mappedIndices + (IndexBufferSize * batch.region + batch.indexPos);
+				*indexOffset = batch.vertexPos;
+
+				batch.vertexPos += vertexSize;
+				batch.indexPos += indexSize;
+
+				return true;
+			}
+
 			// VB
 			const uint32 requiredVertexSize = m_vertexArrayWritePos + vertexSize;
 
@@ -188,24 +402,16 @@ namespace s3d
 
 				resizeIndices(requiredIndexSize);
 			}
-			
-			if (VertexBufferSize < (m_batches.back().vertexPos + vertexSize)
-				|| IndexBufferSize < (m_batches.back().indexPos + indexSize))
-			{
-				m_batches.emplace_back();
-				
-				commandManager.pushNextBatch();
-			}
 
 			*pVertex = m_vertices.data() + m_vertexArrayWritePos;
 			*pIndices = m_indices.data() + m_indexArrayWritePos;
-			*indexOffset = m_batches.back().vertexPos;
+			*indexOffset = batch.vertexPos;
 
 			m_vertexArrayWritePos += vertexSize;
 			m_indexArrayWritePos += indexSize;
 			
-			m_batches.back().vertexPos += vertexSize;
-			m_batches.back().indexPos += indexSize;
+			batch.vertexPos += vertexSize;
+			batch.indexPos += indexSize;
 
 			return true;
 		}
@@ -215,26 +421,19 @@ namespace s3d
 			return m_batches.size();
 		}
 
-		// 仮の実装
-		BatchDrawOffset setBuffers(const size_t batchIndex)
+		// 頂点とインデックスをリングバッファに書き込み、描画に使う位置を返す
+		BatchDrawOffset upload(const Vertex2D* vertexData, const uint32 vertexSize, const IndexType* indexData, const uint32 indexSize)
 		{
 			BatchDrawOffset batchDrawOffset;
-			
-			size_t vertexArrayOffset = 0;
-			size_t indexArrayOffset = 0;
-			
-			for (size_t i = 0; i < batchIndex; ++i)
-			{
-				vertexArrayOffset += m_batches[i].vertexPos;
-				indexArrayOffset += m_batches[i].indexPos;
-			}
 
 			::glBindVertexArray(m_vao);
+
+			m_currentVAO = m_vao;
+			
+			// GL_ARRAY_BUFFER は VAO に含まれないため、インスタンスバッファから戻しておく
+			::glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
 			
 			{
-				const Vertex2D* vertexData = m_vertices.data() + vertexArrayOffset;
-				const size_t vertexSize = m_batches[batchIndex].vertexPos;
-				
 				if (VertexBufferSize < m_vertexBufferWritePos + vertexSize)
 				{
 					m_vertexBufferWritePos = 0;
@@ -256,9 +455,6 @@ namespace s3d
 				m_vertexBufferWritePos += vertexSize;
 				batchDrawOffset.vertexStartLocation = vertexOffset;
 				
-				IndexType* indexData = m_indices.data() + indexArrayOffset;
-				const uint32 indexSize = m_batches[batchIndex].indexPos;
-				
 				if (IndexBufferSize < m_indexBufferWritePos + indexSize)
 				{
 					m_indexBufferWritePos = 0;
@@ -280,16 +476,104 @@ namespace s3d
 				m_indexBufferWritePos += indexSize;
 				batchDrawOffset.indexCount = indexSize;
 				batchDrawOffset.indexStartLocation = indexOffset;
+
+				Siv3DEngine::GetProfiler()->reportVertexUpload(sizeof(Vertex2D) * vertexSize + sizeof(IndexType) * indexSize);
 			}
 
 			return batchDrawOffset;
 		}
 
+		// バッチの頂点とインデックスが CPU 側の配列にある場合、その先頭を返す
+		bool getBatchData(const size_t batchIndex, const Vertex2D** pVertex, IndexType** pIndices)
+		{
+			if (m_batches[batchIndex].region != -1)
+			{
+				return false;
+			}
+
+			size_t vertexArrayOffset = 0;
+			size_t indexArrayOffset = 0;
+
+			for (size_t i = 0; i < batchIndex; ++i)
+			{
+				if (m_batches[i].region == -1)
+				{
+					vertexArrayOffset += m_batches[i].vertexPos;
+					indexArrayOffset += m_batches[i].indexPos;
+				}
+			}
+
+			*pVertex = m_vertices.data() + vertexArrayOffset;
+			*pIndices = m_indices.data() + indexArrayOffset;
+
+			return true;
+		}
+
+		BatchDrawOffset setBuffers(const size_t batchIndex)
+		{
+			const BatchBufferPos& batch = m_batches[batchIndex];
+
+			if (batch.region != -1)
+			{
+				// 頂点は getBuffer() で書き込み済み
+				::glBindVertexArray(m_persistentVAO);
+
+				m_currentVAO = m_persistentVAO;
+
+				BatchDrawOffset batchDrawOffset;
+				batchDrawOffset.indexCount = batch.indexPos;
+				batchDrawOffset.indexStartLocation = IndexBufferSize * batch.region;
+				batchDrawOffset.vertexStartLocation = VertexBufferSize * batch.region;
+
+				Siv3DEngine::GetProfiler()->reportVertexUpload(sizeof(Vertex2D) * batch.vertexPos + sizeof(IndexType) * batch.indexPos);
+
+				return batchDrawOffset;
+			}
+
+			size_t vertexArrayOffset = 0;
+			size_t indexArrayOffset = 0;
+			
+			for (size_t i = 0; i < batchIndex; ++i)
+			{
+				if (m_batches[i].region == -1)
+				{
+					vertexArrayOffset += m_batches[i].vertexPos;
+					indexArrayOffset += m_batches[i].indexPos;
+				}
+			}
+
+			return upload(m_vertices.data() + vertexArrayOffset, batch.vertexPos,
+						  m_indices.data() + indexArrayOffset, batch.indexPos);
+		}
+
+		void bind()
+		{
+			::glBindVertexArray(m_currentVAO);
+		}
+
+		// フレームの描画コマンドをすべて発行した後に呼ぶ
 		void clear()
 		{
+			// このフレームで使った領域は、描画が完了するまで再利用しない
+			for (uint32 i = 0; i < m_regionsInFrame; ++i)
+			{
+				const uint32 region = (m_nextRegion + NumRegions - m_regionsInFrame + i) % NumRegions;
+
+				if (m_regionFences[region])
+				{
+					::glDeleteSync(m_regionFences[region]);
+				}
+
+				m_regionFences[region] = ::glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			}
+
+			m_regionsInFrame = 0;
+
 			m_batches = Array<BatchBufferPos>(1);
 			
 			m_vertexArrayWritePos = m_indexArrayWritePos = 0;
+
+			beginBatch(m_batches.back());
 		}
 	};
 }
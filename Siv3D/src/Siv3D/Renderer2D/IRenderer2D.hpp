@@ -19,6 +19,8 @@
 
 namespace s3d
 {
+	struct DrawList2DData;
+
 	class ISiv3DRenderer2D
 	{
 	public:
@@ -63,6 +65,14 @@ namespace s3d
 
 		virtual float getMaxScaling() const = 0;
 
+		virtual void setInstancingEnabled(bool enabled) = 0;
+
+		virtual bool isInstancingEnabled() const = 0;
+
+		virtual void setDrawCallSortingEnabled(bool enabled) = 0;
+
+		virtual bool isDrawCallSortingEnabled() const = 0;
+
 		virtual void addLine(const LineStyle& style, const Float2& begin, const Float2& end, float thickness, const Float4(&colors)[2]) = 0;
 
 		virtual void addTriangle(const Float2(&pts)[3], const Float4& color) = 0;
@@ -113,6 +123,8 @@ namespace s3d
 
 		virtual void addSprite(const Optional<Texture>& texture, const Sprite& sprite, uint32 startIndex, uint32 indexCount) = 0;
 
+		virtual void addDrawList(const std::shared_ptr<const DrawList2DData>& list) = 0;
+
 
 		virtual const Texture& getBoxShadowTexture() const = 0;
 	};
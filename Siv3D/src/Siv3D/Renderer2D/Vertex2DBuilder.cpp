@@ -0,0 +1,308 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <cassert>
+# include <cmath>
+# include <array>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/Utility.hpp>
+# include <Siv3D/MathConstants.hpp>
+# include "Vertex2DBuilder.hpp"
+
+# if defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+	# define SIV3D_VERTEX2DBUILDER_REFERENCE
+
+# else
+
+	# include <emmintrin.h>
+
+# endif
+
+namespace s3d
+{
+	namespace detail
+	{
+		class UnitCircleTable
+		{
+		private:
+
+			Array<Float2> m_values;
+
+			std::array<uint32, Vertex2DBuilder::MaxCircleQuality + 1> m_offsets = {};
+
+		public:
+
+			UnitCircleTable()
+			{
+				m_values.reserve(Vertex2DBuilder::MaxCircleQuality * (Vertex2DBuilder::MaxCircleQuality + 1) / 2);
+
+				for (uint32 quality = 1; quality <= Vertex2DBuilder::MaxCircleQuality; ++quality)
+				{
+					m_offsets[quality] = static_cast<uint32>(m_values.size());
+
+					const double radDelta = Math::TwoPi / quality;
+
+					for (uint32 i = 0; i < quality; ++i)
+					{
+						const double rad = radDelta * i;
+
+						m_values.emplace_back(static_cast<float>(std::cos(rad)), static_cast<float>(std::sin(rad)));
+					}
+				}
+			}
+
+			const Float2* get(const uint32 quality) const
+			{
+				return m_values.data() + m_offsets[quality];
+			}
+		};
+
+		//////////////////////////////////////////////////
+		//
+		//	Reference
+		//
+		//////////////////////////////////////////////////
+
+		inline void SetVertex(Vertex2D& vertex, const Float2& center, const Float2& radius, const Float2& unit, const Float4& color)
+		{
+			vertex.pos.set(center.x + radius.x * unit.x, center.y - radius.y * unit.y);
+			vertex.tex.set(0.0f, 0.0f);
+			vertex.color = color;
+		}
+
+		static void BuildFanReference(Vertex2D* pVertex, uint32* pIndex, const uint32 indexOffset,
+			const Float2& center, const Float2& radius, const Float2* unit, const uint32 quality, const Float4& color, const bool closed, uint32 begin)
+		{
+			for (uint32 i = begin; i < quality; ++i)
+			{
+				SetVertex(pVertex[i + 1], center, radius, unit[i], color);
+			}
+
+			for (uint32 i = begin; i < (quality - 1); ++i)
+			{
+				pIndex[i * 3 + 0] = indexOffset + i + 1;
+				pIndex[i * 3 + 1] = indexOffset;
+				pIndex[i * 3 + 2] = indexOffset + i + 2;
+			}
+
+			if (closed)
+			{
+				const uint32 i = quality - 1;
+				pIndex[i * 3 + 0] = indexOffset + i + 1;
+				pIndex[i * 3 + 1] = indexOffset;
+				pIndex[i * 3 + 2] = indexOffset + 1;
+			}
+		}
+
+		static void BuildRingReference(Vertex2D* pVertex, uint32* pIndex, const uint32 indexOffset,
+			const Float2& center, const Float2& radius0, const Float2& radius1, const Float2* unit, const uint32 quality,
+			const Float4& color0, const Float4& color1, const bool closed, uint32 begin)
+		{
+			constexpr uint32 rectIndexTable[6] = { 0, 1, 2, 2, 1, 3 };
+
+			for (uint32 i = begin; i < quality; ++i)
+			{
+				SetVertex(pVertex[i * 2 + 0], center, radius0, unit[i], color0);
+				SetVertex(pVertex[i * 2 + 1], center, radius1, unit[i], color1);
+			}
+
+			const uint32 segments = closed ? quality : (quality - 1);
+			const uint32 vertexSize = quality * 2;
+
+			for (uint32 i = begin; i < segments; ++i)
+			{
+				for (uint32 k = 0; k < 6; ++k)
+				{
+					pIndex[i * 6 + k] = indexOffset + (i * 2 + rectIndexTable[k]) % vertexSize;
+				}
+			}
+		}
+
+	# if !defined(SIV3D_VERTEX2DBUILDER_REFERENCE)
+
+		//////////////////////////////////////////////////
+		//
+		//	SSE2
+		//
+		//////////////////////////////////////////////////
+
+		// 2 つの頂点の位置 (x0, y0, x1, y1) と色を書き込む
+		inline void StoreVertices2(Vertex2D* pVertex, const __m128 pos, const __m128 color)
+		{
+			const __m128 zero = ::_mm_setzero_ps();
+			::_mm_storeu_ps(&pVertex[0].pos.x, ::_mm_movelh_ps(pos, zero));
+			::_mm_storeu_ps(&pVertex[0].color.x, color);
+			::_mm_storeu_ps(&pVertex[1].pos.x, ::_mm_movehl_ps(zero, pos));
+			::_mm_storeu_ps(&pVertex[1].color.x, color);
+		}
+
+		static void BuildFanSSE2(Vertex2D* pVertex, uint32* pIndex, const uint32 indexOffset,
+			const Float2& center, const Float2& radius, const Float2* unit, const uint32 quality, const Float4& color, const bool closed)
+		{
+			const __m128 center2 = ::_mm_setr_ps(center.x, center.y, center.x, center.y);
+			const __m128 radius2 = ::_mm_setr_ps(radius.x, -radius.y, radius.x, -radius.y);
+			const __m128 color4 = ::_mm_loadu_ps(&color.x);
+
+			// 4 つの三角形 (i + k + 1, 0, i + k + 2) のインデックスを、i を足すレーンのマスクと定数に分ける
+			const __m128i base = ::_mm_set1_epi32(static_cast<int32>(indexOffset));
+			const __m128i add0 = ::_mm_add_epi32(base, ::_mm_setr_epi32(1, 0, 2, 2));
+			const __m128i add1 = ::_mm_add_epi32(base, ::_mm_setr_epi32(0, 3, 3, 0));
+			const __m128i add2 = ::_mm_add_epi32(base, ::_mm_setr_epi32(4, 4, 0, 5));
+			const __m128i mask0 = ::_mm_setr_epi32(-1, 0, -1, -1);
+			const __m128i mask1 = ::_mm_setr_epi32(0, -1, -1, 0);
+			const __m128i mask2 = ::_mm_setr_epi32(-1, -1, 0, -1);
+
+			// 中心
+			pVertex[0].pos = center;
+			pVertex[0].tex.set(0.0f, 0.0f);
+			pVertex[0].color = color;
+
+			// 周を閉じる三角形を含まない範囲を 4 頂点ずつ処理する
+			uint32 i = 0;
+
+			for (; (i + 4) < quality; i += 4)
+			{
+				const __m128 p01 = ::_mm_add_ps(center2, ::_mm_mul_ps(radius2, ::_mm_loadu_ps(&unit[i].x)));
+				const __m128 p23 = ::_mm_add_ps(center2, ::_mm_mul_ps(radius2, ::_mm_loadu_ps(&unit[i + 2].x)));
+
+				StoreVertices2(pVertex + i + 1, p01, color4);
+				StoreVertices2(pVertex + i + 3, p23, color4);
+
+				const __m128i offset = ::_mm_set1_epi32(static_cast<int32>(i));
+				__m128i* pDst = reinterpret_cast<__m128i*>(pIndex + i * 3);
+				::_mm_storeu_si128(pDst + 0, ::_mm_add_epi32(add0, ::_mm_and_si128(offset, mask0)));
+				::_mm_storeu_si128(pDst + 1, ::_mm_add_epi32(add1, ::_mm_and_si128(offset, mask1)));
+				::_mm_storeu_si128(pDst + 2, ::_mm_add_epi32(add2, ::_mm_and_si128(offset, mask2)));
+			}
+
+			BuildFanReference(pVertex, pIndex, indexOffset, center, radius, unit, quality, color, closed, i);
+		}
+
+		static void BuildRingSSE2(Vertex2D* pVertex, uint32* pIndex, const uint32 indexOffset,
+			const Float2& center, const Float2& radius0, const Float2& radius1, const Float2* unit, const uint32 quality,
+			const Float4& color0, const Float4& color1, const bool closed)
+		{
+			const __m128 center2 = ::_mm_setr_ps(center.x, center.y, center.x, center.y);
+			const __m128 radius01 = ::_mm_setr_ps(radius0.x, -radius0.y, radius1.x, -radius1.y);
+			const __m128 color0_4 = ::_mm_loadu_ps(&color0.x);
+			const __m128 color1_4 = ::_mm_loadu_ps(&color1.x);
+			const __m128 zero = ::_mm_setzero_ps();
+
+			// 2 つの四角形 (rectIndexTable + i * 2) のインデックス
+			const __m128i base = ::_mm_set1_epi32(static_cast<int32>(indexOffset));
+			const __m128i add0 = ::_mm_add_epi32(base, ::_mm_setr_epi32(0, 1, 2, 2));
+			const __m128i add1 = ::_mm_add_epi32(base, ::_mm_setr_epi32(1, 3, 2, 3));
+			const __m128i add2 = ::_mm_add_epi32(base, ::_mm_setr_epi32(4, 4, 3, 5));
+
+			// 周を閉じる四角形を含まない範囲を 2 組ずつ処理する
+			uint32 i = 0;
+
+			for (; (i + 2) < quality; i += 2)
+			{
+				const __m128 u = ::_mm_loadu_ps(&unit[i].x);
+
+				// (cos0, sin0, cos0, sin0), (cos1, sin1, cos1, sin1)
+				const __m128 u0 = ::_mm_movelh_ps(u, u);
+				const __m128 u1 = ::_mm_movehl_ps(u, u);
+
+				const __m128 p0 = ::_mm_add_ps(center2, ::_mm_mul_ps(radius01, u0));
+				const __m128 p1 = ::_mm_add_ps(center2, ::_mm_mul_ps(radius01, u1));
+
+				Vertex2D* pDstVertex = pVertex + i * 2;
+				::_mm_storeu_ps(&pDstVertex[0].pos.x, ::_mm_movelh_ps(p0, zero));
+				::_mm_storeu_ps(&pDstVertex[0].color.x, color0_4);
+				::_mm_storeu_ps(&pDstVertex[1].pos.x, ::_mm_movehl_ps(zero, p0));
+				::_mm_storeu_ps(&pDstVertex[1].color.x, color1_4);
+				::_mm_storeu_ps(&pDstVertex[2].pos.x, ::_mm_movelh_ps(p1, zero));
+				::_mm_storeu_ps(&pDstVertex[2].color.x, color0_4);
+				::_mm_storeu_ps(&pDstVertex[3].pos.x, ::_mm_movehl_ps(zero, p1));
+				::_mm_storeu_ps(&pDstVertex[3].color.x, color1_4);
+
+				const __m128i offset = ::_mm_set1_epi32(static_cast<int32>(i * 2));
+				__m128i* pDst = reinterpret_cast<__m128i*>(pIndex + i * 6);
+				::_mm_storeu_si128(pDst + 0, ::_mm_add_epi32(add0, offset));
+				::_mm_storeu_si128(pDst + 1, ::_mm_add_epi32(add1, offset));
+				::_mm_storeu_si128(pDst + 2, ::_mm_add_epi32(add2, offset));
+			}
+
+			BuildRingReference(pVertex, pIndex, indexOffset, center, radius0, radius1, unit, quality, color0, color1, closed, i);
+		}
+
+	# endif
+	}
+
+	namespace Vertex2DBuilder
+	{
+		const Float2* GetUnitCircle(const uint32 quality)
+		{
+			assert(InRange<uint32>(quality, 1, MaxCircleQuality));
+
+			static const detail::UnitCircleTable table;
+
+			return table.get(quality);
+		}
+
+		void GetUnitArc(Float2* dst, const float startAngle, const float angleStep, const uint32 quality)
+		{
+			// 1 ステップの回転を繰り返し掛ける。誤差が積もらないよう double で計算する
+			const double stepC = std::cos(angleStep);
+			const double stepS = std::sin(angleStep);
+			double c = std::cos(startAngle);
+			double s = std::sin(startAngle);
+
+			for (uint32 i = 0; i < quality; ++i)
+			{
+				dst[i].set(static_cast<float>(c), static_cast<float>(s));
+
+				const double nc = c * stepC - s * stepS;
+				s = s * stepC + c * stepS;
+				c = nc;
+			}
+		}
+
+	# if defined(SIV3D_VERTEX2DBUILDER_REFERENCE)
+
+		void BuildFan(Vertex2D* pVertex, uint32* pIndex, const uint32 indexOffset,
+			const Float2& center, const Float2& radius, const Float2* unit, const uint32 quality, const Float4& color, const bool closed)
+		{
+			pVertex[0].pos = center;
+			pVertex[0].tex.set(0.0f, 0.0f);
+			pVertex[0].color = color;
+
+			detail::BuildFanReference(pVertex, pIndex, indexOffset, center, radius, unit, quality, color, closed, 0);
+		}
+
+		void BuildRing(Vertex2D* pVertex, uint32* pIndex, const uint32 indexOffset,
+			const Float2& center, const Float2& radius0, const Float2& radius1, const Float2* unit, const uint32 quality,
+			const Float4& color0, const Float4& color1, const bool closed)
+		{
+			detail::BuildRingReference(pVertex, pIndex, indexOffset, center, radius0, radius1, unit, quality, color0, color1, closed, 0);
+		}
+
+	# else
+
+		void BuildFan(Vertex2D* pVertex, uint32* pIndex, const uint32 indexOffset,
+			const Float2& center, const Float2& radius, const Float2* unit, const uint32 quality, const Float4& color, const bool closed)
+		{
+			detail::BuildFanSSE2(pVertex, pIndex, indexOffset, center, radius, unit, quality, color, closed);
+		}
+
+		void BuildRing(Vertex2D* pVertex, uint32* pIndex, const uint32 indexOffset,
+			const Float2& center, const Float2& radius0, const Float2& radius1, const Float2* unit, const uint32 quality,
+			const Float4& color0, const Float4& color1, const bool closed)
+		{
+			detail::BuildRingSSE2(pVertex, pIndex, indexOffset, center, radius0, radius1, unit, quality, color0, color1, closed);
+		}
+
+	# endif
+	}
+}
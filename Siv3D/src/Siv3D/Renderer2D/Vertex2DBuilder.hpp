@@ -0,0 +1,61 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <algorithm>
+# include <Siv3D/Fwd.hpp>
+# include <Siv3D/PointVector.hpp>
+# include <Siv3D/Vertex2D.hpp>
+
+namespace s3d
+{
+	// GLSpriteBatch / D3D11SpriteBatch と同じインデックスの型（異なる型を宣言するとコンパイルエラーになる）
+	using IndexType = uint32;
+
+	// 円や楕円の頂点とインデックスを生成する、GL / D3D11 共通の関数
+	// x86 では SSE2 で位置・色・インデックスを 1 回の走査で書き込む。
+	namespace Vertex2DBuilder
+	{
+		// 円の分割数の最大値
+		constexpr uint32 MaxCircleQuality = 255;
+
+		// 画面上の半径から円の分割数を計算する（CRenderer2D と DrawList2D で共通）
+		[[nodiscard]] constexpr IndexType CalculateCircleQuality(const float size) noexcept
+		{
+			if (size <= 5.0f)
+			{
+				return static_cast<IndexType>(size + 3) * 2;
+			}
+			else
+			{
+				return static_cast<IndexType>(std::min(18 + (size - 5.0f) / 2.2f, 255.0f));
+			}
+		}
+
+		// 円周を quality 等分した角度の (cos, sin) の表を返す（1 <= quality <= MaxCircleQuality）
+		// 表は分割数ごとに最初の呼び出しで一度だけ作られる。
+		[[nodiscard]] const Float2* GetUnitCircle(uint32 quality);
+
+		// startAngle から angleStep ずつ増える quality 個の角度の (cos, sin) を dst に書き込む
+		void GetUnitArc(Float2* dst, float startAngle, float angleStep, uint32 quality);
+
+		// 中心と、周上の center + (radius.x * cos, -radius.y * sin) の頂点からなる扇形
+		// 頂点数: quality + 1, インデックス数: closed ? quality * 3 : (quality - 1) * 3
+		void BuildFan(Vertex2D* pVertex, uint32* pIndex, uint32 indexOffset,
+			const Float2& center, const Float2& radius, const Float2* unit, uint32 quality, const Float4& color, bool closed);
+
+		// radius0 と radius1 の 2 つの周の頂点を交互に並べた帯
+		// 頂点数: quality * 2, インデックス数: closed ? quality * 6 : (quality - 1) * 6
+		void BuildRing(Vertex2D* pVertex, uint32* pIndex, uint32 indexOffset,
+			const Float2& center, const Float2& radius0, const Float2& radius1, const Float2* unit, uint32 quality,
+			const Float4& color0, const Float4& color1, bool closed);
+	}
+}
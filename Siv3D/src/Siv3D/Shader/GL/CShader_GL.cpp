@@ -59,6 +59,7 @@ namespace s3d
 		}
 		
 		m_standardVSs.push_back(VertexShader(Resource(U"engine/shader/sprite.vert"), { { U"SpriteCB", 0 } }));
+		m_standardVSs.push_back(VertexShader(Resource(U"engine/shader/sprite_instanced.vert"), { { U"SpriteCB", 0 } }));
 		m_standardPSs.push_back(PixelShader(Resource(U"engine/shader/shape.frag")));
 		m_standardPSs.push_back(PixelShader(Resource(U"engine/shader/line_dot.frag")));
 		m_standardPSs.push_back(PixelShader(Resource(U"engine/shader/line_round_dot.frag")));
@@ -14,6 +14,7 @@
 # include "Logger/ILogger.hpp"
 # include "System/ISystem.hpp"
 # include "CPU/ICPU.hpp"
+# include "ThreadPool/IThreadPool.hpp"
 # include "Console/IConsole.hpp"
 # include "ImageFormat/IImageFormat.hpp"
 # include "ObjectDetection/IObjectDetection.hpp"
@@ -86,6 +87,7 @@ namespace s3d
 		m_objectDetection.release();
 		m_imageFormat.release();
 		m_console.release();
+		m_threadPool.release();
 		m_cpu.release();
 		m_system.release();
 		m_logger.release();
@@ -18,6 +18,7 @@ namespace s3d
 	class ISiv3DLogger;
 	class ISiv3DSystem;
 	class ISiv3DCPU;
+	class ISiv3DThreadPool;
 	class ISiv3DConsole;
 	class ISiv3DImageFormat;
 	class ISiv3DObjectDetection;
@@ -94,6 +95,8 @@ namespace s3d
 
 		Siv3DComponent<ISiv3DCPU> m_cpu;
 
+		Siv3DComponent<ISiv3DThreadPool> m_threadPool;
+
 		Siv3DComponent<ISiv3DConsole> m_console;
 
 		Siv3DComponent<ISiv3DImageFormat> m_imageFormat;
@@ -187,6 +190,11 @@ namespace s3d
 			return pEngine->m_cpu.get();
 		}
 
+		static ISiv3DThreadPool* GetThreadPool()
+		{
+			return pEngine->m_threadPool.get();
+		}
+
 		static ISiv3DConsole* GetConsole()
 		{
 			return pEngine->m_console.get();
@@ -13,6 +13,7 @@
 # if defined(SIV3D_TARGET_LINUX)
 
 # include <iostream>
+# include <cstring>
 # include <unistd.h>
 # include <Siv3D/String.hpp>
 # include <Siv3D/FileSystem.hpp>
@@ -30,11 +31,13 @@ namespace s3d
 		namespace init
 		{
 			void SetModulePath(const FilePath& path);
+
+			void SetHeadless(bool headless);
 		}
 	}
 }
 
-int main(int, char* argv[])
+int main(int argc, char* argv[])
 {
 	using namespace s3d;
 
@@ -50,6 +53,15 @@ int main(int, char* argv[])
 
 	detail::init::SetModulePath(modulePath);
 
+	// --headless: ウィンドウを作成せず、オフスクリーンのフレームバッファに描画する
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--headless") == 0)
+		{
+			detail::init::SetHeadless(true);
+		}
+	}
+
 	chdir(FileSystem::ParentPath(path, 0).narrow().c_str());
 
 	Siv3DEngine engine;
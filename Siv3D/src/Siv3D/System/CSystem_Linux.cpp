@@ -42,6 +42,7 @@
 # include "../Script/IScript.hpp"
 # include "../Asset/IAsset.hpp"
 # include <Siv3D/Logger.hpp>
+# include <Siv3D/Profiler.hpp>
 
 namespace s3d
 {
@@ -207,14 +208,22 @@ namespace s3d
 
 		Siv3DEngine::GetPrint()->draw();
 		
-		if (!Siv3DEngine::GetGraphics()->flush(clearGraphics))
 		{
-			return false;
+			SIV3D_PROFILE_SCOPE("Graphics::flush");
+
+			if (!Siv3DEngine::GetGraphics()->flush(clearGraphics))
+			{
+				return false;
+			}
 		}
 
 		Siv3DEngine::GetProfiler()->endFrame();
 
-		Siv3DEngine::GetGraphics()->present();
+		{
+			SIV3D_PROFILE_SCOPE("Graphics::present");
+
+			Siv3DEngine::GetGraphics()->present();
+		}
 
 		if (!Siv3DEngine::GetScreenCapture()->update())
 		{
@@ -235,6 +244,8 @@ namespace s3d
 
 		++m_frameCounter;
 
+		SIV3D_PROFILE_SCOPE("System::update");
+
 		m_frameDelta.update();
 
 		if (!Siv3DEngine::GetWindow()->update())
@@ -264,6 +275,8 @@ namespace s3d
 		Siv3DEngine::GetTextInput()->update();
 
 		Siv3DEngine::GetEffect()->update();
+
+		Siv3DEngine::GetAsset()->update();
 		
 		return m_updateSucceeded = true;
 	}
@@ -43,6 +43,7 @@
 
 # include <Siv3D/Cursor.hpp>
 # include <Siv3D/Logger.hpp>
+# include <Siv3D/Profiler.hpp>
 
 namespace s3d
 {
@@ -219,16 +220,24 @@ namespace s3d
 
 		Siv3DEngine::GetPrint()->draw();
 
-		if (!Siv3DEngine::GetGraphics()->flush(clearGraphics))
 		{
-			return false;
+			SIV3D_PROFILE_SCOPE("Graphics::flush");
+
+			if (!Siv3DEngine::GetGraphics()->flush(clearGraphics))
+			{
+				return false;
+			}
 		}
 
 		Siv3DEngine::GetProfiler()->endFrame();
 
-		if (!Siv3DEngine::GetGraphics()->present())
 		{
-			return false;
+			SIV3D_PROFILE_SCOPE("Graphics::present");
+
+			if (!Siv3DEngine::GetGraphics()->present())
+			{
+				return false;
+			}
 		}
 
 		if (!Siv3DEngine::GetScreenCapture()->update())
@@ -252,6 +261,8 @@ namespace s3d
 
 		++m_frameCounter;
 
+		SIV3D_PROFILE_SCOPE("System::update");
+
 		m_frameDelta.update();
 
 		Siv3DEngine::GetGraphics()->clear();
@@ -272,6 +283,8 @@ namespace s3d
 
 		Siv3DEngine::GetEffect()->update();
 
+		Siv3DEngine::GetAsset()->update();
+
 		return m_updateSucceeded = true;
 	}
 
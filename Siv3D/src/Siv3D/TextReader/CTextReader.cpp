@@ -9,10 +9,11 @@
 //
 //-----------------------------------------------
 
+# include <cstring>
 # include <Siv3D/FileSystem.hpp>
 # include <Siv3D/BinaryWriter.hpp>
-# include <Siv3D/ByteArray.hpp>
 # include "CTextReader.hpp"
+# include "../Unicode/UnicodeKernel.hpp"
 
 # include <Siv3D/Logger.hpp>
 
@@ -52,6 +53,29 @@ namespace s3d
 
 			return path;
 		}
+
+		static void AppendUTF8(String& text, const char8* src, const size_t size)
+		{
+			const size_t oldSize = text.size();
+
+			text.resize(oldSize + size);
+
+			text.resize(oldSize + UnicodeKernel::UTF8ToUTF32(text.data() + oldSize, src, size));
+		}
+
+		[[nodiscard]] static char16 LoadChar16(const char8* src, const TextEncoding encoding) noexcept
+		{
+			char16 ch;
+
+			std::memcpy(&ch, src, sizeof(ch));
+
+			if (encoding == TextEncoding::UTF16BE)
+			{
+				ch = static_cast<char16>(((ch << 8) & 0xFF00) | ((ch >> 8) & 0xFF));
+			}
+
+			return ch;
+		}
 	}
 
 	TextReader::CTextReader::CTextReader()
@@ -93,6 +117,8 @@ namespace s3d
 
 			m_opened = m_reader->isOpened();
 
+			resetBuffer();
+
 			if (const size_t bomSize = Unicode::GetBOMSize(m_encoding))
 			{
 				m_reader->skip(bomSize);
@@ -154,6 +180,8 @@ namespace s3d
 
 			m_opened = m_reader->isOpened();
 
+			resetBuffer();
+
 			if (const size_t bomSize = Unicode::GetBOMSize(m_encoding))
 			{
 				m_reader->skip(bomSize);
@@ -193,6 +221,10 @@ namespace s3d
 		if (m_reader)
 		{
 			m_reader.reset();
+
+			m_buffer.release();
+
+			m_bufferPos = m_bufferEnd = 0;
 		}
 		else
 		{
@@ -233,8 +265,8 @@ namespace s3d
 		{
 			const size_t bomSize = Unicode::GetBOMSize(m_encoding);
 
-			Array<Byte> tmp(static_cast<size_t>(m_reader->size()) - bomSize);
-			
+			Array<char8> tmp(static_cast<size_t>(m_reader->size()) - bomSize);
+
 			if (tmp.empty())
 			{
 				return;
@@ -242,82 +274,25 @@ namespace s3d
 
 			m_reader->read(tmp.data(), bomSize, tmp.size());
 
-			ByteArray reader(std::move(tmp));
-
-			const int64 size = reader.size();
+			resetBuffer();
 
-			while (reader.getPos() < size)
+			if ((m_encoding == TextEncoding::UTF16LE) || (m_encoding == TextEncoding::UTF16BE))
 			{
-				char32 codePoint = 0;
+				std::u16string text(tmp.size() / sizeof(char16), u'\0');
 
-				if (m_encoding == TextEncoding::UTF16LE)
+				for (size_t i = 0; i < text.size(); ++i)
 				{
-					char16 c0 = 0, c1 = 0;
-					reader.read(c0);
-
-					if (Unicode::IsHighSurrogate(c0))
-					{
-						reader.read(c1);
-						codePoint = (((c0 - 0xD800) << 10) | (c1 - 0xDC00)) + 0x10000;
-					}
-					else
-					{
-						codePoint = c0;
-					}
-				}
-				else if (m_encoding == TextEncoding::UTF16BE)
-				{
-					char16 c0 = 0, c1 = 0;
-					reader.read(c0);
-					c0 = ((c0 << 8) & 0xff00) | ((c0 >> 8) & 0xFF);
-
-					if (Unicode::IsHighSurrogate(c0))
-					{
-						reader.read(c1);
-						c1 = ((c1 << 8) & 0xff00) | ((c1 >> 8) & 0xFF);
-
-						codePoint = (((c0 - 0xD800) << 10) | (c1 - 0xDC00)) + 0x10000;
-					}
-					else
-					{
-						codePoint = c0;
-					}
-				}
-				else // UTF8, UTF8
-				{
-					char8 buffer[4] = {};
-					
-					const size_t readSize = static_cast<size_t>(reader.lookahead(buffer, sizeof(buffer)));
-					
-					Unicode::Translator_UTF8toUTF32 translator;
-
-					size_t i = 0;
-
-					for (; i < readSize; ++i)
-					{
-						if (translator.put(buffer[i]))
-						{
-							break;
-						}
-					}
-
-					if (i != readSize)
-					{
-						reader.skip(i + 1);
-						codePoint = translator.get();
-					}
-					else
-					{
-						reader.skip(readSize);
-						codePoint = 0xFFFD;
-					}
+					text[i] = detail::LoadChar16(tmp.data() + i * sizeof(char16), m_encoding);
 				}
 
-				if (codePoint != U'\r')
-				{
-					out.push_back(codePoint);
-				}
+				out = Unicode::FromUTF16(text);
 			}
+			else
+			{
+				out = Unicode::FromUTF8(std::string_view(tmp.data(), tmp.size()));
+			}
+
+			out.remove(U'\r');
 		}
 		else
 		{
@@ -365,6 +340,13 @@ namespace s3d
 
 		if (m_reader)
 		{
+			if ((m_encoding == TextEncoding::UTF8) || (m_encoding == TextEncoding::UTF8_NO_BOM))
+			{
+				readLineUTF8(text);
+
+				return;
+			}
+
 			for (;;)
 			{
 				const char32 codePoint = readChar();
@@ -422,7 +404,7 @@ namespace s3d
 
 		if (m_reader)
 		{
-			return m_reader->getPos() == m_size;
+			return (m_bufferPos == m_bufferEnd) && (m_reader->getPos() == m_size);
 		}
 		else
 		{
@@ -451,68 +433,141 @@ namespace s3d
 			return ch; // [Siv3D TODO]
 		}
 		
-		if (m_reader->getPos() == m_reader->size())
+		// 1 文字は最大 4 バイト
+		if ((m_bufferEnd - m_bufferPos) < 4)
 		{
-			return U'\0';
+			fillBuffer();
 		}
 
-		if (m_encoding == TextEncoding::UTF16LE)
+		const size_t available = (m_bufferEnd - m_bufferPos);
+
+		if (available == 0)
 		{
-			char16 c0 = 0, c1 = 0;
-			m_reader->read(c0);
+			return U'\0';
+		}
 
-			if (Unicode::IsHighSurrogate(c0))
+		const char8* const src = m_buffer.data() + m_bufferPos;
+
+		if ((m_encoding == TextEncoding::UTF16LE) || (m_encoding == TextEncoding::UTF16BE))
+		{
+			if (available < 2)
 			{
-				m_reader->read(c1);
-				return (((c0 - 0xD800) << 10) | (c1 - 0xDC00)) + 0x10000;
+				m_bufferPos = m_bufferEnd;
+
+				return 0xFFFD;
 			}
 
-			return c0;
-		}
-		else if (m_encoding == TextEncoding::UTF16BE)
-		{
-			char16 c0 = 0, c1 = 0;
-			m_reader->read(c0);
-			c0 = ((c0 << 8) & 0xff00) | ((c0 >> 8) & 0xFF);
+			const char16 c0 = detail::LoadChar16(src, m_encoding);
 
-			if (Unicode::IsHighSurrogate(c0))
+			m_bufferPos += 2;
+
+			if (!Unicode::IsHighSurrogate(c0))
 			{
-				m_reader->read(c1);
-				c1 = ((c1 << 8) & 0xff00) | ((c1 >> 8) & 0xFF);
+				return c0;
+			}
 
-				return (((c0 - 0xD800) << 10) | (c1 - 0xDC00)) + 0x10000;
+			if (available < 4)
+			{
+				return 0xFFFD;
 			}
 
-			return c0;
+			const char16 c1 = detail::LoadChar16(src + 2, m_encoding);
+
+			if (!Unicode::IsLowSurrogate(c1))
+			{
+				return 0xFFFD;
+			}
+
+			m_bufferPos += 2;
+
+			return (((c0 - 0xD800) << 10) | (c1 - 0xDC00)) + 0x10000;
 		}
 		else // UTF-8
 		{
-			char8 buffer[4] = {};
+			size_t length;
 
-			const size_t readSize = static_cast<size_t>(m_reader->lookahead(buffer, sizeof(buffer)));
+			const char32 codePoint = UnicodeKernel::DecodeUTF8(src, available, length);
 
-			Unicode::Translator_UTF8toUTF32 translator;
+			m_bufferPos += length;
 
-			size_t i = 0;
+			return codePoint;
+		}
+	}
 
-			for (; i < readSize; ++i)
-			{
-				if (translator.put(buffer[i]))
-				{
-					break;
-				}
-			}
+	bool TextReader::CTextReader::fillBuffer()
+	{
+		const size_t remaining = (m_bufferEnd - m_bufferPos);
+
+		if (remaining && m_bufferPos)
+		{
+			std::memmove(m_buffer.data(), m_buffer.data() + m_bufferPos, remaining);
+		}
+
+		m_bufferPos = 0;
+
+		m_bufferEnd = remaining;
+
+		if (remaining == m_buffer.size())
+		{
+			return false;
+		}
+
+		const int64 readSize = m_reader->read(m_buffer.data() + remaining, m_buffer.size() - remaining);
+
+		if (readSize <= 0)
+		{
+			return false;
+		}
+
+		m_bufferEnd += static_cast<size_t>(readSize);
+
+		return true;
+	}
+
+	void TextReader::CTextReader::resetBuffer()
+	{
+		// 小さなファイルではファイルサイズ分だけ確保する
+		m_buffer.resize(static_cast<size_t>(std::min<int64>(BufferSize, m_reader->size())));
+
+		m_bufferPos = m_bufferEnd = 0;
+	}
+
+	void TextReader::CTextReader::readLineUTF8(String& text)
+	{
+		for (;;)
+		{
+			const char8* const src = m_buffer.data() + m_bufferPos;
+
+			const size_t available = (m_bufferEnd - m_bufferPos);
 
-			if (i != readSize)
+			if (const void* newLine = (available ? std::memchr(src, '\n', available) : nullptr))
 			{
-				m_reader->skip(i + 1);
-				return translator.get();
+				const size_t length = static_cast<size_t>(static_cast<const char8*>(newLine) - src);
+
+				detail::AppendUTF8(text, src, length);
+
+				m_bufferPos += (length + 1);
+
+				break;
 			}
-			else
+
+			// 改行が見つからなければ、途中で切れた文字を残して変換し、続きを読み込む
+			const size_t length = available - UnicodeKernel::IncompleteUTF8Tail(src, available);
+
+			detail::AppendUTF8(text, src, length);
+
+			m_bufferPos += length;
+
+			if (!fillBuffer())
 			{
-				m_reader->skip(readSize);
-				return 0xFFFD;
+				detail::AppendUTF8(text, m_buffer.data() + m_bufferPos, (m_bufferEnd - m_bufferPos));
+
+				m_bufferPos = m_bufferEnd;
+
+				break;
 			}
 		}
+
+		text.remove(U'\r');
 	}
 }
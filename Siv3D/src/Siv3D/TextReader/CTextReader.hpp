@@ -20,6 +20,8 @@ namespace s3d
 	{
 	private:
 
+		static constexpr size_t BufferSize = 64 * 1024;
+
 		std::shared_ptr<IReader> m_reader;
 
 		std::ifstream m_ifs;
@@ -34,6 +36,20 @@ namespace s3d
 
 		bool m_opened = false;
 
+		// m_reader から読み込んだ、まだ変換していないバイト列
+		Array<char8> m_buffer;
+
+		size_t m_bufferPos = 0;
+
+		size_t m_bufferEnd = 0;
+
+		// 未処理のバイトをバッファの先頭に移動し、続きを読み込む
+		bool fillBuffer();
+
+		void resetBuffer();
+
+		void readLineUTF8(String& text);
+
 		char32_t readCodePoint();
 
 	public:
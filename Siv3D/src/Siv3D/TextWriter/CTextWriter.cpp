@@ -9,7 +9,9 @@
 //
 //-----------------------------------------------
 
+# include <cstring>
 # include "CTextWriter.hpp"
+# include "../Unicode/UnicodeKernel.hpp"
 
 namespace s3d
 {
@@ -131,6 +133,16 @@ namespace s3d
 		open(path, OpenMode::Trunc, m_encoding);
 	}
 
+	void TextWriter::CTextWriter::flush()
+	{
+		if (!isOpened())
+		{
+			return;
+		}
+
+		m_binaryWriter.flush();
+	}
+
 	void TextWriter::CTextWriter::write(const StringView view)
 	{
 		if (!isOpened())
@@ -142,57 +154,20 @@ namespace s3d
 		{
 		case TextEncoding::Unknown:
 			{
-				char previous = '\0';
+				const std::string text = Unicode::Narrow(view);
 
-				for (const char ch : Unicode::Narrow(view))
-				{
-					if (ch == '\n' && previous != '\r')
-					{
-						m_binaryWriter.write(u8"\r\n", sizeof(char) * 2);
-					}
-					else
-					{
-						m_binaryWriter.write(ch);
-					}
-
-					previous = ch;
-				}
+				writeWithCRLF(text.data(), text.size());
 
 				break;
 			}
 		case TextEncoding::UTF8_NO_BOM:
 		case TextEncoding::UTF8:
 			{
-				char8 previous = '\0';
+				m_utf8Buffer.resize(UnicodeKernel::UTF8Length(view.data(), view.size()));
 
-				Unicode::Translator_UTF32toUTF8 translator;
+				UnicodeKernel::UTF32ToUTF8(m_utf8Buffer.data(), view.data(), view.size());
 
-				for (const char32 ch32 : view)
-				{
-					const size_t length = translator.put(ch32);
-
-					if (length == 1)
-					{
-						const char8 ch = translator.get()[0];
-
-						if (ch == '\n' && previous != '\r')
-						{
-							m_binaryWriter.write(u8"\r\n", 2);
-						}
-						else
-						{
-							m_binaryWriter.write(ch);
-
-							previous = ch;
-						}
-					}
-					else
-					{
-						m_binaryWriter.write(translator.get().data(), length);
-
-						previous = '\0';
-					}
-				}
+				writeWithCRLF(m_utf8Buffer.data(), m_utf8Buffer.size());
 
 				break;
 			}
@@ -319,21 +294,7 @@ namespace s3d
 		case TextEncoding::UTF8_NO_BOM:
 		case TextEncoding::UTF8:
 			{
-				char previous = '\0';
-
-				for (const char8 ch : view)
-				{
-					if (ch == '\n' && previous != '\r')
-					{
-						m_binaryWriter.write(u8"\r\n", sizeof(char) * 2);
-					}
-					else
-					{
-						m_binaryWriter.write(ch);
-					}
-
-					previous = ch;
-				}
+				writeWithCRLF(view.data(), view.size());
 
 				break;
 			}
@@ -388,4 +349,39 @@ namespace s3d
 	{
 		return m_binaryWriter.path();
 	}
+
+	void TextWriter::CTextWriter::writeWithCRLF(const char8* src, const size_t size)
+	{
+		if (size == 0)
+		{
+			return;
+		}
+
+		const char8* const srcEnd = src + size;
+		const char8* begin = src;
+		const char8* searchFrom = src;
+
+		while (const void* p = std::memchr(searchFrom, '\n', srcEnd - searchFrom))
+		{
+			const char8* const newLine = static_cast<const char8*>(p);
+
+			searchFrom = newLine + 1;
+
+			if ((newLine != src) && (newLine[-1] == '\r'))
+			{
+				continue;
+			}
+
+			m_binaryWriter.write(begin, newLine - begin);
+
+			m_binaryWriter.write(u8"\r\n", 2);
+
+			begin = searchFrom;
+		}
+
+		if (begin != srcEnd)
+		{
+			m_binaryWriter.write(begin, srcEnd - begin);
+		}
+	}
 }
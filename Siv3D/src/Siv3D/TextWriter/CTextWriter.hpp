@@ -23,6 +23,12 @@ namespace s3d
 
 		TextEncoding m_encoding = TextEncoding::Default;
 
+		// UTF-32 から変換した UTF-8 の文字列
+		std::string m_utf8Buffer;
+
+		// 直前が '\r' でない '\n' を "\r\n" にして書き込む
+		void writeWithCRLF(const char8* src, size_t size);
+
 	public:
 
 		CTextWriter();
@@ -37,6 +43,8 @@ namespace s3d
 
 		void clear();
 
+		void flush();
+
 		void write(StringView view);
 
 		void writeNewLine();
@@ -45,6 +45,11 @@ namespace s3d
 		pImpl->clear();
 	}
 
+	void TextWriter::flush()
+	{
+		pImpl->flush();
+	}
+
 	void TextWriter::write(const StringView view)
 	{
 		pImpl->write(view);
@@ -208,6 +208,11 @@ namespace s3d
 	{
 		return m_textures[handleID]->fill(m_context, src, stride, wait);
 	}
+
+	bool CTexture_D3D11::fillRegion(const TextureID handleID, const void* const src, const uint32 stride, const Rect& rect, const bool wait)
+	{
+		return m_textures[handleID]->fillRegion(m_context, src, stride, rect, wait);
+	}
 }
 
 # endif
@@ -78,6 +78,8 @@ namespace s3d
 		bool fill(TextureID handleID, const ColorF& color, bool wait) override;
 
 		bool fill(TextureID handleID, const void* src, uint32 stride, bool wait) override;
+
+		bool fillRegion(TextureID handleID, const void* src, uint32 stride, const Rect& rect, bool wait) override;
 	};
 }
 
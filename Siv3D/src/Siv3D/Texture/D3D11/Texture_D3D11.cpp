@@ -360,6 +360,63 @@ namespace s3d
 		return true;
 	}
 
+	bool Texture_D3D11::fillRegion(ID3D11DeviceContext* context, const void* src, const uint32 stride, const Rect& rect, const bool wait)
+	{
+		if (!m_textureStaging)
+		{
+			return false;
+		}
+
+		if (rect.x < 0 || rect.y < 0 || (rect.x + rect.w) > m_desc.size.x || (rect.y + rect.h) > m_desc.size.y)
+		{
+			return false;
+		}
+
+		if (rect.w <= 0 || rect.h <= 0)
+		{
+			return true;
+		}
+
+		D3D11_MAPPED_SUBRESOURCE mapped;
+
+		if (FAILED(context->Map(m_textureStaging.Get(), 0, D3D11_MAP_WRITE, wait ? 0 : D3D11_MAP_FLAG_DO_NOT_WAIT, &mapped)))
+		{
+			return false;
+		}
+
+		if (m_desc.stride() > mapped.RowPitch)
+		{
+			context->Unmap(m_textureStaging.Get(), 0);
+
+			return false;
+		}
+
+		if (mapped.pData)
+		{
+			const uint32 pixelSize = detail::GetPixelSize(m_desc.format);
+			const uint32 lineSize = pixelSize * rect.w;
+			uint8* pDst = static_cast<uint8*>(mapped.pData) + (rect.y * mapped.RowPitch) + (rect.x * pixelSize);
+			const uint8* pSrc = static_cast<const uint8*>(src) + (rect.y * stride) + (rect.x * pixelSize);
+
+			for (int32 y = 0; y < rect.h; ++y)
+			{
+				::memcpy(pDst, pSrc, lineSize);
+				pDst += mapped.RowPitch;
+				pSrc += stride;
+			}
+		}
+
+		context->Unmap(m_textureStaging.Get(), 0);
+
+		// ステージングテクスチャは常にテクスチャと同じ内容を保持しているので、変更した範囲だけをコピーすればよい
+		const D3D11_BOX box = { static_cast<UINT>(rect.x), static_cast<UINT>(rect.y), 0,
+			static_cast<UINT>(rect.x + rect.w), static_cast<UINT>(rect.y + rect.h), 1 };
+
+		context->CopySubresourceRegion(m_texture.Get(), 0, rect.x, rect.y, 0, m_textureStaging.Get(), 0, &box);
+
+		return true;
+	}
+
 	bool Texture_D3D11::createShaderResourceView(ID3D11Device* const device)
 	{
 		const D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = m_desc.makeD3D11SRVDesc();
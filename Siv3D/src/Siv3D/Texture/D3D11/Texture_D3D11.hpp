@@ -209,6 +209,9 @@ namespace s3d
 		bool fill(ID3D11DeviceContext* context, const ColorF& color, bool wait);
 
 		bool fill(ID3D11DeviceContext* context, const void* src, uint32 stride, bool wait);
+
+		// src はテクスチャと同じ大きさの画像。rect の範囲だけを転送する
+		bool fillRegion(ID3D11DeviceContext* context, const void* src, uint32 stride, const Rect& rect, bool wait);
 	};
 }
 
@@ -195,6 +195,11 @@ namespace s3d
 		return m_textures[handleID]->fill(src, stride, wait);
 	}
 
+	bool CTexture_GL::fillRegion(const TextureID handleID, const void* const src, const uint32 stride, const Rect& rect, const bool wait)
+	{
+		return m_textures[handleID]->fillRegion(src, stride, rect, wait);
+	}
+
 	bool CTexture_GL::isMainThread() const
 	{
 		return std::this_thread::get_id() == m_id;
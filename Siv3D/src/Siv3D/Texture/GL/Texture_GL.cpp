@@ -134,6 +134,36 @@ namespace s3d
 		
 		return true;
 	}
+
+	bool Texture_GL::fillRegion(const void* src, const uint32 stride, const Rect& rect, bool wait)
+	{
+		if (!m_isDynamic)
+		{
+			return false;
+		}
+
+		if (rect.x < 0 || rect.y < 0 || (rect.x + rect.w) > m_size.x || (rect.y + rect.h) > m_size.y)
+		{
+			return false;
+		}
+
+		if (rect.w <= 0 || rect.h <= 0)
+		{
+			return true;
+		}
+
+		const uint8* pSrc = static_cast<const uint8*>(src) + (rect.y * stride) + (rect.x * sizeof(uint32));
+
+		::glBindTexture(GL_TEXTURE_2D, m_texture);
+
+		::glPixelStorei(GL_UNPACK_ROW_LENGTH, static_cast<GLint>(stride / sizeof(uint32)));
+
+		::glTexSubImage2D(GL_TEXTURE_2D, 0, rect.x, rect.y, rect.w, rect.h, GL_RGBA, GL_UNSIGNED_BYTE, pSrc);
+
+		::glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+
+		return true;
+	}
 }
 
 # endif
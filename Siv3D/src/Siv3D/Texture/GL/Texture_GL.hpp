@@ -82,6 +82,9 @@ namespace s3d
 		bool fill(const ColorF& color, bool wait);
 		
 		bool fill(const void* src, uint32 stride, bool wait);
+
+		// src はテクスチャと同じ大きさの画像。rect の範囲だけを転送する
+		bool fillRegion(const void* src, uint32 stride, const Rect& rect, bool wait);
 	};
 }
 
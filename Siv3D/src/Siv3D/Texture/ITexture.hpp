@@ -59,5 +59,7 @@ namespace s3d
 		virtual bool fill(TextureID handleID, const ColorF& color, bool wait) = 0;
 
 		virtual bool fill(TextureID handleID, const void* src, uint32 stride, bool wait) = 0;
+
+		virtual bool fillRegion(TextureID handleID, const void* src, uint32 stride, const Rect& rect, bool wait) = 0;
 	};
 }
@@ -0,0 +1,334 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <algorithm>
+# include <exception>
+# include "CThreadPool.hpp"
+# include "../Profiler/CPUProfiler.hpp"
+# include <Siv3D/ConcurrentTask.hpp>
+# include <Siv3D/Logger.hpp>
+# include <Siv3D/Profiler.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		// ワーカースレッドが自分のキューを見つけるための情報
+		thread_local const CThreadPool* t_currentPool = nullptr;
+
+		thread_local size_t t_workerIndex = 0;
+
+		class ParallelForState
+		{
+		private:
+
+			Threading::detail::ParallelForFunction m_function;
+
+			void* m_data;
+
+			size_t m_count;
+
+			size_t m_chunkSize;
+
+			size_t m_numChunks;
+
+			std::atomic<size_t> m_nextChunk = { 0 };
+
+			std::atomic<size_t> m_finishedChunks = { 0 };
+
+			std::atomic<bool> m_failed = { false };
+
+			std::exception_ptr m_exception;
+
+			std::mutex m_mutex;
+
+			std::condition_variable m_condition;
+
+		public:
+
+			ParallelForState(const Threading::detail::ParallelForFunction f, void* data, const size_t count, const size_t chunkSize)
+				: m_function(f)
+				, m_data(data)
+				, m_count(count)
+				, m_chunkSize(chunkSize)
+				, m_numChunks((count + chunkSize - 1) / chunkSize) {}
+
+			size_t numChunks() const noexcept
+			{
+				return m_numChunks;
+			}
+
+			void run()
+			{
+				for (;;)
+				{
+					const size_t chunk = m_nextChunk.fetch_add(1);
+
+					if (chunk >= m_numChunks)
+					{
+						return;
+					}
+
+					if (!m_failed.load(std::memory_order_relaxed))
+					{
+						const size_t beginIndex = (chunk * m_chunkSize);
+						const size_t endIndex = std::min(beginIndex + m_chunkSize, m_count);
+
+						try
+						{
+							m_function(m_data, beginIndex, endIndex);
+						}
+						catch (...)
+						{
+							std::lock_guard<std::mutex> lock(m_mutex);
+
+							if (!m_exception)
+							{
+								m_exception = std::current_exception();
+							}
+
+							m_failed = true;
+						}
+					}
+
+					if (m_finishedChunks.fetch_add(1) + 1 == m_numChunks)
+					{
+						std::lock_guard<std::mutex> lock(m_mutex);
+
+						m_condition.notify_all();
+					}
+				}
+			}
+
+			void wait()
+			{
+				std::unique_lock<std::mutex> lock(m_mutex);
+
+				m_condition.wait(lock, [this]() { return m_finishedChunks == m_numChunks; });
+
+				if (m_exception)
+				{
+					std::rethrow_exception(m_exception);
+				}
+			}
+		};
+	}
+
+	CThreadPool::CThreadPool()
+		: m_workerCount(std::max<size_t>(1, Threading::GetConcurrency() - 1))
+	{
+		m_queues.reserve(m_workerCount);
+
+		for (size_t i = 0; i < m_workerCount; ++i)
+		{
+			m_queues.push_back(std::make_unique<WorkQueue>());
+		}
+	}
+
+	CThreadPool::~CThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_sleepMutex);
+
+			m_exit = true;
+		}
+
+		m_sleepCondition.notify_all();
+
+		for (auto& worker : m_workers)
+		{
+			worker.join();
+		}
+	}
+
+	size_t CThreadPool::getWorkerCount() const
+	{
+		return m_workerCount;
+	}
+
+	bool CThreadPool::isWorkerThread() const
+	{
+		return (detail::t_currentPool == this);
+	}
+
+	void CThreadPool::submit(Job job, const TaskPriority priority)
+	{
+		std::call_once(m_startFlag, [this]() { start(); });
+
+		// ワーカースレッドからの投入は自分のキューへ、それ以外はラウンドロビンで分配
+		const size_t index = isWorkerThread() ? detail::t_workerIndex
+			: (m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_workerCount);
+
+		{
+			WorkQueue& queue = *m_queues[index];
+
+			std::lock_guard<std::mutex> lock(queue.mutex);
+
+			queue.jobs[static_cast<size_t>(priority)].push_back(std::move(job));
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_sleepMutex);
+
+			++m_pendingJobs;
+		}
+
+		m_sleepCondition.notify_one();
+	}
+
+	bool CThreadPool::runPendingJob()
+	{
+		if (!isWorkerThread())
+		{
+			return false;
+		}
+
+		Job job;
+
+		if (!tryPop(detail::t_workerIndex, job))
+		{
+			return false;
+		}
+
+		job();
+
+		return true;
+	}
+
+	void CThreadPool::parallelFor(const size_t count, size_t numThreads, const size_t grainSize, const Threading::detail::ParallelForFunction f, void* data)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		numThreads = std::clamp<size_t>(numThreads, 1, m_workerCount + 1);
+
+		const size_t minChunks = (numThreads * ChunksPerThread);
+		const size_t chunkSize = std::max({ grainSize, size_t(1), (count + minChunks - 1) / minChunks });
+
+		if ((numThreads == 1) || (count <= chunkSize))
+		{
+			f(data, 0, count);
+
+			return;
+		}
+
+		const auto state = std::make_shared<detail::ParallelForState>(f, data, count, chunkSize);
+
+		const size_t numHelpers = std::min(numThreads - 1, state->numChunks() - 1);
+
+		// 呼び出し元は完了までブロックするので、補助タスクは優先して実行する
+		for (size_t i = 0; i < numHelpers; ++i)
+		{
+			submit([state]() { state->run(); }, TaskPriority::High);
+		}
+
+		// 呼び出し元のスレッドも処理に参加する
+		state->run();
+
+		state->wait();
+	}
+
+	void CThreadPool::start()
+	{
+		m_workers.reserve(m_workerCount);
+
+		for (size_t i = 0; i < m_workerCount; ++i)
+		{
+			m_workers.emplace_back(&CThreadPool::workerMain, this, i);
+		}
+
+		LOG_INFO(U"ℹ️ Thread pool started ({0} workers)"_fmt(m_workerCount));
+	}
+
+	void CThreadPool::workerMain(const size_t index)
+	{
+		detail::t_currentPool = this;
+
+		detail::t_workerIndex = index;
+
+		CPUProfiler::SetThreadName(U"Siv3D ThreadPool {}"_fmt(index));
+
+		for (;;)
+		{
+			Job job;
+
+			if (tryPop(index, job))
+			{
+				SIV3D_PROFILE_SCOPE("ThreadPool::job");
+
+				job();
+
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_sleepMutex);
+
+			m_sleepCondition.wait(lock, [this]() { return m_exit || (m_pendingJobs > 0); });
+
+			if (m_exit && (m_pendingJobs <= 0))
+			{
+				return;
+			}
+		}
+	}
+
+	bool CThreadPool::tryPop(const size_t index, Job& job)
+	{
+		// 優先度の高いキューから順に探す
+		for (size_t priority = NumPriorities; priority-- > 0;)
+		{
+			// 自分のキューからは LIFO で取り出す
+			{
+				WorkQueue& queue = *m_queues[index];
+
+				std::lock_guard<std::mutex> lock(queue.mutex);
+
+				auto& jobs = queue.jobs[priority];
+
+				if (!jobs.empty())
+				{
+					job = std::move(jobs.back());
+
+					jobs.pop_back();
+
+					--m_pendingJobs;
+
+					return true;
+				}
+			}
+
+			// 他のワーカーのキューからは FIFO で盗む
+			for (size_t i = 1; i < m_workerCount; ++i)
+			{
+				WorkQueue& queue = *m_queues[(index + i) % m_workerCount];
+
+				std::lock_guard<std::mutex> lock(queue.mutex);
+
+				auto& jobs = queue.jobs[priority];
+
+				if (!jobs.empty())
+				{
+					job = std::move(jobs.front());
+
+					jobs.pop_front();
+
+					--m_pendingJobs;
+
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+}
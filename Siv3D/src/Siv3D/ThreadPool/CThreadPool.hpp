@@ -0,0 +1,85 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <array>
+# include <atomic>
+# include <condition_variable>
+# include <deque>
+# include <memory>
+# include <mutex>
+# include <thread>
+# include <vector>
+# include "IThreadPool.hpp"
+
+namespace s3d
+{
+	class CThreadPool : public ISiv3DThreadPool
+	{
+	private:
+
+		using Job = std::function<void()>;
+
+		// TaskPriority の種類数
+		static constexpr size_t NumPriorities = 3;
+
+		struct WorkQueue
+		{
+			std::mutex mutex;
+
+			// TaskPriority ごとのキュー
+			std::array<std::deque<Job>, NumPriorities> jobs;
+		};
+
+		// 1 つの parallelFor() の処理を、スレッドあたり何個のチャンクに分けるか
+		static constexpr size_t ChunksPerThread = 4;
+
+		size_t m_workerCount = 0;
+
+		std::vector<std::unique_ptr<WorkQueue>> m_queues;
+
+		std::vector<std::thread> m_workers;
+
+		std::once_flag m_startFlag;
+
+		std::mutex m_sleepMutex;
+
+		std::condition_variable m_sleepCondition;
+
+		std::atomic<int64> m_pendingJobs = { 0 };
+
+		std::atomic<size_t> m_nextQueue = { 0 };
+
+		bool m_exit = false;
+
+		void start();
+
+		void workerMain(size_t index);
+
+		bool tryPop(size_t index, Job& job);
+
+	public:
+
+		CThreadPool();
+
+		~CThreadPool() override;
+
+		size_t getWorkerCount() const override;
+
+		bool isWorkerThread() const override;
+
+		void submit(Job job, TaskPriority priority) override;
+
+		bool runPendingJob() override;
+
+		void parallelFor(size_t count, size_t numThreads, size_t grainSize, Threading::detail::ParallelForFunction f, void* data) override;
+	};
+}
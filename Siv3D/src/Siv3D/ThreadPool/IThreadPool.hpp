@@ -0,0 +1,37 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <functional>
+# include <Siv3D/Fwd.hpp>
+# include <Siv3D/Threading.hpp>
+
+namespace s3d
+{
+	class ISiv3DThreadPool
+	{
+	public:
+
+		static ISiv3DThreadPool* Create();
+
+		virtual ~ISiv3DThreadPool() = default;
+
+		virtual size_t getWorkerCount() const = 0;
+
+		virtual bool isWorkerThread() const = 0;
+
+		virtual void submit(std::function<void()> job, TaskPriority priority) = 0;
+
+		virtual bool runPendingJob() = 0;
+
+		virtual void parallelFor(size_t count, size_t numThreads, size_t grainSize, Threading::detail::ParallelForFunction f, void* data) = 0;
+	};
+}
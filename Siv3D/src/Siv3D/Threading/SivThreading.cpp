@@ -10,11 +10,19 @@
 //-----------------------------------------------
 
 # include <thread>
+# include <atomic>
 # include <algorithm>
 # include <Siv3D/Threading.hpp>
+# include "../Siv3DEngine.hpp"
+# include "../ThreadPool/IThreadPool.hpp"
 
 namespace s3d
 {
+	namespace detail
+	{
+		static std::atomic<size_t> g_parallelGrainSize = { 1 };
+	}
+
 	namespace Threading
 	{
 		size_t GetConcurrency() noexcept
@@ -22,5 +30,38 @@ namespace s3d
 			static const size_t n = std::max<size_t>(1, std::thread::hardware_concurrency());
 			return n;
 		}
+
+		void SetParallelGrainSize(const size_t grainSize) noexcept
+		{
+			s3d::detail::g_parallelGrainSize = std::max<size_t>(1, grainSize);
+		}
+
+		size_t GetParallelGrainSize() noexcept
+		{
+			return s3d::detail::g_parallelGrainSize;
+		}
+
+		namespace detail
+		{
+			void ParallelFor(const size_t count, const size_t numThreads, const ParallelForFunction f, void* data)
+			{
+				if (count == 0)
+				{
+					return;
+				}
+
+				ISiv3DThreadPool* const pool = Siv3DEngine::isActive() ? Siv3DEngine::GetThreadPool() : nullptr;
+
+				// エンジンの外（起動前・終了後）では呼び出し元のスレッドで処理する
+				if ((numThreads <= 1) || (pool == nullptr))
+				{
+					f(data, 0, count);
+
+					return;
+				}
+
+				pool->parallelFor(count, numThreads, GetParallelGrainSize(), f, data);
+			}
+		}
 	}
 }
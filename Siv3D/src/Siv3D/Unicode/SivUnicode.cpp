@@ -9,9 +9,28 @@
 //
 //-----------------------------------------------
 
+# include <algorithm>
+# include <Siv3D/Platform.hpp>
 # include <Siv3D/String.hpp>
 # include <Siv3D/Unicode.hpp>
 # include "../../ThirdParty/miniutf/miniutf.hpp"
+# include "UnicodeKernel.hpp"
+
+# if defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+	# define SIV3D_UNICODE_REFERENCE
+
+# else
+
+	# include <emmintrin.h>
+
+	# if defined(SIV3D_TARGET_WINDOWS)
+
+		# include <intrin.h>
+
+	# endif
+
+# endif
 
 namespace s3d::detail
 {
@@ -39,21 +58,6 @@ namespace s3d::detail
 		}
 	}
 
-	[[nodiscard]] static constexpr size_t UTF8Length(const StringView view) noexcept
-	{
-		size_t length = 0;
-
-		const char32* pSrc = view.data();
-		const char32* const pSrcEnd = pSrc + view.size();
-
-		while (pSrc != pSrcEnd)
-		{
-			length += UTF8Length(*pSrc++);
-		}
-
-		return length;
-	}
-
 	[[nodiscard]] static size_t UTF8Length(const std::u16string_view view) noexcept
 	{
 		size_t length = 0;
@@ -239,6 +243,205 @@ namespace s3d::detail
 
 # endif
 
+# if !defined(SIV3D_UNICODE_REFERENCE)
+
+	[[nodiscard]] static uint32 CountTrailingZeros(const uint32 x) noexcept
+	{
+	# if defined(SIV3D_TARGET_WINDOWS)
+
+		unsigned long index;
+		::_BitScanForward(&index, x);
+		return index;
+
+	# else
+
+		return static_cast<uint32>(__builtin_ctz(x));
+
+	# endif
+	}
+
+# endif
+}
+
+namespace s3d::UnicodeKernel
+{
+	size_t UTF8ToUTF32(char32* const dst, const char8* src, const size_t size) noexcept
+	{
+		const char8* const srcEnd = src + size;
+		char32* pDst = dst;
+
+		while (src != srcEnd)
+		{
+		# if !defined(SIV3D_UNICODE_REFERENCE)
+
+			// ASCII が続く間は 16 バイトずつ変換する
+			const __m128i zero = _mm_setzero_si128();
+
+			while ((srcEnd - src) >= 16)
+			{
+				const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+
+				if (const uint32 mask = _mm_movemask_epi8(v))
+				{
+					for (const char8* const asciiEnd = src + detail::CountTrailingZeros(mask); src != asciiEnd;)
+					{
+						*pDst++ = static_cast<uint8>(*src++);
+					}
+
+					break;
+				}
+
+				const __m128i lo = _mm_unpacklo_epi8(v, zero);
+				const __m128i hi = _mm_unpackhi_epi8(v, zero);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + 0), _mm_unpacklo_epi16(lo, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + 4), _mm_unpackhi_epi16(lo, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + 8), _mm_unpacklo_epi16(hi, zero));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + 12), _mm_unpackhi_epi16(hi, zero));
+
+				src += 16;
+				pDst += 16;
+			}
+
+			if (src == srcEnd)
+			{
+				break;
+			}
+
+		# endif
+
+			if (static_cast<uint8>(*src) < 0x80)
+			{
+				*pDst++ = static_cast<uint8>(*src++);
+				continue;
+			}
+
+			// 非 ASCII の連続は 1 文字ずつ検証しながら変換する
+			do
+			{
+				int32 offset;
+
+				*pDst++ = detail::utf8_decode(src, srcEnd - src, offset);
+
+				src += offset;
+			}
+			while ((src != srcEnd) && (static_cast<uint8>(*src) >= 0x80));
+		}
+
+		return static_cast<size_t>(pDst - dst);
+	}
+
+	char32 DecodeUTF8(const char8* const src, const size_t size, size_t& length) noexcept
+	{
+		int32 offset;
+
+		const char32 codePoint = detail::utf8_decode(src, size, offset);
+
+		length = static_cast<size_t>(offset);
+
+		return codePoint;
+	}
+
+	size_t IncompleteUTF8Tail(const char8* const src, const size_t size) noexcept
+	{
+		for (size_t i = 1; i <= std::min<size_t>(size, 3); ++i)
+		{
+			const uint8 ch = src[size - i];
+
+			if ((ch & 0xC0) == 0x80)
+			{
+				continue;
+			}
+
+			if ((ch < 0xC0) || (0xF8 <= ch))
+			{
+				return 0;
+			}
+
+			const size_t length = (ch < 0xE0) ? 2 : (ch < 0xF0) ? 3 : 4;
+
+			return (i < length) ? i : 0;
+		}
+
+		return 0;
+	}
+
+	size_t UTF8Length(const char32* src, const size_t size) noexcept
+	{
+		const char32* const srcEnd = src + size;
+		size_t length = 0;
+
+	# if !defined(SIV3D_UNICODE_REFERENCE)
+
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i nonAscii = _mm_set1_epi32(~0x7F);
+
+		while ((srcEnd - src) >= 4)
+		{
+			const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+
+			if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(v, nonAscii), zero)) == 0xFFFF)
+			{
+				length += 4;
+				src += 4;
+				continue;
+			}
+
+			for (const char32* const blockEnd = src + 4; src != blockEnd;)
+			{
+				length += detail::UTF8Length(*src++);
+			}
+		}
+
+	# endif
+
+		while (src != srcEnd)
+		{
+			length += detail::UTF8Length(*src++);
+		}
+
+		return length;
+	}
+
+	char8* UTF32ToUTF8(char8* dst, const char32* src, const size_t size) noexcept
+	{
+		const char32* const srcEnd = src + size;
+
+	# if !defined(SIV3D_UNICODE_REFERENCE)
+
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i nonAscii = _mm_set1_epi32(~0x7F);
+
+		while ((srcEnd - src) >= 8)
+		{
+			const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+			const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 4));
+
+			// 8 文字すべてが ASCII であれば 8 バイトに詰めて書き込む
+			if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(_mm_or_si128(v0, v1), nonAscii), zero)) == 0xFFFF)
+			{
+				const __m128i packed = _mm_packs_epi32(v0, v1);
+				_mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(packed, packed));
+
+				src += 8;
+				dst += 8;
+				continue;
+			}
+
+			for (const char32* const blockEnd = src + 8; src != blockEnd;)
+			{
+				detail::UTF8Encode(&dst, *src++);
+			}
+		}
+
+	# endif
+
+		while (src != srcEnd)
+		{
+			detail::UTF8Encode(&dst, *src++);
+		}
+
+		return dst;
+	}
 }
 
 
@@ -406,19 +609,15 @@ namespace s3d
 
 		String FromUTF8(const std::string_view view)
 		{
-			String result(detail::UTF32Length(view), '0');
+			// 文字数はバイト数を超えないので、先に最大の長さを確保して 1 回の走査で変換する
+			String result(view.size(), U'\0');
 
-			const char8* pSrc = view.data();
-			const char8* const pSrcEnd = pSrc + view.size();
-			char32* pDst = &result[0];
+			result.resize(UnicodeKernel::UTF8ToUTF32(result.data(), view.data(), view.size()));
 
-			while (pSrc != pSrcEnd)
+			// 非 ASCII が多く、確保した領域の半分以上が余った場合は解放する
+			if (result.size() < (view.size() / 2))
 			{
-				int32 offset;
-
-				*pDst++ = detail::utf8_decode(pSrc, pSrcEnd - pSrc, offset);
-
-				pSrc += offset;
+				result.shrink_to_fit();
 			}
 
 			return result;
@@ -451,16 +650,9 @@ namespace s3d
 
 		std::string ToUTF8(const StringView view)
 		{
-			std::string result(detail::UTF8Length(view), '0');
+			std::string result(UnicodeKernel::UTF8Length(view.data(), view.size()), '\0');
 
-			const char32* pSrc = view.data();
-			const char32* const pSrcEnd = pSrc + view.size();
-			char8* pDst = &result[0];
-
-			while (pSrc != pSrcEnd)
-			{
-				detail::UTF8Encode(&pDst, *pSrc++);
-			}
+			UnicodeKernel::UTF32ToUTF8(result.data(), view.data(), view.size());
 
 			return result;
 		}
@@ -508,19 +700,13 @@ namespace s3d
 
 		std::u32string UTF8ToUTF32(const std::string_view view)
 		{
-			std::u32string result(detail::UTF32Length(view), '0');
-			
-			const char8* pSrc = view.data();
-			const char8* const pSrcEnd = pSrc + view.size();
-			char32* pDst = &result[0];
+			std::u32string result(view.size(), U'\0');
 
-			while (pSrc != pSrcEnd)
-			{
-				int32 offset;
+			result.resize(UnicodeKernel::UTF8ToUTF32(result.data(), view.data(), view.size()));
 
-				*pDst++ = detail::utf8_decode(pSrc, pSrcEnd - pSrc, offset);
-
-				pSrc += offset;
+			if (result.size() < (view.size() / 2))
+			{
+				result.shrink_to_fit();
 			}
 
 			return result;
@@ -568,16 +754,9 @@ namespace s3d
 
 		std::string UTF32ToUTF8(const std::u32string_view view)
 		{
-			std::string result(detail::UTF8Length(view), '0');
+			std::string result(UnicodeKernel::UTF8Length(view.data(), view.size()), '\0');
 
-			const char32* pSrc = view.data();
-			const char32* const pSrcEnd = pSrc + view.size();
-			char8* pDst = &result[0];
-
-			while (pSrc != pSrcEnd)
-			{
-				detail::UTF8Encode(&pDst, *pSrc++);
-			}
+			UnicodeKernel::UTF32ToUTF8(result.data(), view.data(), view.size());
 
 			return result;
 		}
@@ -600,23 +779,7 @@ namespace s3d
 
 		size_t CountCodePoints(const std::string_view view) noexcept
 		{
-			size_t length = 0;
-
-			const char* pSrc = view.data();
-			const char* const pSrcEnd = pSrc + view.size();
-
-			while (pSrc != pSrcEnd)
-			{
-				int32 offset;
-
-				detail::utf8_decode(pSrc, pSrcEnd - pSrc, offset);
-
-				pSrc += offset;
-
-				++length;
-			}
-
-			return length;
+			return detail::UTF32Length(view);
 		}
 
 		size_t CountCodePoints(const std::u16string_view view) noexcept
@@ -0,0 +1,38 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2018 Ryo Suzuki
+//	Copyright (c) 2016-2018 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Fwd.hpp>
+
+namespace s3d
+{
+	// UTF-8 と UTF-32 のブロック単位の変換
+	// x86 では ASCII の連続を SSE2 で 16 バイトずつ変換し、それ以外を 1 文字ずつ検証しながら変換する。
+	namespace UnicodeKernel
+	{
+		// UTF-8 の src を UTF-32 に変換して dst に書き込み、書き込んだ文字数を返す
+		// dst には size 文字分の領域が必要。不正なシーケンスは 1 バイトごとに U+FFFD になる。
+		size_t UTF8ToUTF32(char32* dst, const char8* src, size_t size) noexcept;
+
+		// UTF-8 の src の先頭の 1 文字を変換し、その文字のバイト数を length に書き込む（size は 1 以上）
+		char32 DecodeUTF8(const char8* src, size_t size, size_t& length) noexcept;
+
+		// src の末尾にある、途中で切れた（後続のバイトが来れば有効になりうる）UTF-8 シーケンスのバイト数を返す
+		[[nodiscard]] size_t IncompleteUTF8Tail(const char8* src, size_t size) noexcept;
+
+		// UTF-32 の src を UTF-8 に変換したときのバイト数を返す
+		[[nodiscard]] size_t UTF8Length(const char32* src, size_t size) noexcept;
+
+		// UTF-32 の src を UTF-8 に変換して dst に書き込み、書き込み終わりの位置を返す
+		// dst には UTF8Length(src, size) バイトの領域が必要。
+		char8* UTF32ToUTF8(char8* dst, const char32* src, size_t size) noexcept;
+	}
+}
@@ -12,14 +12,31 @@
 # include <Siv3D/Platform.hpp>
 # if defined(SIV3D_TARGET_LINUX)
 
+# include <EGL/egl.h>
+# include <EGL/eglext.h>
 # include "CWindow_Linux.hpp"
 # include "../Siv3DEngine.hpp"
 # include "../System/ISystem.hpp"
 # include <Siv3D/System.hpp>
 # include <Siv3D/Logger.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/FormatLiteral.hpp>
 
 namespace s3d
 {
+	namespace detail
+	{
+		namespace init
+		{
+			static bool g_headless = false;
+
+			void SetHeadless(const bool headless)
+			{
+				g_headless = headless;
+			}
+		}
+	}
+
 	CWindow_Linux::CWindow_Linux()
 	{
 
@@ -27,11 +44,125 @@ namespace s3d
 
 	CWindow_Linux::~CWindow_Linux()
 	{
+		if (m_headless)
+		{
+			if (m_eglDisplay != EGL_NO_DISPLAY)
+			{
+				::eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+				if (m_eglContext != EGL_NO_CONTEXT)
+				{
+					::eglDestroyContext(m_eglDisplay, m_eglContext);
+				}
+
+				::eglTerminate(m_eglDisplay);
+			}
+
+			return;
+		}
+
 		::glfwTerminate();
 	}
 
+	bool CWindow_Linux::initHeadless()
+	{
+		m_headless = true;
+
+		// Mesa の surfaceless プラットフォームを優先し、使えない場合はデフォルトのディスプレイを使う
+		if (const auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(::eglGetProcAddress("eglGetPlatformDisplayEXT")))
+		{
+			m_eglDisplay = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+		}
+
+		if (m_eglDisplay == EGL_NO_DISPLAY)
+		{
+			m_eglDisplay = ::eglGetDisplay(EGL_DEFAULT_DISPLAY);
+		}
+
+		if (m_eglDisplay == EGL_NO_DISPLAY
+			|| !::eglInitialize(m_eglDisplay, nullptr, nullptr))
+		{
+			LOG_FAIL(U"❌ Headless: Failed to initialize an EGL display");
+
+			return false;
+		}
+
+		if (!::eglBindAPI(EGL_OPENGL_API))
+		{
+			LOG_FAIL(U"❌ Headless: OpenGL is not supported by EGL");
+
+			return false;
+		}
+
+		// 描画先はフレームバッファオブジェクトなので、サーフェスの種類は問わない
+		const EGLint configAttributes[] =
+		{
+			EGL_SURFACE_TYPE, 0,
+			EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+			EGL_NONE
+		};
+
+		EGLConfig config;
+		EGLint numConfigs = 0;
+
+		if (!::eglChooseConfig(m_eglDisplay, configAttributes, &config, 1, &numConfigs)
+			|| numConfigs == 0)
+		{
+			LOG_FAIL(U"❌ Headless: No suitable EGL config");
+
+			return false;
+		}
+
+		const EGLint contextAttributes[] =
+		{
+			EGL_CONTEXT_MAJOR_VERSION, 4,
+			EGL_CONTEXT_MINOR_VERSION, 1,
+			EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+			EGL_CONTEXT_OPENGL_FORWARD_COMPATIBLE, EGL_TRUE,
+			EGL_NONE
+		};
+
+		m_eglContext = ::eglCreateContext(m_eglDisplay, config, EGL_NO_CONTEXT, contextAttributes);
+
+		if (m_eglContext == EGL_NO_CONTEXT
+			|| !::eglMakeCurrent(m_eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, m_eglContext))
+		{
+			LOG_FAIL(U"❌ Headless: Failed to create an OpenGL 4.1 context");
+
+			return false;
+		}
+
+		::glewExperimental = GL_TRUE;
+
+		// GLX 向けにビルドされた GLEW は、X ディスプレイが無いとエラーを返すが、GL の関数は読み込まれている
+		::glewInit();
+
+		if (!GLEW_VERSION_4_1)
+		{
+			LOG_FAIL(U"❌ Headless: Failed to load OpenGL 4.1 functions");
+
+			return false;
+		}
+
+		m_state.clientSize.set(Window::DefaultClientSize);
+		m_state.windowSize.set(Window::DefaultClientSize);
+		m_state.title = U"Siv3D App";
+		m_state.showState = ShowState::Normal;
+		m_state.focused = true;
+		m_state.fullScreen = false;
+
+		LOG_INFO(U"ℹ️ Window initialized (headless: {0})"_fmt(Unicode::Widen(reinterpret_cast<const char*>(::glGetString(GL_RENDERER)))));
+
+		return true;
+	}
+
 	bool CWindow_Linux::init()
 	{
+		if (detail::init::g_headless)
+		{
+			return initHeadless();
+		}
+
 		if (!glfwInit())
 		{
 			return false;
@@ -91,6 +222,11 @@ namespace s3d
 	
 	bool CWindow_Linux::update()
 	{
+		if (m_headless)
+		{
+			return true;
+		}
+
 		::glfwPollEvents();
 		
 		if (::glfwGetKey(m_glfwWindow, GLFW_KEY_ESCAPE) == GLFW_PRESS)
@@ -139,6 +275,11 @@ namespace s3d
 
 		m_state.title = title;
 
+		if (m_headless)
+		{
+			return;
+		}
+
 		if constexpr (SIV3D_IS_DEBUG)
 		{
 			const String titleDebug = m_state.title + U" [Debug Build]";
@@ -159,6 +300,11 @@ namespace s3d
     void CWindow_Linux::setPos(const Point& pos)
     {   
         m_state.pos.set(pos);
+
+        if (m_headless)
+        {
+            return;
+        }
     
         ::glfwSetWindowPos(m_glfwWindow, pos.x, pos.y);
     } 
@@ -168,6 +314,13 @@ namespace s3d
 		m_state.clientSize.set(size);
 		m_state.fullScreen = fullScreen;
 
+		if (m_headless)
+		{
+			m_state.windowSize.set(size);
+
+			return;
+		}
+
 		int32 windowSizeX, windowSizeY;
 		::glfwGetWindowSize(m_glfwWindow, &windowSizeX, &windowSizeY);
 		m_state.windowSize.set(windowSizeX, windowSizeY);
@@ -30,6 +30,17 @@ namespace s3d
 		WindowState m_state;	
 
 		Size m_baseSize = Window::DefaultClientSize;
+
+		// ヘッドレスモードでは GLFW を使わず、EGL でウィンドウを持たない GL コンテキストを作成する
+		bool m_headless = false;
+
+		// EGLDisplay（X11 のヘッダを読み込まないよう void* で保持する）
+		void* m_eglDisplay = nullptr;
+
+		// EGLContext
+		void* m_eglContext = nullptr;
+
+		bool initHeadless();
 		
 	public:
 